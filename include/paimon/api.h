@@ -34,6 +34,7 @@
 #include "paimon/status.h"                   // IWYU pragma: export
 #include "paimon/table/source/table_read.h"  // IWYU pragma: export
 #include "paimon/table/source/table_scan.h"  // IWYU pragma: export
+#include "paimon/table_delete.h"             // IWYU pragma: export
 #include "paimon/write_context.h"            // IWYU pragma: export
 
 /// Top-level namespace for Paimon C++ API.
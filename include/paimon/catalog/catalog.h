@@ -24,6 +24,7 @@
 #include "paimon/catalog/identifier.h"
 #include "paimon/result.h"
 #include "paimon/schema/schema.h"
+#include "paimon/stats/table_statistics.h"
 #include "paimon/status.h"
 #include "paimon/type_fwd.h"
 #include "paimon/visibility.h"
@@ -104,6 +105,29 @@ class PAIMON_EXPORT Catalog {
     /// doesn't, or an error status on failure.
     virtual Result<std::optional<std::shared_ptr<Schema>>> LoadTableSchema(
         const Identifier& identifier) const = 0;
+
+    /// Loads the approximate column statistics of the latest snapshot of a specified table.
+    ///
+    /// @note Statistics are only maintained for tables with `Options::COLUMN_SKETCHES_ENABLED`
+    /// set, and are unknown as long as the table has live data files written without sketches
+    /// (e.g. before the option was set, or by other writers). Statistics of primary key tables
+    /// cover all stored records, including older versions of keys which are not compacted yet.
+    ///
+    /// @param identifier The identifier (database and table name) of the table to load.
+    /// @return A result containing the table statistics, or std::nullopt if the table has no
+    /// snapshot or no column statistics, or an error status on failure. Catalogs which do not
+    /// maintain statistics always return std::nullopt.
+    virtual Result<std::optional<std::shared_ptr<TableStatistics>>> LoadTableStatistics(
+        const Identifier& identifier) const {
+        return std::optional<std::shared_ptr<TableStatistics>>();
+    }
+
+    /// Drops the cached metadata of a specified table, so that the next access loads it from the
+    /// file system again. Does nothing if the catalog does not cache metadata, see
+    /// `Options::CACHE_ENABLED`.
+    ///
+    /// @param identifier The identifier (database and table name) of the table to invalidate.
+    virtual void InvalidateTable(const Identifier& identifier) {}
 };
 
 }  // namespace paimon
@@ -0,0 +1,133 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "paimon/commit_message.h"
+#include "paimon/result.h"
+#include "paimon/status.h"
+#include "paimon/visibility.h"
+
+namespace paimon {
+class CommitMessageSerializer;
+class DataInputStream;
+class DataOutputStream;
+class FileSystem;
+class InputStream;
+class MemoryPool;
+class OutputStream;
+
+/// Appends commit messages one by one to a file backed spool.
+///
+/// A commit of a large batch job may consist of hundreds of thousands of new files from thousands
+/// of writer tasks. Instead of holding all serialized commit messages and their decoded copies in
+/// memory at once, the coordinator appends each message to the spool as soon as it arrives, and
+/// commits the spool with `FileStoreCommit::Commit(CommitMessageSpoolReader*, ...)`, which
+/// decodes the messages lazily.
+///
+/// Each message is stored as its version, its length and its bytes in the format of
+/// `CommitMessage::Serialize()`, so messages serialized by writers of an older version can be
+/// appended as they are.
+class PAIMON_EXPORT CommitMessageSpoolWriter {
+ public:
+    ~CommitMessageSpoolWriter();
+
+    /// Create a spool writer on a new file, an existing file at `path` is overwritten.
+    ///
+    /// @param fs File system of the spool file.
+    /// @param path Path of the spool file.
+    /// @param pool Memory pool for serialization.
+    /// @return Result containing the spool writer or an error status.
+    static Result<std::unique_ptr<CommitMessageSpoolWriter>> Create(
+        const std::shared_ptr<FileSystem>& fs, const std::string& path,
+        const std::shared_ptr<MemoryPool>& pool);
+
+    /// Serialize and append a commit message to the spool.
+    Status Append(const std::shared_ptr<CommitMessage>& commit_message);
+
+    /// Append a commit message serialized by `CommitMessage::Serialize()` to the spool without
+    /// decoding it.
+    ///
+    /// @param version The serialization format version used when the data was serialized.
+    /// @param buffer Pointer to the binary data buffer.
+    /// @param length Length of the binary data in bytes.
+    Status AppendSerialized(int32_t version, const char* buffer, int32_t length);
+
+    /// @return The number of commit messages appended.
+    int64_t NumMessages() const {
+        return num_messages_;
+    }
+
+    /// Flush and close the spool file. No message can be appended afterwards.
+    Status Close();
+
+ private:
+    CommitMessageSpoolWriter(const std::shared_ptr<OutputStream>& out,
+                             const std::shared_ptr<MemoryPool>& pool);
+
+ private:
+    std::shared_ptr<MemoryPool> pool_;
+    std::shared_ptr<OutputStream> out_;
+    std::unique_ptr<DataOutputStream> data_out_;
+    std::unique_ptr<CommitMessageSerializer> serializer_;
+    int64_t num_messages_ = 0;
+    bool closed_ = false;
+};
+
+/// Iterates the commit messages of a spool written by `CommitMessageSpoolWriter` lazily. Only the
+/// message returned by the last `Next()` is held in memory.
+class PAIMON_EXPORT CommitMessageSpoolReader {
+ public:
+    ~CommitMessageSpoolReader();
+
+    /// Open a spool file written by `CommitMessageSpoolWriter`.
+    ///
+    /// @param fs File system of the spool file.
+    /// @param path Path of the spool file.
+    /// @param pool Memory pool for deserialization.
+    /// @return Result containing the spool reader or an error status.
+    static Result<std::unique_ptr<CommitMessageSpoolReader>> Create(
+        const std::shared_ptr<FileSystem>& fs, const std::string& path,
+        const std::shared_ptr<MemoryPool>& pool);
+
+    /// Decode the next commit message of the spool.
+    ///
+    /// @return Result containing the next commit message, or nullptr if all messages have been
+    /// read.
+    Result<std::shared_ptr<CommitMessage>> Next();
+
+    /// Seek back to the first commit message of the spool.
+    Status Rewind();
+
+    Status Close();
+
+ private:
+    CommitMessageSpoolReader(const std::shared_ptr<InputStream>& in, uint64_t length,
+                             const std::shared_ptr<MemoryPool>& pool);
+
+ private:
+    std::shared_ptr<MemoryPool> pool_;
+    std::shared_ptr<InputStream> in_;
+    std::unique_ptr<DataInputStream> data_in_;
+    std::unique_ptr<CommitMessageSerializer> serializer_;
+    uint64_t length_ = 0;
+};
+
+}  // namespace paimon
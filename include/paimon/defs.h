@@ -212,7 +212,8 @@ struct PAIMON_EXPORT Options {
     static const char MERGE_ENGINE[];
 
     /// "sort-engine" - Specify the sort engine for table with primary key. Values can be:
-    /// "min-heap", "loser-tree". Default value is "loser-tree".
+    /// "min-heap", "loser-tree". At most two sorted runs are always merged with a specialized
+    /// two-way merge, the sort engine applies to more runs. Default value is "loser-tree".
     static const char SORT_ENGINE[];
 
     /// "ignore-delete" - Whether to ignore delete records. Default value is "false".
@@ -228,7 +229,7 @@ struct PAIMON_EXPORT Options {
     /// Default value is false.
     static const char DELETION_VECTORS_ENABLED[];
 
-    ///  @note `CHANGELOG_PRODUCER` currently only support `none`
+    ///  @note `CHANGELOG_PRODUCER` currently only support `none` and `input`
     ///
     /// "changelog-producer" - Whether to double write to a changelog file. This changelog file
     /// keeps the details of data changes, it can be read directly during stream reads. This can be
@@ -258,6 +259,51 @@ struct PAIMON_EXPORT Options {
 
     /// "file-index.read.enabled" - Whether enabled read file index. Default value is "true".
     static const char FILE_INDEX_READ_ENABLED[];
+    /// "file-index.in-manifest-threshold" - The threshold to store file index bytes in manifest.
+    /// File indexes not larger than it are embedded in the data file meta, larger ones are written
+    /// to a separate index file next to the data file. Default value is "500 B".
+    static const char FILE_INDEX_IN_MANIFEST_THRESHOLD[];
+
+    /// @name file index configurations
+    ///
+    /// Writers build file indexes of the columns configured by
+    /// - file-index.$index_type.columns (column names separated with FIELDS_SEPARATOR)
+    ///
+    /// and pass options of the index to the indexer, options of a single column override the
+    /// options shared by all columns of the index type:
+    /// - file-index.$index_type.$option
+    /// - file-index.$index_type.$column_name.$option
+    ///
+    /// examples:
+    /// - file-index.bitmap.columns = f1,f2
+    /// - file-index.bitmap.index-block-size = 32kb
+    /// - file-index.bitmap.f1.version = 1
+    /// - file-index.bsi.columns = f3
+    ///
+    /// @{
+
+    /// FILE_INDEX_PREFIX is "file-index"
+    static const char FILE_INDEX_PREFIX[];
+    /// FILE_INDEX_COLUMNS is "columns"
+    static const char FILE_INDEX_COLUMNS[];
+    /// @}
+
+    /// "metadata.stats-mode" - The mode of the value stats stored in the data file meta, which
+    /// are used to skip files in planning. Values can be:
+    /// - "none": no stats are stored.
+    /// - "counts": only null counts are stored.
+    /// - "truncate(N)": min/max of strings are truncated to N characters, N > 0.
+    /// - "full": full min/max and null counts are stored.
+    ///
+    /// The mode of a single column can be set by fields.$field_name.stats-mode. Default value is
+    /// "full".
+    static const char METADATA_STATS_MODE[];
+    /// STATS_MODE is "stats-mode", the suffix of fields.$field_name.stats-mode
+    static const char STATS_MODE[];
+    /// "metadata.stats-dense-store" - Whether to store the value stats of the columns not in
+    /// "none" mode only, the stored columns are listed in the data file meta. Default value is
+    /// "true".
+    static const char METADATA_STATS_DENSE_STORE[];
 
     /// "data-file.external-paths" - The external paths where the data of this table will be
     /// written, multiple elements separated by commas.
@@ -284,6 +330,22 @@ struct PAIMON_EXPORT Options {
     static const char BLOB_AS_DESCRIPTOR[];
     /// "global-index.enabled" - Whether to enable global index for scan. Default value is "true".
     static const char GLOBAL_INDEX_ENABLED[];
+    /// "partition.stats-file.enabled" - Whether to maintain a partition statistics file for each
+    /// committed snapshot, so that partitions can be listed without reading manifests. Default
+    /// value is "false".
+    static const char PARTITION_STATS_FILE_ENABLED[];
+    /// "column-sketches.enabled" - Whether writers collect approximate distinct counts and
+    /// quantiles of each column, which commits merge into column sketches of the table for cost
+    /// based optimizers. Default value is "false".
+    static const char COLUMN_SKETCHES_ENABLED[];
+    /// "cache-enabled" - Whether the catalog caches table schemas and table listings. A cached
+    /// table schema is reloaded once the latest snapshot of the table changes. Default value is
+    /// "false".
+    static const char CACHE_ENABLED[];
+    /// "cache.expire-after-write" - Cache expiration policy of the catalog: entries expire after
+    /// the given duration since they were loaded, e.g. to pick up schema changes which are not
+    /// followed by a commit. Default value is "30 min".
+    static const char CACHE_EXPIRE_AFTER_WRITE[];
 };
 
 static constexpr int64_t BATCH_WRITE_COMMIT_IDENTIFIER = std::numeric_limits<int64_t>::max();
@@ -17,11 +17,13 @@
 #pragma once
 
 #include <cstdint>
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
 
 #include "paimon/file_index/file_index_reader.h"
+#include "paimon/memory/bytes.h"
 #include "paimon/result.h"
 #include "paimon/visibility.h"
 
@@ -96,6 +98,17 @@ class PAIMON_EXPORT FileIndexFormat {
     static Result<std::unique_ptr<Reader>> CreateReader(
         const std::shared_ptr<InputStream>& input_stream, const std::shared_ptr<MemoryPool>& pool);
 
+    /// Serializes the indexes of several columns into an index file.
+    ///
+    /// @param column_indexes Serialized index data of each column, keyed by column name and index
+    ///                       type. An empty index is recorded with `EMPTY_INDEX_FLAG` in the head
+    ///                       and takes no bytes in the body.
+    /// @param pool Memory pool for the serialized bytes.
+    /// @return The bytes of the index file, which can be parsed by `CreateReader()`.
+    static Result<PAIMON_UNIQUE_PTR<Bytes>> WriteColumnIndexes(
+        const std::map<std::string, std::map<std::string, std::shared_ptr<Bytes>>>& column_indexes,
+        const std::shared_ptr<MemoryPool>& pool);
+
  public:
     static const int64_t MAGIC;
     static const int32_t EMPTY_INDEX_FLAG;
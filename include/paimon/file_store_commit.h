@@ -35,6 +35,7 @@
 namespace paimon {
 class CommitContext;
 class CommitMessage;
+class CommitMessageSpoolReader;
 
 /// Interface for commit operations in a file store.
 ///
@@ -63,6 +64,24 @@ class PAIMON_EXPORT FileStoreCommit {
                           int64_t commit_identifier = BATCH_WRITE_COMMIT_IDENTIFIER,
                           std::optional<int64_t> watermark = std::nullopt) = 0;
 
+    /// Commit the changes of a commit message spool to the file store.
+    ///
+    /// Compared to commit with a vector of commit messages, the messages are decoded one by one
+    /// from the spool, and the files of each of them are written into manifest files before the
+    /// next one is decoded. This is meant for very large commits, whose messages do not fit in
+    /// memory at once. The default implementation decodes all messages and commits them as a
+    /// vector.
+    ///
+    /// @param spool_reader Reader of the commit message spool, it is read to the end.
+    /// @param commit_identifier An optional identifier for the commit operation. Default is
+    /// `BATCH_WRITE_COMMIT_IDENTIFIER`.
+    /// @param watermark An optional event-time watermark used to indicate the progress of data
+    ///     processing. Default is std::nullopt.
+    /// @return Status indicating the success or failure of the commit operation.
+    virtual Status Commit(CommitMessageSpoolReader* spool_reader,
+                          int64_t commit_identifier = BATCH_WRITE_COMMIT_IDENTIFIER,
+                          std::optional<int64_t> watermark = std::nullopt);
+
     /// Filter out all `std::vector<CommitMessage>` which have been committed and commit the
     /// remaining ones.
     ///
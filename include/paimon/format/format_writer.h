@@ -17,6 +17,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 
 #include "paimon/type_fwd.h"
 
@@ -68,4 +69,21 @@ class PAIMON_EXPORT FormatWriter {
     virtual std::shared_ptr<Metrics> GetWriterMetrics() const = 0;
 };
 
+/// A `FormatWriter` which keeps the statistics of written columns in memory (e.g., the file
+/// footer), so that statistics can be fetched after `Finish()` without re-opening the written file.
+class PAIMON_EXPORT StatsAwareFormatWriter : public FormatWriter {
+ public:
+    ~StatsAwareFormatWriter() override = default;
+
+    /// Get the statistics of each top-level column of the written file.
+    ///
+    /// @param pool Memory pool used to build the statistics.
+    /// @return Column statistics in the order of the write schema, or `std::nullopt` if the
+    ///         statistics are not available in memory, in which case the caller is supposed to
+    ///         fall back to a `FormatStatsExtractor`.
+    /// @note This method should only be called after `Finish()`.
+    virtual Result<std::optional<ColumnStatsVector>> GetColumnStats(
+        const std::shared_ptr<MemoryPool>& pool) = 0;
+};
+
 }  // namespace paimon
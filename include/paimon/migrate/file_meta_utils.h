@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <cstdint>
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
@@ -23,9 +25,11 @@
 
 #include "paimon/commit_message.h"
 #include "paimon/result.h"
+#include "paimon/status.h"
 #include "paimon/visibility.h"
 
 namespace paimon {
+class Executor;
 
 /// Utility class for handling file metadata operations during data migration.
 ///
@@ -34,7 +38,7 @@ namespace paimon {
 /// integration of existing data into Paimon's file store architecture.
 ///
 /// @note This utility currently does not support:
-/// - object store file systems
+/// - object store file systems, except for `GenerateCommitMessages()`
 /// - primary-key tables
 ///
 /// @warning This utility will move/rename source data files to destination paths during migration.
@@ -62,6 +66,63 @@ class PAIMON_EXPORT FileMetaUtils {
         const std::vector<std::string>& src_data_files, const std::string& dst_table_path,
         const std::map<std::string, std::string>& partition_values,
         const std::map<std::string, std::string>& options);
+
+    /// Source data files of a partition to migrate.
+    struct MigratePartition {
+        /// Map of partition column names to their values, empty for non-partitioned tables.
+        std::map<std::string, std::string> partition_values;
+        /// Paths to source data files of the partition.
+        std::vector<std::string> src_data_files;
+    };
+
+    /// List the data files of source partition directories concurrently on `executor`. Hidden
+    /// files, whose names start with '.' or '_', and sub directories are skipped.
+    ///
+    /// @param src_partition_dirs Map of source partition directories to their partition values.
+    /// @param options Options to get the file system of the source directories.
+    /// @param executor Executor to list the directories on.
+    /// @return Result containing the partitions with their data files sorted by path.
+    static Result<std::vector<MigratePartition>> ListPartitions(
+        const std::map<std::string, std::map<std::string, std::string>>& src_partition_dirs,
+        const std::map<std::string, std::string>& options,
+        const std::shared_ptr<Executor>& executor);
+
+    /// Generate commit messages for migrating the data files of several partitions.
+    ///
+    /// Data files are moved and their stats are extracted concurrently on `executor`. Files are
+    /// submitted across partitions in order, a new one as soon as the oldest in flight is done,
+    /// and at most `max_concurrent_files` files are in flight. At most `max_files_per_message`
+    /// files are put into a commit message, and the messages are handed to `batch_consumer` in
+    /// batches of at most `max_messages_per_batch`, while files of later messages are still moved.
+    ///
+    /// Unlike `GenerateCommitMessage()`, the source files and the table may be on an object store
+    /// file system.
+    ///
+    /// A batch consumer may commit each batch, or spool the messages and commit them at last. To
+    /// restart after a failure, call this method again with the same `partitions`, i.e. the source
+    /// files listed before the first run rather than listed again: files already in the latest
+    /// snapshot of the table are skipped, and files moved to the table but not committed yet are
+    /// reused.
+    ///
+    /// @param partitions Partitions and their source data files to be migrated.
+    ///                   **These files must have the same schema as the target Paimon table**.
+    /// @param dst_table_path Path to the destination Paimon table directory.
+    /// @param options Set a configuration options map to set some option entries which are not
+    ///                defined in the table schema or whose values you want to overwrite.
+    /// @param max_files_per_message Max number of data files in each commit message.
+    /// @param max_messages_per_batch Max number of commit messages in each batch.
+    /// @param max_concurrent_files Max number of data files moved and read at the same time.
+    /// @param executor Executor to move files and extract stats on.
+    /// @param batch_consumer Consumer of the generated commit messages, called in the order of
+    ///                       `partitions`. An error status returned by it stops the migration.
+    /// @return Status indicating success or an error if the migration cannot be performed.
+    static Status GenerateCommitMessages(
+        const std::vector<MigratePartition>& partitions, const std::string& dst_table_path,
+        const std::map<std::string, std::string>& options, int32_t max_files_per_message,
+        int32_t max_messages_per_batch, int32_t max_concurrent_files,
+        const std::shared_ptr<Executor>& executor,
+        const std::function<Status(std::vector<std::unique_ptr<CommitMessage>>&&)>&
+            batch_consumer);
 };
 
 }  // namespace paimon
@@ -32,6 +32,7 @@ namespace paimon {
 class Executor;
 class MemoryPool;
 class Predicate;
+class Schema;
 
 /// `ReadContext` is some configuration for read operations.
 ///
@@ -46,6 +47,7 @@ class PAIMON_EXPORT ReadContext {
                 bool enable_prefetch, uint32_t prefetch_batch_count,
                 uint32_t prefetch_max_parallel_num, bool enable_multi_thread_row_to_batch,
                 uint32_t row_to_batch_thread_number, const std::optional<std::string>& table_schema,
+                const std::shared_ptr<Schema>& loaded_table_schema,
                 const std::shared_ptr<MemoryPool>& memory_pool,
                 const std::shared_ptr<Executor>& executor,
                 const std::map<std::string, std::string>& fs_scheme_to_identifier_map,
@@ -97,6 +99,9 @@ class PAIMON_EXPORT ReadContext {
     const std::optional<std::string>& GetSpecificTableSchema() {
         return table_schema_;
     }
+    const std::shared_ptr<Schema>& GetLoadedTableSchema() const {
+        return loaded_table_schema_;
+    }
     std::shared_ptr<MemoryPool> GetMemoryPool() const {
         return memory_pool_;
     }
@@ -116,6 +121,7 @@ class PAIMON_EXPORT ReadContext {
     bool enable_multi_thread_row_to_batch_;
     uint32_t row_to_batch_thread_number_;
     std::optional<std::string> table_schema_;
+    std::shared_ptr<Schema> loaded_table_schema_;
     std::shared_ptr<MemoryPool> memory_pool_;
     std::shared_ptr<Executor> executor_;
     std::map<std::string, std::string> fs_scheme_to_identifier_map_;
@@ -248,6 +254,15 @@ class PAIMON_EXPORT ReadContextBuilder {
     /// @note If not set, the schema will be loaded from the table path.
     ReadContextBuilder& SetTableSchema(const std::string& table_schema);
 
+    /// Set a table schema loaded by `Catalog::LoadTableSchema()`, which saves the schema loading
+    /// I/O and parsing, e.g. for schemas cached by a caching catalog.
+    ///
+    /// @param table_schema The loaded table schema of the main branch.
+    /// @return Reference to this builder for method chaining.
+    /// @note Takes precedence over a schema string set by `SetTableSchema()`.
+    /// @note If not set, the schema will be loaded from the table path.
+    ReadContextBuilder& SetTableSchema(const std::shared_ptr<Schema>& table_schema);
+
     /// Set the specific branch to read from in a versioned table.
     ///
     /// Paimon supports branching for data versioning and time travel queries.
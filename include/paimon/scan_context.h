@@ -34,6 +34,7 @@ class ScanFilter;
 class Executor;
 class MemoryPool;
 class Predicate;
+class Schema;
 
 /// `ScanContext` is some configuration for table scan operations.
 ///
@@ -45,6 +46,7 @@ class PAIMON_EXPORT ScanContext {
     ScanContext(const std::string& path, bool is_streaming_mode, std::optional<int32_t> limit,
                 const std::shared_ptr<ScanFilter>& scan_filter,
                 const std::shared_ptr<GlobalIndexResult>& global_index_result,
+                const std::shared_ptr<Schema>& table_schema,
                 const std::shared_ptr<MemoryPool>& memory_pool,
                 const std::shared_ptr<Executor>& executor,
                 const std::map<std::string, std::string>& options);
@@ -80,6 +82,9 @@ class PAIMON_EXPORT ScanContext {
     std::shared_ptr<GlobalIndexResult> GetGlobalIndexResult() const {
         return global_index_result_;
     }
+    const std::shared_ptr<Schema>& GetTableSchema() const {
+        return table_schema_;
+    }
 
  private:
     std::string path_;
@@ -87,6 +92,7 @@ class PAIMON_EXPORT ScanContext {
     std::optional<int32_t> limit_;
     std::shared_ptr<ScanFilter> scan_filters_;
     std::shared_ptr<GlobalIndexResult> global_index_result_;
+    std::shared_ptr<Schema> table_schema_;
     std::shared_ptr<MemoryPool> memory_pool_;
     std::shared_ptr<Executor> executor_;
     std::map<std::string, std::string> options_;
@@ -141,6 +147,10 @@ class PAIMON_EXPORT ScanContextBuilder {
     /// data retrieval.
     ScanContextBuilder& SetGlobalIndexResult(
         const std::shared_ptr<GlobalIndexResult>& global_index_result);
+    /// Set a table schema loaded by `Catalog::LoadTableSchema()` to avoid loading the latest schema
+    /// from the table path, e.g. for schemas cached by a caching catalog.
+    /// @note if not set, the latest schema of the table is loaded
+    ScanContextBuilder& SetTableSchema(const std::shared_ptr<Schema>& table_schema);
     /// The options added or set in `ScanContextBuilder` have high priority and will be merged with
     /// the options in table schema.
     ScanContextBuilder& AddOption(const std::string& key, const std::string& value);
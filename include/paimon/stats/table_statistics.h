@@ -0,0 +1,83 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "paimon/visibility.h"
+
+namespace paimon {
+
+/// This interface provides approximate statistics of one column of a table, estimated from the
+/// column sketches collected while writing (see `Options::COLUMN_SKETCHES_ENABLED`).
+class PAIMON_EXPORT ColumnStatistics {
+ public:
+    virtual ~ColumnStatistics() = default;
+
+    /// Get the id of the field.
+    virtual int32_t FieldId() const = 0;
+
+    /// Get the name of the field in the latest schema.
+    virtual const std::string& FieldName() const = 0;
+
+    /// Get the number of rows, including null values.
+    virtual int64_t RowCount() const = 0;
+
+    /// Get the number of null values.
+    virtual int64_t NullCount() const = 0;
+
+    /// Get the estimated number of distinct non-null values.
+    virtual int64_t DistinctCount() const = 0;
+
+    /// Whether quantiles are available, which is only the case for columns of numeric, date or
+    /// timestamp type.
+    virtual bool HasQuantiles() const = 0;
+
+    /// Get the approximate value at normalized `rank` in [0, 1], e.g. 0.5 for the median.
+    /// @return The value as double, or std::nullopt if quantiles are not available or the column
+    /// has no non-null values.
+    virtual std::optional<double> Quantile(double rank) const = 0;
+
+    /// Get the boundaries splitting the non-null values into `num_buckets` buckets of roughly
+    /// equal size, e.g. to build an equi-depth histogram or split a range evenly.
+    /// @return `num_buckets + 1` ascending boundaries starting with the minimum and ending with
+    /// the maximum, or an empty vector if quantiles are not available or the column has no
+    /// non-null values.
+    virtual std::vector<double> EquiDepthBoundaries(int32_t num_buckets) const = 0;
+};
+
+/// This interface provides approximate column statistics of a table as of a snapshot.
+class PAIMON_EXPORT TableStatistics {
+ public:
+    virtual ~TableStatistics() = default;
+
+    /// Get the id of the snapshot these statistics belong to.
+    virtual int64_t SnapshotId() const = 0;
+
+    /// Get the statistics of all sketched columns.
+    virtual const std::vector<std::shared_ptr<ColumnStatistics>>& Columns() const = 0;
+
+    /// Get the statistics of column `field_name`.
+    /// @return The column statistics, or nullptr if the column is not sketched.
+    virtual std::shared_ptr<ColumnStatistics> GetColumn(const std::string& field_name) const = 0;
+};
+
+}  // namespace paimon
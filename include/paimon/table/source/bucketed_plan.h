@@ -0,0 +1,86 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "arrow/api.h"
+#include "paimon/result.h"
+#include "paimon/table/source/split.h"
+#include "paimon/visibility.h"
+
+namespace paimon {
+
+/// %Result plan of `TableScan::CreateBucketedPlan()`: the splits of a snapshot grouped by
+/// partition and bucket, together with the bucketing of the table.
+///
+/// Rows of a table with a fixed number of buckets are assigned to buckets by the hash of their
+/// bucket keys. Two such tables with the same number of buckets and the same types of bucket keys
+/// are therefore co-partitioned: rows with equal bucket keys are in buckets with the same id in
+/// both tables, whatever their partitions are. Engines can join them on the bucket keys bucket by
+/// bucket without shuffling, see `PairBuckets()`.
+class PAIMON_EXPORT BucketedPlan {
+ public:
+    /// Splits of one bucket of one partition.
+    struct BucketSplits {
+        /// Partition spec, empty for non-partitioned tables.
+        std::map<std::string, std::string> partition;
+        int32_t bucket;
+        std::vector<std::shared_ptr<Split>> splits;
+    };
+
+    /// Splits of the same bucket of two co-partitioned tables, over all their partitions.
+    struct BucketPair {
+        int32_t bucket;
+        /// Splits of the bucket of the left table, empty if it has no data.
+        std::vector<std::shared_ptr<Split>> left;
+        /// Splits of the bucket of the right table, empty if it has no data.
+        std::vector<std::shared_ptr<Split>> right;
+    };
+
+    virtual ~BucketedPlan() = default;
+
+    /// Snapshot id of this plan, return `std::nullopt` if the table is empty.
+    virtual std::optional<int64_t> SnapshotId() const = 0;
+
+    /// Number of buckets of the table.
+    virtual int32_t NumBuckets() const = 0;
+
+    /// Bucket key fields of the table, in the order they are hashed. Types of the fields decide
+    /// the bucket of a key, names do not.
+    virtual const arrow::FieldVector& BucketKeys() const = 0;
+
+    /// Non-empty buckets with their splits. Buckets of the same partition are adjacent and ordered
+    /// by bucket id.
+    virtual const std::vector<BucketSplits>& Buckets() const = 0;
+
+    /// Pair the buckets of two co-partitioned tables for a join on their bucket keys.
+    ///
+    /// @param left Bucketed plan of the left table.
+    /// @param right Bucketed plan of the right table.
+    /// @return One `BucketPair` per bucket id with data in either table, ordered by bucket id, or
+    /// an error status if the tables are not co-partitioned, i.e. the numbers of buckets or the
+    /// types of bucket keys differ.
+    static Result<std::vector<BucketPair>> PairBuckets(const BucketedPlan& left,
+                                                       const BucketedPlan& right);
+};
+}  // namespace paimon
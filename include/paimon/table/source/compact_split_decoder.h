@@ -0,0 +1,64 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#include "paimon/memory/memory_pool.h"
+#include "paimon/result.h"
+#include "paimon/table/source/split.h"
+#include "paimon/visibility.h"
+
+namespace paimon {
+class MemoryPool;
+
+/// Decoder of a batch of splits serialized by `Split::SerializeCompact()`.
+///
+/// Only the dictionaries shared by the splits are decoded when the decoder is created, each split
+/// is decoded on demand by `GetSplit()`. A worker which is assigned a few splits of a large plan
+/// therefore does not pay for decoding the whole plan.
+class PAIMON_EXPORT CompactSplitDecoder {
+ public:
+    ~CompactSplitDecoder();
+
+    /// Create a `CompactSplitDecoder` from a binary buffer, the buffer is copied.
+    ///
+    /// @param buffer Const pointer to the binary data produced by `Split::SerializeCompact()`.
+    /// @param length Size of the buffer in bytes.
+    /// @param pool Memory pool for allocating objects during deserialization.
+    /// @return Result containing the decoder or an error status.
+    static Result<std::unique_ptr<CompactSplitDecoder>> Create(
+        const char* buffer, size_t length, const std::shared_ptr<MemoryPool>& pool);
+
+    /// @return The number of splits in the batch.
+    size_t NumSplits() const;
+
+    /// Decode the split at `index`.
+    ///
+    /// @param index Index of the split in the batch passed to `Split::SerializeCompact()`.
+    /// @return Result containing the decoded `Split` or an error status.
+    Result<std::shared_ptr<Split>> GetSplit(size_t index) const;
+
+ private:
+    class Impl;
+
+    explicit CompactSplitDecoder(std::unique_ptr<Impl>&& impl);
+
+    std::unique_ptr<Impl> impl_;
+};
+}  // namespace paimon
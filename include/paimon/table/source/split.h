@@ -62,5 +62,19 @@ class PAIMON_EXPORT Split {
     /// @return Result containing the serialized binary data as a string or an error status.
     static Result<std::string> Serialize(const std::shared_ptr<Split>& split,
                                          const std::shared_ptr<MemoryPool>& pool);
+
+    /// Serialize a batch of `Split` to a binary string in the compact encoding.
+    ///
+    /// Unlike `Serialize()`, the compact encoding is not compatible with java version. It is meant
+    /// for shipping large plans from a coordinator to workers: key and value stats of data files,
+    /// which are not needed for reading, are dropped, and partitions, bucket paths and other
+    /// strings repeated across the splits are stored only once. Use `CompactSplitDecoder` to
+    /// decode the result.
+    ///
+    /// @param splits The `Split` instances to serialize.
+    /// @param pool Memory pool for allocating temporary objects during serialization.
+    /// @return Result containing the serialized binary data as a string or an error status.
+    static Result<std::string> SerializeCompact(const std::vector<std::shared_ptr<Split>>& splits,
+                                                const std::shared_ptr<MemoryPool>& pool);
 };
 }  // namespace paimon
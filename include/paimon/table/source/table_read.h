@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -27,6 +28,8 @@
 #include "paimon/table/source/split.h"
 #include "paimon/visibility.h"
 
+struct ArrowArrayStream;  // IWYU pragma: keep
+
 namespace paimon {
 class MemoryPool;
 class ReadContext;
@@ -61,10 +64,65 @@ class PAIMON_EXPORT TableRead {
     virtual Result<std::unique_ptr<BatchReader>> CreateReader(
         const std::shared_ptr<Split>& split) = 0;
 
+    /// Creates a `BatchReader` which returns the rows of the provided splits in primary key order.
+    ///
+    /// The readers of all splits, e.g. the splits of all buckets in a partition, are opened
+    /// together, and their outputs, each already sorted by key, are merged with a k-way merge. The
+    /// returned rows are in ascending order of the trimmed primary key (the primary key without
+    /// partition fields), compared field by field with nulls first. Rows with equal keys, which
+    /// only occur for splits of different partitions, are returned in the order of the splits. To
+    /// read a key range, set a predicate on the key fields in the `ReadContext`. At most one batch
+    /// of each split is held in memory at a time.
+    ///
+    /// Only batch splits of primary key tables are supported, and the read schema must contain all
+    /// trimmed primary key fields.
+    ///
+    /// @param splits A vector of shared pointers to `Split` instances representing the data to be
+    ///                    read.
+    /// @return A Result containing a unique pointer to the `BatchReader` instance.
+    Result<std::unique_ptr<BatchReader>> CreateKeyOrderedReader(
+        const std::vector<std::shared_ptr<Split>>& splits);
+
+    /// Default number of batches read ahead by an exported `ArrowArrayStream`.
+    static constexpr uint32_t DEFAULT_STREAM_READ_AHEAD_BATCHES = 4;
+    /// Default number of bytes read ahead by an exported `ArrowArrayStream`.
+    static constexpr uint64_t DEFAULT_STREAM_READ_AHEAD_BYTES = 64 * 1024 * 1024;
+
+    /// Creates an Arrow C stream (`ArrowArrayStream`) for reading data from the provided splits.
+    ///
+    /// The stream is pull-based: batches are read ahead in a background thread, and reading pauses
+    /// once `max_read_ahead_batches` batches or `max_read_ahead_bytes` bytes are buffered but not
+    /// yet consumed. Each array of the stream is a struct array with the same layout as the batches
+    /// returned by `BatchReader::NextBatch()`, including the `_VALUE_KIND` field.
+    ///
+    /// @param splits A vector of shared pointers to `Split` instances representing the data to be
+    ///                    read.
+    /// @param max_read_ahead_batches Maximum number of batches buffered ahead of the consumer.
+    /// @param max_read_ahead_bytes Maximum number of bytes buffered ahead of the consumer. A batch
+    ///                    is always read when nothing is buffered, even if it exceeds this limit.
+    /// @return A Result containing a unique pointer to the `ArrowArrayStream`. The caller must call
+    ///         its `release` callback once done, which also stops the background reading.
+    Result<std::unique_ptr<ArrowArrayStream>> CreateArrowArrayStream(
+        const std::vector<std::shared_ptr<Split>>& splits,
+        uint32_t max_read_ahead_batches = DEFAULT_STREAM_READ_AHEAD_BATCHES,
+        uint64_t max_read_ahead_bytes = DEFAULT_STREAM_READ_AHEAD_BYTES);
+
+    /// Creates an Arrow C stream (`ArrowArrayStream`) for a single split.
+    ///
+    /// @see CreateArrowArrayStream(const std::vector<std::shared_ptr<Split>>&, uint32_t, uint64_t)
+    Result<std::unique_ptr<ArrowArrayStream>> CreateArrowArrayStream(
+        const std::shared_ptr<Split>& split,
+        uint32_t max_read_ahead_batches = DEFAULT_STREAM_READ_AHEAD_BATCHES,
+        uint64_t max_read_ahead_bytes = DEFAULT_STREAM_READ_AHEAD_BYTES);
+
  protected:
     explicit TableRead(const std::shared_ptr<MemoryPool>& memory_pool);
 
  private:
+    Result<std::unique_ptr<ArrowArrayStream>> ExportArrowArrayStream(
+        std::unique_ptr<BatchReader>&& reader, uint32_t max_read_ahead_batches,
+        uint64_t max_read_ahead_bytes) const;
+
     std::shared_ptr<MemoryPool> pool_;
 };
 }  // namespace paimon
@@ -19,6 +19,7 @@
 #include <memory>
 
 #include "paimon/result.h"
+#include "paimon/table/source/bucketed_plan.h"
 #include "paimon/table/source/plan.h"
 #include "paimon/type_fwd.h"
 #include "paimon/visibility.h"
@@ -41,5 +42,14 @@ class PAIMON_EXPORT TableScan {
     ///
     /// @return A Result containing a shared pointer to the created `Plan` or an error status.
     virtual Result<std::shared_ptr<Plan>> CreatePlan() = 0;
+
+    /// Create a scan plan whose splits are grouped by partition and bucket, with the bucketing
+    /// of the table attached, for engines to process co-partitioned tables bucket by bucket, see
+    /// `BucketedPlan`. Consumes the scan like `CreatePlan()`.
+    ///
+    /// @note Only supported in batch mode for tables with a fixed number of buckets.
+    /// @return A Result containing a shared pointer to the created `BucketedPlan` or an error
+    /// status.
+    virtual Result<std::shared_ptr<BucketedPlan>> CreateBucketedPlan() = 0;
 };
 }  // namespace paimon
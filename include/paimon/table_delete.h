@@ -0,0 +1,57 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "paimon/result.h"
+#include "paimon/visibility.h"
+
+namespace paimon {
+class CommitMessage;
+class ScanContext;
+
+/// Deletes rows of an append table by predicate, without rewriting data files.
+///
+/// The candidate data files are found with the same pruning as `TableScan` (partition, file stats
+/// and file indexes), then the predicate is evaluated on each candidate file and the positions of
+/// the matched rows are recorded in deletion vectors. The returned commit messages only contain
+/// deletion vector index file changes and should be committed by `FileStoreCommit`.
+///
+/// Requires an append table (no primary keys) with `deletion-vectors.enabled` set. An UPDATE is a
+/// `Delete()` followed by writing the new rows through `FileStoreWrite`, with the commit messages
+/// of both committed together.
+class PAIMON_EXPORT TableDelete {
+ public:
+    /// Create an instance of `TableDelete`.
+    ///
+    /// @param context The scan context of the table, its predicate (set by
+    ///     `ScanContextBuilder::SetPredicate()`) selects the rows to delete and must use the field
+    ///     indexes of the table schema.
+    /// @return A Result containing a unique pointer to the `TableDelete` instance.
+    static Result<std::unique_ptr<TableDelete>> Create(std::unique_ptr<ScanContext> context);
+
+    virtual ~TableDelete() = default;
+
+    /// Mark the rows matched by the predicate in the latest snapshot as deleted.
+    ///
+    /// @return Commit messages with the new deletion vector index files of the touched buckets
+    ///     and the index files they replace, empty if no row is matched.
+    virtual Result<std::vector<std::shared_ptr<CommitMessage>>> Delete() = 0;
+};
+}  // namespace paimon
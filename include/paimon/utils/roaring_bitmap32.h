@@ -69,6 +69,12 @@ class PAIMON_EXPORT RoaringBitmap32 {
     /// @param x value added to bitmap
     void Add(int32_t x);
 
+    /// Adds values in bulk, which is much faster than adding them one by one when the values are
+    /// sorted.
+    /// @param values values added to bitmap
+    /// @param length number of values
+    void AddMany(const int32_t* values, size_t length);
+
     /// @param x value added to bitmap
     /// @return false if contain x; true if not contain x
     bool CheckedAdd(int32_t x);
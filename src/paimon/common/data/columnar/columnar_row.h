@@ -68,6 +68,11 @@ class ColumnarRow : public InternalRow {
         row_kind_ = kind;
     }
 
+    /// Moves the view to another row of the same arrays.
+    void SetRowId(int64_t row_id) {
+        row_id_ = row_id;
+    }
+
     int32_t GetFieldCount() const override {
         return array_vec_.size();
     }
@@ -71,6 +71,12 @@ const char Options::PARTIAL_UPDATE_REMOVE_RECORD_ON_SEQUENCE_GROUP[] =
 const char Options::SCAN_FALLBACK_BRANCH[] = "scan.fallback-branch";
 const char Options::BRANCH[] = "branch";
 const char Options::FILE_INDEX_READ_ENABLED[] = "file-index.read.enabled";
+const char Options::FILE_INDEX_IN_MANIFEST_THRESHOLD[] = "file-index.in-manifest-threshold";
+const char Options::FILE_INDEX_PREFIX[] = "file-index";
+const char Options::FILE_INDEX_COLUMNS[] = "columns";
+const char Options::METADATA_STATS_MODE[] = "metadata.stats-mode";
+const char Options::STATS_MODE[] = "stats-mode";
+const char Options::METADATA_STATS_DENSE_STORE[] = "metadata.stats-dense-store";
 const char Options::DATA_FILE_EXTERNAL_PATHS[] = "data-file.external-paths";
 const char Options::DATA_FILE_EXTERNAL_PATHS_STRATEGY[] = "data-file.external-paths.strategy";
 const char Options::DATA_FILE_PREFIX[] = "data-file.prefix";
@@ -80,4 +86,8 @@ const char Options::DATA_EVOLUTION_ENABLED[] = "data-evolution.enabled";
 const char Options::PARTITION_GENERATE_LEGACY_NAME[] = "partition.legacy-name";
 const char Options::BLOB_AS_DESCRIPTOR[] = "blob-as-descriptor";
 const char Options::GLOBAL_INDEX_ENABLED[] = "global-index.enabled";
+const char Options::PARTITION_STATS_FILE_ENABLED[] = "partition.stats-file.enabled";
+const char Options::COLUMN_SKETCHES_ENABLED[] = "column-sketches.enabled";
+const char Options::CACHE_ENABLED[] = "cache-enabled";
+const char Options::CACHE_EXPIRE_AFTER_WRITE[] = "cache.expire-after-write";
 }  // namespace paimon
@@ -16,11 +16,17 @@
 
 #include "paimon/common/file_index/bsi/bit_slice_index_bitmap_file_index.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
+#include <limits>
 
+#include "arrow/api.h"
+#include "arrow/util/checked_cast.h"
 #include "fmt/format.h"
 #include "paimon/common/file_index/bsi/bit_slice_index_roaring_bitmap.h"
+#include "paimon/common/io/memory_segment_output_stream.h"
+#include "paimon/common/memory/memory_segment_utils.h"
 #include "paimon/common/utils/date_time_utils.h"
 #include "paimon/common/utils/field_type_utils.h"
 #include "paimon/data/timestamp.h"
@@ -89,6 +95,18 @@ Result<std::shared_ptr<FileIndexReader>> BitSliceIndexBitmapFileIndex::CreateRea
                                                                 negative);
 }
 
+Result<std::shared_ptr<FileIndexWriter>> BitSliceIndexBitmapFileIndex::CreateWriter(
+    ::ArrowSchema* c_arrow_schema, const std::shared_ptr<MemoryPool>& pool) const {
+    PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(std::shared_ptr<arrow::Schema> arrow_schema,
+                                      arrow::ImportSchema(c_arrow_schema));
+    if (arrow_schema->num_fields() != 1) {
+        return Status::Invalid(
+            "invalid schema for BitSliceIndexBitmapFileIndexWriter, supposed to have single "
+            "field.");
+    }
+    return BitSliceIndexBitmapFileIndexWriter::Create(arrow_schema, pool);
+}
+
 // precondition, literal is not null
 Result<BitSliceIndexBitmapFileIndex::ValueMapperType> BitSliceIndexBitmapFileIndex::GetValueMapper(
     const std::shared_ptr<arrow::DataType>& arrow_type) {
@@ -135,8 +153,151 @@ Result<BitSliceIndexBitmapFileIndex::ValueMapperType> BitSliceIndexBitmapFileInd
         default:
             // TODO(xinyu.lxy): support decimal
             return Status::Invalid(
-                "BitSliceIndexBitmapFileIndex only support TINYINT/SMALLINT/INT/BIGINT/DATE");
+                "BitSliceIndexBitmapFileIndex only support "
+                "TINYINT/SMALLINT/INT/BIGINT/DATE/TIMESTAMP");
+    }
+}
+
+namespace {
+template <typename ArrowType>
+Status ConvertValues(const arrow::Array& array, int64_t* values) {
+    const auto* raw_values =
+        arrow::internal::checked_cast<const arrow::NumericArray<ArrowType>&>(array).raw_values();
+    for (int64_t i = 0; i < array.length(); ++i) {
+        values[i] = static_cast<int64_t>(raw_values[i]);
+    }
+    return Status::OK();
+}
+}  // namespace
+
+Result<std::shared_ptr<BitSliceIndexBitmapFileIndexWriter>>
+BitSliceIndexBitmapFileIndexWriter::Create(const std::shared_ptr<arrow::Schema>& arrow_schema,
+                                           const std::shared_ptr<MemoryPool>& pool) {
+    if (arrow_schema->num_fields() != 1) {
+        return Status::Invalid(
+            "invalid schema for BitSliceIndexBitmapFileIndexWriter, supposed to have single "
+            "field.");
+    }
+    auto arrow_field = arrow_schema->field(0);
+    PAIMON_ASSIGN_OR_RAISE(ValueConverter converter, GetValueConverter(arrow_field->type()));
+    return std::shared_ptr<BitSliceIndexBitmapFileIndexWriter>(
+        new BitSliceIndexBitmapFileIndexWriter(arrow::struct_({arrow_field}),
+                                               std::move(converter), pool));
+}
+
+BitSliceIndexBitmapFileIndexWriter::BitSliceIndexBitmapFileIndexWriter(
+    const std::shared_ptr<arrow::DataType>& struct_type, ValueConverter&& converter,
+    const std::shared_ptr<MemoryPool>& pool)
+    : struct_type_(struct_type), converter_(std::move(converter)), pool_(pool) {}
+
+// same mapping as BitSliceIndexBitmapFileIndex::GetValueMapper
+Result<BitSliceIndexBitmapFileIndexWriter::ValueConverter>
+BitSliceIndexBitmapFileIndexWriter::GetValueConverter(
+    const std::shared_ptr<arrow::DataType>& arrow_type) {
+    switch (arrow_type->id()) {
+        case arrow::Type::INT8:
+            return ValueConverter(ConvertValues<arrow::Int8Type>);
+        case arrow::Type::INT16:
+            return ValueConverter(ConvertValues<arrow::Int16Type>);
+        case arrow::Type::INT32:
+            return ValueConverter(ConvertValues<arrow::Int32Type>);
+        case arrow::Type::DATE32:
+            return ValueConverter(ConvertValues<arrow::Date32Type>);
+        case arrow::Type::INT64:
+            return ValueConverter(ConvertValues<arrow::Int64Type>);
+        case arrow::Type::TIMESTAMP: {
+            auto ts_type = arrow::internal::checked_pointer_cast<arrow::TimestampType>(arrow_type);
+            arrow::TimeUnit::type unit = ts_type->unit();
+            return ValueConverter([unit](const arrow::Array& array, int64_t* values) -> Status {
+                PAIMON_RETURN_NOT_OK(ConvertValues<arrow::TimestampType>(array, values));
+                if (unit == arrow::TimeUnit::SECOND) {
+                    // seconds to milliseconds
+                    for (int64_t i = 0; i < array.length(); ++i) {
+                        values[i] *= 1000;
+                    }
+                } else if (unit == arrow::TimeUnit::NANO) {
+                    // nanoseconds to microseconds, rounded down as Timestamp::ToMicrosecond
+                    for (int64_t i = 0; i < array.length(); ++i) {
+                        int64_t micros = values[i] / 1000;
+                        values[i] = (values[i] % 1000 < 0) ? micros - 1 : micros;
+                    }
+                }
+                return Status::OK();
+            });
+        }
+        default:
+            return Status::Invalid(
+                "BitSliceIndexBitmapFileIndex only support "
+                "TINYINT/SMALLINT/INT/BIGINT/DATE/TIMESTAMP");
+    }
+}
+
+Status BitSliceIndexBitmapFileIndexWriter::AddBatch(::ArrowArray* batch) {
+    PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(std::shared_ptr<arrow::Array> arrow_array,
+                                      arrow::ImportArray(batch, struct_type_));
+    auto struct_array = std::dynamic_pointer_cast<arrow::StructArray>(arrow_array);
+    if (!struct_array || struct_array->num_fields() != 1) {
+        return Status::Invalid(
+            "invalid batch for BitSliceIndexBitmapFileIndexWriter, supposed to be struct array "
+            "with single field.");
+    }
+    const std::shared_ptr<arrow::Array>& array = struct_array->field(0);
+    if (array->length() > std::numeric_limits<int32_t>::max() - row_number_) {
+        return Status::Invalid("too many rows for BitSliceIndexBitmapFileIndexWriter");
+    }
+    batch_values_.resize(array->length());
+    PAIMON_RETURN_NOT_OK(converter_(*array, batch_values_.data()));
+    for (int64_t i = 0; i < array->length(); ++i) {
+        if (array->IsNull(i)) {
+            continue;
+        }
+        auto rid = static_cast<int32_t>(row_number_ + i);
+        int64_t value = batch_values_[i];
+        if (value >= 0) {
+            positive_rids_.push_back(rid);
+            positive_values_.push_back(value);
+            positive_max_ = std::max(positive_max_, value);
+        } else {
+            if (value == std::numeric_limits<int64_t>::min()) {
+                return Status::Invalid(fmt::format(
+                    "value {} is out of range of BitSliceIndexBitmapFileIndexWriter", value));
+            }
+            negative_rids_.push_back(rid);
+            negative_values_.push_back(-value);
+            negative_max_ = std::max(negative_max_, -value);
+        }
+    }
+    row_number_ += array->length();
+    return Status::OK();
+}
+
+Result<std::shared_ptr<Bytes>> BitSliceIndexBitmapFileIndexWriter::SerializeBitmap(
+    const std::vector<int32_t>& rids, const std::vector<int64_t>& values, int64_t max) const {
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<BitSliceIndexRoaringBitmap::Appender> appender,
+                           BitSliceIndexRoaringBitmap::Appender::Create(/*min=*/0, max));
+    PAIMON_RETURN_NOT_OK(appender->AppendBatch(rids.data(), values.data(), rids.size()));
+    return appender->Serialize(pool_);
+}
+
+Result<PAIMON_UNIQUE_PTR<Bytes>> BitSliceIndexBitmapFileIndexWriter::SerializedBytes() const {
+    MemorySegmentOutputStream output_stream(MemorySegmentOutputStream::DEFAULT_SEGMENT_SIZE,
+                                            pool_);
+    output_stream.WriteValue<int8_t>(BitSliceIndexBitmapFileIndex::VERSION_1);
+    output_stream.WriteValue<int32_t>(row_number_);
+    output_stream.WriteValue<int8_t>(positive_rids_.empty() ? 0 : 1);
+    if (!positive_rids_.empty()) {
+        PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<Bytes> positive_bytes,
+                               SerializeBitmap(positive_rids_, positive_values_, positive_max_));
+        output_stream.WriteBytes(positive_bytes);
+    }
+    output_stream.WriteValue<int8_t>(negative_rids_.empty() ? 0 : 1);
+    if (!negative_rids_.empty()) {
+        PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<Bytes> negative_bytes,
+                               SerializeBitmap(negative_rids_, negative_values_, negative_max_));
+        output_stream.WriteBytes(negative_bytes);
     }
+    return MemorySegmentUtils::CopyToBytes(output_stream.Segments(), 0, output_stream.CurrentSize(),
+                                           pool_.get());
 }
 
 BitSliceIndexBitmapFileIndexReader::BitSliceIndexBitmapFileIndexReader(
@@ -29,7 +29,9 @@
 #include "paimon/common/utils/arrow/status_utils.h"
 #include "paimon/file_index/file_index_reader.h"
 #include "paimon/file_index/file_index_result.h"
+#include "paimon/file_index/file_index_writer.h"
 #include "paimon/file_index/file_indexer.h"
+#include "paimon/memory/bytes.h"
 #include "paimon/predicate/literal.h"
 #include "paimon/result.h"
 #include "paimon/status.h"
@@ -52,11 +54,7 @@ class BitSliceIndexBitmapFileIndex : public FileIndexer {
         const std::shared_ptr<MemoryPool>& pool) const override;
 
     Result<std::shared_ptr<FileIndexWriter>> CreateWriter(
-        ::ArrowSchema* arrow_schema, const std::shared_ptr<MemoryPool>& pool) const override {
-        PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(std::shared_ptr<arrow::DataType> arrow_type,
-                                          arrow::ImportType(arrow_schema));
-        return Status::NotImplemented("do not support index writer in bsi");
-    }
+        ::ArrowSchema* arrow_schema, const std::shared_ptr<MemoryPool>& pool) const override;
 
     using ValueMapperType = std::function<Result<int64_t>(const Literal& literal)>;
 
@@ -64,6 +62,8 @@ class BitSliceIndexBitmapFileIndex : public FileIndexer {
     static Result<ValueMapperType> GetValueMapper(
         const std::shared_ptr<arrow::DataType>& arrow_type);
 
+    friend class BitSliceIndexBitmapFileIndexWriter;
+
     template <typename T>
     static Result<int64_t> GetValueFromLiteral(const Literal& literal) {
         if (literal.IsNull()) {
@@ -77,6 +77,56 @@ class BitSliceIndexBitmapFileIndex : public FileIndexer {
     static constexpr int8_t VERSION_1 = 1;
 };
 
+/// Writer of BSI file index, which keeps values of the indexed field in the same mapping as
+/// `BitSliceIndexBitmapFileIndexReader`: integers and dates as they are, timestamps as
+/// milliseconds if precision <= 3, otherwise as microseconds.
+///
+/// Values are converted from arrow arrays in a batch, and the bit slices of non-negative values
+/// and of absolute negative values are built in blocks on serialization, when the value range and
+/// thus the number of slices is known.
+class BitSliceIndexBitmapFileIndexWriter : public FileIndexWriter {
+ public:
+    static Result<std::shared_ptr<BitSliceIndexBitmapFileIndexWriter>> Create(
+        const std::shared_ptr<arrow::Schema>& arrow_schema,
+        const std::shared_ptr<MemoryPool>& pool);
+
+    Status AddBatch(::ArrowArray* batch) override;
+
+    Result<PAIMON_UNIQUE_PTR<Bytes>> SerializedBytes() const override;
+
+ private:
+    using ValueConverter = std::function<Status(const arrow::Array& array, int64_t* values)>;
+
+    BitSliceIndexBitmapFileIndexWriter(const std::shared_ptr<arrow::DataType>& struct_type,
+                                       ValueConverter&& converter,
+                                       const std::shared_ptr<MemoryPool>& pool);
+
+    static Result<ValueConverter> GetValueConverter(
+        const std::shared_ptr<arrow::DataType>& arrow_type);
+
+    Result<std::shared_ptr<Bytes>> SerializeBitmap(const std::vector<int32_t>& rids,
+                                                   const std::vector<int64_t>& values,
+                                                   int64_t max) const;
+
+ private:
+    /// @note struct_type_ contains only one field with the indexed type, used for import from C
+    /// ArrowArray
+    std::shared_ptr<arrow::DataType> struct_type_;
+    ValueConverter converter_;
+    std::shared_ptr<MemoryPool> pool_;
+    int32_t row_number_ = 0;
+    // rows and values of non-negative values
+    std::vector<int32_t> positive_rids_;
+    std::vector<int64_t> positive_values_;
+    int64_t positive_max_ = 0;
+    // rows and absolute values of negative values
+    std::vector<int32_t> negative_rids_;
+    std::vector<int64_t> negative_values_;
+    int64_t negative_max_ = 0;
+    // buffer of values converted from a batch
+    std::vector<int64_t> batch_values_;
+};
+
 class BitSliceIndexBitmapFileIndexReader
     : public FileIndexReader,
       public std::enable_shared_from_this<BitSliceIndexBitmapFileIndexReader> {
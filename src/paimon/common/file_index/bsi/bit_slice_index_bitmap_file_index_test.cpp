@@ -16,9 +16,14 @@
 
 #include "paimon/common/file_index/bsi/bit_slice_index_bitmap_file_index.h"
 
+#include <string>
 #include <utility>
 
+#include "arrow/api.h"
+#include "arrow/c/bridge.h"
+#include "arrow/ipc/json_simple.h"
 #include "gtest/gtest.h"
+#include "paimon/common/utils/arrow/status_utils.h"
 #include "paimon/common/utils/field_type_utils.h"
 #include "paimon/data/timestamp.h"
 #include "paimon/defs.h"
@@ -57,6 +62,31 @@ class BitSliceIndexBitmapIndexReaderTest : public ::testing::Test {
             << ", expected=" << RoaringBitmap32::From(expected).ToString();
     }
 
+    Result<std::shared_ptr<FileIndexReader>> WriteAndCreateReader(
+        const std::shared_ptr<arrow::DataType>& data_type,
+        const std::vector<std::string>& json_batches) const {
+        BitSliceIndexBitmapFileIndex file_index({});
+        PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<FileIndexWriter> writer,
+                               file_index.CreateWriter(CreateArrowSchema(data_type).get(), pool_));
+        auto struct_type = arrow::struct_({arrow::field("f0", data_type)});
+        for (const auto& json : json_batches) {
+            PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(
+                std::shared_ptr<arrow::Array> array,
+                arrow::ipc::internal::json::ArrayFromJSON(struct_type, json));
+            ArrowArray c_array;
+            PAIMON_RETURN_NOT_OK_FROM_ARROW(arrow::ExportArray(*array, &c_array));
+            PAIMON_RETURN_NOT_OK(writer->AddBatch(&c_array));
+        }
+        PAIMON_ASSIGN_OR_RAISE(PAIMON_UNIQUE_PTR<Bytes> bytes, writer->SerializedBytes());
+        auto input_stream = std::make_shared<ByteArrayInputStream>(bytes->data(), bytes->size());
+        PAIMON_ASSIGN_OR_RAISE(
+            std::shared_ptr<FileIndexReader> reader,
+            file_index.CreateReader(CreateArrowSchema(data_type).get(), /*start=*/0,
+                                    /*length=*/bytes->size(), input_stream, pool_));
+        // the reader holds the decoded bitmaps only, the serialized bytes can be released
+        return reader;
+    }
+
  private:
     std::shared_ptr<MemoryPool> pool_;
 };
@@ -382,7 +412,85 @@ TEST_F(BitSliceIndexBitmapIndexReaderTest, TestUnInvalidType) {
     ASSERT_NOK_WITH_MSG(
         file_index.CreateReader(CreateArrowSchema(arrow::boolean()).get(),
                                 /*start=*/0, /*length=*/index_bytes.size(), input_stream, pool_),
-        "BitSliceIndexBitmapFileIndex only support TINYINT/SMALLINT/INT/BIGINT/DATE");
+        "BitSliceIndexBitmapFileIndex only support TINYINT/SMALLINT/INT/BIGINT/DATE/TIMESTAMP");
+}
+
+TEST_F(BitSliceIndexBitmapIndexReaderTest, TestWriteMix) {
+    // same data as TestMix, written in two batches
+    ASSERT_OK_AND_ASSIGN(
+        auto reader,
+        WriteAndCreateReader(arrow::int32(), {R"([[1], [2], [null], [-2], [-2]])",
+                                              R"([[-1], [null], [2], [0], [5], [null]])"}));
+    CheckResult(reader->VisitEqual(Literal(2)).value(), {1, 7});
+    CheckResult(reader->VisitEqual(Literal(-2)).value(), {3, 4});
+    CheckResult(reader->VisitEqual(Literal(100)).value(), {});
+    CheckResult(reader->VisitNotEqual(Literal(2)).value(), {0, 3, 4, 5, 8, 9});
+    CheckResult(reader->VisitIn({Literal(-1), Literal(1), Literal(2), Literal(3)}).value(),
+                {0, 1, 5, 7});
+    CheckResult(reader->VisitIsNull().value(), {2, 6, 10});
+    CheckResult(reader->VisitIsNotNull().value(), {0, 1, 3, 4, 5, 7, 8, 9});
+    CheckResult(reader->VisitLessThan(Literal(2)).value(), {0, 3, 4, 5, 8});
+    CheckResult(reader->VisitLessOrEqual(Literal(-1)).value(), {3, 4, 5});
+    CheckResult(reader->VisitGreaterThan(Literal(-2)).value(), {0, 1, 5, 7, 8, 9});
+    CheckResult(reader->VisitGreaterOrEqual(Literal(2)).value(), {1, 7, 9});
+}
+
+TEST_F(BitSliceIndexBitmapIndexReaderTest, TestWritePositiveAndNegativeOnly) {
+    {
+        ASSERT_OK_AND_ASSIGN(auto reader,
+                             WriteAndCreateReader(arrow::int64(),
+                                                  {R"([[0], [1], [null], [3], [4000000000]])"}));
+        CheckResult(reader->VisitEqual(Literal(4000000000l)).value(), {4});
+        CheckResult(reader->VisitLessThan(Literal(3l)).value(), {0, 1});
+        CheckResult(reader->VisitLessThan(Literal(0l)).value(), {});
+        CheckResult(reader->VisitIsNull().value(), {2});
+    }
+    {
+        ASSERT_OK_AND_ASSIGN(auto reader,
+                             WriteAndCreateReader(arrow::int16(), {R"([[-3], [null], [-1]])"}));
+        CheckResult(reader->VisitEqual(Literal(static_cast<int16_t>(-1))).value(), {2});
+        CheckResult(reader->VisitGreaterThan(Literal(static_cast<int16_t>(-3))).value(), {2});
+        CheckResult(reader->VisitGreaterOrEqual(Literal(static_cast<int16_t>(0))).value(), {});
+    }
+    {
+        // all values are null
+        ASSERT_OK_AND_ASSIGN(auto reader,
+                             WriteAndCreateReader(arrow::date32(), {R"([[null], [null]])"}));
+        CheckResult(reader->VisitIsNull().value(), {0, 1});
+        CheckResult(reader->VisitEqual(Literal(FieldType::DATE, 0)).value(), {});
+    }
+}
+
+TEST_F(BitSliceIndexBitmapIndexReaderTest, TestWriteTimestamp) {
+    {
+        // millisecond precision is indexed in milliseconds
+        ASSERT_OK_AND_ASSIGN(
+            auto reader,
+            WriteAndCreateReader(arrow::timestamp(arrow::TimeUnit::SECOND),
+                                 {R"([[1745542802], [null], [-1745], [1745542802]])"}));
+        CheckResult(reader->VisitEqual(Literal(Timestamp(1745542802000l, 0))).value(), {0, 3});
+        CheckResult(reader->VisitLessThan(Literal(Timestamp(0, 0))).value(), {2});
+    }
+    {
+        // nanosecond precision is indexed in microseconds
+        ASSERT_OK_AND_ASSIGN(
+            auto reader,
+            WriteAndCreateReader(arrow::timestamp(arrow::TimeUnit::NANO),
+                                 {R"([[1745542802000123000], [-1745123001], [null]])"}));
+        CheckResult(reader->VisitEqual(Literal(Timestamp(1745542802000l, 123000))).value(), {0});
+        CheckResult(reader->VisitEqual(Literal(Timestamp(-1746, 876999))).value(), {1});
+        CheckResult(reader->VisitGreaterThan(Literal(Timestamp(0, 0))).value(), {0});
+    }
+}
+
+TEST_F(BitSliceIndexBitmapIndexReaderTest, TestWriteInvalid) {
+    BitSliceIndexBitmapFileIndex file_index({});
+    ASSERT_NOK_WITH_MSG(
+        file_index.CreateWriter(CreateArrowSchema(arrow::boolean()).get(), pool_),
+        "BitSliceIndexBitmapFileIndex only support TINYINT/SMALLINT/INT/BIGINT/DATE/TIMESTAMP");
+    ASSERT_NOK_WITH_MSG(
+        WriteAndCreateReader(arrow::int64(), {R"([[1], [-9223372036854775808]])"}),
+        "is out of range of BitSliceIndexBitmapFileIndexWriter");
 }
 
 }  // namespace paimon::test
@@ -16,6 +16,7 @@
 
 #include "paimon/common/file_index/bsi/bit_slice_index_roaring_bitmap.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "fmt/format.h"
@@ -273,6 +274,57 @@ Status BitSliceIndexRoaringBitmap::Appender::Append(int32_t rid, int64_t value)
     return Status::OK();
 }
 
+Status BitSliceIndexRoaringBitmap::Appender::AppendBatch(const int32_t* rids,
+                                                         const int64_t* values, size_t length) {
+    if (length == 0) {
+        return Status::OK();
+    }
+    // validate the whole batch first, so that a failed batch leaves the bitmap unchanged
+    for (size_t i = 0; i < length; i++) {
+        if (i > 0 && rids[i] <= rids[i - 1]) {
+            return Status::Invalid(fmt::format(
+                "rids should be strictly ascending for append to BitSliceIndexRoaringBitmap, got "
+                "{} after {}",
+                rids[i], rids[i - 1]));
+        }
+        if (values[i] < bsi_->min_ || values[i] > bsi_->max_) {
+            return Status::Invalid(fmt::format(
+                "value {} is out of range [{}, {}] for append to BitSliceIndexRoaringBitmap",
+                values[i], bsi_->min_, bsi_->max_));
+        }
+    }
+    if (rids[length - 1] == RoaringBitmap32::MAX_VALUE ||
+        bsi_->ebm_.ContainsAny(rids[0], rids[length - 1] + 1)) {
+        return Status::Invalid("rids already exist for append to BitSliceIndexRoaringBitmap");
+    }
+
+    // rows of a block with each bit set, the block keeps the buffers small and cache friendly
+    static constexpr size_t BLOCK_SIZE = 4096;
+    std::vector<std::vector<int32_t>> slice_rids(bsi_->slices_.size());
+    for (auto& buffer : slice_rids) {
+        buffer.reserve(BLOCK_SIZE);
+    }
+    for (size_t block_start = 0; block_start < length; block_start += BLOCK_SIZE) {
+        size_t block_end = std::min(length, block_start + BLOCK_SIZE);
+        for (size_t i = block_start; i < block_end; i++) {
+            // reduce the number of slices, only bit=1 need to set
+            int64_t value = values[i] - bsi_->min_;
+            while (value != 0) {
+                slice_rids[NumberOfTrailingZeros(value)].push_back(rids[i]);
+                value &= (value - 1);
+            }
+        }
+        for (size_t slice = 0; slice < slice_rids.size(); slice++) {
+            if (!slice_rids[slice].empty()) {
+                bsi_->slices_[slice].AddMany(slice_rids[slice].data(), slice_rids[slice].size());
+                slice_rids[slice].clear();
+            }
+        }
+    }
+    bsi_->ebm_.AddMany(rids, length);
+    return Status::OK();
+}
+
 bool BitSliceIndexRoaringBitmap::Appender::IsNotEmpty() const {
     return !bsi_->ebm_.IsEmpty();
 }
@@ -15,6 +15,7 @@
  */
 
 #pragma once
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <optional>
@@ -50,6 +51,15 @@ class BitSliceIndexRoaringBitmap {
      public:
         static Result<std::unique_ptr<Appender>> Create(int64_t min, int64_t max);
         Status Append(int32_t rid, int64_t value);
+        /// Appends the values of a batch of rows. Instead of setting the bits of each row one by
+        /// one, the rows with a bit set are collected per slice from a block of values and added
+        /// to the slice at once.
+        ///
+        /// @param rids Row ids in strictly ascending order, which must be larger than the row ids
+        /// appended before.
+        /// @param values Values of the rows, within [min, max] of the appender.
+        /// @param length Number of rows.
+        Status AppendBatch(const int32_t* rids, const int64_t* values, size_t length);
         bool IsNotEmpty() const;
         // TODO(xinyu.lxy): may use data output stream
         std::shared_ptr<Bytes> Serialize(const std::shared_ptr<MemoryPool>& pool);
@@ -20,6 +20,7 @@
 #include <cstdlib>
 #include <map>
 #include <utility>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include "paimon/common/utils/date_time_utils.h"
@@ -115,6 +116,46 @@ TEST_F(BitSliceIndexRoaringBitmapTest, TestSerializeAndDeserialize) {
     ASSERT_EQ(*bsi, *de_bsi);
 }
 
+TEST_F(BitSliceIndexRoaringBitmapTest, TestAppendBatch) {
+    std::vector<std::pair<int32_t, int64_t>> rows;
+    for (const auto& [value, rids] : expected_map_) {
+        for (const auto& rid : rids) {
+            rows.emplace_back(rid, value);
+        }
+    }
+    std::sort(rows.begin(), rows.end());
+    std::vector<int32_t> rids;
+    std::vector<int64_t> values;
+    for (const auto& [rid, value] : rows) {
+        rids.push_back(rid);
+        values.push_back(value);
+    }
+    ASSERT_OK_AND_ASSIGN(auto appender, BitSliceIndexRoaringBitmap::Appender::Create(
+                                            /*min=*/1, /*max=*/VALUE_BOUND));
+    // batches across several blocks
+    size_t batch_size = 10000;
+    for (size_t start = 0; start < rids.size(); start += batch_size) {
+        size_t length = std::min(batch_size, rids.size() - start);
+        ASSERT_OK(appender->AppendBatch(rids.data() + start, values.data() + start, length));
+    }
+    ASSERT_EQ(*bsi_, *appender->Build());
+
+    // test invalid append, which leaves the bitmap unchanged
+    std::vector<int32_t> invalid_rids = {NUM_OF_ROWS + 1, NUM_OF_ROWS};
+    std::vector<int64_t> invalid_values = {1, 1};
+    ASSERT_NOK_WITH_MSG(appender->AppendBatch(invalid_rids.data(), invalid_values.data(), 2),
+                        "rids should be strictly ascending");
+    invalid_rids = {NUM_OF_ROWS, NUM_OF_ROWS + 1};
+    invalid_values = {1, VALUE_GT_MAX};
+    ASSERT_NOK_WITH_MSG(appender->AppendBatch(invalid_rids.data(), invalid_values.data(), 2),
+                        "is out of range [1, 1000]");
+    invalid_rids = {rids.back(), NUM_OF_ROWS};
+    invalid_values = {1, 1};
+    ASSERT_NOK_WITH_MSG(appender->AppendBatch(invalid_rids.data(), invalid_values.data(), 2),
+                        "rids already exist");
+    ASSERT_EQ(*bsi_, *appender->Build());
+}
+
 TEST_F(BitSliceIndexRoaringBitmapTest, TestEqual) {
     // test predicate in the value bound
     for (int32_t i = 0; i < 10; i++) {
@@ -17,6 +17,7 @@
 #include "paimon/file_index/file_index_format.h"
 
 #include <cassert>
+#include <limits>
 #include <map>
 #include <unordered_map>
 #include <utility>
@@ -25,10 +26,13 @@
 #include "arrow/type.h"
 #include "fmt/format.h"
 #include "paimon/common/file_index/empty/empty_file_index_reader.h"
+#include "paimon/common/io/memory_segment_output_stream.h"
+#include "paimon/common/memory/memory_segment_utils.h"
 #include "paimon/common/utils/arrow/status_utils.h"
 #include "paimon/file_index/file_indexer.h"
 #include "paimon/file_index/file_indexer_factory.h"
 #include "paimon/io/byte_array_input_stream.h"
+#include "paimon/io/byte_order.h"
 #include "paimon/io/data_input_stream.h"
 #include "paimon/memory/bytes.h"
 #include "paimon/status.h"
@@ -151,4 +155,68 @@ Result<std::unique_ptr<FileIndexFormat::Reader>> FileIndexFormat::CreateReader(
     const std::shared_ptr<InputStream>& input_stream, const std::shared_ptr<MemoryPool>& pool) {
     return FileIndexFormatReaderImpl::Create(input_stream, pool);
 }
+
+Result<PAIMON_UNIQUE_PTR<Bytes>> FileIndexFormat::WriteColumnIndexes(
+    const std::map<std::string, std::map<std::string, std::shared_ptr<Bytes>>>& column_indexes,
+    const std::shared_ptr<MemoryPool>& pool) {
+    // strings are written as an int16 length followed by the bytes
+    auto string_length = [](const std::string& value) -> Result<int32_t> {
+        if (value.size() > std::numeric_limits<uint16_t>::max()) {
+            return Status::Invalid(
+                fmt::format("name {} is too long for file index format", value));
+        }
+        return static_cast<int32_t>(sizeof(uint16_t) + value.size());
+    };
+    // magic, version, head length, column number and redundant length
+    int64_t head_length = sizeof(int64_t) + sizeof(int32_t) * 4;
+    int64_t body_length = 0;
+    for (const auto& [column_name, indexes] : column_indexes) {
+        PAIMON_ASSIGN_OR_RAISE(int32_t column_name_length, string_length(column_name));
+        head_length += column_name_length + sizeof(int32_t);
+        for (const auto& [index_type, index_bytes] : indexes) {
+            PAIMON_ASSIGN_OR_RAISE(int32_t index_type_length, string_length(index_type));
+            head_length += index_type_length + sizeof(int32_t) * 2;
+            body_length += index_bytes ? index_bytes->size() : 0;
+        }
+    }
+    if (head_length + body_length > std::numeric_limits<int32_t>::max()) {
+        return Status::Invalid(fmt::format("file index of {} bytes is too large",
+                                           head_length + body_length));
+    }
+
+    MemorySegmentOutputStream out(MemorySegmentOutputStream::DEFAULT_SEGMENT_SIZE, pool);
+    out.SetOrder(ByteOrder::PAIMON_BIG_ENDIAN);
+    out.WriteValue<int64_t>(MAGIC);
+    out.WriteValue<int32_t>(V_1);
+    out.WriteValue<int32_t>(static_cast<int32_t>(head_length));
+    out.WriteValue<int32_t>(static_cast<int32_t>(column_indexes.size()));
+    // body starts right after the head, offsets are positions in the whole index file
+    int32_t offset = static_cast<int32_t>(head_length);
+    for (const auto& [column_name, indexes] : column_indexes) {
+        out.WriteString(column_name);
+        out.WriteValue<int32_t>(static_cast<int32_t>(indexes.size()));
+        for (const auto& [index_type, index_bytes] : indexes) {
+            out.WriteString(index_type);
+            if (!index_bytes || index_bytes->size() == 0) {
+                out.WriteValue<int32_t>(EMPTY_INDEX_FLAG);
+                out.WriteValue<int32_t>(0);
+            } else {
+                out.WriteValue<int32_t>(offset);
+                out.WriteValue<int32_t>(static_cast<int32_t>(index_bytes->size()));
+                offset += index_bytes->size();
+            }
+        }
+    }
+    // redundant length
+    out.WriteValue<int32_t>(0);
+    for (const auto& [column_name, indexes] : column_indexes) {
+        for (const auto& [index_type, index_bytes] : indexes) {
+            if (index_bytes && index_bytes->size() > 0) {
+                out.WriteBytes(index_bytes);
+            }
+        }
+    }
+    return MemorySegmentUtils::CopyToBytes(out.Segments(), /*offset=*/0,
+                                           /*num_bytes=*/out.CurrentSize(), pool.get());
+}
 }  // namespace paimon
@@ -15,8 +15,11 @@
  */
 #include "paimon/file_index/file_index_format.h"
 
+#include <map>
 #include <utility>
 
+#include "arrow/c/bridge.h"
+#include "arrow/ipc/json_simple.h"
 #include "gtest/gtest.h"
 #include "paimon/common/file_index/bitmap/bitmap_file_index.h"
 #include "paimon/common/file_index/bloomfilter/bloom_filter_file_index.h"
@@ -69,6 +72,75 @@ TEST_F(FileIndexFormatTest, TestCreateEmptyFileIndexReader) {
     ASSERT_TRUE(empty_reader);
 }
 
+TEST_F(FileIndexFormatTest, TestWriteEmptyIndex) {
+    std::map<std::string, std::map<std::string, std::shared_ptr<Bytes>>> column_indexes;
+    column_indexes["c1"]["empty"] = nullptr;
+    ASSERT_OK_AND_ASSIGN(PAIMON_UNIQUE_PTR<Bytes> bytes,
+                         FileIndexFormat::WriteColumnIndexes(column_indexes, pool_));
+    // same as the index file of TestCreateEmptyFileIndexReader
+    std::vector<char> expected = {0,  5,  78, 78, -48, 26, 53,  -82, 0,   0,   0,   1,
+                                  0,  0,  0,  47, 0,   0,  0,   1,   0,   2,   99,  49,
+                                  0,  0,  0,  1,  0,   5,  101, 109, 112, 116, 121, -1,
+                                  -1, -1, -1, 0,  0,   0,  0,   0,   0,   0,   0};
+    ASSERT_EQ(std::string(expected.data(), expected.size()),
+              std::string(bytes->data(), bytes->size()));
+}
+
+TEST_F(FileIndexFormatTest, TestWriteAndRead) {
+    auto type = arrow::struct_({arrow::field("f0", arrow::int32())});
+    auto write_bitmap = [&](const std::string& json) -> std::shared_ptr<Bytes> {
+        auto array = arrow::ipc::internal::json::ArrayFromJSON(type, json).ValueOrDie();
+        BitmapFileIndex file_index({});
+        auto c_schema = CreateArrowSchema(arrow::schema(type->fields()));
+        auto writer = file_index.CreateWriter(c_schema.get(), pool_).value();
+        ArrowArray c_array;
+        EXPECT_TRUE(arrow::ExportArray(*array, &c_array).ok());
+        EXPECT_OK(writer->AddBatch(&c_array));
+        return std::shared_ptr<Bytes>(writer->SerializedBytes().value());
+    };
+    std::map<std::string, std::map<std::string, std::shared_ptr<Bytes>>> column_indexes;
+    column_indexes["f0"]["bitmap"] = write_bitmap("[[10], [20], [10], [null]]");
+    column_indexes["f1"]["bitmap"] = write_bitmap("[[1], [1], [2], [3]]");
+    column_indexes["f1"]["empty"] = nullptr;
+    ASSERT_OK_AND_ASSIGN(PAIMON_UNIQUE_PTR<Bytes> bytes,
+                         FileIndexFormat::WriteColumnIndexes(column_indexes, pool_));
+
+    auto schema = arrow::schema({arrow::field("f0", arrow::int32()),
+                                 arrow::field("f1", arrow::int32()),
+                                 arrow::field("f2", arrow::int32())});
+    auto input_stream = std::make_shared<ByteArrayInputStream>(bytes->data(), bytes->size());
+    ASSERT_OK_AND_ASSIGN(auto reader, FileIndexFormat::CreateReader(input_stream, pool_));
+    {
+        ASSERT_OK_AND_ASSIGN(auto index_file_readers,
+                             reader->ReadColumnIndex("f0", CreateArrowSchema(schema).get()));
+        ASSERT_EQ(1, index_file_readers.size());
+        ASSERT_OK_AND_ASSIGN(auto result, index_file_readers[0]->VisitEqual(Literal(10)));
+        ASSERT_EQ("{0,2}", result->ToString());
+        ASSERT_OK_AND_ASSIGN(result, index_file_readers[0]->VisitIsNull());
+        ASSERT_EQ("{3}", result->ToString());
+    }
+    {
+        ASSERT_OK_AND_ASSIGN(auto index_file_readers,
+                             reader->ReadColumnIndex("f1", CreateArrowSchema(schema).get()));
+        ASSERT_EQ(2, index_file_readers.size());
+        int32_t empty_count = 0;
+        for (const auto& index_file_reader : index_file_readers) {
+            if (dynamic_cast<EmptyFileIndexReader*>(index_file_reader.get())) {
+                empty_count++;
+                continue;
+            }
+            ASSERT_OK_AND_ASSIGN(auto result, index_file_reader->VisitEqual(Literal(1)));
+            ASSERT_EQ("{0,1}", result->ToString());
+        }
+        ASSERT_EQ(1, empty_count);
+    }
+    {
+        ASSERT_OK_AND_ASSIGN(auto index_file_readers,
+                             reader->ReadColumnIndex("f2", CreateArrowSchema(schema).get()));
+        ASSERT_TRUE(index_file_readers.empty());
+    }
+}
+
 TEST_F(FileIndexFormatTest, TestSimple) {
     auto schema =
         arrow::schema({arrow::field("f1", arrow::int32()), arrow::field("f2", arrow::int32()),
@@ -0,0 +1,507 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/common/format/columnar_stats_collector.h"
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "arrow/api.h"
+#include "arrow/util/bit_run_reader.h"
+#include "arrow/util/checked_cast.h"
+#include "fmt/format.h"
+#include "paimon/common/utils/date_time_utils.h"
+#include "paimon/data/decimal.h"
+#include "paimon/data/timestamp.h"
+#include "paimon/defs.h"
+#include "paimon/format/column_stats.h"
+
+namespace paimon {
+
+/// Accumulates statistics of one field over the batches collected so far.
+class ColumnStatsAccumulator {
+ public:
+    virtual ~ColumnStatsAccumulator() = default;
+    virtual void Update(const arrow::Array& array) = 0;
+    virtual std::unique_ptr<ColumnStats> ToColumnStats() const = 0;
+};
+
+namespace {
+
+/// Calls `visitor(position, length)` for each run of non-null values, so that the typed loops
+/// below never look at the validity bitmap.
+template <typename Visitor>
+void VisitValidRuns(const arrow::Array& array, Visitor&& visitor) {
+    if (array.null_count() == 0) {
+        visitor(0, array.length());
+    } else if (array.null_count() < array.length()) {
+        arrow::internal::VisitSetBitRunsVoid(array.null_bitmap_data(), array.offset(),
+                                             array.length(), std::forward<Visitor>(visitor));
+    }
+}
+
+/// Branch-free min/max of a run of values, which compilers lower to packed min/max instructions.
+/// NaN never replaces a bound, as every comparison against it is false.
+template <typename T>
+void MinMaxKernel(const T* values, int64_t length, T* min, T* max) {
+    T lo = *min;
+    T hi = *max;
+    for (int64_t i = 0; i < length; ++i) {
+        lo = values[i] < lo ? values[i] : lo;
+        hi = hi < values[i] ? values[i] : hi;
+    }
+    *min = lo;
+    *max = hi;
+}
+
+template <typename T>
+constexpr T InitialMin() {
+    if constexpr (std::numeric_limits<T>::has_infinity) {
+        return std::numeric_limits<T>::infinity();
+    } else {
+        return std::numeric_limits<T>::max();
+    }
+}
+
+template <typename T>
+constexpr T InitialMax() {
+    if constexpr (std::numeric_limits<T>::has_infinity) {
+        return -std::numeric_limits<T>::infinity();
+    } else {
+        return std::numeric_limits<T>::lowest();
+    }
+}
+
+/// Accumulator of fixed width primitive fields, including date and timestamp.
+template <typename ArrowType>
+class NumericAccumulator : public ColumnStatsAccumulator {
+ public:
+    using CType = typename ArrowType::c_type;
+
+    explicit NumericAccumulator(const std::shared_ptr<arrow::DataType>& type) : type_(type) {}
+
+    void Update(const arrow::Array& array) override {
+        const CType* values =
+            arrow::internal::checked_cast<const arrow::NumericArray<ArrowType>&>(array)
+                .raw_values();
+        VisitValidRuns(array, [&](int64_t position, int64_t length) {
+            MinMaxKernel(values + position, length, &min_, &max_);
+        });
+        null_count_ += array.null_count();
+    }
+
+    std::unique_ptr<ColumnStats> ToColumnStats() const override {
+        std::optional<CType> min;
+        std::optional<CType> max;
+        // bounds cross each other when no (non-NaN) value has been seen
+        if (!(max_ < min_)) {
+            min = min_;
+            max = max_;
+        }
+        if constexpr (std::is_same_v<ArrowType, arrow::Int8Type>) {
+            return ColumnStats::CreateTinyIntColumnStats(min, max, null_count_);
+        } else if constexpr (std::is_same_v<ArrowType, arrow::Int16Type>) {
+            return ColumnStats::CreateSmallIntColumnStats(min, max, null_count_);
+        } else if constexpr (std::is_same_v<ArrowType, arrow::Int32Type>) {
+            return ColumnStats::CreateIntColumnStats(min, max, null_count_);
+        } else if constexpr (std::is_same_v<ArrowType, arrow::Int64Type>) {
+            return ColumnStats::CreateBigIntColumnStats(min, max, null_count_);
+        } else if constexpr (std::is_same_v<ArrowType, arrow::FloatType>) {
+            return ColumnStats::CreateFloatColumnStats(min, max, null_count_);
+        } else if constexpr (std::is_same_v<ArrowType, arrow::DoubleType>) {
+            return ColumnStats::CreateDoubleColumnStats(min, max, null_count_);
+        } else if constexpr (std::is_same_v<ArrowType, arrow::Date32Type>) {
+            return ColumnStats::CreateDateColumnStats(min, max, null_count_);
+        } else {
+            static_assert(std::is_same_v<ArrowType, arrow::TimestampType>);
+            auto timestamp_type =
+                arrow::internal::checked_pointer_cast<arrow::TimestampType>(type_);
+            int32_t precision = DateTimeUtils::GetPrecisionFromType(timestamp_type);
+            if (!min || !max) {
+                return ColumnStats::CreateTimestampColumnStats(std::nullopt, std::nullopt,
+                                                               null_count_, precision);
+            }
+            auto src_time_type = DateTimeUtils::GetTimeTypeFromArrowType(timestamp_type);
+            auto [milli_min, nano_min] = DateTimeUtils::TimestampConverter(
+                min.value(), src_time_type, DateTimeUtils::TimeType::MILLISECOND,
+                DateTimeUtils::TimeType::NANOSECOND);
+            auto [milli_max, nano_max] = DateTimeUtils::TimestampConverter(
+                max.value(), src_time_type, DateTimeUtils::TimeType::MILLISECOND,
+                DateTimeUtils::TimeType::NANOSECOND);
+            return ColumnStats::CreateTimestampColumnStats(Timestamp(milli_min, nano_min),
+                                                           Timestamp(milli_max, nano_max),
+                                                           null_count_, precision);
+        }
+    }
+
+ private:
+    std::shared_ptr<arrow::DataType> type_;
+    CType min_ = InitialMin<CType>();
+    CType max_ = InitialMax<CType>();
+    int64_t null_count_ = 0;
+};
+
+class BooleanAccumulator : public ColumnStatsAccumulator {
+ public:
+    void Update(const arrow::Array& array) override {
+        const auto& typed_array = arrow::internal::checked_cast<const arrow::BooleanArray&>(array);
+        true_count_ += typed_array.true_count();
+        false_count_ += typed_array.false_count();
+        null_count_ += array.null_count();
+    }
+
+    std::unique_ptr<ColumnStats> ToColumnStats() const override {
+        std::optional<bool> min;
+        std::optional<bool> max;
+        if (true_count_ + false_count_ > 0) {
+            min = false_count_ == 0;
+            max = true_count_ > 0;
+        }
+        return ColumnStats::CreateBooleanColumnStats(min, max, null_count_);
+    }
+
+ private:
+    int64_t true_count_ = 0;
+    int64_t false_count_ = 0;
+    int64_t null_count_ = 0;
+};
+
+class DecimalAccumulator : public ColumnStatsAccumulator {
+ public:
+    explicit DecimalAccumulator(const std::shared_ptr<arrow::DataType>& type)
+        : type_(arrow::internal::checked_pointer_cast<arrow::Decimal128Type>(type)) {}
+
+    void Update(const arrow::Array& array) override {
+        const auto& typed_array =
+            arrow::internal::checked_cast<const arrow::Decimal128Array&>(array);
+        // decimal128 values are stored as little-endian 16 bytes, same as int128
+        const uint8_t* values = typed_array.raw_values();
+        VisitValidRuns(array, [&](int64_t position, int64_t length) {
+            for (int64_t i = position; i < position + length; ++i) {
+                Decimal::int128_t value;
+                std::memcpy(&value, values + i * sizeof(Decimal::int128_t), sizeof(value));
+                if (!has_value_) {
+                    min_ = value;
+                    max_ = value;
+                    has_value_ = true;
+                } else {
+                    min_ = value < min_ ? value : min_;
+                    max_ = max_ < value ? value : max_;
+                }
+            }
+        });
+        null_count_ += array.null_count();
+    }
+
+    std::unique_ptr<ColumnStats> ToColumnStats() const override {
+        int32_t precision = type_->precision();
+        int32_t scale = type_->scale();
+        std::optional<Decimal> min;
+        std::optional<Decimal> max;
+        if (has_value_) {
+            min = Decimal(precision, scale, min_);
+            max = Decimal(precision, scale, max_);
+        }
+        return ColumnStats::CreateDecimalColumnStats(min, max, null_count_, precision, scale);
+    }
+
+ private:
+    std::shared_ptr<arrow::Decimal128Type> type_;
+    bool has_value_ = false;
+    Decimal::int128_t min_ = 0;
+    Decimal::int128_t max_ = 0;
+    int64_t null_count_ = 0;
+};
+
+constexpr uint32_t MAX_CODE_POINT = 0x10FFFF;
+constexpr uint32_t MIN_SURROGATE = 0xD800;
+constexpr uint32_t MAX_SURROGATE = 0xDFFF;
+
+bool IsContinuationByte(char c) {
+    return (static_cast<uint8_t>(c) & 0xC0) == 0x80;
+}
+
+/// @return Byte length of the first `num_code_points` code points of an utf-8 string.
+size_t CodePointPrefixLength(std::string_view value, int32_t num_code_points) {
+    size_t pos = 0;
+    for (int32_t i = 0; i < num_code_points && pos < value.size(); ++i) {
+        ++pos;
+        while (pos < value.size() && IsContinuationByte(value[pos])) {
+            ++pos;
+        }
+    }
+    return pos;
+}
+
+std::optional<uint32_t> DecodeCodePoint(std::string_view bytes) {
+    auto lead = static_cast<uint8_t>(bytes[0]);
+    size_t length = 0;
+    uint32_t code_point = 0;
+    if (lead < 0x80) {
+        return lead;
+    } else if ((lead & 0xE0) == 0xC0) {
+        length = 2;
+        code_point = lead & 0x1F;
+    } else if ((lead & 0xF0) == 0xE0) {
+        length = 3;
+        code_point = lead & 0x0F;
+    } else if ((lead & 0xF8) == 0xF0) {
+        length = 4;
+        code_point = lead & 0x07;
+    } else {
+        return std::nullopt;
+    }
+    if (bytes.size() != length) {
+        return std::nullopt;
+    }
+    for (size_t i = 1; i < length; ++i) {
+        code_point = (code_point << 6) | (static_cast<uint8_t>(bytes[i]) & 0x3F);
+    }
+    return code_point;
+}
+
+void AppendCodePoint(uint32_t code_point, std::string* out) {
+    if (code_point < 0x80) {
+        out->push_back(static_cast<char>(code_point));
+    } else if (code_point < 0x800) {
+        out->push_back(static_cast<char>(0xC0 | (code_point >> 6)));
+        out->push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+    } else if (code_point < 0x10000) {
+        out->push_back(static_cast<char>(0xE0 | (code_point >> 12)));
+        out->push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+        out->push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+    } else {
+        out->push_back(static_cast<char>(0xF0 | (code_point >> 18)));
+        out->push_back(static_cast<char>(0x80 | ((code_point >> 12) & 0x3F)));
+        out->push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+        out->push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+    }
+}
+
+/// Truncates `value` to a lower bound of at most `num_code_points` code points.
+std::string TruncateLowerBound(std::string_view value, int32_t num_code_points) {
+    return std::string(value.substr(0, CodePointPrefixLength(value, num_code_points)));
+}
+
+/// Truncates `value` to an upper bound of at most `num_code_points` code points, by incrementing
+/// the last code point of the truncated prefix that can be incremented.
+///
+/// @return `std::nullopt` if no such code point exists or `value` is not valid utf-8.
+std::optional<std::string> TruncateUpperBound(std::string_view value, int32_t num_code_points) {
+    size_t prefix_length = CodePointPrefixLength(value, num_code_points);
+    if (prefix_length == value.size()) {
+        return std::string(value);
+    }
+    std::string result(value.substr(0, prefix_length));
+    while (!result.empty()) {
+        size_t start = result.size() - 1;
+        while (start > 0 && IsContinuationByte(result[start])) {
+            --start;
+        }
+        std::optional<uint32_t> code_point =
+            DecodeCodePoint(std::string_view(result).substr(start));
+        if (!code_point) {
+            return std::nullopt;
+        }
+        result.resize(start);
+        if (code_point.value() < MAX_CODE_POINT) {
+            uint32_t next_code_point = code_point.value() + 1;
+            if (next_code_point >= MIN_SURROGATE && next_code_point <= MAX_SURROGATE) {
+                next_code_point = MAX_SURROGATE + 1;
+            }
+            AppendCodePoint(next_code_point, &result);
+            return result;
+        }
+    }
+    return std::nullopt;
+}
+
+class StringAccumulator : public ColumnStatsAccumulator {
+ public:
+    explicit StringAccumulator(int32_t truncate_length) : truncate_length_(truncate_length) {}
+
+    void Update(const arrow::Array& array) override {
+        const auto& typed_array = arrow::internal::checked_cast<const arrow::StringArray&>(array);
+        // find bounds of the batch on views first, only copy them once per batch
+        std::optional<std::string_view> batch_min;
+        std::optional<std::string_view> batch_max;
+        VisitValidRuns(array, [&](int64_t position, int64_t length) {
+            for (int64_t i = position; i < position + length; ++i) {
+                std::string_view value = typed_array.GetView(i);
+                if (!batch_min || value < batch_min.value()) {
+                    batch_min = value;
+                }
+                if (!batch_max || batch_max.value() < value) {
+                    batch_max = value;
+                }
+            }
+        });
+        if (batch_min && (!min_ || batch_min.value() < min_.value())) {
+            min_ = std::string(batch_min.value());
+        }
+        if (batch_max && (!max_ || max_.value() < batch_max.value())) {
+            max_ = std::string(batch_max.value());
+        }
+        null_count_ += array.null_count();
+    }
+
+    std::unique_ptr<ColumnStats> ToColumnStats() const override {
+        std::optional<std::string> min;
+        std::optional<std::string> max;
+        if (min_ && max_) {
+            max = TruncateUpperBound(max_.value(), truncate_length_);
+            if (max) {
+                min = TruncateLowerBound(min_.value(), truncate_length_);
+            }
+        }
+        return ColumnStats::CreateStringColumnStats(min, max, null_count_);
+    }
+
+ private:
+    int32_t truncate_length_;
+    std::optional<std::string> min_;
+    std::optional<std::string> max_;
+    int64_t null_count_ = 0;
+};
+
+/// Accumulator of binary and nested fields, which only track null counts.
+class NullCountAccumulator : public ColumnStatsAccumulator {
+ public:
+    explicit NullCountAccumulator(FieldType field_type) : field_type_(field_type) {}
+
+    void Update(const arrow::Array& array) override {
+        null_count_ += array.null_count();
+    }
+
+    std::unique_ptr<ColumnStats> ToColumnStats() const override {
+        if (field_type_ == FieldType::BINARY) {
+            return ColumnStats::CreateStringColumnStats(std::nullopt, std::nullopt, null_count_);
+        }
+        return ColumnStats::CreateNestedColumnStats(field_type_, null_count_);
+    }
+
+ private:
+    FieldType field_type_;
+    int64_t null_count_ = 0;
+};
+
+Result<std::unique_ptr<ColumnStatsAccumulator>> CreateAccumulator(
+    const std::shared_ptr<arrow::DataType>& type, int32_t string_truncate_length) {
+    switch (type->id()) {
+        case arrow::Type::BOOL:
+            return std::make_unique<BooleanAccumulator>();
+        case arrow::Type::INT8:
+            return std::make_unique<NumericAccumulator<arrow::Int8Type>>(type);
+        case arrow::Type::INT16:
+            return std::make_unique<NumericAccumulator<arrow::Int16Type>>(type);
+        case arrow::Type::INT32:
+            return std::make_unique<NumericAccumulator<arrow::Int32Type>>(type);
+        case arrow::Type::INT64:
+            return std::make_unique<NumericAccumulator<arrow::Int64Type>>(type);
+        case arrow::Type::FLOAT:
+            return std::make_unique<NumericAccumulator<arrow::FloatType>>(type);
+        case arrow::Type::DOUBLE:
+            return std::make_unique<NumericAccumulator<arrow::DoubleType>>(type);
+        case arrow::Type::DATE32:
+            return std::make_unique<NumericAccumulator<arrow::Date32Type>>(type);
+        case arrow::Type::TIMESTAMP:
+            return std::make_unique<NumericAccumulator<arrow::TimestampType>>(type);
+        case arrow::Type::DECIMAL128:
+            return std::make_unique<DecimalAccumulator>(type);
+        case arrow::Type::STRING:
+            return std::make_unique<StringAccumulator>(string_truncate_length);
+        case arrow::Type::BINARY:
+            return std::make_unique<NullCountAccumulator>(FieldType::BINARY);
+        case arrow::Type::LIST:
+            return std::make_unique<NullCountAccumulator>(FieldType::ARRAY);
+        case arrow::Type::MAP:
+            return std::make_unique<NullCountAccumulator>(FieldType::MAP);
+        case arrow::Type::STRUCT:
+            return std::make_unique<NullCountAccumulator>(FieldType::STRUCT);
+        default:
+            return Status::NotImplemented(
+                fmt::format("Do not support collecting stats of arrow type {}", type->ToString()));
+    }
+}
+
+}  // namespace
+
+ColumnarStatsCollector::ColumnarStatsCollector(
+    const std::shared_ptr<arrow::Schema>& schema,
+    std::vector<std::unique_ptr<ColumnStatsAccumulator>>&& accumulators)
+    : schema_(schema), accumulators_(std::move(accumulators)) {}
+
+ColumnarStatsCollector::~ColumnarStatsCollector() = default;
+
+Result<std::unique_ptr<ColumnarStatsCollector>> ColumnarStatsCollector::Create(
+    const std::shared_ptr<arrow::Schema>& schema, int32_t string_truncate_length) {
+    if (string_truncate_length <= 0) {
+        return Status::Invalid(fmt::format("string truncate length must be positive, but is {}",
+                                           string_truncate_length));
+    }
+    std::vector<std::unique_ptr<ColumnStatsAccumulator>> accumulators;
+    accumulators.reserve(schema->num_fields());
+    for (const auto& field : schema->fields()) {
+        PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<ColumnStatsAccumulator> accumulator,
+                               CreateAccumulator(field->type(), string_truncate_length));
+        accumulators.push_back(std::move(accumulator));
+    }
+    return std::unique_ptr<ColumnarStatsCollector>(
+        new ColumnarStatsCollector(schema, std::move(accumulators)));
+}
+
+Status ColumnarStatsCollector::Collect(const arrow::Array& batch) {
+    if (batch.type_id() != arrow::Type::STRUCT) {
+        return Status::Invalid(fmt::format("batch to collect stats must be struct, but is {}",
+                                           batch.type()->ToString()));
+    }
+    const auto& struct_array = arrow::internal::checked_cast<const arrow::StructArray&>(batch);
+    if (struct_array.num_fields() != schema_->num_fields()) {
+        return Status::Invalid(
+            fmt::format("fields count {} in batch not equal to fields count {} in schema",
+                        struct_array.num_fields(), schema_->num_fields()));
+    }
+    for (int32_t i = 0; i < schema_->num_fields(); ++i) {
+        const std::shared_ptr<arrow::Array>& field_array = struct_array.field(i);
+        if (field_array->type_id() != schema_->field(i)->type()->id()) {
+            return Status::Invalid(
+                fmt::format("type {} of field {} in batch mismatches type {} in schema",
+                            field_array->type()->ToString(), schema_->field(i)->name(),
+                            schema_->field(i)->type()->ToString()));
+        }
+        accumulators_[i]->Update(*field_array);
+    }
+    return Status::OK();
+}
+
+Result<ColumnStatsVector> ColumnarStatsCollector::GetResult() const {
+    ColumnStatsVector stats;
+    stats.reserve(accumulators_.size());
+    for (const auto& accumulator : accumulators_) {
+        stats.push_back(accumulator->ToColumnStats());
+    }
+    return stats;
+}
+
+}  // namespace paimon
@@ -0,0 +1,74 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "paimon/result.h"
+#include "paimon/status.h"
+#include "paimon/type_fwd.h"
+
+namespace arrow {
+class Array;
+class Schema;
+}  // namespace arrow
+
+namespace paimon {
+
+class ColumnStatsAccumulator;
+
+/// Collects min/max/null count statistics of each field directly from arrow batches.
+///
+/// Unlike `SimpleStatsCollector`, which updates statistics one `BinaryRow` at a time, this
+/// collector scans every column of a batch with a tight typed loop over the value buffer, only
+/// consulting the validity bitmap run by run. It is meant for format writers whose files carry no
+/// statistics in their footers (e.g. avro), but works for any format.
+///
+/// Binary fields only track null counts, and nested fields (arrays, maps, structs) only track null
+/// counts of the top level, which is consistent with the statistics of orc and parquet files.
+class ColumnarStatsCollector {
+ public:
+    /// Max code points kept in string min/max by default, same as the default `truncate(16)`
+    /// statistics mode of paimon.
+    static constexpr int32_t DEFAULT_STRING_TRUNCATE_LENGTH = 16;
+
+    /// @param schema Schema of the batches to collect.
+    /// @param string_truncate_length Max code points kept in string min/max. Min is cut to a
+    ///        prefix and max is rounded up after being cut, so both remain valid bounds. If max can
+    ///        not be rounded up, min/max of the field are dropped.
+    static Result<std::unique_ptr<ColumnarStatsCollector>> Create(
+        const std::shared_ptr<arrow::Schema>& schema,
+        int32_t string_truncate_length = DEFAULT_STRING_TRUNCATE_LENGTH);
+
+    ~ColumnarStatsCollector();
+
+    /// Updates statistics with a struct array whose fields match the schema.
+    Status Collect(const arrow::Array& batch);
+
+    Result<ColumnStatsVector> GetResult() const;
+
+ private:
+    ColumnarStatsCollector(const std::shared_ptr<arrow::Schema>& schema,
+                           std::vector<std::unique_ptr<ColumnStatsAccumulator>>&& accumulators);
+
+    std::shared_ptr<arrow::Schema> schema_;
+    std::vector<std::unique_ptr<ColumnStatsAccumulator>> accumulators_;
+};
+
+}  // namespace paimon
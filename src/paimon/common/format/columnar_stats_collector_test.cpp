@@ -0,0 +1,199 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/common/format/columnar_stats_collector.h"
+
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/api.h"
+#include "arrow/ipc/json_simple.h"
+#include "gtest/gtest.h"
+#include "paimon/data/decimal.h"
+#include "paimon/data/timestamp.h"
+#include "paimon/format/column_stats.h"
+#include "paimon/testing/utils/testharness.h"
+
+namespace paimon::test {
+
+class ColumnarStatsCollectorTest : public testing::Test {
+ public:
+    static std::shared_ptr<arrow::Array> MakeBatch(const std::shared_ptr<arrow::Schema>& schema,
+                                                   const std::string& json) {
+        auto array = arrow::ipc::internal::json::ArrayFromJSON(arrow::struct_(schema->fields()),
+                                                               json)
+                         .ValueOr(nullptr);
+        EXPECT_TRUE(array);
+        return array;
+    }
+};
+
+TEST_F(ColumnarStatsCollectorTest, TestPrimitiveTypes) {
+    auto schema = arrow::schema({arrow::field("f0", arrow::boolean()),
+                                 arrow::field("f1", arrow::int8()),
+                                 arrow::field("f2", arrow::int16()),
+                                 arrow::field("f3", arrow::int32()),
+                                 arrow::field("f4", arrow::int64()),
+                                 arrow::field("f5", arrow::float32()),
+                                 arrow::field("f6", arrow::float64()),
+                                 arrow::field("f7", arrow::date32()),
+                                 arrow::field("f8", arrow::int32())});
+    ASSERT_OK_AND_ASSIGN(auto collector, ColumnarStatsCollector::Create(schema));
+    ASSERT_OK(collector->Collect(*MakeBatch(schema, R"([
+        [true, 1, 300, 7, 10, 1.5, 2.5, 100, null],
+        [null, -3, null, 9, -20, null, -0.5, null, null],
+        [true, 2, -300, null, 30, 0.5, 1.0, 50, null]
+    ])")));
+    ASSERT_OK(collector->Collect(*MakeBatch(schema, R"([
+        [true, null, 5, -1, 5, 3.5, null, 200, null]
+    ])")));
+    ASSERT_OK_AND_ASSIGN(ColumnStatsVector stats, collector->GetResult());
+    ASSERT_EQ(9, stats.size());
+    ASSERT_EQ("min true, max true, null count 1", stats[0]->ToString());
+    ASSERT_EQ("min -3, max 2, null count 1", stats[1]->ToString());
+    ASSERT_EQ("min -300, max 300, null count 1", stats[2]->ToString());
+    ASSERT_EQ("min -1, max 9, null count 1", stats[3]->ToString());
+    ASSERT_EQ("min -20, max 30, null count 0", stats[4]->ToString());
+    ASSERT_EQ("min 0.5, max 3.5, null count 1", stats[5]->ToString());
+    ASSERT_EQ("min -0.5, max 2.5, null count 1", stats[6]->ToString());
+    ASSERT_EQ("min 50, max 200, null count 1", stats[7]->ToString());
+    ASSERT_EQ("min null, max null, null count 4", stats[8]->ToString());
+    ASSERT_EQ(FieldType::DATE, stats[7]->GetFieldType());
+}
+
+TEST_F(ColumnarStatsCollectorTest, TestSlicedBatch) {
+    auto schema = arrow::schema({arrow::field("f0", arrow::int32()),
+                                 arrow::field("f1", arrow::boolean())});
+    ASSERT_OK_AND_ASSIGN(auto collector, ColumnarStatsCollector::Create(schema));
+    auto batch = MakeBatch(schema, R"([
+        [-100, false], [1, true], [null, null], [3, true], [null, true], [5, true], [100, false]
+    ])");
+    ASSERT_OK(collector->Collect(*batch->Slice(1, 5)));
+    ASSERT_OK_AND_ASSIGN(ColumnStatsVector stats, collector->GetResult());
+    ASSERT_EQ("min 1, max 5, null count 2", stats[0]->ToString());
+    ASSERT_EQ("min true, max true, null count 1", stats[1]->ToString());
+}
+
+TEST_F(ColumnarStatsCollectorTest, TestFloatingPointNaN) {
+    auto schema = arrow::schema({arrow::field("f0", arrow::float64()),
+                                 arrow::field("f1", arrow::float32())});
+    ASSERT_OK_AND_ASSIGN(auto collector, ColumnarStatsCollector::Create(schema));
+    ASSERT_OK(collector->Collect(*MakeBatch(schema, R"([
+        [NaN, NaN], [2.0, NaN], [-1.0, null], [Inf, NaN]
+    ])")));
+    ASSERT_OK_AND_ASSIGN(ColumnStatsVector stats, collector->GetResult());
+    auto double_stats = dynamic_cast<DoubleColumnStats*>(stats[0].get());
+    ASSERT_TRUE(double_stats);
+    ASSERT_EQ(-1.0, double_stats->Min().value());
+    ASSERT_EQ(std::numeric_limits<double>::infinity(), double_stats->Max().value());
+    ASSERT_EQ("min null, max null, null count 1", stats[1]->ToString());
+}
+
+TEST_F(ColumnarStatsCollectorTest, TestStringTruncation) {
+    auto schema = arrow::schema({arrow::field("f0", arrow::utf8()),
+                                 arrow::field("f1", arrow::utf8()),
+                                 arrow::field("f2", arrow::utf8()),
+                                 arrow::field("f3", arrow::utf8()),
+                                 arrow::field("f4", arrow::binary())});
+    ASSERT_OK_AND_ASSIGN(auto collector,
+                         ColumnarStatsCollector::Create(schema, /*string_truncate_length=*/3));
+    ASSERT_OK(collector->Collect(*MakeBatch(schema, R"([
+        ["abcdef", "ab", "你好世界", "a\uDBFF\uDFFF\uDBFF\uDFFFz", "abc"],
+        ["abc", null, "你好", "a\uDBFF\uDFFF", null]
+    ])")));
+    ASSERT_OK(collector->Collect(*MakeBatch(schema, R"([
+        ["abzz", "abcdef", null, null, "xyz"]
+    ])")));
+    ASSERT_OK_AND_ASSIGN(ColumnStatsVector stats, collector->GetResult());
+    // max "abzz" is cut to "abz" and rounded up
+    ASSERT_EQ("min abc, max ab{, null count 0", stats[0]->ToString());
+    ASSERT_EQ("min ab, max abd, null count 1", stats[1]->ToString());
+    ASSERT_EQ("min 你好, max 你好丗, null count 1", stats[2]->ToString());
+    // U+10FFFF can not be incremented, so the code point before it is rounded up instead
+    ASSERT_EQ("min a\xF4\x8F\xBF\xBF, max b, null count 1", stats[3]->ToString());
+    ASSERT_EQ("min null, max null, null count 1", stats[4]->ToString());
+}
+
+TEST_F(ColumnarStatsCollectorTest, TestStringBoundCannotBeRoundedUp) {
+    auto schema = arrow::schema({arrow::field("f0", arrow::utf8())});
+    ASSERT_OK_AND_ASSIGN(auto collector,
+                         ColumnarStatsCollector::Create(schema, /*string_truncate_length=*/1));
+    ASSERT_OK(collector->Collect(*MakeBatch(schema, R"([["\uDBFF\uDFFF\uDBFF\uDFFF"], [null]])")));
+    ASSERT_OK_AND_ASSIGN(ColumnStatsVector stats, collector->GetResult());
+    ASSERT_EQ("min null, max null, null count 1", stats[0]->ToString());
+}
+
+TEST_F(ColumnarStatsCollectorTest, TestTimestampDecimalAndNestedTypes) {
+    auto schema = arrow::schema(
+        {arrow::field("f0", arrow::timestamp(arrow::TimeUnit::NANO)),
+         arrow::field("f1", arrow::timestamp(arrow::TimeUnit::SECOND)),
+         arrow::field("f2", arrow::decimal128(10, 2)),
+         arrow::field("f3", arrow::list(arrow::int32())),
+         arrow::field("f4", arrow::struct_({arrow::field("sub", arrow::int32())}))});
+    ASSERT_OK_AND_ASSIGN(auto collector, ColumnarStatsCollector::Create(schema));
+    ASSERT_OK(collector->Collect(*MakeBatch(schema, R"([
+        [1000000001, 10, "-12.34", [1, 2], {"sub": 1}],
+        [null, 5, "123.45", null, null],
+        [2000000002, null, null, [], {"sub": null}]
+    ])")));
+    ASSERT_OK_AND_ASSIGN(ColumnStatsVector stats, collector->GetResult());
+
+    auto nano_stats = dynamic_cast<TimestampColumnStats*>(stats[0].get());
+    ASSERT_TRUE(nano_stats);
+    ASSERT_EQ(Timestamp(1000, 1), nano_stats->Min().value());
+    ASSERT_EQ(Timestamp(2000, 2), nano_stats->Max().value());
+    ASSERT_EQ(1, nano_stats->NullCount().value());
+    ASSERT_EQ(9, nano_stats->GetPrecision());
+
+    auto second_stats = dynamic_cast<TimestampColumnStats*>(stats[1].get());
+    ASSERT_TRUE(second_stats);
+    ASSERT_EQ(Timestamp(5000, 0), second_stats->Min().value());
+    ASSERT_EQ(Timestamp(10000, 0), second_stats->Max().value());
+    ASSERT_EQ(0, second_stats->GetPrecision());
+
+    auto decimal_stats = dynamic_cast<DecimalColumnStats*>(stats[2].get());
+    ASSERT_TRUE(decimal_stats);
+    ASSERT_EQ(Decimal(10, 2, -1234), decimal_stats->Min().value());
+    ASSERT_EQ(Decimal(10, 2, 12345), decimal_stats->Max().value());
+    ASSERT_EQ(1, decimal_stats->NullCount().value());
+
+    ASSERT_EQ(FieldType::ARRAY, stats[3]->GetFieldType());
+    ASSERT_EQ(1, stats[3]->NullCount().value());
+    ASSERT_EQ(FieldType::STRUCT, stats[4]->GetFieldType());
+    ASSERT_EQ(1, stats[4]->NullCount().value());
+}
+
+TEST_F(ColumnarStatsCollectorTest, TestInvalidInput) {
+    ASSERT_NOK_WITH_MSG(
+        ColumnarStatsCollector::Create(arrow::schema({arrow::field("f0", arrow::float16())})),
+        "Do not support collecting stats of arrow type halffloat");
+    auto schema = arrow::schema({arrow::field("f0", arrow::int32())});
+    ASSERT_NOK_WITH_MSG(ColumnarStatsCollector::Create(schema, /*string_truncate_length=*/0),
+                        "string truncate length must be positive");
+
+    ASSERT_OK_AND_ASSIGN(auto collector, ColumnarStatsCollector::Create(schema));
+    auto int_array = arrow::ipc::internal::json::ArrayFromJSON(arrow::int32(), "[1, 2]")
+                         .ValueOr(nullptr);
+    ASSERT_TRUE(int_array);
+    ASSERT_NOK_WITH_MSG(collector->Collect(*int_array), "batch to collect stats must be struct");
+    auto other_schema = arrow::schema({arrow::field("f0", arrow::int64())});
+    ASSERT_NOK_WITH_MSG(collector->Collect(*MakeBatch(other_schema, "[[1]]")),
+                        "type int64 of field f0 in batch mismatches type int32 in schema");
+}
+
+}  // namespace paimon::test
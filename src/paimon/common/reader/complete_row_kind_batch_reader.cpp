@@ -60,7 +60,7 @@ Result<BatchReader::ReadBatchWithBitmap> CompleteRowKindBatchReader::NextBatchWi
             arrow::ExportArray(*struct_array, c_array.get(), c_schema.get()));
         return batch_with_bitmap;
     }
-    // create value kind array, all are insert
+    // create value kind array, all are `row_kind_`
     PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<arrow::Array> row_kind_array,
                            PrepareRowKindArray(struct_array->length()));
     // complete row kind
@@ -80,7 +80,7 @@ Result<std::shared_ptr<arrow::Array>> CompleteRowKindBatchReader::PrepareRowKind
     int32_t struct_array_length) {
     if (!row_kind_array_ || row_kind_array_->length() < struct_array_length) {
         auto row_kind_scalar =
-            std::make_shared<arrow::Int8Scalar>(RowKind::Insert()->ToByteValue());
+            std::make_shared<arrow::Int8Scalar>(row_kind_->ToByteValue());
         PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(
             row_kind_array_,
             arrow::MakeArrayFromScalar(*row_kind_scalar, struct_array_length, arrow_pool_.get()));
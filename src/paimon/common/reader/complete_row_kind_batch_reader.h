@@ -24,6 +24,7 @@
 
 #include "arrow/api.h"
 #include "arrow/array/array_base.h"
+#include "paimon/common/types/row_kind.h"
 #include "paimon/common/utils/arrow/mem_utils.h"
 #include "paimon/reader/batch_reader.h"
 #include "paimon/result.h"
@@ -36,11 +37,13 @@ namespace paimon {
 class MemoryPool;
 class Metrics;
 
+/// Completes the value kind field of batches without one, all rows get `row_kind`.
 class CompleteRowKindBatchReader : public BatchReader {
  public:
     CompleteRowKindBatchReader(std::unique_ptr<BatchReader>&& reader,
-                               const std::shared_ptr<MemoryPool>& pool)
-        : arrow_pool_(GetArrowPool(pool)), reader_(std::move(reader)) {}
+                               const std::shared_ptr<MemoryPool>& pool,
+                               const RowKind* row_kind = RowKind::Insert())
+        : arrow_pool_(GetArrowPool(pool)), reader_(std::move(reader)), row_kind_(row_kind) {}
 
     Result<ReadBatch> NextBatch() override;
 
@@ -64,6 +67,7 @@ class CompleteRowKindBatchReader : public BatchReader {
  private:
     std::unique_ptr<arrow::MemoryPool> arrow_pool_;
     std::unique_ptr<BatchReader> reader_;
+    const RowKind* row_kind_;
     std::shared_ptr<arrow::Array> row_kind_array_;
     std::vector<std::string> field_names_with_row_kind_;
 };
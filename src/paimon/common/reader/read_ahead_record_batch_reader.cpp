@@ -0,0 +1,167 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/common/reader/read_ahead_record_batch_reader.h"
+
+#include <utility>
+
+#include "arrow/c/abi.h"
+#include "arrow/c/bridge.h"
+#include "arrow/type.h"
+#include "arrow/util/byte_size.h"
+#include "fmt/format.h"
+#include "paimon/common/utils/arrow/status_utils.h"
+
+namespace paimon {
+
+Result<std::shared_ptr<ReadAheadRecordBatchReader>> ReadAheadRecordBatchReader::Create(
+    std::unique_ptr<BatchReader>&& reader, const std::shared_ptr<arrow::Schema>& fallback_schema,
+    uint32_t max_read_ahead_batches, uint64_t max_read_ahead_bytes) {
+    if (reader == nullptr) {
+        return Status::Invalid("batch reader is null pointer");
+    }
+    if (max_read_ahead_batches == 0 || max_read_ahead_bytes == 0) {
+        return Status::Invalid(
+            fmt::format("read-ahead limits must be positive, max batches {}, max bytes {}",
+                        max_read_ahead_batches, max_read_ahead_bytes));
+    }
+    std::shared_ptr<ReadAheadRecordBatchReader> read_ahead_reader(new ReadAheadRecordBatchReader(
+        std::move(reader), fallback_schema, max_read_ahead_batches, max_read_ahead_bytes));
+    read_ahead_reader->background_thread_ = std::make_unique<std::thread>(
+        &ReadAheadRecordBatchReader::Workloop, read_ahead_reader.get());
+    return read_ahead_reader;
+}
+
+ReadAheadRecordBatchReader::ReadAheadRecordBatchReader(
+    std::unique_ptr<BatchReader>&& reader, const std::shared_ptr<arrow::Schema>& fallback_schema,
+    uint32_t max_read_ahead_batches, uint64_t max_read_ahead_bytes)
+    : reader_(std::move(reader)),
+      fallback_schema_(fallback_schema),
+      max_read_ahead_batches_(max_read_ahead_batches),
+      max_read_ahead_bytes_(max_read_ahead_bytes) {}
+
+ReadAheadRecordBatchReader::~ReadAheadRecordBatchReader() {
+    [[maybe_unused]] auto status = Close();
+}
+
+std::shared_ptr<arrow::Schema> ReadAheadRecordBatchReader::schema() const {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this] { return schema_ != nullptr || finished_ || closed_; });
+    if (schema_) {
+        return schema_;
+    }
+    return fallback_schema_ ? fallback_schema_ : arrow::schema(arrow::FieldVector());
+}
+
+arrow::Status ReadAheadRecordBatchReader::ReadNext(std::shared_ptr<arrow::RecordBatch>* batch) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this] { return !buffer_.empty() || finished_ || closed_; });
+    if (closed_) {
+        return arrow::Status::Invalid("read next batch on a closed ReadAheadRecordBatchReader");
+    }
+    if (buffer_.empty()) {
+        // batches read before a failure are still returned, the error is reported afterwards
+        *batch = nullptr;
+        return ToArrowStatus(read_status_);
+    }
+    BufferedBatch buffered = std::move(buffer_.front());
+    buffer_.pop_front();
+    buffered_bytes_ -= buffered.bytes;
+    *batch = std::move(buffered.batch);
+    cv_.notify_all();
+    return arrow::Status::OK();
+}
+
+arrow::Status ReadAheadRecordBatchReader::Close() {
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (closed_) {
+            return arrow::Status::OK();
+        }
+        closed_ = true;
+        buffer_.clear();
+        buffered_bytes_ = 0;
+    }
+    cv_.notify_all();
+    if (background_thread_ && background_thread_->joinable()) {
+        background_thread_->join();
+    }
+    reader_->Close();
+    return arrow::Status::OK();
+}
+
+bool ReadAheadRecordBatchReader::HasCapacity() const {
+    if (buffer_.empty()) {
+        return true;
+    }
+    return buffer_.size() < max_read_ahead_batches_ && buffered_bytes_ < max_read_ahead_bytes_;
+}
+
+Result<std::shared_ptr<arrow::RecordBatch>> ReadAheadRecordBatchReader::ReadBatch() {
+    while (true) {
+        PAIMON_ASSIGN_OR_RAISE(BatchReader::ReadBatch read_batch, reader_->NextBatch());
+        if (BatchReader::IsEofBatch(read_batch)) {
+            return std::shared_ptr<arrow::RecordBatch>();
+        }
+        auto& [c_array, c_schema] = read_batch;
+        PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(std::shared_ptr<arrow::RecordBatch> batch,
+                                          arrow::ImportRecordBatch(c_array.get(), c_schema.get()));
+        if (batch->num_rows() > 0) {
+            return batch;
+        }
+    }
+}
+
+void ReadAheadRecordBatchReader::Workloop() {
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [this] { return closed_ || HasCapacity(); });
+            if (closed_) {
+                return;
+            }
+        }
+        Result<std::shared_ptr<arrow::RecordBatch>> result = ReadBatch();
+        bool finished = false;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            if (closed_) {
+                return;
+            }
+            if (!result.ok()) {
+                read_status_ = result.status();
+                finished = true;
+            } else if (result.value() == nullptr) {
+                finished = true;
+            } else {
+                std::shared_ptr<arrow::RecordBatch> batch = std::move(result).value();
+                if (schema_ == nullptr) {
+                    schema_ = batch->schema();
+                }
+                auto bytes = static_cast<uint64_t>(arrow::util::TotalBufferSize(*batch));
+                buffered_bytes_ += bytes;
+                buffer_.push_back({std::move(batch), bytes});
+            }
+            finished_ = finished;
+        }
+        cv_.notify_all();
+        if (finished) {
+            return;
+        }
+    }
+}
+
+}  // namespace paimon
@@ -0,0 +1,95 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "arrow/record_batch.h"
+#include "arrow/status.h"
+#include "paimon/reader/batch_reader.h"
+#include "paimon/result.h"
+#include "paimon/status.h"
+
+namespace arrow {
+class Schema;
+}  // namespace arrow
+
+namespace paimon {
+
+/// An `arrow::RecordBatchReader` on top of a `BatchReader`, which reads ahead in a background
+/// thread. The read-ahead buffer is bounded by both a number of batches and a number of bytes, so a
+/// slow consumer applies back-pressure to the underlying reader instead of letting it buffer the
+/// whole split in memory.
+class ReadAheadRecordBatchReader : public arrow::RecordBatchReader {
+ public:
+    /// @param reader The reader to pull batches from, owned by the created instance.
+    /// @param fallback_schema Schema reported when the reader returns no batch at all.
+    /// @param max_read_ahead_batches Maximum number of batches buffered ahead, must be positive.
+    /// @param max_read_ahead_bytes Maximum number of buffer bytes buffered ahead. A batch is always
+    /// read when the buffer is empty, so a single batch larger than this limit is still returned.
+    static Result<std::shared_ptr<ReadAheadRecordBatchReader>> Create(
+        std::unique_ptr<BatchReader>&& reader,
+        const std::shared_ptr<arrow::Schema>& fallback_schema, uint32_t max_read_ahead_batches,
+        uint64_t max_read_ahead_bytes);
+
+    ~ReadAheadRecordBatchReader() override;
+
+    /// Returns the schema of the stream, blocks until the first batch is read if necessary.
+    std::shared_ptr<arrow::Schema> schema() const override;
+
+    arrow::Status ReadNext(std::shared_ptr<arrow::RecordBatch>* batch) override;
+
+    arrow::Status Close() override;
+
+ private:
+    ReadAheadRecordBatchReader(std::unique_ptr<BatchReader>&& reader,
+                               const std::shared_ptr<arrow::Schema>& fallback_schema,
+                               uint32_t max_read_ahead_batches, uint64_t max_read_ahead_bytes);
+
+    void Workloop();
+    Result<std::shared_ptr<arrow::RecordBatch>> ReadBatch();
+    bool HasCapacity() const;
+
+ private:
+    struct BufferedBatch {
+        std::shared_ptr<arrow::RecordBatch> batch;
+        uint64_t bytes;
+    };
+
+    std::unique_ptr<BatchReader> reader_;
+    const std::shared_ptr<arrow::Schema> fallback_schema_;
+    const uint32_t max_read_ahead_batches_;
+    const uint64_t max_read_ahead_bytes_;
+
+    mutable std::mutex mutex_;
+    mutable std::condition_variable cv_;
+    std::deque<BufferedBatch> buffer_;
+    uint64_t buffered_bytes_ = 0;
+    std::shared_ptr<arrow::Schema> schema_;
+    // set by the background thread when the reader meets eof or an error
+    bool finished_ = false;
+    bool closed_ = false;
+    Status read_status_;
+    std::unique_ptr<std::thread> background_thread_;
+};
+
+}  // namespace paimon
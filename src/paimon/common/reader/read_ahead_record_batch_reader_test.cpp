@@ -0,0 +1,183 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/common/reader/read_ahead_record_batch_reader.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "arrow/api.h"
+#include "arrow/c/abi.h"
+#include "arrow/c/bridge.h"
+#include "arrow/ipc/json_simple.h"
+#include "gtest/gtest.h"
+#include "paimon/status.h"
+#include "paimon/testing/mock/mock_file_batch_reader.h"
+#include "paimon/testing/utils/testharness.h"
+
+namespace paimon::test {
+namespace {
+// counts the batches pulled from the inner reader
+class CountingBatchReader : public BatchReader {
+ public:
+    CountingBatchReader(std::unique_ptr<BatchReader>&& reader, std::atomic<int32_t>* count)
+        : reader_(std::move(reader)), count_(count) {}
+
+    Result<ReadBatch> NextBatch() override {
+        (*count_)++;
+        return reader_->NextBatch();
+    }
+    std::shared_ptr<Metrics> GetReaderMetrics() const override {
+        return reader_->GetReaderMetrics();
+    }
+    void Close() override {
+        reader_->Close();
+    }
+
+ private:
+    std::unique_ptr<BatchReader> reader_;
+    std::atomic<int32_t>* count_;
+};
+}  // namespace
+
+class ReadAheadRecordBatchReaderTest : public ::testing::Test {
+ public:
+    void SetUp() override {
+        type_ = arrow::struct_({arrow::field("f0", arrow::int32())});
+        data_ = arrow::ipc::internal::json::ArrayFromJSON(
+                    type_, R"([[1], [2], [3], [4], [5], [6], [7], [8], [9], [10]])")
+                    .ValueOrDie();
+    }
+
+    std::unique_ptr<MockFileBatchReader> CreateMockReader(int32_t batch_size) const {
+        auto reader = std::make_unique<MockFileBatchReader>(data_, type_, batch_size);
+        reader->EnableRandomizeBatchSize(false);
+        return reader;
+    }
+
+    std::shared_ptr<arrow::Array> CollectResult(arrow::RecordBatchReader* reader) const {
+        arrow::ArrayVector arrays;
+        while (true) {
+            std::shared_ptr<arrow::RecordBatch> batch;
+            EXPECT_TRUE(reader->ReadNext(&batch).ok());
+            if (!batch) {
+                break;
+            }
+            arrays.push_back(batch->ToStructArray().ValueOrDie());
+        }
+        return arrow::Concatenate(arrays).ValueOrDie();
+    }
+
+ protected:
+    std::shared_ptr<arrow::DataType> type_;
+    std::shared_ptr<arrow::Array> data_;
+};
+
+TEST_F(ReadAheadRecordBatchReaderTest, TestReadAll) {
+    for (uint32_t max_batches : {1u, 2u, 100u}) {
+        for (uint64_t max_bytes : {1ul, 1024ul * 1024ul}) {
+            ASSERT_OK_AND_ASSIGN(
+                auto reader,
+                ReadAheadRecordBatchReader::Create(CreateMockReader(/*batch_size=*/3),
+                                                   /*fallback_schema=*/nullptr, max_batches,
+                                                   max_bytes));
+            ASSERT_TRUE(reader->schema()->Equals(arrow::schema(type_->fields())));
+            auto result = CollectResult(reader.get());
+            ASSERT_TRUE(result->Equals(data_)) << result->ToString();
+            ASSERT_TRUE(reader->Close().ok());
+        }
+    }
+}
+
+TEST_F(ReadAheadRecordBatchReaderTest, TestReadAheadIsBounded) {
+    std::atomic<int32_t> count = 0;
+    auto counting_reader =
+        std::make_unique<CountingBatchReader>(CreateMockReader(/*batch_size=*/1), &count);
+    ASSERT_OK_AND_ASSIGN(auto reader, ReadAheadRecordBatchReader::Create(
+                                          std::move(counting_reader), /*fallback_schema=*/nullptr,
+                                          /*max_read_ahead_batches=*/2,
+                                          /*max_read_ahead_bytes=*/1024 * 1024));
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    ASSERT_EQ(2, count.load());
+
+    std::shared_ptr<arrow::RecordBatch> batch;
+    ASSERT_TRUE(reader->ReadNext(&batch).ok());
+    ASSERT_EQ(1, batch->num_rows());
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    ASSERT_EQ(3, count.load());
+
+    // close stops reading ahead even if batches are not consumed
+    ASSERT_TRUE(reader->Close().ok());
+    ASSERT_EQ(3, count.load());
+    ASSERT_FALSE(reader->ReadNext(&batch).ok());
+}
+
+TEST_F(ReadAheadRecordBatchReaderTest, TestEmptyReader) {
+    auto fallback_schema = arrow::schema({arrow::field("f0", arrow::int32())});
+    auto empty_data = arrow::ipc::internal::json::ArrayFromJSON(type_, "[]").ValueOrDie();
+    ASSERT_OK_AND_ASSIGN(auto reader,
+                         ReadAheadRecordBatchReader::Create(
+                             std::make_unique<MockFileBatchReader>(empty_data, type_, 1),
+                             fallback_schema, /*max_read_ahead_batches=*/1,
+                             /*max_read_ahead_bytes=*/1));
+    ASSERT_EQ(fallback_schema, reader->schema());
+    std::shared_ptr<arrow::RecordBatch> batch;
+    ASSERT_TRUE(reader->ReadNext(&batch).ok());
+    ASSERT_FALSE(batch);
+}
+
+TEST_F(ReadAheadRecordBatchReaderTest, TestReadWithError) {
+    auto mock_reader = CreateMockReader(/*batch_size=*/3);
+    mock_reader->SetNextBatchStatus(Status::IOError("mock error"));
+    ASSERT_OK_AND_ASSIGN(auto reader, ReadAheadRecordBatchReader::Create(
+                                          std::move(mock_reader), /*fallback_schema=*/nullptr,
+                                          /*max_read_ahead_batches=*/1,
+                                          /*max_read_ahead_bytes=*/1));
+    std::shared_ptr<arrow::RecordBatch> batch;
+    auto status = reader->ReadNext(&batch);
+    ASSERT_TRUE(status.IsIOError());
+    ASSERT_TRUE(status.message().find("mock error") != std::string::npos);
+}
+
+TEST_F(ReadAheadRecordBatchReaderTest, TestExportToArrowArrayStream) {
+    ASSERT_OK_AND_ASSIGN(auto reader, ReadAheadRecordBatchReader::Create(
+                                          CreateMockReader(/*batch_size=*/4),
+                                          /*fallback_schema=*/nullptr,
+                                          /*max_read_ahead_batches=*/2,
+                                          /*max_read_ahead_bytes=*/1024));
+    ArrowArrayStream stream;
+    ASSERT_TRUE(arrow::ExportRecordBatchReader(reader, &stream).ok());
+    reader.reset();
+    auto imported = arrow::ImportRecordBatchReader(&stream).ValueOrDie();
+    auto result = CollectResult(imported.get());
+    ASSERT_TRUE(result->Equals(data_)) << result->ToString();
+}
+
+TEST_F(ReadAheadRecordBatchReaderTest, TestInvalidLimits) {
+    ASSERT_NOK_WITH_MSG(ReadAheadRecordBatchReader::Create(CreateMockReader(1), nullptr,
+                                                           /*max_read_ahead_batches=*/0,
+                                                           /*max_read_ahead_bytes=*/1),
+                        "read-ahead limits must be positive");
+    ASSERT_NOK_WITH_MSG(ReadAheadRecordBatchReader::Create(CreateMockReader(1), nullptr,
+                                                           /*max_read_ahead_batches=*/1,
+                                                           /*max_read_ahead_bytes=*/0),
+                        "read-ahead limits must be positive");
+}
+
+}  // namespace paimon::test
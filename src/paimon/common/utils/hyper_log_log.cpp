@@ -0,0 +1,98 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/common/utils/hyper_log_log.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <utility>
+
+#include "fmt/format.h"
+
+namespace paimon {
+
+HyperLogLog::HyperLogLog(int32_t precision)
+    : precision_(std::clamp(precision, MIN_PRECISION, MAX_PRECISION)),
+      registers_(static_cast<size_t>(1) << precision_, 0) {}
+
+Result<HyperLogLog> HyperLogLog::FromRegisters(int32_t precision,
+                                               std::vector<uint8_t>&& registers) {
+    if (precision < MIN_PRECISION || precision > MAX_PRECISION) {
+        return Status::Invalid(fmt::format("invalid precision {} of hyper log log", precision));
+    }
+    if (registers.size() != (static_cast<size_t>(1) << precision)) {
+        return Status::Invalid(
+            fmt::format("hyper log log with precision {} expects {} registers, got {}", precision,
+                        static_cast<size_t>(1) << precision, registers.size()));
+    }
+    HyperLogLog sketch(precision);
+    sketch.registers_ = std::move(registers);
+    return sketch;
+}
+
+void HyperLogLog::AddHash(uint64_t hash) {
+    uint64_t index = hash >> (64 - precision_);
+    // set a sentinel bit so that the rank is bounded by the remaining bits
+    uint64_t remaining = (hash << precision_) | (static_cast<uint64_t>(1) << (precision_ - 1));
+    auto rank = static_cast<uint8_t>(__builtin_clzll(remaining) + 1);
+    uint8_t& reg = registers_[index];
+    if (rank > reg) {
+        reg = rank;
+    }
+}
+
+Status HyperLogLog::Merge(const HyperLogLog& other) {
+    if (precision_ != other.precision_) {
+        return Status::Invalid(fmt::format("cannot merge hyper log log of precision {} into {}",
+                                           other.precision_, precision_));
+    }
+    for (size_t i = 0; i < registers_.size(); ++i) {
+        registers_[i] = std::max(registers_[i], other.registers_[i]);
+    }
+    return Status::OK();
+}
+
+int64_t HyperLogLog::Estimate() const {
+    auto m = static_cast<double>(registers_.size());
+    double sum = 0.0;
+    int64_t zeros = 0;
+    for (uint8_t reg : registers_) {
+        sum += std::ldexp(1.0, -static_cast<int32_t>(reg));
+        if (reg == 0) {
+            ++zeros;
+        }
+    }
+    double alpha;
+    if (registers_.size() == 16) {
+        alpha = 0.673;
+    } else if (registers_.size() == 32) {
+        alpha = 0.697;
+    } else if (registers_.size() == 64) {
+        alpha = 0.709;
+    } else {
+        alpha = 0.7213 / (1.0 + 1.079 / m);
+    }
+    double estimate = alpha * m * m / sum;
+    if (estimate <= 2.5 * m && zeros > 0) {
+        // linear counting is more accurate for small cardinalities
+        estimate = m * std::log(m / static_cast<double>(zeros));
+    }
+    // 64 bit hashes make the large range correction of 32 bit hashes unnecessary
+    return static_cast<int64_t>(std::llround(estimate));
+}
+
+}  // namespace paimon
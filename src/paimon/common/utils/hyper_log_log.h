@@ -0,0 +1,67 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "paimon/result.h"
+#include "paimon/status.h"
+
+namespace paimon {
+
+/// HyperLogLog sketch estimating the number of distinct values from their 64 bit hashes.
+///
+/// The sketch keeps `2^precision` one byte registers, each remembering the longest run of
+/// leading zeros seen among the hashes routed to it. Two sketches of the same precision can be
+/// merged losslessly by taking the register-wise maximum, so sketches of data files can be
+/// combined into a sketch of the whole table. The relative standard error of the estimate is about
+/// `1.04 / sqrt(2^precision)`, e.g. 1.6% for the default precision.
+class HyperLogLog {
+ public:
+    static constexpr int32_t MIN_PRECISION = 4;
+    static constexpr int32_t MAX_PRECISION = 18;
+    static constexpr int32_t DEFAULT_PRECISION = 12;
+
+    explicit HyperLogLog(int32_t precision = DEFAULT_PRECISION);
+
+    /// Restore a sketch from its registers, e.g. after deserialization.
+    static Result<HyperLogLog> FromRegisters(int32_t precision, std::vector<uint8_t>&& registers);
+
+    /// Add a value by its hash. The hash should be well distributed over all 64 bits.
+    void AddHash(uint64_t hash);
+
+    /// Merge `other` into this sketch, both sketches must have the same precision.
+    Status Merge(const HyperLogLog& other);
+
+    /// @return The estimated number of distinct hashes added to this sketch.
+    int64_t Estimate() const;
+
+    int32_t Precision() const {
+        return precision_;
+    }
+
+    const std::vector<uint8_t>& Registers() const {
+        return registers_;
+    }
+
+ private:
+    int32_t precision_;
+    std::vector<uint8_t> registers_;
+};
+
+}  // namespace paimon
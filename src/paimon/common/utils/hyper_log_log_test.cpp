@@ -0,0 +1,86 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/common/utils/hyper_log_log.h"
+
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "paimon/testing/utils/testharness.h"
+#include "xxhash.h"  // NOLINT(build/include_subdir)
+
+namespace paimon::test {
+namespace {
+uint64_t HashOf(int64_t value) {
+    return XXH64(&value, sizeof(value), /*seed=*/0);
+}
+}  // namespace
+
+TEST(HyperLogLogTest, TestEstimate) {
+    for (int64_t cardinality : {0, 1, 10, 1000, 100000}) {
+        HyperLogLog sketch;
+        for (int64_t i = 0; i < cardinality; ++i) {
+            // duplicates must not change the estimate
+            sketch.AddHash(HashOf(i));
+            sketch.AddHash(HashOf(i));
+        }
+        double error = std::abs(static_cast<double>(sketch.Estimate() - cardinality));
+        ASSERT_LE(error, std::max(1.0, cardinality * 0.05)) << cardinality;
+    }
+}
+
+TEST(HyperLogLogTest, TestMerge) {
+    HyperLogLog left;
+    HyperLogLog right;
+    HyperLogLog all;
+    for (int64_t i = 0; i < 20000; ++i) {
+        // half of the values are in both sketches
+        if (i < 15000) {
+            left.AddHash(HashOf(i));
+        }
+        if (i >= 5000) {
+            right.AddHash(HashOf(i));
+        }
+        all.AddHash(HashOf(i));
+    }
+    ASSERT_OK(left.Merge(right));
+    ASSERT_EQ(all.Registers(), left.Registers());
+    ASSERT_EQ(all.Estimate(), left.Estimate());
+
+    HyperLogLog other_precision(/*precision=*/10);
+    ASSERT_NOK_WITH_MSG(left.Merge(other_precision), "cannot merge hyper log log");
+}
+
+TEST(HyperLogLogTest, TestFromRegisters) {
+    HyperLogLog sketch(/*precision=*/8);
+    for (int64_t i = 0; i < 100; ++i) {
+        sketch.AddHash(HashOf(i));
+    }
+    std::vector<uint8_t> registers = sketch.Registers();
+    ASSERT_OK_AND_ASSIGN(HyperLogLog restored, HyperLogLog::FromRegisters(8, std::move(registers)));
+    ASSERT_EQ(sketch.Estimate(), restored.Estimate());
+
+    ASSERT_NOK_WITH_MSG(HyperLogLog::FromRegisters(8, std::vector<uint8_t>(10)),
+                        "expects 256 registers");
+    ASSERT_NOK_WITH_MSG(HyperLogLog::FromRegisters(30, std::vector<uint8_t>(10)),
+                        "invalid precision");
+}
+
+}  // namespace paimon::test
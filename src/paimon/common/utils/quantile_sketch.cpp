@@ -0,0 +1,220 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/common/utils/quantile_sketch.h"
+
+#include <algorithm>
+#include <cmath>
+#include <optional>
+#include <utility>
+
+#include "fmt/format.h"
+
+namespace paimon {
+namespace {
+// capacity ratio between adjacent levels
+constexpr double CAPACITY_DECAY = 2.0 / 3.0;
+// lower bound of the capacity of a level, avoids compacting tiny levels over and over
+constexpr int32_t MIN_LEVEL_CAPACITY = 8;
+}  // namespace
+
+QuantileSketch::QuantileSketch(int32_t k) : k_(std::max(k, MIN_K)), levels_(1) {}
+
+Result<QuantileSketch> QuantileSketch::FromLevels(int32_t k, int64_t count, double min_value,
+                                                  double max_value,
+                                                  std::vector<std::vector<double>>&& levels) {
+    if (k < MIN_K) {
+        return Status::Invalid(fmt::format("invalid k {} of quantile sketch", k));
+    }
+    if (levels.empty()) {
+        return Status::Invalid("quantile sketch should have at least one level");
+    }
+    int64_t weight = 0;
+    for (size_t level = 0; level < levels.size(); ++level) {
+        weight += static_cast<int64_t>(levels[level].size()) << level;
+    }
+    if (weight != count) {
+        return Status::Invalid(fmt::format(
+            "weight {} of retained items mismatches count {} of quantile sketch", weight, count));
+    }
+    QuantileSketch sketch(k);
+    sketch.count_ = count;
+    sketch.min_value_ = min_value;
+    sketch.max_value_ = max_value;
+    sketch.levels_ = std::move(levels);
+    return sketch;
+}
+
+int32_t QuantileSketch::LevelCapacity(size_t level) const {
+    size_t depth = levels_.size() - 1 - level;
+    auto capacity = static_cast<int32_t>(std::ceil(k_ * std::pow(CAPACITY_DECAY, depth)));
+    return std::max(capacity, MIN_LEVEL_CAPACITY);
+}
+
+int64_t QuantileSketch::RetainedItems() const {
+    int64_t retained = 0;
+    for (const auto& level : levels_) {
+        retained += level.size();
+    }
+    return retained;
+}
+
+int64_t QuantileSketch::TotalCapacity() const {
+    int64_t capacity = 0;
+    for (size_t level = 0; level < levels_.size(); ++level) {
+        capacity += LevelCapacity(level);
+    }
+    return capacity;
+}
+
+void QuantileSketch::Update(double value) {
+    if (std::isnan(value)) {
+        return;
+    }
+    if (count_ == 0) {
+        min_value_ = value;
+        max_value_ = value;
+    } else {
+        min_value_ = std::min(min_value_, value);
+        max_value_ = std::max(max_value_, value);
+    }
+    ++count_;
+    levels_[0].push_back(value);
+    if (static_cast<int64_t>(levels_[0].size()) >= LevelCapacity(0)) {
+        Compress();
+    }
+}
+
+Status QuantileSketch::Merge(const QuantileSketch& other) {
+    if (k_ != other.k_) {
+        return Status::Invalid(
+            fmt::format("cannot merge quantile sketch of k {} into {}", other.k_, k_));
+    }
+    if (other.IsEmpty()) {
+        return Status::OK();
+    }
+    if (IsEmpty()) {
+        min_value_ = other.min_value_;
+        max_value_ = other.max_value_;
+    } else {
+        min_value_ = std::min(min_value_, other.min_value_);
+        max_value_ = std::max(max_value_, other.max_value_);
+    }
+    if (levels_.size() < other.levels_.size()) {
+        levels_.resize(other.levels_.size());
+    }
+    for (size_t level = 0; level < other.levels_.size(); ++level) {
+        levels_[level].insert(levels_[level].end(), other.levels_[level].begin(),
+                              other.levels_[level].end());
+    }
+    count_ += other.count_;
+    Compress();
+    return Status::OK();
+}
+
+void QuantileSketch::Compress() {
+    while (RetainedItems() > TotalCapacity()) {
+        for (size_t level = 0; level < levels_.size(); ++level) {
+            if (static_cast<int64_t>(levels_[level].size()) >= LevelCapacity(level)) {
+                CompactLevel(level);
+                break;
+            }
+        }
+    }
+}
+
+void QuantileSketch::CompactLevel(size_t level) {
+    if (level + 1 == levels_.size()) {
+        levels_.emplace_back();
+    }
+    std::vector<double>& items = levels_[level];
+    std::sort(items.begin(), items.end());
+    // an odd item can not be halved, it stays in this level with its current weight
+    std::optional<double> leftover;
+    if (items.size() % 2 == 1) {
+        leftover = items.back();
+        items.pop_back();
+    }
+    std::vector<double>& next = levels_[level + 1];
+    for (size_t i = odd_offset_ ? 1 : 0; i < items.size(); i += 2) {
+        next.push_back(items[i]);
+    }
+    odd_offset_ = !odd_offset_;
+    items.clear();
+    if (leftover) {
+        items.push_back(leftover.value());
+    }
+}
+
+std::vector<std::pair<double, int64_t>> QuantileSketch::SortedView() const {
+    std::vector<std::pair<double, int64_t>> items;
+    items.reserve(RetainedItems());
+    for (size_t level = 0; level < levels_.size(); ++level) {
+        int64_t weight = static_cast<int64_t>(1) << level;
+        for (double value : levels_[level]) {
+            items.emplace_back(value, weight);
+        }
+    }
+    std::sort(items.begin(), items.end());
+    return items;
+}
+
+std::optional<double> QuantileSketch::Quantile(double rank) const {
+    if (IsEmpty()) {
+        return std::nullopt;
+    }
+    if (rank <= 0.0) {
+        return min_value_;
+    }
+    if (rank >= 1.0) {
+        return max_value_;
+    }
+    std::vector<std::pair<double, int64_t>> items = SortedView();
+    auto target = static_cast<int64_t>(std::ceil(rank * static_cast<double>(count_)));
+    int64_t cumulative = 0;
+    for (const auto& [value, weight] : items) {
+        cumulative += weight;
+        if (cumulative >= target) {
+            return value;
+        }
+    }
+    return max_value_;
+}
+
+std::vector<double> QuantileSketch::EquiDepthBoundaries(int32_t num_buckets) const {
+    if (IsEmpty() || num_buckets <= 0) {
+        return {};
+    }
+    std::vector<double> boundaries;
+    boundaries.reserve(num_buckets + 1);
+    boundaries.push_back(min_value_);
+    std::vector<std::pair<double, int64_t>> items = SortedView();
+    size_t pos = 0;
+    int64_t cumulative = 0;
+    for (int32_t bucket = 1; bucket < num_buckets; ++bucket) {
+        auto target = static_cast<int64_t>(
+            std::ceil(static_cast<double>(bucket) * static_cast<double>(count_) / num_buckets));
+        while (pos < items.size() && cumulative + items[pos].second < target) {
+            cumulative += items[pos].second;
+            ++pos;
+        }
+        boundaries.push_back(pos < items.size() ? items[pos].first : max_value_);
+    }
+    boundaries.push_back(max_value_);
+    return boundaries;
+}
+
+}  // namespace paimon
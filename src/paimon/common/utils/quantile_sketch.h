@@ -0,0 +1,115 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "paimon/result.h"
+
+namespace paimon {
+
+/// Compact quantile sketch of a stream of doubles, in the spirit of the KLL sketch.
+///
+/// Values are buffered in a hierarchy of levels, an item of level `h` stands for `2^h` values of
+/// the stream. When a level exceeds its capacity, it is sorted and every other item is promoted to
+/// the next level, which halves its size while keeping the rank error bounded. Capacities decay
+/// geometrically towards the lower levels, so the memory is dominated by the top level and stays
+/// in the order of `k` items regardless of the stream length. Sketches of the same `k` are
+/// mergeable, which allows combining sketches of data files into a sketch of the whole table. With
+/// the default `k` the rank error is in the order of one percent.
+class QuantileSketch {
+ public:
+    static constexpr int32_t DEFAULT_K = 200;
+    static constexpr int32_t MIN_K = 8;
+
+    explicit QuantileSketch(int32_t k = DEFAULT_K);
+
+    /// Restore a sketch from its state, e.g. after deserialization.
+    static Result<QuantileSketch> FromLevels(int32_t k, int64_t count, double min_value,
+                                             double max_value,
+                                             std::vector<std::vector<double>>&& levels);
+
+    /// Add a value to the sketch, NaN is ignored.
+    void Update(double value);
+
+    /// Merge `other` into this sketch, both sketches must have the same `k`.
+    Status Merge(const QuantileSketch& other);
+
+    /// @param rank Normalized rank in [0, 1], e.g. 0.5 for the median.
+    /// @return The approximate value at `rank`, or `std::nullopt` if the sketch is empty.
+    std::optional<double> Quantile(double rank) const;
+
+    /// @return `num_buckets + 1` approximate boundaries of an equi-depth histogram with
+    /// `num_buckets` buckets, or an empty vector if the sketch is empty.
+    std::vector<double> EquiDepthBoundaries(int32_t num_buckets) const;
+
+    int32_t K() const {
+        return k_;
+    }
+
+    /// @return The number of values added to the sketch.
+    int64_t Count() const {
+        return count_;
+    }
+
+    bool IsEmpty() const {
+        return count_ == 0;
+    }
+
+    double MinValue() const {
+        return min_value_;
+    }
+
+    double MaxValue() const {
+        return max_value_;
+    }
+
+    const std::vector<std::vector<double>>& Levels() const {
+        return levels_;
+    }
+
+ private:
+    int32_t LevelCapacity(size_t level) const;
+
+    int64_t RetainedItems() const;
+
+    int64_t TotalCapacity() const;
+
+    /// Compact levels until the retained items fit into the capacity.
+    void Compress();
+
+    /// Promote every other item of `level` to the next level.
+    void CompactLevel(size_t level);
+
+    /// @return All retained items with their weights, sorted by value.
+    std::vector<std::pair<double, int64_t>> SortedView() const;
+
+ private:
+    int32_t k_;
+    int64_t count_ = 0;
+    double min_value_ = 0.0;
+    double max_value_ = 0.0;
+    // alternates the kept half of each compaction, which makes the sketch deterministic while not
+    // systematically biasing ranks to one side
+    bool odd_offset_ = false;
+    std::vector<std::vector<double>> levels_;
+};
+
+}  // namespace paimon
@@ -0,0 +1,120 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/common/utils/quantile_sketch.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "paimon/testing/utils/testharness.h"
+
+namespace paimon::test {
+
+TEST(QuantileSketchTest, TestEmptyAndSmall) {
+    QuantileSketch sketch;
+    ASSERT_TRUE(sketch.IsEmpty());
+    ASSERT_EQ(std::nullopt, sketch.Quantile(0.5));
+    ASSERT_TRUE(sketch.EquiDepthBoundaries(4).empty());
+
+    sketch.Update(std::numeric_limits<double>::quiet_NaN());
+    ASSERT_TRUE(sketch.IsEmpty());
+    for (double value : {3.0, 1.0, 2.0}) {
+        sketch.Update(value);
+    }
+    ASSERT_EQ(3, sketch.Count());
+    // small sketches are exact
+    ASSERT_EQ(1.0, sketch.Quantile(0.0));
+    ASSERT_EQ(2.0, sketch.Quantile(0.5));
+    ASSERT_EQ(3.0, sketch.Quantile(1.0));
+    ASSERT_EQ(std::vector<double>({1.0, 2.0, 3.0}), sketch.EquiDepthBoundaries(2));
+}
+
+TEST(QuantileSketchTest, TestRankError) {
+    std::mt19937_64 engine(42);
+    std::vector<double> values(100000);
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = static_cast<double>(i);
+    }
+    std::shuffle(values.begin(), values.end(), engine);
+    QuantileSketch sketch;
+    for (double value : values) {
+        sketch.Update(value);
+    }
+    ASSERT_EQ(100000, sketch.Count());
+    ASSERT_EQ(0.0, sketch.MinValue());
+    ASSERT_EQ(99999.0, sketch.MaxValue());
+    // the sketch stays compact
+    int64_t retained = 0;
+    for (const auto& level : sketch.Levels()) {
+        retained += level.size();
+    }
+    ASSERT_LT(retained, 1000);
+    for (double rank : {0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99}) {
+        std::optional<double> quantile = sketch.Quantile(rank);
+        ASSERT_TRUE(quantile);
+        ASSERT_NEAR(rank, quantile.value() / 100000, 0.02) << rank;
+    }
+    std::vector<double> boundaries = sketch.EquiDepthBoundaries(4);
+    ASSERT_EQ(5, boundaries.size());
+    ASSERT_TRUE(std::is_sorted(boundaries.begin(), boundaries.end()));
+    ASSERT_EQ(0.0, boundaries.front());
+    ASSERT_EQ(99999.0, boundaries.back());
+}
+
+TEST(QuantileSketchTest, TestMerge) {
+    QuantileSketch low;
+    QuantileSketch high;
+    for (int32_t i = 0; i < 50000; ++i) {
+        low.Update(i);
+        high.Update(50000 + i);
+    }
+    ASSERT_OK(low.Merge(high));
+    ASSERT_EQ(100000, low.Count());
+    ASSERT_EQ(0.0, low.MinValue());
+    ASSERT_EQ(99999.0, low.MaxValue());
+    ASSERT_NEAR(0.5, low.Quantile(0.5).value() / 100000, 0.02);
+
+    QuantileSketch empty;
+    ASSERT_OK(empty.Merge(low));
+    ASSERT_EQ(low.Count(), empty.Count());
+    ASSERT_EQ(low.MinValue(), empty.MinValue());
+
+    QuantileSketch other_k(/*k=*/100);
+    ASSERT_NOK_WITH_MSG(low.Merge(other_k), "cannot merge quantile sketch");
+}
+
+TEST(QuantileSketchTest, TestFromLevels) {
+    QuantileSketch sketch(/*k=*/16);
+    for (int32_t i = 0; i < 1000; ++i) {
+        sketch.Update(i);
+    }
+    auto levels = sketch.Levels();
+    ASSERT_OK_AND_ASSIGN(QuantileSketch restored,
+                         QuantileSketch::FromLevels(16, sketch.Count(), sketch.MinValue(),
+                                                    sketch.MaxValue(), std::move(levels)));
+    ASSERT_EQ(sketch.Quantile(0.3), restored.Quantile(0.3));
+
+    ASSERT_NOK_WITH_MSG(QuantileSketch::FromLevels(16, 3, 0.0, 1.0, {{0.0, 1.0}}),
+                        "mismatches count");
+}
+
+}  // namespace paimon::test
@@ -154,6 +154,10 @@ void RoaringBitmap32::Add(int32_t x) {
     GetRoaringBitmap(roaring_bitmap_).add(x);
 }
 
+void RoaringBitmap32::AddMany(const int32_t* values, size_t length) {
+    GetRoaringBitmap(roaring_bitmap_).addMany(length, reinterpret_cast<const uint32_t*>(values));
+}
+
 void RoaringBitmap32::AddRange(int32_t min, int32_t max) {
     GetRoaringBitmap(roaring_bitmap_).addRange(min, max);
 }
@@ -264,9 +268,7 @@ RoaringBitmap32 RoaringBitmap32::AndNot(const RoaringBitmap32& lhs, const Roarin
 
 RoaringBitmap32 RoaringBitmap32::From(const std::vector<int32_t>& values) {
     RoaringBitmap32 res;
-    for (const auto& value : values) {
-        res.Add(value);
-    }
+    res.AddMany(values.data(), values.size());
     return res;
 }
 
@@ -21,6 +21,7 @@
 #include <ctime>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include "paimon/io/byte_array_input_stream.h"
@@ -47,6 +48,10 @@ TEST(RoaringBitmap32Test, TestSimple) {
     roaring.RemoveRange(12, 20);
     ASSERT_EQ("{10,11,20,100}", roaring.ToString());
     ASSERT_EQ(4, roaring.Cardinality());
+    std::vector<int32_t> values = {1, 2, 3, 11, 200000, 100};
+    roaring.AddMany(values.data(), values.size());
+    ASSERT_EQ("{1,2,3,10,11,20,100,200000}", roaring.ToString());
+    ASSERT_EQ(RoaringBitmap32::From({1, 2, 3, 10, 11, 20, 100, 200000}), roaring);
 }
 TEST(RoaringBitmap32Test, TestCompatibleWithJava) {
     auto pool = GetDefaultPool();
@@ -14,37 +14,63 @@
  * limitations under the License.
  */
 
-//  Copyright (c) 2011-present, Facebook, Inc.  All rights reserved.
-//  This source code is licensed under both the GPLv2 (found in the
-//  COPYING file in the root directory) and Apache 2.0 License
-//  (found in the LICENSE.Apache file in the root directory).
-//
-// Copyright (c) 2011 The LevelDB Authors. All rights reserved.
-// Use of this source code is governed by a BSD-style license that can be
-// found in the LICENSE file. See the AUTHORS file for names of contributors.
-
-// Adapted from RocksDB
-// https://github.com/facebook/rocksdb/blob/main/port/port_posix.cc
-
 #pragma once
 
-#include <fstream>
+#include <sys/random.h>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
 #include <string>
 
 namespace paimon {
 
+/// Generates random (version 4) UUIDs.
+///
+/// Every UUID is drawn from the kernel CSPRNG with `getrandom`, which keeps no state in the
+/// process, so forked processes never repeat the UUIDs of their parent. It needs neither a file
+/// open nor a read of /proc on hot write paths.
 class UUID {
  public:
     static bool Generate(std::string* output) {
+        static constexpr char kHexDigits[] = "0123456789abcdef";
         output->clear();
-        std::ifstream f("/proc/sys/kernel/random/uuid");
-        std::getline(f, /*&*/ *output);
-        if (output->size() == 36) {
-            return true;
-        } else {
-            output->clear();
+        uint64_t bits[2];
+        if (!FillRandom(bits, sizeof(bits))) {
             return false;
         }
+        uint64_t high = bits[0];
+        uint64_t low = bits[1];
+        // version 4 in the high nibble of the 7th byte, variant 10xx in the 9th byte
+        high = (high & 0xFFFFFFFFFFFF0FFFULL) | 0x0000000000004000ULL;
+        low = (low & 0x3FFFFFFFFFFFFFFFULL) | 0x8000000000000000ULL;
+
+        output->reserve(36);
+        for (int32_t i = 0; i < 32; ++i) {
+            if (i == 8 || i == 12 || i == 16 || i == 20) {
+                output->push_back('-');
+            }
+            uint64_t value = i < 16 ? high : low;
+            output->push_back(kHexDigits[(value >> (60 - 4 * (i % 16))) & 0xF]);
+        }
+        return true;
+    }
+
+ private:
+    static bool FillRandom(void* buffer, size_t length) {
+        auto* bytes = static_cast<char*>(buffer);
+        size_t filled = 0;
+        while (filled < length) {
+            ssize_t ret = getrandom(bytes + filled, length - filled, /*flags=*/0);
+            if (ret < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                return false;
+            }
+            filled += static_cast<size_t>(ret);
+        }
+        return true;
     }
 };
 
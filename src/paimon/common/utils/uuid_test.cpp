@@ -16,7 +16,15 @@
 
 #include "paimon/common/utils/uuid.h"
 
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cctype>
+#include <cstdint>
+#include <set>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -38,4 +46,70 @@ TEST(UUIDTest, GenerateValidUUID) {
                 output.find('-') == 23);
 }
 
+TEST(UUIDTest, GenerateRandomUUID) {
+    std::string output;
+    ASSERT_TRUE(UUID::Generate(&output));
+    for (size_t i = 0; i < output.size(); ++i) {
+        if (i == 8 || i == 13 || i == 18 || i == 23) {
+            ASSERT_EQ('-', output[i]);
+        } else {
+            ASSERT_TRUE(std::isxdigit(static_cast<unsigned char>(output[i])));
+        }
+    }
+    // version 4 and variant 10xx
+    ASSERT_EQ('4', output[14]);
+    ASSERT_TRUE(output[19] == '8' || output[19] == '9' || output[19] == 'a' || output[19] == 'b');
+}
+
+TEST(UUIDTest, GenerateUniqueUUIDAcrossThreads) {
+    constexpr int32_t kThreadNum = 4;
+    constexpr int32_t kUUIDNumPerThread = 1000;
+    std::vector<std::vector<std::string>> uuids(kThreadNum);
+    std::vector<std::thread> threads;
+    for (int32_t i = 0; i < kThreadNum; ++i) {
+        threads.emplace_back([&uuids, i]() {
+            for (int32_t j = 0; j < kUUIDNumPerThread; ++j) {
+                std::string uuid;
+                ASSERT_TRUE(UUID::Generate(&uuid));
+                uuids[i].push_back(uuid);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    std::set<std::string> unique_uuids;
+    for (const auto& thread_uuids : uuids) {
+        unique_uuids.insert(thread_uuids.begin(), thread_uuids.end());
+    }
+    ASSERT_EQ(kThreadNum * kUUIDNumPerThread, unique_uuids.size());
+}
+
+TEST(UUIDTest, GenerateUniqueUUIDAcrossFork) {
+    std::string parent_uuid;
+    ASSERT_TRUE(UUID::Generate(&parent_uuid));
+    int32_t fds[2];
+    ASSERT_EQ(0, pipe(fds));
+    pid_t pid = fork();
+    ASSERT_GE(pid, 0);
+    if (pid == 0) {
+        std::string child_uuid;
+        bool ok = UUID::Generate(&child_uuid) &&
+                  write(fds[1], child_uuid.data(), child_uuid.size()) ==
+                      static_cast<ssize_t>(child_uuid.size());
+        _exit(ok ? 0 : 1);
+    }
+    close(fds[1]);
+    std::string parent_next_uuid;
+    ASSERT_TRUE(UUID::Generate(&parent_next_uuid));
+    std::string child_uuid(36, '\0');
+    ASSERT_EQ(36, read(fds[0], child_uuid.data(), child_uuid.size()));
+    close(fds[0]);
+    int32_t status = 0;
+    ASSERT_EQ(pid, waitpid(pid, &status, 0));
+    ASSERT_TRUE(WIFEXITED(status));
+    ASSERT_EQ(0, WEXITSTATUS(status));
+    ASSERT_NE(parent_next_uuid, child_uuid);
+}
+
 }  // namespace paimon::test
@@ -21,26 +21,26 @@
 #include <utility>
 
 #include "arrow/c/abi.h"
-#include "arrow/c/bridge.h"
-#include "arrow/c/helpers.h"
 #include "arrow/type.h"
 #include "paimon/common/metrics/metrics_impl.h"
 #include "paimon/common/types/row_kind.h"
 #include "paimon/common/utils/arrow/status_utils.h"
 #include "paimon/common/utils/long_counter.h"
-#include "paimon/common/utils/scope_guard.h"
 #include "paimon/core/io/compact_increment.h"
+#include "paimon/core/io/data_file_index_writer.h"
 #include "paimon/core/io/data_file_path_factory.h"
 #include "paimon/core/io/data_file_writer.h"
 #include "paimon/core/io/data_increment.h"
+#include "paimon/core/io/format_writer_context.h"
 #include "paimon/core/io/rolling_blob_file_writer.h"
 #include "paimon/core/io/rolling_file_writer.h"
 #include "paimon/core/io/single_file_writer.h"
 #include "paimon/core/manifest/file_source.h"
+#include "paimon/core/stats/column_sketch_collector.h"
+#include "paimon/core/stats/value_stats_converter.h"
 #include "paimon/core/utils/commit_increment.h"
 #include "paimon/format/file_format.h"
 #include "paimon/format/file_format_factory.h"
-#include "paimon/format/writer_builder.h"
 #include "paimon/macros.h"
 #include "paimon/metrics.h"
 #include "paimon/record_batch.h"
@@ -48,7 +48,6 @@
 namespace paimon {
 
 class MemoryPool;
-class FormatStatsExtractor;
 
 AppendOnlyWriter::AppendOnlyWriter(const CoreOptions& options, int64_t schema_id,
                                    const std::shared_ptr<arrow::Schema>& write_schema,
@@ -107,84 +106,97 @@ Status AppendOnlyWriter::Flush() {
     return Status::OK();
 }
 
-AppendOnlyWriter::RollingFileWriterResult AppendOnlyWriter::CreateRollingRowWriter() const {
+AppendOnlyWriter::RollingFileWriterResult AppendOnlyWriter::CreateRollingRowWriter() {
     auto schemas = BlobUtils::SeparateBlobSchema(write_schema_);
     if (schemas.blob_schema && schemas.blob_schema->num_fields() > 0) {
         return CreateRollingBlobWriter(schemas);
-    } else {
-        return std::make_unique<RollingFileWriter<::ArrowArray*, std::shared_ptr<DataFileMeta>>>(
-            options_.GetTargetFileSize(), GetDataFileWriterCreator(write_schema_, write_cols_));
     }
+    if (data_format_context_ == nullptr) {
+        PAIMON_ASSIGN_OR_RAISE(
+            data_format_context_,
+            FormatWriterContext::Create(options_.GetWriteFileFormat(), write_schema_,
+                                        options_.GetWriteBatchSize(), memory_pool_));
+    }
+    return std::make_unique<RollingFileWriter<::ArrowArray*, std::shared_ptr<DataFileMeta>>>(
+        options_.GetTargetFileSize(),
+        GetDataFileWriterCreator(data_format_context_, write_schema_, write_cols_));
 }
 
 AppendOnlyWriter::SingleFileWriterCreator AppendOnlyWriter::GetDataFileWriterCreator(
+    const std::shared_ptr<FormatWriterContext>& format_context,
     const std::shared_ptr<arrow::Schema>& schema,
     const std::optional<std::vector<std::string>>& write_cols) const {
     return
-        [this, schema, write_cols]()
+        [this, format_context, schema, write_cols,
+         index_columns = options_.GetFileIndexColumns()]()
             -> Result<
                 std::unique_ptr<SingleFileWriter<::ArrowArray*, std::shared_ptr<DataFileMeta>>>> {
-            ::ArrowSchema arrow_schema;
-            ScopeGuard guard([&arrow_schema]() { ArrowSchemaRelease(&arrow_schema); });
-            PAIMON_RETURN_NOT_OK_FROM_ARROW(arrow::ExportSchema(*schema, &arrow_schema));
-            auto format = options_.GetWriteFileFormat();
+            std::unique_ptr<ColumnSketchCollector> sketch_collector;
+            if (options_.ColumnSketchesEnabled()) {
+                PAIMON_ASSIGN_OR_RAISE(sketch_collector, ColumnSketchCollector::Create(schema));
+            }
             PAIMON_ASSIGN_OR_RAISE(
-                std::shared_ptr<WriterBuilder> writer_builder,
-                format->CreateWriterBuilder(&arrow_schema, options_.GetWriteBatchSize()));
-            writer_builder->WithMemoryPool(memory_pool_);
-
-            PAIMON_RETURN_NOT_OK_FROM_ARROW(arrow::ExportSchema(*schema, &arrow_schema));
-            PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<FormatStatsExtractor> stats_extractor,
-                                   format->CreateStatsExtractor(&arrow_schema));
+                std::unique_ptr<DataFileIndexWriter> index_writer,
+                DataFileIndexWriter::Create(schema, index_columns,
+                                            options_.GetFileIndexInManifestThreshold(),
+                                            memory_pool_));
+            PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<ValueStatsConverter> value_stats_converter,
+                                   ValueStatsConverter::Create(options_, schema->field_names()));
             auto writer = std::make_unique<DataFileWriter>(
                 options_.GetFileCompression(), std::function<Status(ArrowArray*, ArrowArray*)>(),
-                schema_id_, seq_num_counter_, FileSource::Append(), stats_extractor,
-                path_factory_->IsExternalPath(), write_cols, memory_pool_);
-            PAIMON_RETURN_NOT_OK(
-                writer->Init(options_.GetFileSystem(), path_factory_->NewPath(), writer_builder));
+                schema_id_, seq_num_counter_, FileSource::Append(),
+                format_context->GetStatsExtractor(), path_factory_->IsExternalPath(), write_cols,
+                std::move(value_stats_converter), std::move(sketch_collector),
+                std::move(index_writer), memory_pool_);
+            PAIMON_RETURN_NOT_OK(writer->Init(options_.GetFileSystem(), path_factory_->NewPath(),
+                                              format_context->GetWriterBuilder()));
             return writer;
         };
 }
 
 AppendOnlyWriter::SingleFileWriterCreator AppendOnlyWriter::GetBlobFileWriterCreator(
-    const std::shared_ptr<WriterBuilder>& writer_builder,
-    const std::shared_ptr<FormatStatsExtractor>& stats_extractor,
+    const std::shared_ptr<FormatWriterContext>& format_context,
     const std::optional<std::vector<std::string>>& write_cols) const {
     return
-        [this, writer_builder, stats_extractor, write_cols]()
+        [this, format_context, write_cols]()
             -> Result<
                 std::unique_ptr<SingleFileWriter<::ArrowArray*, std::shared_ptr<DataFileMeta>>>> {
             auto writer = std::make_unique<DataFileWriter>(
                 /*compression=*/"none", std::function<Status(ArrowArray*, ArrowArray*)>(),
-                schema_id_, seq_num_counter_, FileSource::Append(), stats_extractor,
-                path_factory_->IsExternalPath(), write_cols, memory_pool_);
+                schema_id_, seq_num_counter_, FileSource::Append(),
+                format_context->GetStatsExtractor(), path_factory_->IsExternalPath(), write_cols,
+                /*value_stats_converter=*/nullptr, /*sketch_collector=*/nullptr,
+                /*index_writer=*/nullptr, memory_pool_);
             PAIMON_RETURN_NOT_OK(writer->Init(options_.GetFileSystem(),
-                                              path_factory_->NewBlobPath(), writer_builder));
+                                              path_factory_->NewBlobPath(),
+                                              format_context->GetWriterBuilder()));
             return writer;
         };
 }
 
 AppendOnlyWriter::RollingFileWriterResult AppendOnlyWriter::CreateRollingBlobWriter(
-    const BlobUtils::SeparatedSchemas& schemas) const {
+    const BlobUtils::SeparatedSchemas& schemas) {
     if (schemas.blob_schema->num_fields() > RollingBlobFileWriter::EXPECTED_BLOB_FIELD_COUNT) {
         return Status::Invalid("Limit exactly one blob field in one paimon table yet.");
     }
     // use a specialized writer that writes blob data to a separate rolling file.
-    ::ArrowSchema arrow_schema;
-    ScopeGuard guard([&arrow_schema]() { ArrowSchemaRelease(&arrow_schema); });
-    PAIMON_RETURN_NOT_OK_FROM_ARROW(arrow::ExportSchema(*schemas.blob_schema, &arrow_schema));
-    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<FileFormat> format,
-                           FileFormatFactory::Get("blob", options_.ToMap()));
-    PAIMON_ASSIGN_OR_RAISE(
-        std::shared_ptr<WriterBuilder> writer_builder,
-        format->CreateWriterBuilder(&arrow_schema, options_.GetWriteBatchSize()));
-    writer_builder->WithMemoryPool(memory_pool_);
-    PAIMON_RETURN_NOT_OK_FROM_ARROW(arrow::ExportSchema(*schemas.blob_schema, &arrow_schema));
-    PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<FormatStatsExtractor> stats_extractor,
-                           format->CreateStatsExtractor(&arrow_schema));
-
-    auto single_blob_file_writer_creator = GetBlobFileWriterCreator(
-        writer_builder, stats_extractor, schemas.blob_schema->field_names());
+    if (blob_format_context_ == nullptr) {
+        PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<FileFormat> blob_format,
+                               FileFormatFactory::Get("blob", options_.ToMap()));
+        PAIMON_ASSIGN_OR_RAISE(
+            blob_format_context_,
+            FormatWriterContext::Create(std::move(blob_format), schemas.blob_schema,
+                                        options_.GetWriteBatchSize(), memory_pool_));
+    }
+    if (data_format_context_ == nullptr) {
+        PAIMON_ASSIGN_OR_RAISE(
+            data_format_context_,
+            FormatWriterContext::Create(options_.GetWriteFileFormat(), schemas.main_schema,
+                                        options_.GetWriteBatchSize(), memory_pool_));
+    }
+
+    auto single_blob_file_writer_creator =
+        GetBlobFileWriterCreator(blob_format_context_, schemas.blob_schema->field_names());
     auto rolling_blob_file_writer_creator = [this, single_blob_file_writer_creator]()
         -> Result<
             std::unique_ptr<RollingFileWriter<::ArrowArray*, std::shared_ptr<DataFileMeta>>>> {
@@ -193,7 +205,8 @@ AppendOnlyWriter::RollingFileWriterResult AppendOnlyWriter::CreateRollingBlobWri
     };
     return std::make_unique<RollingBlobFileWriter>(
         options_.GetTargetFileSize(),
-        GetDataFileWriterCreator(schemas.main_schema, schemas.main_schema->field_names()),
+        GetDataFileWriterCreator(data_format_context_, schemas.main_schema,
+                                 schemas.main_schema->field_names()),
         rolling_blob_file_writer_creator, arrow::struct_(write_schema_->fields()));
 }
 
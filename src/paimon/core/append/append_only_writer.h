@@ -48,8 +48,7 @@ class LongCounter;
 class DataFilePathFactory;
 class MemoryPool;
 class Metrics;
-class FormatStatsExtractor;
-class WriterBuilder;
+class FormatWriterContext;
 
 class AppendOnlyWriter : public BatchWriter {
  public:
@@ -77,20 +76,20 @@ class AppendOnlyWriter : public BatchWriter {
     using RollingFileWriterResult =
         Result<std::unique_ptr<RollingFileWriter<::ArrowArray*, std::shared_ptr<DataFileMeta>>>>;
 
-    RollingFileWriterResult CreateRollingRowWriter() const;
-    RollingFileWriterResult CreateRollingBlobWriter(
-        const BlobUtils::SeparatedSchemas& schemas) const;
+    RollingFileWriterResult CreateRollingRowWriter();
+    RollingFileWriterResult CreateRollingBlobWriter(const BlobUtils::SeparatedSchemas& schemas);
 
     Result<CommitIncrement> DrainIncrement();
     Status Flush();
 
+    /// @param schema Schema of the data files, used to collect column sketches if enabled.
     SingleFileWriterCreator GetDataFileWriterCreator(
+        const std::shared_ptr<FormatWriterContext>& format_context,
         const std::shared_ptr<arrow::Schema>& schema,
         const std::optional<std::vector<std::string>>& write_cols) const;
 
     SingleFileWriterCreator GetBlobFileWriterCreator(
-        const std::shared_ptr<WriterBuilder>& writer_builder,
-        const std::shared_ptr<FormatStatsExtractor>& stats_extractor,
+        const std::shared_ptr<FormatWriterContext>& format_context,
         const std::optional<std::vector<std::string>>& write_cols) const;
 
     CoreOptions options_;
@@ -101,6 +100,9 @@ class AppendOnlyWriter : public BatchWriter {
     std::shared_ptr<DataFilePathFactory> path_factory_;
     std::shared_ptr<MemoryPool> memory_pool_;
     std::shared_ptr<Metrics> metrics_;
+    // created on first use and shared by all rolling writers
+    std::shared_ptr<FormatWriterContext> data_format_context_;
+    std::shared_ptr<FormatWriterContext> blob_format_context_;
 
     std::vector<std::shared_ptr<DataFileMeta>> new_files_;
     std::vector<std::shared_ptr<DataFileMeta>> deleted_files_;
@@ -21,6 +21,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "arrow/api.h"
 #include "arrow/array/builder_binary.h"
@@ -28,18 +29,26 @@
 #include "arrow/c/abi.h"
 #include "arrow/c/bridge.h"
 #include "arrow/c/helpers.h"
+#include "arrow/ipc/json_simple.h"
 #include "arrow/type.h"
 #include "gtest/gtest.h"
+#include "paimon/common/data/binary_string.h"
 #include "paimon/common/fs/external_path_provider.h"
 #include "paimon/core/core_options.h"
 #include "paimon/core/io/compact_increment.h"
 #include "paimon/core/io/data_file_path_factory.h"
+#include "paimon/core/io/data_file_meta.h"
 #include "paimon/core/io/data_increment.h"
+#include "paimon/core/stats/simple_stats.h"
 #include "paimon/core/utils/commit_increment.h"
 #include "paimon/defs.h"
+#include "paimon/file_index/file_index_format.h"
+#include "paimon/file_index/file_index_result.h"
 #include "paimon/fs/file_system.h"
 #include "paimon/fs/local/local_file_system.h"
+#include "paimon/io/byte_array_input_stream.h"
 #include "paimon/memory/memory_pool.h"
+#include "paimon/predicate/literal.h"
 #include "paimon/record_batch.h"
 #include "paimon/testing/utils/testharness.h"
 
@@ -179,6 +188,115 @@ TEST_F(AppendOnlyWriterTest, TestWriteAndClose) {
     ASSERT_TRUE(file_status_list.empty());
 }
 
+TEST_F(AppendOnlyWriterTest, TestWriteFileIndex) {
+    arrow::FieldVector fields = {arrow::field("f0", arrow::utf8()),
+                                 arrow::field("f1", arrow::int32())};
+    auto schema = arrow::schema(fields);
+    auto write_file = [&](const std::string& in_manifest_threshold)
+        -> std::pair<std::shared_ptr<DataFileMeta>, std::string> {
+        std::map<std::string, std::string> raw_options;
+        raw_options[Options::FILE_FORMAT] = "orc";
+        raw_options[Options::FILE_SYSTEM] = "local";
+        raw_options[Options::MANIFEST_FORMAT] = "orc";
+        raw_options["file-index.bitmap.columns"] = "f0";
+        raw_options[Options::FILE_INDEX_IN_MANIFEST_THRESHOLD] = in_manifest_threshold;
+        auto options = CoreOptions::FromMap(raw_options).value();
+
+        auto dir = UniqueTestDirectory::Create();
+        EXPECT_TRUE(dir);
+        auto path_factory = std::make_shared<DataFilePathFactory>();
+        EXPECT_OK(path_factory->Init(dir->Str(), "orc", options.DataFilePrefix(), nullptr));
+        AppendOnlyWriter writer(options, /*schema_id=*/0, schema, /*write_cols=*/std::nullopt,
+                                /*max_sequence_number=*/-1, path_factory, memory_pool_);
+        auto array = arrow::ipc::internal::json::ArrayFromJSON(arrow::struct_(fields), R"([
+            ["a", 1], ["b", 2], ["a", 3], [null, 4]
+        ])")
+                         .ValueOrDie();
+        ::ArrowArray arrow_array;
+        EXPECT_TRUE(arrow::ExportArray(*array, &arrow_array).ok());
+        RecordBatchBuilder batch_builder(&arrow_array);
+        auto record_batch = batch_builder.Finish().value();
+        EXPECT_OK(writer.Write(std::move(record_batch)));
+        auto inc = writer.PrepareCommit(true).value();
+        EXPECT_OK(writer.Close());
+        EXPECT_EQ(1, inc.GetNewFilesIncrement().NewFiles().size());
+        auto meta = inc.GetNewFilesIncrement().NewFiles()[0];
+        return {meta, dir->Str() + "/" + meta->file_name};
+    };
+    auto check_index = [&](const char* data, size_t length) {
+        auto input_stream = std::make_shared<ByteArrayInputStream>(data, length);
+        ASSERT_OK_AND_ASSIGN(auto reader,
+                             FileIndexFormat::CreateReader(input_stream, memory_pool_));
+        ArrowSchema c_schema;
+        ASSERT_TRUE(arrow::ExportSchema(*schema, &c_schema).ok());
+        ASSERT_OK_AND_ASSIGN(auto index_readers, reader->ReadColumnIndex("f0", &c_schema));
+        ASSERT_EQ(1, index_readers.size());
+        ASSERT_OK_AND_ASSIGN(auto result,
+                             index_readers[0]->VisitEqual(Literal(FieldType::STRING, "a", 1)));
+        ASSERT_EQ("{0,2}", result->ToString());
+    };
+    {
+        // small index is embedded in data file meta
+        auto [meta, data_path] = write_file("1 kb");
+        ASSERT_TRUE(meta->embedded_index);
+        ASSERT_TRUE(meta->extra_files.empty());
+        check_index(meta->embedded_index->data(), meta->embedded_index->size());
+    }
+    {
+        // large index is written to an index file next to the data file
+        auto [meta, data_path] = write_file("1 b");
+        ASSERT_FALSE(meta->embedded_index);
+        ASSERT_EQ(1, meta->extra_files.size());
+        ASSERT_EQ(meta->file_name + DataFilePathFactory::INDEX_PATH_SUFFIX,
+                  meta->extra_files[0].value());
+        auto fs = std::make_shared<LocalFileSystem>();
+        std::string content;
+        ASSERT_OK(fs->ReadFile(data_path + DataFilePathFactory::INDEX_PATH_SUFFIX, &content));
+        check_index(content.data(), content.size());
+    }
+}
+
+TEST_F(AppendOnlyWriterTest, TestWriteValueStatsMode) {
+    std::map<std::string, std::string> raw_options;
+    raw_options[Options::FILE_FORMAT] = "orc";
+    raw_options[Options::FILE_SYSTEM] = "local";
+    raw_options[Options::MANIFEST_FORMAT] = "orc";
+    raw_options[Options::METADATA_STATS_MODE] = "truncate(1)";
+    raw_options["fields.f1.stats-mode"] = "none";
+    ASSERT_OK_AND_ASSIGN(CoreOptions options, CoreOptions::FromMap(raw_options));
+
+    arrow::FieldVector fields = {arrow::field("f0", arrow::utf8()),
+                                 arrow::field("f1", arrow::int32())};
+    auto schema = arrow::schema(fields);
+    auto dir = UniqueTestDirectory::Create();
+    ASSERT_TRUE(dir);
+    auto path_factory = std::make_shared<DataFilePathFactory>();
+    ASSERT_OK(path_factory->Init(dir->Str(), "orc", options.DataFilePrefix(), nullptr));
+    AppendOnlyWriter writer(options, /*schema_id=*/0, schema, /*write_cols=*/std::nullopt,
+                            /*max_sequence_number=*/-1, path_factory, memory_pool_);
+    auto array = arrow::ipc::internal::json::ArrayFromJSON(arrow::struct_(fields), R"([
+        ["abc", 1], ["bcd", 2], [null, 3]
+    ])")
+                     .ValueOrDie();
+    ::ArrowArray arrow_array;
+    ASSERT_TRUE(arrow::ExportArray(*array, &arrow_array).ok());
+    RecordBatchBuilder batch_builder(&arrow_array);
+    ASSERT_OK_AND_ASSIGN(auto record_batch, batch_builder.Finish());
+    ASSERT_OK(writer.Write(std::move(record_batch)));
+    ASSERT_OK_AND_ASSIGN(CommitIncrement inc, writer.PrepareCommit(true));
+    ASSERT_OK(writer.Close());
+
+    ASSERT_EQ(1, inc.GetNewFilesIncrement().NewFiles().size());
+    auto meta = inc.GetNewFilesIncrement().NewFiles()[0];
+    // stats of f1 are not stored, stats of f0 are truncated
+    ASSERT_EQ(std::vector<std::string>({"f0"}), meta->value_stats_cols);
+    const auto& stats = meta->value_stats;
+    ASSERT_EQ(1, stats.MinValues().GetFieldCount());
+    ASSERT_EQ("a", stats.MinValues().GetString(0).ToString());
+    ASSERT_EQ("c", stats.MaxValues().GetString(0).ToString());
+    ASSERT_EQ(1, stats.NullCounts().GetLong(0));
+}
+
 TEST_F(AppendOnlyWriterTest, TestInvalidRowKind) {
     std::map<std::string, std::string> raw_options;
     raw_options[Options::FILE_FORMAT] = "orc";
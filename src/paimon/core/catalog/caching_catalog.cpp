@@ -0,0 +1,138 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/catalog/caching_catalog.h"
+
+#include <utility>
+
+#include "paimon/catalog/identifier.h"
+#include "paimon/common/utils/date_time_utils.h"
+#include "paimon/core/catalog/file_system_catalog.h"
+#include "paimon/core/utils/snapshot_manager.h"
+#include "paimon/fs/file_system.h"
+
+namespace paimon {
+
+CachingCatalog::CachingCatalog(std::unique_ptr<Catalog>&& wrapped,
+                               const std::shared_ptr<FileSystem>& fs, const std::string& warehouse,
+                               int64_t expire_after_write_ms)
+    : wrapped_(std::move(wrapped)),
+      fs_(fs),
+      warehouse_(warehouse),
+      expire_after_write_ms_(expire_after_write_ms) {}
+
+Status CachingCatalog::CreateDatabase(const std::string& db_name,
+                                      const std::map<std::string, std::string>& options,
+                                      bool ignore_if_exists) {
+    return wrapped_->CreateDatabase(db_name, options, ignore_if_exists);
+}
+
+Status CachingCatalog::CreateTable(const Identifier& identifier, ArrowSchema* c_schema,
+                                   const std::vector<std::string>& partition_keys,
+                                   const std::vector<std::string>& primary_keys,
+                                   const std::map<std::string, std::string>& options,
+                                   bool ignore_if_exists) {
+    Status status = wrapped_->CreateTable(identifier, c_schema, partition_keys, primary_keys,
+                                          options, ignore_if_exists);
+    InvalidateTable(identifier);
+    return status;
+}
+
+Result<std::vector<std::string>> CachingCatalog::ListDatabases() const {
+    return wrapped_->ListDatabases();
+}
+
+Result<std::vector<std::string>> CachingCatalog::ListTables(const std::string& db_name) const {
+    int64_t now_ms = CurrentTimeMillis();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto iter = tables_cache_.find(db_name);
+        if (iter != tables_cache_.end() && !IsExpired(iter->second.load_time_ms, now_ms)) {
+            return iter->second.table_names;
+        }
+    }
+    // load outside of the lock, so that a slow listing does not block other tables
+    PAIMON_ASSIGN_OR_RAISE(std::vector<std::string> table_names, wrapped_->ListTables(db_name));
+    std::lock_guard<std::mutex> lock(mutex_);
+    tables_cache_[db_name] = TablesEntry{table_names, now_ms};
+    return table_names;
+}
+
+Result<std::optional<std::shared_ptr<Schema>>> CachingCatalog::LoadTableSchema(
+    const Identifier& identifier) const {
+    TableKey key = ToKey(identifier);
+    int64_t now_ms = CurrentTimeMillis();
+    std::optional<SchemaEntry> cached;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto iter = schema_cache_.find(key);
+        if (iter != schema_cache_.end()) {
+            if (IsExpired(iter->second.load_time_ms, now_ms)) {
+                schema_cache_.erase(iter);
+            } else {
+                cached = iter->second;
+            }
+        }
+    }
+    // the snapshot id is read before the schema, so that a commit in between makes the entry
+    // stale rather than being missed
+    PAIMON_ASSIGN_OR_RAISE(std::optional<int64_t> snapshot_id, LatestSnapshotId(identifier));
+    if (cached && cached->snapshot_id == snapshot_id) {
+        return std::optional<std::shared_ptr<Schema>>(cached->schema);
+    }
+    PAIMON_ASSIGN_OR_RAISE(std::optional<std::shared_ptr<Schema>> schema,
+                           wrapped_->LoadTableSchema(identifier));
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (schema) {
+        schema_cache_[key] = SchemaEntry{schema.value(), snapshot_id, now_ms};
+    } else {
+        // absent tables are not cached, they may be created by other processes at any time
+        schema_cache_.erase(key);
+    }
+    return schema;
+}
+
+Result<std::optional<std::shared_ptr<TableStatistics>>> CachingCatalog::LoadTableStatistics(
+    const Identifier& identifier) const {
+    return wrapped_->LoadTableStatistics(identifier);
+}
+
+void CachingCatalog::InvalidateTable(const Identifier& identifier) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    schema_cache_.erase(ToKey(identifier));
+    tables_cache_.erase(identifier.GetDatabaseName());
+}
+
+CachingCatalog::TableKey CachingCatalog::ToKey(const Identifier& identifier) {
+    return std::make_pair(identifier.GetDatabaseName(), identifier.GetTableName());
+}
+
+int64_t CachingCatalog::CurrentTimeMillis() {
+    return DateTimeUtils::GetCurrentUTCTimeUs() / 1000;
+}
+
+bool CachingCatalog::IsExpired(int64_t load_time_ms, int64_t now_ms) const {
+    return now_ms - load_time_ms >= expire_after_write_ms_;
+}
+
+Result<std::optional<int64_t>> CachingCatalog::LatestSnapshotId(
+    const Identifier& identifier) const {
+    SnapshotManager snapshot_manager(fs_,
+                                     FileSystemCatalog::NewDataTablePath(warehouse_, identifier));
+    return snapshot_manager.LatestSnapshotId();
+}
+
+}  // namespace paimon
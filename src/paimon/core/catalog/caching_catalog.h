@@ -0,0 +1,103 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "paimon/catalog/catalog.h"
+#include "paimon/result.h"
+#include "paimon/status.h"
+
+struct ArrowSchema;
+
+namespace paimon {
+
+class FileSystem;
+class Identifier;
+
+/// A `Catalog` decorator which caches table schemas and table listings of the wrapped
+/// `FileSystemCatalog`.
+///
+/// A cached schema is shared by all callers and is valid until `expire_after_write_ms` has passed
+/// since it was loaded, or until the latest snapshot id of the table changes. Checking the latest
+/// snapshot id reads the snapshot hint of the table, which is much cheaper than listing and
+/// parsing the schema files. Schema changes which are not followed by a commit are picked up once
+/// the entry expires, or after `InvalidateTable()`.
+///
+/// Pass a cached schema to `ScanContextBuilder::SetTableSchema()` and
+/// `ReadContextBuilder::SetTableSchema()` to create table scans and reads without reloading it.
+class CachingCatalog : public Catalog {
+ public:
+    CachingCatalog(std::unique_ptr<Catalog>&& wrapped, const std::shared_ptr<FileSystem>& fs,
+                   const std::string& warehouse, int64_t expire_after_write_ms);
+
+    Status CreateDatabase(const std::string& db_name,
+                          const std::map<std::string, std::string>& options,
+                          bool ignore_if_exists) override;
+    Status CreateTable(const Identifier& identifier, ArrowSchema* c_schema,
+                       const std::vector<std::string>& partition_keys,
+                       const std::vector<std::string>& primary_keys,
+                       const std::map<std::string, std::string>& options,
+                       bool ignore_if_exists) override;
+
+    Result<std::vector<std::string>> ListDatabases() const override;
+    Result<std::vector<std::string>> ListTables(const std::string& db_name) const override;
+    Result<std::optional<std::shared_ptr<Schema>>> LoadTableSchema(
+        const Identifier& identifier) const override;
+    Result<std::optional<std::shared_ptr<TableStatistics>>> LoadTableStatistics(
+        const Identifier& identifier) const override;
+
+    void InvalidateTable(const Identifier& identifier) override;
+
+ private:
+    using TableKey = std::pair<std::string, std::string>;
+
+    struct SchemaEntry {
+        std::shared_ptr<Schema> schema;
+        std::optional<int64_t> snapshot_id;
+        int64_t load_time_ms = 0;
+    };
+
+    struct TablesEntry {
+        std::vector<std::string> table_names;
+        int64_t load_time_ms = 0;
+    };
+
+    static TableKey ToKey(const Identifier& identifier);
+    static int64_t CurrentTimeMillis();
+    bool IsExpired(int64_t load_time_ms, int64_t now_ms) const;
+    Result<std::optional<int64_t>> LatestSnapshotId(const Identifier& identifier) const;
+
+ private:
+    std::unique_ptr<Catalog> wrapped_;
+    std::shared_ptr<FileSystem> fs_;
+    std::string warehouse_;
+    int64_t expire_after_write_ms_;
+
+    mutable std::mutex mutex_;
+    mutable std::map<TableKey, SchemaEntry> schema_cache_;
+    mutable std::map<std::string, TablesEntry> tables_cache_;
+};
+
+}  // namespace paimon
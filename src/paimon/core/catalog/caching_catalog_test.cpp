@@ -0,0 +1,195 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/catalog/caching_catalog.h"
+
+#include <algorithm>
+
+#include "arrow/api.h"
+#include "arrow/c/abi.h"
+#include "arrow/c/bridge.h"
+#include "arrow/c/helpers.h"
+#include "gtest/gtest.h"
+#include "paimon/catalog/identifier.h"
+#include "paimon/common/utils/path_util.h"
+#include "paimon/core/catalog/file_system_catalog.h"
+#include "paimon/core/core_options.h"
+#include "paimon/defs.h"
+#include "paimon/fs/file_system.h"
+#include "paimon/read_context.h"
+#include "paimon/scan_context.h"
+#include "paimon/table/source/plan.h"
+#include "paimon/table/source/table_read.h"
+#include "paimon/table/source/table_scan.h"
+#include "paimon/testing/utils/testharness.h"
+
+namespace paimon::test {
+
+class CachingCatalogTest : public testing::Test {
+ public:
+    void SetUp() override {
+        options_[Options::FILE_SYSTEM] = "local";
+        options_[Options::FILE_FORMAT] = "orc";
+        ASSERT_OK_AND_ASSIGN(CoreOptions core_options, CoreOptions::FromMap(options_));
+        fs_ = core_options.GetFileSystem();
+        dir_ = UniqueTestDirectory::Create();
+        ASSERT_TRUE(dir_);
+    }
+
+    void CreateTable(Catalog* catalog, const std::string& table_name) const {
+        arrow::FieldVector fields = {arrow::field("f0", arrow::int32()),
+                                     arrow::field("f1", arrow::utf8())};
+        arrow::Schema typed_schema(fields);
+        ::ArrowSchema schema;
+        ASSERT_TRUE(arrow::ExportSchema(typed_schema, &schema).ok());
+        ASSERT_OK(catalog->CreateTable(Identifier("db1", table_name), &schema,
+                                       /*partition_keys=*/{}, /*primary_keys=*/{}, options_,
+                                       /*ignore_if_exists=*/false));
+        ArrowSchemaRelease(&schema);
+    }
+
+ protected:
+    std::map<std::string, std::string> options_;
+    std::shared_ptr<FileSystem> fs_;
+    std::unique_ptr<UniqueTestDirectory> dir_;
+};
+
+TEST_F(CachingCatalogTest, TestCreate) {
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<Catalog> catalog, Catalog::Create(dir_->Str(), options_));
+    ASSERT_FALSE(dynamic_cast<CachingCatalog*>(catalog.get()));
+
+    options_[Options::CACHE_ENABLED] = "true";
+    ASSERT_OK_AND_ASSIGN(catalog, Catalog::Create(dir_->Str(), options_));
+    ASSERT_TRUE(dynamic_cast<CachingCatalog*>(catalog.get()));
+}
+
+TEST_F(CachingCatalogTest, TestCacheTableSchema) {
+    CachingCatalog catalog(std::make_unique<FileSystemCatalog>(fs_, dir_->Str()), fs_, dir_->Str(),
+                           /*expire_after_write_ms=*/3600 * 1000);
+    ASSERT_OK(catalog.CreateDatabase("db1", options_, /*ignore_if_exists=*/false));
+    CreateTable(&catalog, "tbl");
+
+    Identifier identifier("db1", "tbl");
+    ASSERT_OK_AND_ASSIGN(std::optional<std::shared_ptr<Schema>> schema,
+                         catalog.LoadTableSchema(identifier));
+    ASSERT_TRUE(schema);
+    ASSERT_EQ(std::vector<std::string>({"f0", "f1"}), schema.value()->FieldNames());
+    // the cached schema is shared
+    ASSERT_OK_AND_ASSIGN(std::optional<std::shared_ptr<Schema>> cached_schema,
+                         catalog.LoadTableSchema(identifier));
+    ASSERT_EQ(schema.value(), cached_schema.value());
+
+    // a new snapshot makes the cached schema stale
+    std::string table_path = FileSystemCatalog::NewDataTablePath(dir_->Str(), identifier);
+    ASSERT_OK(fs_->WriteFile(PathUtil::JoinPath(table_path, "snapshot/snapshot-1"), "",
+                             /*overwrite=*/true));
+    ASSERT_OK_AND_ASSIGN(std::optional<std::shared_ptr<Schema>> reloaded_schema,
+                         catalog.LoadTableSchema(identifier));
+    ASSERT_NE(schema.value(), reloaded_schema.value());
+    ASSERT_OK_AND_ASSIGN(cached_schema, catalog.LoadTableSchema(identifier));
+    ASSERT_EQ(reloaded_schema.value(), cached_schema.value());
+
+    // invalidate explicitly
+    catalog.InvalidateTable(identifier);
+    ASSERT_OK_AND_ASSIGN(reloaded_schema, catalog.LoadTableSchema(identifier));
+    ASSERT_NE(cached_schema.value(), reloaded_schema.value());
+
+    // absent tables are not cached
+    ASSERT_OK_AND_ASSIGN(schema, catalog.LoadTableSchema(Identifier("db1", "tbl2")));
+    ASSERT_FALSE(schema);
+    FileSystemCatalog fs_catalog(fs_, dir_->Str());
+    CreateTable(&fs_catalog, "tbl2");
+    ASSERT_OK_AND_ASSIGN(schema, catalog.LoadTableSchema(Identifier("db1", "tbl2")));
+    ASSERT_TRUE(schema);
+}
+
+TEST_F(CachingCatalogTest, TestScanAndReadWithCachedTableSchema) {
+    CachingCatalog catalog(std::make_unique<FileSystemCatalog>(fs_, dir_->Str()), fs_, dir_->Str(),
+                           /*expire_after_write_ms=*/3600 * 1000);
+    ASSERT_OK(catalog.CreateDatabase("db1", options_, /*ignore_if_exists=*/false));
+    CreateTable(&catalog, "tbl");
+    Identifier identifier("db1", "tbl");
+    ASSERT_OK_AND_ASSIGN(std::optional<std::shared_ptr<Schema>> schema,
+                         catalog.LoadTableSchema(identifier));
+    ASSERT_TRUE(schema);
+
+    // the cached schema is used instead of the schema files of the table
+    std::string table_path = FileSystemCatalog::NewDataTablePath(dir_->Str(), identifier);
+    ASSERT_OK(fs_->Delete(PathUtil::JoinPath(table_path, "schema"), /*recursive=*/true));
+
+    ScanContextBuilder scan_context_builder(table_path);
+    scan_context_builder.SetTableSchema(schema.value());
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<ScanContext> scan_context, scan_context_builder.Finish());
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<TableScan> table_scan,
+                         TableScan::Create(std::move(scan_context)));
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<Plan> plan, table_scan->CreatePlan());
+    ASSERT_TRUE(plan->Splits().empty());
+
+    ReadContextBuilder read_context_builder(table_path);
+    read_context_builder.SetTableSchema(schema.value());
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<ReadContext> read_context, read_context_builder.Finish());
+    ASSERT_OK(TableRead::Create(std::move(read_context)));
+
+    // without the cached schema, the schema is loaded from the table path
+    ASSERT_OK_AND_ASSIGN(scan_context, ScanContextBuilder(table_path).Finish());
+    ASSERT_NOK_WITH_MSG(TableScan::Create(std::move(scan_context)), "not found latest schema");
+    ASSERT_OK_AND_ASSIGN(read_context, ReadContextBuilder(table_path).Finish());
+    ASSERT_NOK_WITH_MSG(TableRead::Create(std::move(read_context)), "schema file not found");
+}
+
+TEST_F(CachingCatalogTest, TestCacheListTables) {
+    CachingCatalog catalog(std::make_unique<FileSystemCatalog>(fs_, dir_->Str()), fs_, dir_->Str(),
+                           /*expire_after_write_ms=*/3600 * 1000);
+    ASSERT_OK(catalog.CreateDatabase("db1", options_, /*ignore_if_exists=*/false));
+    CreateTable(&catalog, "tbl");
+    ASSERT_OK_AND_ASSIGN(std::vector<std::string> table_names, catalog.ListTables("db1"));
+    ASSERT_EQ(std::vector<std::string>({"tbl"}), table_names);
+
+    // tables created by other catalogs are not visible until the listing is invalidated
+    FileSystemCatalog fs_catalog(fs_, dir_->Str());
+    CreateTable(&fs_catalog, "tbl2");
+    ASSERT_OK_AND_ASSIGN(table_names, catalog.ListTables("db1"));
+    ASSERT_EQ(std::vector<std::string>({"tbl"}), table_names);
+    catalog.InvalidateTable(Identifier("db1", "tbl2"));
+    ASSERT_OK_AND_ASSIGN(table_names, catalog.ListTables("db1"));
+    std::sort(table_names.begin(), table_names.end());
+    ASSERT_EQ(std::vector<std::string>({"tbl", "tbl2"}), table_names);
+
+    // tables created by the caching catalog are visible at once
+    CreateTable(&catalog, "tbl3");
+    ASSERT_OK_AND_ASSIGN(table_names, catalog.ListTables("db1"));
+    ASSERT_EQ(3, table_names.size());
+}
+
+TEST_F(CachingCatalogTest, TestExpireAfterWrite) {
+    CachingCatalog catalog(std::make_unique<FileSystemCatalog>(fs_, dir_->Str()), fs_, dir_->Str(),
+                           /*expire_after_write_ms=*/0);
+    ASSERT_OK(catalog.CreateDatabase("db1", options_, /*ignore_if_exists=*/false));
+    CreateTable(&catalog, "tbl");
+    Identifier identifier("db1", "tbl");
+    ASSERT_OK_AND_ASSIGN(std::optional<std::shared_ptr<Schema>> schema,
+                         catalog.LoadTableSchema(identifier));
+    ASSERT_OK_AND_ASSIGN(std::optional<std::shared_ptr<Schema>> reloaded_schema,
+                         catalog.LoadTableSchema(identifier));
+    ASSERT_NE(schema.value(), reloaded_schema.value());
+
+    FileSystemCatalog fs_catalog(fs_, dir_->Str());
+    CreateTable(&fs_catalog, "tbl2");
+    ASSERT_OK_AND_ASSIGN(std::vector<std::string> table_names, catalog.ListTables("db1"));
+    ASSERT_EQ(2, table_names.size());
+}
+
+}  // namespace paimon::test
@@ -18,6 +18,7 @@
 
 #include <utility>
 
+#include "paimon/core/catalog/caching_catalog.h"
 #include "paimon/core/catalog/file_system_catalog.h"
 #include "paimon/core/core_options.h"
 
@@ -31,7 +32,12 @@ const char Catalog::DB_LOCATION_PROP[] = "location";
 Result<std::unique_ptr<Catalog>> Catalog::Create(
     const std::string& root_path, const std::map<std::string, std::string>& options) {
     PAIMON_ASSIGN_OR_RAISE(CoreOptions core_options, CoreOptions::FromMap(options));
-    return std::make_unique<FileSystemCatalog>(core_options.GetFileSystem(), root_path);
+    auto catalog = std::make_unique<FileSystemCatalog>(core_options.GetFileSystem(), root_path);
+    if (core_options.CacheEnabled()) {
+        return std::make_unique<CachingCatalog>(std::move(catalog), core_options.GetFileSystem(),
+                                                root_path, core_options.GetCacheExpireAfterWrite());
+    }
+    return catalog;
 }
 
 }  // namespace paimon
@@ -29,8 +29,15 @@
 #include "paimon/common/utils/string_utils.h"
 #include "paimon/core/schema/schema_impl.h"
 #include "paimon/core/schema/schema_manager.h"
+#include "paimon/core/schema/table_schema.h"
+#include "paimon/core/snapshot.h"
+#include "paimon/core/stats/column_sketches_file.h"
+#include "paimon/core/stats/table_statistics_impl.h"
+#include "paimon/core/utils/file_store_path_factory.h"
+#include "paimon/core/utils/snapshot_manager.h"
 #include "paimon/fs/file_system.h"
 #include "paimon/logging.h"
+#include "paimon/memory/memory_pool.h"
 #include "paimon/result.h"
 
 namespace arrow {
@@ -227,4 +234,47 @@ Result<std::optional<std::shared_ptr<Schema>>> FileSystemCatalog::LoadTableSchem
     return std::optional<std::shared_ptr<Schema>>();
 }
 
+Result<std::optional<std::shared_ptr<TableStatistics>>> FileSystemCatalog::LoadTableStatistics(
+    const Identifier& identifier) const {
+    if (IsSystemTable(identifier)) {
+        return Status::NotImplemented("do not support loading statistics for system table.");
+    }
+    std::string table_path = NewDataTablePath(warehouse_, identifier);
+    SnapshotManager snapshot_manager(fs_, table_path);
+    PAIMON_ASSIGN_OR_RAISE(std::optional<Snapshot> latest_snapshot,
+                           snapshot_manager.LatestSnapshot());
+    if (!latest_snapshot) {
+        return std::optional<std::shared_ptr<TableStatistics>>();
+    }
+    std::optional<std::string> sketches_file = latest_snapshot.value().ColumnSketchesFileName();
+    if (!sketches_file) {
+        return std::optional<std::shared_ptr<TableStatistics>>();
+    }
+    std::string stats_dir = FileStorePathFactory::StatisticsPath(table_path);
+    PAIMON_ASSIGN_OR_RAISE(TableColumnSketches table_sketches,
+                           ColumnSketchesFile::ReadTableSketches(
+                               fs_, stats_dir, sketches_file.value(), GetDefaultPool()));
+    if (!table_sketches.IsComplete()) {
+        // some live data files are not sketched
+        return std::optional<std::shared_ptr<TableStatistics>>();
+    }
+    // report the current names of fields, and skip fields which were dropped
+    SchemaManager schema_manager(fs_, table_path);
+    PAIMON_ASSIGN_OR_RAISE(std::optional<std::shared_ptr<TableSchema>> latest_schema,
+                           schema_manager.Latest());
+    if (!latest_schema) {
+        return Status::Invalid(fmt::format("schema of table {} does not exist", table_path));
+    }
+    std::vector<std::shared_ptr<ColumnStatistics>> columns;
+    for (const auto& field : latest_schema.value()->Fields()) {
+        const ColumnSketch* sketch = table_sketches.merged.GetColumn(field.Id());
+        if (sketch) {
+            columns.push_back(std::make_shared<ColumnStatisticsImpl>(field.Name(), *sketch));
+        }
+    }
+    std::shared_ptr<TableStatistics> statistics = std::make_shared<TableStatisticsImpl>(
+        latest_snapshot.value().Id(), std::move(columns));
+    return std::optional<std::shared_ptr<TableStatistics>>(statistics);
+}
+
 }  // namespace paimon
@@ -51,10 +51,13 @@ class FileSystemCatalog : public Catalog {
     Result<std::vector<std::string>> ListTables(const std::string& database_names) const override;
     Result<std::optional<std::shared_ptr<Schema>>> LoadTableSchema(
         const Identifier& identifier) const override;
+    Result<std::optional<std::shared_ptr<TableStatistics>>> LoadTableStatistics(
+        const Identifier& identifier) const override;
 
- private:
     static std::string NewDatabasePath(const std::string& warehouse, const std::string& db_name);
     static std::string NewDataTablePath(const std::string& warehouse, const Identifier& identifier);
+
+ private:
     static bool IsSystemDatabase(const std::string& db_name);
     static bool IsSpecifiedSystemTable(const Identifier& identifier);
     static bool IsSystemTable(const Identifier& identifier);
@@ -250,9 +250,11 @@ struct CoreOptions::Impl {
     int64_t source_split_target_size = 128 * 1024 * 1024;
     int64_t source_split_open_file_cost = 4 * 1024 * 1024;
     int64_t manifest_target_file_size = 8 * 1024 * 1024;
+    int64_t file_index_in_manifest_threshold = 500;
     int64_t manifest_full_compaction_file_size = 16 * 1024 * 1024;
     int64_t write_buffer_size = 256 * 1024 * 1024;
     int64_t commit_timeout = std::numeric_limits<int64_t>::max();
+    int64_t cache_expire_after_write = 30 * 60 * 1000;
 
     std::shared_ptr<FileFormat> file_format;
     std::shared_ptr<FileSystem> file_system;
@@ -269,6 +271,7 @@ struct CoreOptions::Impl {
     std::string manifest_compression = "zstd";
     std::string branch = BranchManager::DEFAULT_MAIN_BRANCH;
     std::string data_file_prefix = "data-";
+    std::string metadata_stats_mode = "full";
     std::string file_system_scheme_to_identifier_map_str;
 
     std::optional<std::string> field_default_func;
@@ -297,12 +300,16 @@ struct CoreOptions::Impl {
     bool force_lookup = false;
     bool partial_update_remove_record_on_delete = false;
     bool file_index_read_enabled = true;
+    bool metadata_stats_dense_store = true;
     bool enable_adaptive_prefetch_strategy = true;
     bool index_file_in_data_file_dir = false;
     bool row_tracking_enabled = false;
     bool data_evolution_enabled = false;
     bool legacy_partition_name_enabled = true;
     bool global_index_enabled = true;
+    bool partition_stats_file_enabled = false;
+    bool column_sketches_enabled = false;
+    bool cache_enabled = false;
 };
 
 // Parse configurations from a map and return a populated CoreOptions object
@@ -439,6 +446,15 @@ Result<CoreOptions> CoreOptions::FromMap(
     // Parse file-index.read.enabled
     PAIMON_RETURN_NOT_OK(
         parser.Parse<bool>(Options::FILE_INDEX_READ_ENABLED, &impl->file_index_read_enabled));
+    // Parse file-index.in-manifest-threshold
+    PAIMON_RETURN_NOT_OK(parser.ParseMemorySize(Options::FILE_INDEX_IN_MANIFEST_THRESHOLD,
+                                                &impl->file_index_in_manifest_threshold));
+    // Parse metadata.stats-mode
+    PAIMON_RETURN_NOT_OK(
+        parser.ParseString(Options::METADATA_STATS_MODE, &impl->metadata_stats_mode));
+    // Parse metadata.stats-dense-store
+    PAIMON_RETURN_NOT_OK(parser.Parse<bool>(Options::METADATA_STATS_DENSE_STORE,
+                                            &impl->metadata_stats_dense_store));
 
     // Parse data-file.external-paths
     std::string data_file_external_paths;
@@ -470,6 +486,22 @@ Result<CoreOptions> CoreOptions::FromMap(
     // Parse global-index.enabled
     PAIMON_RETURN_NOT_OK(
         parser.Parse<bool>(Options::GLOBAL_INDEX_ENABLED, &impl->global_index_enabled));
+    // Parse partition.stats-file.enabled
+    PAIMON_RETURN_NOT_OK(parser.Parse<bool>(Options::PARTITION_STATS_FILE_ENABLED,
+                                            &impl->partition_stats_file_enabled));
+    // Parse column-sketches.enabled
+    PAIMON_RETURN_NOT_OK(
+        parser.Parse<bool>(Options::COLUMN_SKETCHES_ENABLED, &impl->column_sketches_enabled));
+    // Parse cache-enabled
+    PAIMON_RETURN_NOT_OK(parser.Parse<bool>(Options::CACHE_ENABLED, &impl->cache_enabled));
+    // Parse cache.expire-after-write
+    std::string cache_expire_after_write_str;
+    PAIMON_RETURN_NOT_OK(
+        parser.ParseString(Options::CACHE_EXPIRE_AFTER_WRITE, &cache_expire_after_write_str));
+    if (!cache_expire_after_write_str.empty()) {
+        PAIMON_ASSIGN_OR_RAISE(impl->cache_expire_after_write,
+                               TimeDuration::Parse(cache_expire_after_write_str));
+    }
     return options;
 }
 
@@ -627,6 +659,20 @@ Result<std::optional<std::string>> CoreOptions::GetFieldAggFunc(
     return std::optional<std::string>();
 }
 
+std::string CoreOptions::GetFieldStatsMode(const std::string& field_name) const {
+    std::string key = std::string(Options::FIELDS_PREFIX) + "." + field_name + "." +
+                      std::string(Options::STATS_MODE);
+    auto iter = impl_->raw_options.find(key);
+    if (iter != impl_->raw_options.end()) {
+        return iter->second;
+    }
+    return impl_->metadata_stats_mode;
+}
+
+bool CoreOptions::MetadataStatsDenseStore() const {
+    return impl_->metadata_stats_dense_store;
+}
+
 Result<bool> CoreOptions::FieldAggIgnoreRetract(const std::string& field_name) const {
     ConfigParser parser(impl_->raw_options);
     bool field_agg_ignore_retract = false;
@@ -690,6 +736,54 @@ bool CoreOptions::FileIndexReadEnabled() const {
     return impl_->file_index_read_enabled;
 }
 
+int64_t CoreOptions::GetFileIndexInManifestThreshold() const {
+    return impl_->file_index_in_manifest_threshold;
+}
+
+std::map<std::string, std::map<std::string, std::map<std::string, std::string>>>
+CoreOptions::GetFileIndexColumns() const {
+    const auto& raw_options = impl_->raw_options;
+    std::string prefix = std::string(Options::FILE_INDEX_PREFIX) + ".";
+    std::string columns_suffix = "." + std::string(Options::FILE_INDEX_COLUMNS);
+    std::map<std::string, std::map<std::string, std::map<std::string, std::string>>> columns;
+    for (const auto& [key, value] : raw_options) {
+        // file-index.$index_type.columns
+        if (!StringUtils::StartsWith(key, prefix) || !StringUtils::EndsWith(key, columns_suffix) ||
+            key.size() <= prefix.size() + columns_suffix.size()) {
+            continue;
+        }
+        std::string index_type =
+            key.substr(prefix.size(), key.size() - prefix.size() - columns_suffix.size());
+        if (index_type.find('.') != std::string::npos) {
+            continue;
+        }
+        std::string type_prefix = prefix + index_type + ".";
+        for (auto column : StringUtils::Split(value, Options::FIELDS_SEPARATOR)) {
+            StringUtils::Trim(&column);
+            if (column.empty()) {
+                continue;
+            }
+            std::string column_prefix = type_prefix + column + ".";
+            std::map<std::string, std::string> index_options;
+            for (const auto& [option_key, option_value] : raw_options) {
+                if (!StringUtils::StartsWith(option_key, type_prefix)) {
+                    continue;
+                }
+                std::string option = option_key.substr(type_prefix.size());
+                if (option.find('.') == std::string::npos &&
+                    option != Options::FILE_INDEX_COLUMNS) {
+                    // options shared by all columns, do not override the column specific ones
+                    index_options.emplace(option, option_value);
+                } else if (StringUtils::StartsWith(option_key, column_prefix)) {
+                    index_options[option_key.substr(column_prefix.size())] = option_value;
+                }
+            }
+            columns[column][index_type] = std::move(index_options);
+        }
+    }
+    return columns;
+}
+
 std::optional<std::string> CoreOptions::GetDataFileExternalPaths() const {
     return impl_->data_file_external_paths;
 }
@@ -746,4 +840,20 @@ bool CoreOptions::LegacyPartitionNameEnabled() const {
 bool CoreOptions::GlobalIndexEnabled() const {
     return impl_->global_index_enabled;
 }
+
+bool CoreOptions::PartitionStatsFileEnabled() const {
+    return impl_->partition_stats_file_enabled;
+}
+
+bool CoreOptions::ColumnSketchesEnabled() const {
+    return impl_->column_sketches_enabled;
+}
+
+bool CoreOptions::CacheEnabled() const {
+    return impl_->cache_enabled;
+}
+
+int64_t CoreOptions::GetCacheExpireAfterWrite() const {
+    return impl_->cache_expire_after_write;
+}
 }  // namespace paimon
@@ -90,10 +90,19 @@ class PAIMON_EXPORT CoreOptions {
     std::optional<std::string> GetFieldsDefaultFunc() const;
     Result<std::optional<std::string>> GetFieldAggFunc(const std::string& field_name) const;
     Result<bool> FieldAggIgnoreRetract(const std::string& field_name) const;
+    /// @return The metadata stats mode of the field, "fields.$field_name.stats-mode" if set,
+    /// otherwise "metadata.stats-mode".
+    std::string GetFieldStatsMode(const std::string& field_name) const;
+    bool MetadataStatsDenseStore() const;
     bool DeletionVectorsEnabled() const;
     ChangelogProducer GetChangelogProducer() const;
     bool NeedLookup() const;
     bool FileIndexReadEnabled() const;
+    int64_t GetFileIndexInManifestThreshold() const;
+    /// @return Options of the file indexes to build in writers, keyed by column name and index
+    /// type.
+    std::map<std::string, std::map<std::string, std::map<std::string, std::string>>>
+    GetFileIndexColumns() const;
 
     std::map<std::string, std::string> GetFieldsSequenceGroups() const;
     bool PartialUpdateRemoveRecordOnDelete() const;
@@ -117,6 +126,10 @@ class PAIMON_EXPORT CoreOptions {
     bool LegacyPartitionNameEnabled() const;
 
     bool GlobalIndexEnabled() const;
+    bool PartitionStatsFileEnabled() const;
+    bool ColumnSketchesEnabled() const;
+    bool CacheEnabled() const;
+    int64_t GetCacheExpireAfterWrite() const;
     const std::map<std::string, std::string>& ToMap() const;
 
  private:
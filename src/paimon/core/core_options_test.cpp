@@ -87,6 +87,10 @@ TEST(CoreOptionsTest, TestDefaultValue) {
     ASSERT_FALSE(core_options.DataEvolutionEnabled());
     ASSERT_TRUE(core_options.LegacyPartitionNameEnabled());
     ASSERT_TRUE(core_options.GlobalIndexEnabled());
+    ASSERT_FALSE(core_options.PartitionStatsFileEnabled());
+    ASSERT_FALSE(core_options.ColumnSketchesEnabled());
+    ASSERT_FALSE(core_options.CacheEnabled());
+    ASSERT_EQ(30 * 60 * 1000, core_options.GetCacheExpireAfterWrite());
 }
 
 TEST(CoreOptionsTest, TestFromMap) {
@@ -144,6 +148,10 @@ TEST(CoreOptionsTest, TestFromMap) {
         {Options::DATA_EVOLUTION_ENABLED, "true"},
         {Options::PARTITION_GENERATE_LEGACY_NAME, "false"},
         {Options::GLOBAL_INDEX_ENABLED, "false"},
+        {Options::PARTITION_STATS_FILE_ENABLED, "true"},
+        {Options::COLUMN_SKETCHES_ENABLED, "true"},
+        {Options::CACHE_ENABLED, "true"},
+        {Options::CACHE_EXPIRE_AFTER_WRITE, "10 s"},
     };
 
     ASSERT_OK_AND_ASSIGN(CoreOptions core_options, CoreOptions::FromMap(options));
@@ -212,6 +220,10 @@ TEST(CoreOptionsTest, TestFromMap) {
     ASSERT_TRUE(core_options.DataEvolutionEnabled());
     ASSERT_FALSE(core_options.LegacyPartitionNameEnabled());
     ASSERT_FALSE(core_options.GlobalIndexEnabled());
+    ASSERT_TRUE(core_options.PartitionStatsFileEnabled());
+    ASSERT_TRUE(core_options.ColumnSketchesEnabled());
+    ASSERT_TRUE(core_options.CacheEnabled());
+    ASSERT_EQ(10 * 1000, core_options.GetCacheExpireAfterWrite());
 }
 
 TEST(CoreOptionsTest, TestInvalidCase) {
@@ -243,6 +255,46 @@ TEST(CoreOptionsTest, TestCreateExternalPath) {
     ASSERT_EQ("FILE:/tmp/index3", external_paths[2]);
 }
 
+TEST(CoreOptionsTest, TestFileIndexColumns) {
+    std::map<std::string, std::string> options = {
+        {"file-index.bitmap.columns", "f1, f2"},
+        {"file-index.bitmap.version", "1"},
+        {"file-index.bitmap.f1.version", "2"},
+        {"file-index.bloom-filter.columns", "f2"},
+        {"file-index.bloom-filter.f2.items", "100"},
+        {"file-index.bsi.f3.version", "1"},
+        {Options::FILE_INDEX_READ_ENABLED, "false"},
+        {Options::FILE_INDEX_IN_MANIFEST_THRESHOLD, "1 kb"},
+    };
+    ASSERT_OK_AND_ASSIGN(CoreOptions core_options, CoreOptions::FromMap(options));
+    ASSERT_EQ(1024, core_options.GetFileIndexInManifestThreshold());
+    std::map<std::string, std::map<std::string, std::map<std::string, std::string>>> expected = {
+        {"f1", {{"bitmap", {{"version", "2"}}}}},
+        {"f2", {{"bitmap", {{"version", "1"}}}, {"bloom-filter", {{"items", "100"}}}}},
+    };
+    ASSERT_EQ(expected, core_options.GetFileIndexColumns());
+
+    ASSERT_OK_AND_ASSIGN(CoreOptions default_options, CoreOptions::FromMap({}));
+    ASSERT_EQ(500, default_options.GetFileIndexInManifestThreshold());
+    ASSERT_TRUE(default_options.GetFileIndexColumns().empty());
+}
+
+TEST(CoreOptionsTest, TestMetadataStatsMode) {
+    std::map<std::string, std::string> options = {
+        {Options::METADATA_STATS_MODE, "truncate(16)"},
+        {"fields.f1.stats-mode", "none"},
+        {Options::METADATA_STATS_DENSE_STORE, "false"},
+    };
+    ASSERT_OK_AND_ASSIGN(CoreOptions core_options, CoreOptions::FromMap(options));
+    ASSERT_EQ("truncate(16)", core_options.GetFieldStatsMode("f0"));
+    ASSERT_EQ("none", core_options.GetFieldStatsMode("f1"));
+    ASSERT_FALSE(core_options.MetadataStatsDenseStore());
+
+    ASSERT_OK_AND_ASSIGN(CoreOptions default_options, CoreOptions::FromMap({}));
+    ASSERT_EQ("full", default_options.GetFieldStatsMode("f0"));
+    ASSERT_TRUE(default_options.MetadataStatsDenseStore());
+}
+
 TEST(CoreOptionsTest, TestInvalidCreateExternalPath) {
     {
         std::map<std::string, std::string> options = {
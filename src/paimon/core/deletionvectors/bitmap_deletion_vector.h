@@ -51,6 +51,10 @@ class BitmapDeletionVector : public DeletionVector {
         return roaring_bitmap_.IsEmpty();
     }
 
+    int64_t GetCardinality() const override {
+        return roaring_bitmap_.Cardinality();
+    }
+
     Result<PAIMON_UNIQUE_PTR<Bytes>> SerializeToBytes(
         const std::shared_ptr<MemoryPool>& pool) override {
         std::shared_ptr<Bytes> bitmap_bytes = roaring_bitmap_.Serialize(pool.get());
@@ -0,0 +1,90 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+#include "arrow/c/abi.h"
+#include "paimon/common/reader/reader_utils.h"
+#include "paimon/reader/batch_reader.h"
+#include "paimon/result.h"
+#include "paimon/status.h"
+#include "paimon/utils/roaring_bitmap32.h"
+
+namespace paimon {
+class Metrics;
+
+/// Only returns the rows of a data file whose positions are in `deleted_rows`, e.g. the rows newly
+/// deleted by a deletion vector. The inner reader must return all rows of the file in order, so
+/// no selection bitmap, deletion vector or predicate may be pushed down into it.
+class DeletedRowsBatchReader : public BatchReader {
+ public:
+    DeletedRowsBatchReader(std::unique_ptr<BatchReader>&& reader, RoaringBitmap32&& deleted_rows)
+        : reader_(std::move(reader)), deleted_rows_(std::move(deleted_rows)) {
+        assert(reader_);
+    }
+
+    Result<ReadBatch> NextBatch() override {
+        return Status::Invalid(
+            "paimon inner reader DeletedRowsBatchReader should use NextBatchWithBitmap");
+    }
+
+    Result<ReadBatchWithBitmap> NextBatchWithBitmap() override {
+        while (true) {
+            PAIMON_ASSIGN_OR_RAISE(ReadBatchWithBitmap batch_with_bitmap,
+                                   reader_->NextBatchWithBitmap());
+            if (BatchReader::IsEofBatch(batch_with_bitmap)) {
+                return batch_with_bitmap;
+            }
+            auto& [batch, bitmap] = batch_with_bitmap;
+            int32_t batch_size = batch.first->length;
+            bitmap &= Filter(next_row_position_, batch_size);
+            next_row_position_ += batch_size;
+            if (bitmap.IsEmpty()) {
+                ReaderUtils::ReleaseReadBatch(std::move(batch));
+                continue;
+            }
+            return batch_with_bitmap;
+        }
+    }
+
+    void Close() override {
+        return reader_->Close();
+    }
+
+    std::shared_ptr<Metrics> GetReaderMetrics() const override {
+        return reader_->GetReaderMetrics();
+    }
+
+ private:
+    RoaringBitmap32 Filter(int32_t start_pos, int32_t length) const {
+        RoaringBitmap32 is_deleted;
+        for (auto iter = deleted_rows_.EqualOrLarger(start_pos);
+             iter != deleted_rows_.End() && *iter < start_pos + length; ++iter) {
+            is_deleted.Add(*iter - start_pos);
+        }
+        return is_deleted;
+    }
+
+ private:
+    std::unique_ptr<BatchReader> reader_;
+    RoaringBitmap32 deleted_rows_;
+    int32_t next_row_position_ = 0;
+};
+}  // namespace paimon
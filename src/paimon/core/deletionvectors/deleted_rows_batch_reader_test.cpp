@@ -0,0 +1,77 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/deletionvectors/deleted_rows_batch_reader.h"
+
+#include <string>
+#include <vector>
+
+#include "arrow/api.h"
+#include "arrow/array/array_nested.h"
+#include "arrow/ipc/json_simple.h"
+#include "gtest/gtest.h"
+#include "paimon/testing/mock/mock_file_batch_reader.h"
+#include "paimon/testing/utils/read_result_collector.h"
+#include "paimon/testing/utils/testharness.h"
+
+namespace paimon::test {
+class DeletedRowsBatchReaderTest : public ::testing::Test {
+ public:
+    void SetUp() override {
+        int_type_ = arrow::int32();
+        target_type_ = arrow::struct_({arrow::field("f1", int_type_)});
+    }
+
+    void CheckResult(const std::string& data_str, const std::vector<int32_t>& deleted_rows,
+                     const std::string& expected_str) const {
+        auto f1 = arrow::ipc::internal::json::ArrayFromJSON(int_type_, data_str).ValueOrDie();
+        std::shared_ptr<arrow::Array> data =
+            arrow::StructArray::Make({f1}, target_type_->fields()).ValueOrDie();
+        for (int32_t batch_size : {1, 2, 3, 10}) {
+            auto reader = std::make_unique<DeletedRowsBatchReader>(
+                std::make_unique<MockFileBatchReader>(data, target_type_, batch_size),
+                RoaringBitmap32::From(deleted_rows));
+            ASSERT_OK_AND_ASSIGN(std::shared_ptr<arrow::ChunkedArray> result,
+                                 ReadResultCollector::CollectResult(reader.get()));
+            if (expected_str.empty()) {
+                ASSERT_FALSE(result);
+            } else {
+                auto expected =
+                    arrow::ipc::internal::json::ArrayFromJSON(int_type_, expected_str).ValueOrDie();
+                std::shared_ptr<arrow::Array> expected_array =
+                    arrow::StructArray::Make({expected}, target_type_->fields()).ValueOrDie();
+                ASSERT_TRUE(result);
+                ASSERT_TRUE(result->Equals(arrow::ChunkedArray(expected_array)))
+                    << result->ToString();
+            }
+            reader->Close();
+        }
+    }
+
+ private:
+    std::shared_ptr<arrow::DataType> int_type_;
+    std::shared_ptr<arrow::DataType> target_type_;
+};
+
+TEST_F(DeletedRowsBatchReaderTest, TestSimple) {
+    std::string data_str = "[10, 11, 12, 13, 14, 15, 16]";
+    CheckResult(data_str, {1, 2, 6}, "[11, 12, 16]");
+    CheckResult(data_str, {0, 1, 2, 3, 4, 5, 6}, data_str);
+    CheckResult(data_str, {3}, "[13]");
+    // no row is deleted
+    CheckResult(data_str, {}, "");
+}
+}  // namespace paimon::test
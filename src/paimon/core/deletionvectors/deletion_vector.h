@@ -72,6 +72,9 @@ class DeletionVector {
     /// @return true if the deletion vector is empty, false if it contains deletions.
     virtual bool IsEmpty() const = 0;
 
+    /// @return The number of rows marked as deleted.
+    virtual int64_t GetCardinality() const = 0;
+
     /// Serializes the deletion vector to a byte array for storage or transmission.
     ///
     /// @return A byte array representing the serialized deletion vector.
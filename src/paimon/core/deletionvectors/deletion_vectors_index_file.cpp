@@ -0,0 +1,117 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/deletionvectors/deletion_vectors_index_file.h"
+
+#include <optional>
+#include <utility>
+
+#include "arrow/util/crc32.h"
+#include "fmt/format.h"
+#include "paimon/common/io/data_output_stream.h"
+#include "paimon/common/utils/linked_hash_map.h"
+#include "paimon/common/utils/path_util.h"
+#include "paimon/core/index/deletion_vector_meta.h"
+#include "paimon/core/index/index_file_meta.h"
+#include "paimon/core/index/index_path_factory.h"
+#include "paimon/fs/file_system.h"
+#include "paimon/io/data_input_stream.h"
+#include "paimon/memory/bytes.h"
+#include "paimon/memory/memory_pool.h"
+#include "paimon/status.h"
+
+namespace paimon {
+
+Result<std::map<std::string, PAIMON_UNIQUE_PTR<DeletionVector>>>
+DeletionVectorsIndexFile::ReadAllDeletionVectors(const std::shared_ptr<IndexFileMeta>& file) const {
+    std::map<std::string, PAIMON_UNIQUE_PTR<DeletionVector>> deletion_vectors;
+    const auto& dv_ranges = file->DvRanges();
+    if (dv_ranges == std::nullopt || dv_ranges->empty()) {
+        return deletion_vectors;
+    }
+    std::string path = path_factory_->ToPath(file);
+    PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<InputStream> input, file_system_->Open(path));
+    DataInputStream input_stream(input);
+    PAIMON_ASSIGN_OR_RAISE(int8_t version, input_stream.ReadValue<int8_t>());
+    if (version != VERSION_ID_V1) {
+        return Status::Invalid(fmt::format(
+            "Version not match, actual version: {}, expect version: {}, file path: {}", version,
+            VERSION_ID_V1, path));
+    }
+    for (const auto& [data_file_name, dv_meta] : dv_ranges.value()) {
+        PAIMON_RETURN_NOT_OK(input_stream.Seek(dv_meta.offset));
+        PAIMON_ASSIGN_OR_RAISE(int32_t actual_length, input_stream.ReadValue<int32_t>());
+        if (actual_length != dv_meta.length) {
+            return Status::Invalid(
+                fmt::format("Size not match, actual size: {}, expect size: {}, file path: {}",
+                            actual_length, dv_meta.length, path));
+        }
+        auto bytes = Bytes::AllocateBytes(dv_meta.length, pool_.get());
+        PAIMON_RETURN_NOT_OK(input_stream.ReadBytes(bytes.get()));
+        PAIMON_ASSIGN_OR_RAISE(int32_t checksum, input_stream.ReadValue<int32_t>());
+        auto actual_checksum =
+            static_cast<int32_t>(arrow::internal::crc32(0, bytes->data(), bytes->size()));
+        if (actual_checksum != checksum) {
+            return Status::Invalid(fmt::format(
+                "Checksum not match, actual checksum: {}, expect checksum: {}, file path: {}",
+                actual_checksum, checksum, path));
+        }
+        PAIMON_ASSIGN_OR_RAISE(PAIMON_UNIQUE_PTR<DeletionVector> deletion_vector,
+                               DeletionVector::DeserializeFromBytes(bytes.get(), pool_.get()));
+        deletion_vectors.emplace(data_file_name, std::move(deletion_vector));
+    }
+    return deletion_vectors;
+}
+
+Result<std::shared_ptr<IndexFileMeta>> DeletionVectorsIndexFile::WriteSingleFile(
+    const std::map<std::string, PAIMON_UNIQUE_PTR<DeletionVector>>& deletion_vectors) const {
+    std::string path = path_factory_->NewPath();
+    PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<OutputStream> output,
+                           file_system_->Create(path, /*overwrite=*/false));
+    DataOutputStream output_stream(output);
+    PAIMON_RETURN_NOT_OK(output_stream.WriteValue<char>(static_cast<char>(VERSION_ID_V1)));
+    LinkedHashMap<std::string, DeletionVectorMeta> dv_ranges;
+    for (const auto& [data_file_name, deletion_vector] : deletion_vectors) {
+        if (deletion_vector == nullptr || deletion_vector->IsEmpty()) {
+            continue;
+        }
+        PAIMON_ASSIGN_OR_RAISE(int64_t offset, output->GetPos());
+        PAIMON_ASSIGN_OR_RAISE(PAIMON_UNIQUE_PTR<Bytes> unique_bytes,
+                               deletion_vector->SerializeToBytes(pool_));
+        std::shared_ptr<Bytes> bytes = std::move(unique_bytes);
+        auto checksum =
+            static_cast<int32_t>(arrow::internal::crc32(0, bytes->data(), bytes->size()));
+        PAIMON_RETURN_NOT_OK(output_stream.WriteValue<int32_t>(bytes->size()));
+        PAIMON_RETURN_NOT_OK(output_stream.WriteBytes(bytes));
+        PAIMON_RETURN_NOT_OK(output_stream.WriteValue<int32_t>(checksum));
+        dv_ranges.insert(data_file_name,
+                         DeletionVectorMeta(data_file_name, static_cast<int32_t>(offset),
+                                            static_cast<int32_t>(bytes->size()),
+                                            deletion_vector->GetCardinality()));
+    }
+    PAIMON_RETURN_NOT_OK(output->Flush());
+    PAIMON_ASSIGN_OR_RAISE(int64_t file_size, output->GetPos());
+    PAIMON_RETURN_NOT_OK(output->Close());
+    std::optional<std::string> external_path;
+    if (path_factory_->IsExternalPath()) {
+        external_path = path;
+    }
+    return std::make_shared<IndexFileMeta>(
+        DELETION_VECTORS_INDEX, PathUtil::GetName(path), file_size,
+        /*row_count=*/static_cast<int64_t>(dv_ranges.size()), dv_ranges, external_path);
+}
+
+}  // namespace paimon
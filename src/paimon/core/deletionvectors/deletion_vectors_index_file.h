@@ -15,12 +15,46 @@
  */
 
 #pragma once
+#include <cstdint>
+#include <map>
+#include <memory>
 #include <string>
+
+#include "paimon/core/deletionvectors/deletion_vector.h"
+#include "paimon/result.h"
+
 namespace paimon {
-/// DeletionVectors index file.
-// TODO(xinyu.lxy): add IndexFile
+class FileSystem;
+class IndexFileMeta;
+class IndexPathFactory;
+class MemoryPool;
+
+/// DeletionVectors index file, one file holds the deletion vectors of all data files in a bucket.
+///
+/// Layout (compatible with Java Paimon): a version byte, then for each deletion vector its
+/// serialized length (int32), its serialized bytes and the crc32 of these bytes (int32).
 class DeletionVectorsIndexFile {
  public:
     static constexpr char DELETION_VECTORS_INDEX[] = "DELETION_VECTORS";
+    static constexpr int8_t VERSION_ID_V1 = 1;
+
+    DeletionVectorsIndexFile(const std::shared_ptr<FileSystem>& file_system,
+                             const std::shared_ptr<IndexPathFactory>& path_factory,
+                             const std::shared_ptr<MemoryPool>& pool)
+        : file_system_(file_system), path_factory_(path_factory), pool_(pool) {}
+
+    /// Read all deletion vectors in `file`, keyed by data file name.
+    Result<std::map<std::string, PAIMON_UNIQUE_PTR<DeletionVector>>> ReadAllDeletionVectors(
+        const std::shared_ptr<IndexFileMeta>& file) const;
+
+    /// Write `deletion_vectors` (keyed by data file name) to a new index file, empty deletion
+    /// vectors are skipped.
+    Result<std::shared_ptr<IndexFileMeta>> WriteSingleFile(
+        const std::map<std::string, PAIMON_UNIQUE_PTR<DeletionVector>>& deletion_vectors) const;
+
+ private:
+    std::shared_ptr<FileSystem> file_system_;
+    std::shared_ptr<IndexPathFactory> path_factory_;
+    std::shared_ptr<MemoryPool> pool_;
 };
 }  // namespace paimon
@@ -0,0 +1,127 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/deletionvectors/deletion_vectors_index_file.h"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "gtest/gtest.h"
+#include "paimon/common/utils/path_util.h"
+#include "paimon/core/deletionvectors/bitmap_deletion_vector.h"
+#include "paimon/core/index/index_file_meta.h"
+#include "paimon/core/index/index_path_factory.h"
+#include "paimon/core/table/source/deletion_file.h"
+#include "paimon/fs/local/local_file_system.h"
+#include "paimon/memory/memory_pool.h"
+#include "paimon/testing/utils/testharness.h"
+
+namespace paimon::test {
+class DeletionVectorsIndexFileTest : public ::testing::Test {
+ public:
+    void SetUp() override {
+        dir_ = UniqueTestDirectory::Create();
+        ASSERT_TRUE(dir_);
+        fs_ = std::make_shared<LocalFileSystem>();
+        pool_ = GetDefaultPool();
+        path_factory_ = std::make_shared<FakeIndexPathFactory>(dir_->Str());
+    }
+
+    class FakeIndexPathFactory : public IndexPathFactory {
+     public:
+        explicit FakeIndexPathFactory(const std::string& index_path) : index_path_(index_path) {}
+        std::string NewPath() const override {
+            return ToPath(IndexPathFactory::INDEX_PREFIX + std::to_string(count_++));
+        }
+        std::string ToPath(const std::shared_ptr<IndexFileMeta>& file) const override {
+            return ToPath(file->FileName());
+        }
+        std::string ToPath(const std::string& file_name) const override {
+            return PathUtil::JoinPath(index_path_, file_name);
+        }
+        bool IsExternalPath() const override {
+            return false;
+        }
+
+     private:
+        std::string index_path_;
+        mutable int32_t count_ = 0;
+    };
+
+    PAIMON_UNIQUE_PTR<DeletionVector> MakeDeletionVector(const std::vector<int32_t>& positions) {
+        return pool_->AllocateUnique<BitmapDeletionVector>(RoaringBitmap32::From(positions));
+    }
+
+ protected:
+    std::unique_ptr<UniqueTestDirectory> dir_;
+    std::shared_ptr<FileSystem> fs_;
+    std::shared_ptr<MemoryPool> pool_;
+    std::shared_ptr<IndexPathFactory> path_factory_;
+};
+
+TEST_F(DeletionVectorsIndexFileTest, TestWriteAndRead) {
+    DeletionVectorsIndexFile index_file(fs_, path_factory_, pool_);
+    std::map<std::string, PAIMON_UNIQUE_PTR<DeletionVector>> deletion_vectors;
+    deletion_vectors["data-1.orc"] = MakeDeletionVector({1, 3, 5});
+    deletion_vectors["data-2.orc"] = MakeDeletionVector({});
+    deletion_vectors["data-3.orc"] = MakeDeletionVector({0, 100000});
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<IndexFileMeta> meta,
+                         index_file.WriteSingleFile(deletion_vectors));
+    ASSERT_EQ(DeletionVectorsIndexFile::DELETION_VECTORS_INDEX, meta->IndexType());
+    // empty deletion vector is skipped
+    ASSERT_EQ(2, meta->RowCount());
+    ASSERT_TRUE(meta->DvRanges());
+    ASSERT_EQ(2, meta->DvRanges()->size());
+    ASSERT_EQ(std::nullopt, meta->ExternalPath());
+    ASSERT_OK_AND_ASSIGN(auto file_status, fs_->GetFileStatus(path_factory_->ToPath(meta)));
+    ASSERT_EQ(meta->FileSize(), file_status->GetLen());
+
+    ASSERT_OK_AND_ASSIGN(auto result, index_file.ReadAllDeletionVectors(meta));
+    ASSERT_EQ(2, result.size());
+    ASSERT_EQ(3, result["data-1.orc"]->GetCardinality());
+    ASSERT_TRUE(result["data-1.orc"]->IsDeleted(3).value());
+    ASSERT_FALSE(result["data-1.orc"]->IsDeleted(4).value());
+    ASSERT_EQ(2, result["data-3.orc"]->GetCardinality());
+    ASSERT_TRUE(result["data-3.orc"]->IsDeleted(100000).value());
+
+    // each range can be read alone as a deletion file
+    for (const auto& [data_file_name, dv_meta] : meta->DvRanges().value()) {
+        DeletionFile deletion_file(path_factory_->ToPath(meta), dv_meta.offset, dv_meta.length,
+                                   dv_meta.cardinality);
+        ASSERT_OK_AND_ASSIGN(auto deletion_vector,
+                             DeletionVector::Read(fs_.get(), deletion_file, pool_.get()));
+        ASSERT_EQ(dv_meta.cardinality.value(), deletion_vector->GetCardinality());
+    }
+}
+
+TEST_F(DeletionVectorsIndexFileTest, TestReadCorruptedFile) {
+    DeletionVectorsIndexFile index_file(fs_, path_factory_, pool_);
+    std::map<std::string, PAIMON_UNIQUE_PTR<DeletionVector>> deletion_vectors;
+    deletion_vectors["data-1.orc"] = MakeDeletionVector({1, 3, 5});
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<IndexFileMeta> meta,
+                         index_file.WriteSingleFile(deletion_vectors));
+    std::string path = path_factory_->ToPath(meta);
+    std::string content;
+    ASSERT_OK(fs_->ReadFile(path, &content));
+    // flip a byte of the serialized bitmap
+    content[content.size() - 5] ^= 0x1;
+    ASSERT_OK(fs_->WriteFile(path, content, /*overwrite=*/true));
+    ASSERT_NOK_WITH_MSG(index_file.ReadAllDeletionVectors(meta), "Checksum not match");
+}
+
+}  // namespace paimon::test
@@ -24,6 +24,7 @@
 #include <vector>
 
 #include "paimon/common/data/binary_row.h"
+#include "paimon/core/deletionvectors/deletion_vectors_index_file.h"
 #include "paimon/core/index/index_file_meta.h"
 #include "paimon/core/index/index_path_factory.h"
 #include "paimon/core/manifest/index_manifest_entry.h"
@@ -33,6 +34,8 @@
 #include "paimon/result.h"
 
 namespace paimon {
+class FileSystem;
+class MemoryPool;
 class Snapshot;
 
 class IndexFileHandler {
@@ -60,6 +63,15 @@ class IndexFileHandler {
         return factory->ToPath(file);
     }
 
+    /// Create a `DeletionVectorsIndexFile` to read and write deletion vectors of the bucket.
+    Result<std::unique_ptr<DeletionVectorsIndexFile>> DvIndex(
+        const std::shared_ptr<FileSystem>& file_system, const BinaryRow& partition,
+        int32_t bucket, const std::shared_ptr<MemoryPool>& pool) const {
+        PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<IndexPathFactory> factory,
+                               path_factories_->Get(partition, bucket));
+        return std::make_unique<DeletionVectorsIndexFile>(file_system, factory, pool);
+    }
+
  private:
     std::unique_ptr<IndexManifestFile> index_manifest_file_;
     std::shared_ptr<IndexFilePathFactories> path_factories_;
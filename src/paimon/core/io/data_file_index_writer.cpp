@@ -0,0 +1,131 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/io/data_file_index_writer.h"
+
+#include <utility>
+
+#include "arrow/api.h"
+#include "arrow/c/bridge.h"
+#include "fmt/format.h"
+#include "paimon/common/utils/arrow/status_utils.h"
+#include "paimon/core/io/data_file_path_factory.h"
+#include "paimon/file_index/file_index_format.h"
+#include "paimon/file_index/file_index_writer.h"
+#include "paimon/file_index/file_indexer.h"
+#include "paimon/file_index/file_indexer_factory.h"
+#include "paimon/fs/file_system.h"
+
+namespace paimon {
+
+DataFileIndexWriter::DataFileIndexWriter(const std::shared_ptr<arrow::Schema>& schema,
+                                         std::vector<ColumnIndexWriter>&& index_writers,
+                                         int64_t in_manifest_threshold,
+                                         const std::shared_ptr<MemoryPool>& pool)
+    : schema_(schema),
+      batch_type_(arrow::struct_(schema->fields())),
+      index_writers_(std::move(index_writers)),
+      in_manifest_threshold_(in_manifest_threshold),
+      pool_(pool) {}
+
+DataFileIndexWriter::~DataFileIndexWriter() = default;
+
+Result<std::unique_ptr<DataFileIndexWriter>> DataFileIndexWriter::Create(
+    const std::shared_ptr<arrow::Schema>& schema,
+    const std::map<std::string, std::map<std::string, std::map<std::string, std::string>>>&
+        index_columns,
+    int64_t in_manifest_threshold, const std::shared_ptr<MemoryPool>& pool) {
+    std::vector<ColumnIndexWriter> index_writers;
+    for (const auto& [column_name, indexes] : index_columns) {
+        // e.g., the column is not written to this file when write columns are specified
+        int32_t field_index = schema->GetFieldIndex(column_name);
+        if (field_index < 0) {
+            continue;
+        }
+        for (const auto& [index_type, options] : indexes) {
+            PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<FileIndexer> file_indexer,
+                                   FileIndexerFactory::Get(index_type, options));
+            if (!file_indexer) {
+                // skip the index not registered, same as readers
+                continue;
+            }
+            ArrowSchema c_schema;
+            PAIMON_RETURN_NOT_OK_FROM_ARROW(
+                arrow::ExportSchema(*arrow::schema({schema->field(field_index)}), &c_schema));
+            Result<std::shared_ptr<FileIndexWriter>> writer =
+                file_indexer->CreateWriter(&c_schema, pool);
+            if (!writer.ok() && writer.status().IsNotImplemented()) {
+                // readers do not filter the data file by a missing index
+                continue;
+            }
+            PAIMON_RETURN_NOT_OK(writer.status());
+            index_writers.push_back(
+                {column_name, index_type, field_index, std::move(writer).value()});
+        }
+    }
+    if (index_writers.empty()) {
+        return std::unique_ptr<DataFileIndexWriter>();
+    }
+    return std::unique_ptr<DataFileIndexWriter>(
+        new DataFileIndexWriter(schema, std::move(index_writers), in_manifest_threshold, pool));
+}
+
+Status DataFileIndexWriter::Write(const arrow::Array& batch) {
+    if (!batch.type()->Equals(*batch_type_, /*check_metadata=*/false)) {
+        return Status::Invalid(
+            fmt::format("batch type {} mismatches schema of file index writer {}",
+                        batch.type()->ToString(), batch_type_->ToString()));
+    }
+    const auto& struct_batch = static_cast<const arrow::StructArray&>(batch);
+    for (const auto& index_writer : index_writers_) {
+        // a single field struct array of the indexed column, which shares buffers with the batch
+        PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(
+            std::shared_ptr<arrow::Array> column_batch,
+            arrow::StructArray::Make({struct_batch.field(index_writer.field_index)},
+                                     {schema_->field(index_writer.field_index)}));
+        ArrowArray c_array;
+        PAIMON_RETURN_NOT_OK_FROM_ARROW(arrow::ExportArray(*column_batch, &c_array));
+        PAIMON_RETURN_NOT_OK(index_writer.writer->AddBatch(&c_array));
+    }
+    return Status::OK();
+}
+
+Result<PAIMON_UNIQUE_PTR<Bytes>> DataFileIndexWriter::Serialize() const {
+    std::map<std::string, std::map<std::string, std::shared_ptr<Bytes>>> column_indexes;
+    for (const auto& index_writer : index_writers_) {
+        PAIMON_ASSIGN_OR_RAISE(PAIMON_UNIQUE_PTR<Bytes> index_bytes,
+                               index_writer.writer->SerializedBytes());
+        column_indexes[index_writer.column_name][index_writer.index_type] = std::move(index_bytes);
+    }
+    return FileIndexFormat::WriteColumnIndexes(column_indexes, pool_);
+}
+
+Status DataFileIndexWriter::WriteIndex(const std::shared_ptr<FileSystem>& fs,
+                                       const std::string& data_file_path,
+                                       std::vector<std::string>* extra_paths,
+                                       std::shared_ptr<Bytes>* embedded_index) const {
+    PAIMON_ASSIGN_OR_RAISE(PAIMON_UNIQUE_PTR<Bytes> index_bytes, Serialize());
+    if (static_cast<int64_t>(index_bytes->size()) <= in_manifest_threshold_) {
+        *embedded_index = std::move(index_bytes);
+        return Status::OK();
+    }
+    std::string index_path = data_file_path + DataFilePathFactory::INDEX_PATH_SUFFIX;
+    extra_paths->push_back(index_path);
+    return fs->WriteFile(index_path, std::string(index_bytes->data(), index_bytes->size()),
+                         /*overwrite=*/false);
+}
+
+}  // namespace paimon
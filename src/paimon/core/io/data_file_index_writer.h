@@ -0,0 +1,103 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "paimon/memory/bytes.h"
+#include "paimon/result.h"
+#include "paimon/status.h"
+
+namespace arrow {
+class Array;
+class DataType;
+class Schema;
+}  // namespace arrow
+
+namespace paimon {
+class FileIndexWriter;
+class FileSystem;
+class MemoryPool;
+
+/// Builds the file indexes of a data file from the written arrow batches, which are serialized in
+/// the format of `FileIndexFormat` when the data file is closed.
+///
+/// The index is embedded in the `DataFileMeta` of the data file if it is not larger than the
+/// in-manifest threshold, otherwise it is written to a separate index file next to the data file.
+class DataFileIndexWriter {
+ public:
+    /// @param schema Schema of the batches to index.
+    /// @param index_columns Options of the file indexes to build, keyed by column name and index
+    /// type, see `CoreOptions::GetFileIndexColumns()`. Columns which are not in the schema are
+    /// skipped, as well as index types which are not registered or cannot be written.
+    /// @param in_manifest_threshold Max size of the index embedded in the data file meta.
+    /// @return nullptr if no index is built for the schema.
+    static Result<std::unique_ptr<DataFileIndexWriter>> Create(
+        const std::shared_ptr<arrow::Schema>& schema,
+        const std::map<std::string, std::map<std::string, std::map<std::string, std::string>>>&
+            index_columns,
+        int64_t in_manifest_threshold, const std::shared_ptr<MemoryPool>& pool);
+
+    ~DataFileIndexWriter();
+
+    /// Adds a struct array whose fields match the schema to the indexes.
+    Status Write(const arrow::Array& batch);
+
+    /// @return The serialized indexes of all indexed columns.
+    Result<PAIMON_UNIQUE_PTR<Bytes>> Serialize() const;
+
+    /// Serializes the indexes of a data file, and either embeds them in `embedded_index` if they do
+    /// not exceed the in-manifest threshold, or writes them to an index file next to the data file
+    /// whose path is appended to `extra_paths`.
+    Status WriteIndex(const std::shared_ptr<FileSystem>& fs, const std::string& data_file_path,
+                      std::vector<std::string>* extra_paths,
+                      std::shared_ptr<Bytes>* embedded_index) const;
+
+    int64_t InManifestThreshold() const {
+        return in_manifest_threshold_;
+    }
+
+    /// @return The struct type of the indexed batches.
+    const std::shared_ptr<arrow::DataType>& BatchType() const {
+        return batch_type_;
+    }
+
+ private:
+    struct ColumnIndexWriter {
+        std::string column_name;
+        std::string index_type;
+        // index of the column in the batch
+        int32_t field_index;
+        std::shared_ptr<FileIndexWriter> writer;
+    };
+
+    DataFileIndexWriter(const std::shared_ptr<arrow::Schema>& schema,
+                        std::vector<ColumnIndexWriter>&& index_writers,
+                        int64_t in_manifest_threshold, const std::shared_ptr<MemoryPool>& pool);
+
+    std::shared_ptr<arrow::Schema> schema_;
+    std::shared_ptr<arrow::DataType> batch_type_;
+    std::vector<ColumnIndexWriter> index_writers_;
+    int64_t in_manifest_threshold_;
+    std::shared_ptr<MemoryPool> pool_;
+};
+
+}  // namespace paimon
@@ -0,0 +1,163 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/io/data_file_index_writer.h"
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/api.h"
+#include "arrow/c/bridge.h"
+#include "arrow/ipc/json_simple.h"
+#include "gtest/gtest.h"
+#include "paimon/common/utils/path_util.h"
+#include "paimon/file_index/file_index_format.h"
+#include "paimon/file_index/file_index_result.h"
+#include "paimon/fs/local/local_file_system.h"
+#include "paimon/io/byte_array_input_stream.h"
+#include "paimon/memory/bytes.h"
+#include "paimon/memory/memory_pool.h"
+#include "paimon/predicate/literal.h"
+#include "paimon/status.h"
+#include "paimon/testing/utils/testharness.h"
+
+namespace paimon::test {
+class DataFileIndexWriterTest : public ::testing::Test {
+ public:
+    void SetUp() override {
+        pool_ = GetDefaultPool();
+        schema_ = arrow::schema({arrow::field("f0", arrow::utf8()),
+                                 arrow::field("f1", arrow::int32()),
+                                 arrow::field("f2", arrow::float64())});
+    }
+
+    std::shared_ptr<arrow::Array> MakeBatch(const std::string& json) const {
+        return arrow::ipc::internal::json::ArrayFromJSON(arrow::struct_(schema_->fields()), json)
+            .ValueOrDie();
+    }
+
+    std::unique_ptr<::ArrowSchema> CreateArrowSchema() const {
+        auto c_schema = std::make_unique<::ArrowSchema>();
+        EXPECT_TRUE(arrow::ExportSchema(*schema_, c_schema.get()).ok());
+        return c_schema;
+    }
+
+ protected:
+    std::shared_ptr<MemoryPool> pool_;
+    std::shared_ptr<arrow::Schema> schema_;
+};
+
+TEST_F(DataFileIndexWriterTest, TestNoIndex) {
+    // no index columns
+    ASSERT_OK_AND_ASSIGN(auto writer, DataFileIndexWriter::Create(schema_, {},
+                                                                  /*in_manifest_threshold=*/500,
+                                                                  pool_));
+    ASSERT_FALSE(writer);
+    // column not in schema, unregistered index type, and index type without writer support
+    ASSERT_OK_AND_ASSIGN(writer, DataFileIndexWriter::Create(
+                                     schema_,
+                                     {{"non-exist", {{"bitmap", {}}}},
+                                      {"f0", {{"unknown", {}}}},
+                                      {"f1", {{"bloom-filter", {}}}}},
+                                     /*in_manifest_threshold=*/500, pool_));
+    ASSERT_FALSE(writer);
+}
+
+TEST_F(DataFileIndexWriterTest, TestWriteAndRead) {
+    ASSERT_OK_AND_ASSIGN(
+        std::unique_ptr<DataFileIndexWriter> writer,
+        DataFileIndexWriter::Create(
+            schema_, {{"f0", {{"bitmap", {}}}}, {"f1", {{"bitmap", {{"version", "1"}}}}}},
+            /*in_manifest_threshold=*/500, pool_));
+    ASSERT_TRUE(writer);
+    ASSERT_EQ(500, writer->InManifestThreshold());
+    ASSERT_OK(writer->Write(*MakeBatch(R"([["a", 1, 1.0], ["b", 2, 2.0], [null, 1, 3.0]])")));
+    ASSERT_OK(writer->Write(*MakeBatch(R"([["a", 3, 4.0], ["c", null, 5.0]])")));
+    auto invalid_batch =
+        arrow::ipc::internal::json::ArrayFromJSON(
+            arrow::struct_({arrow::field("f0", arrow::utf8())}), R"([["a"]])")
+            .ValueOrDie();
+    ASSERT_NOK_WITH_MSG(writer->Write(*invalid_batch), "mismatches schema of file index writer");
+
+    ASSERT_OK_AND_ASSIGN(PAIMON_UNIQUE_PTR<Bytes> bytes, writer->Serialize());
+    auto input_stream = std::make_shared<ByteArrayInputStream>(bytes->data(), bytes->size());
+    ASSERT_OK_AND_ASSIGN(auto reader, FileIndexFormat::CreateReader(input_stream, pool_));
+    {
+        ASSERT_OK_AND_ASSIGN(auto index_readers,
+                             reader->ReadColumnIndex("f0", CreateArrowSchema().get()));
+        ASSERT_EQ(1, index_readers.size());
+        ASSERT_OK_AND_ASSIGN(auto result,
+                             index_readers[0]->VisitEqual(Literal(FieldType::STRING, "a", 1)));
+        ASSERT_EQ("{0,3}", result->ToString());
+        ASSERT_OK_AND_ASSIGN(result, index_readers[0]->VisitIsNull());
+        ASSERT_EQ("{2}", result->ToString());
+    }
+    {
+        ASSERT_OK_AND_ASSIGN(auto index_readers,
+                             reader->ReadColumnIndex("f1", CreateArrowSchema().get()));
+        ASSERT_EQ(1, index_readers.size());
+        ASSERT_OK_AND_ASSIGN(auto result, index_readers[0]->VisitEqual(Literal(1)));
+        ASSERT_EQ("{0,2}", result->ToString());
+        ASSERT_OK_AND_ASSIGN(result, index_readers[0]->VisitIsNull());
+        ASSERT_EQ("{4}", result->ToString());
+    }
+    {
+        ASSERT_OK_AND_ASSIGN(auto index_readers,
+                             reader->ReadColumnIndex("f2", CreateArrowSchema().get()));
+        ASSERT_TRUE(index_readers.empty());
+    }
+}
+
+TEST_F(DataFileIndexWriterTest, TestWriteIndex) {
+    auto dir = UniqueTestDirectory::Create();
+    ASSERT_TRUE(dir);
+    auto fs = std::make_shared<LocalFileSystem>();
+    std::string data_file_path = PathUtil::JoinPath(dir->Str(), "data-0.orc");
+    auto batch = MakeBatch(R"([["a", 1, 1.0], ["b", 2, 2.0], [null, 1, 3.0]])");
+    std::map<std::string, std::map<std::string, std::map<std::string, std::string>>>
+        index_columns = {{"f0", {{"bitmap", {}}}}};
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<DataFileIndexWriter> writer,
+                         DataFileIndexWriter::Create(schema_, index_columns,
+                                                     /*in_manifest_threshold=*/500, pool_));
+    ASSERT_OK(writer->Write(*batch));
+    ASSERT_OK_AND_ASSIGN(PAIMON_UNIQUE_PTR<Bytes> bytes, writer->Serialize());
+    ASSERT_LE(bytes->size(), 500u);
+
+    // small index is embedded in the data file meta
+    std::vector<std::string> extra_paths;
+    std::shared_ptr<Bytes> embedded_index;
+    ASSERT_OK(writer->WriteIndex(fs, data_file_path, &extra_paths, &embedded_index));
+    ASSERT_TRUE(extra_paths.empty());
+    ASSERT_TRUE(embedded_index);
+    ASSERT_EQ(std::string(bytes->data(), bytes->size()),
+              std::string(embedded_index->data(), embedded_index->size()));
+
+    // large index is written to an extra file next to the data file
+    ASSERT_OK_AND_ASSIGN(writer, DataFileIndexWriter::Create(schema_, index_columns,
+                                                             /*in_manifest_threshold=*/0, pool_));
+    ASSERT_OK(writer->Write(*batch));
+    embedded_index.reset();
+    ASSERT_OK(writer->WriteIndex(fs, data_file_path, &extra_paths, &embedded_index));
+    ASSERT_FALSE(embedded_index);
+    ASSERT_EQ(std::vector<std::string>({data_file_path + ".index"}), extra_paths);
+    std::string content;
+    ASSERT_OK(fs->ReadFile(extra_paths[0], &content));
+    ASSERT_EQ(std::string(bytes->data(), bytes->size()), content);
+}
+
+}  // namespace paimon::test
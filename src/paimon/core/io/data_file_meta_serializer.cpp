@@ -22,13 +22,17 @@
 #include <string>
 #include <utility>
 
+#include "arrow/api.h"
+#include "arrow/util/checked_cast.h"
 #include "paimon/common/data/binary_row_writer.h"
 #include "paimon/common/data/binary_string.h"
 #include "paimon/common/data/internal_row.h"
 #include "paimon/common/utils/internal_row_utils.h"
+#include "paimon/common/utils/arrow/status_utils.h"
 #include "paimon/common/utils/serialization_utils.h"
 #include "paimon/core/manifest/file_source.h"
 #include "paimon/core/stats/simple_stats.h"
+#include "paimon/core/utils/meta_builder_utils.h"
 #include "paimon/data/timestamp.h"
 #include "paimon/status.h"
 
@@ -97,6 +101,60 @@ Result<BinaryRow> DataFileMetaSerializer::ToRow(const std::shared_ptr<DataFileMe
     return row;
 }
 
+Status DataFileMetaSerializer::AppendTo(const std::shared_ptr<DataFileMeta>& meta,
+                                        arrow::StructBuilder* builder) const {
+    using Utils = MetaBuilderUtils;
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(builder->Append());
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(
+        Utils::FieldBuilder<arrow::StringBuilder>(builder, 0)->Append(meta->file_name));
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(
+        Utils::FieldBuilder<arrow::Int64Builder>(builder, 1)->Append(meta->file_size));
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(
+        Utils::FieldBuilder<arrow::Int64Builder>(builder, 2)->Append(meta->row_count));
+    PAIMON_RETURN_NOT_OK(Utils::AppendBinaryRow(
+        meta->min_key, pool_.get(), Utils::FieldBuilder<arrow::BinaryBuilder>(builder, 3)));
+    PAIMON_RETURN_NOT_OK(Utils::AppendBinaryRow(
+        meta->max_key, pool_.get(), Utils::FieldBuilder<arrow::BinaryBuilder>(builder, 4)));
+    PAIMON_RETURN_NOT_OK(meta->key_stats.AppendTo(
+        Utils::FieldBuilder<arrow::StructBuilder>(builder, 5), pool_.get()));
+    PAIMON_RETURN_NOT_OK(meta->value_stats.AppendTo(
+        Utils::FieldBuilder<arrow::StructBuilder>(builder, 6), pool_.get()));
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(
+        Utils::FieldBuilder<arrow::Int64Builder>(builder, 7)->Append(meta->min_sequence_number));
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(
+        Utils::FieldBuilder<arrow::Int64Builder>(builder, 8)->Append(meta->max_sequence_number));
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(
+        Utils::FieldBuilder<arrow::Int64Builder>(builder, 9)->Append(meta->schema_id));
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(
+        Utils::FieldBuilder<arrow::Int32Builder>(builder, 10)->Append(meta->level));
+    PAIMON_RETURN_NOT_OK(Utils::AppendStrings(
+        meta->extra_files, Utils::FieldBuilder<arrow::ListBuilder>(builder, 11)));
+    // creation time is stored in millisecond precision
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(Utils::FieldBuilder<arrow::TimestampBuilder>(builder, 12)
+                                        ->Append(meta->creation_time.GetMillisecond()));
+    PAIMON_RETURN_NOT_OK(
+        Utils::AppendOptional<arrow::Int64Builder>(builder, 13, meta->delete_row_count));
+    auto* embedded_index_builder = Utils::FieldBuilder<arrow::BinaryBuilder>(builder, 14);
+    if (meta->embedded_index == nullptr) {
+        PAIMON_RETURN_NOT_OK_FROM_ARROW(embedded_index_builder->AppendNull());
+    } else {
+        PAIMON_RETURN_NOT_OK(Utils::AppendBytes(*meta->embedded_index, embedded_index_builder));
+    }
+    std::optional<int8_t> file_source;
+    if (meta->file_source != std::nullopt) {
+        file_source = meta->file_source.value().ToByteValue();
+    }
+    PAIMON_RETURN_NOT_OK(Utils::AppendOptional<arrow::Int8Builder>(builder, 15, file_source));
+    PAIMON_RETURN_NOT_OK(Utils::AppendStrings(
+        meta->value_stats_cols, Utils::FieldBuilder<arrow::ListBuilder>(builder, 16)));
+    PAIMON_RETURN_NOT_OK(
+        Utils::AppendOptional<arrow::StringBuilder>(builder, 17, meta->external_path));
+    PAIMON_RETURN_NOT_OK(
+        Utils::AppendOptional<arrow::Int64Builder>(builder, 18, meta->first_row_id));
+    return Utils::AppendStrings(meta->write_cols,
+                                Utils::FieldBuilder<arrow::ListBuilder>(builder, 19));
+}
+
 Result<std::shared_ptr<DataFileMeta>> DataFileMetaSerializer::FromRow(
     const InternalRow& row) const {
     auto file_name = row.GetString(0);
@@ -25,6 +25,10 @@
 #include "paimon/core/utils/object_serializer.h"
 #include "paimon/result.h"
 
+namespace arrow {
+class StructBuilder;
+}  // namespace arrow
+
 namespace paimon {
 class InternalRow;
 class MemoryPool;
@@ -38,6 +42,13 @@ class DataFileMetaSerializer : public ObjectSerializer<std::shared_ptr<DataFileM
     Result<BinaryRow> ToRow(const std::shared_ptr<DataFileMeta>& meta) const override;
 
     Result<std::shared_ptr<DataFileMeta>> FromRow(const InternalRow& row) const override;
+
+    bool SupportAppendTo() const override {
+        return true;
+    }
+
+    Status AppendTo(const std::shared_ptr<DataFileMeta>& meta,
+                    arrow::StructBuilder* builder) const override;
 };
 
 }  // namespace paimon
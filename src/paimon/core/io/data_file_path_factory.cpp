@@ -29,6 +29,7 @@ namespace paimon {
 
 const char DataFilePathFactory::CHANGELOG_FILE_PREFIX[] = "changelog-";
 const char DataFilePathFactory::INDEX_PATH_SUFFIX[] = ".index";
+const char DataFilePathFactory::SKETCH_PATH_SUFFIX[] = ".sketch";
 
 Status DataFilePathFactory::Init(const std::string& parent, const std::string& format_identifier,
                                  const std::string& data_file_prefix,
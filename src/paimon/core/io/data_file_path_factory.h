@@ -37,6 +37,8 @@ class DataFilePathFactory : public PathFactory {
  public:
     static const char CHANGELOG_FILE_PREFIX[];
     static const char INDEX_PATH_SUFFIX[];
+    /// Suffix of the column sketch file written next to a data file, see `ColumnSketchesFile`.
+    static const char SKETCH_PATH_SUFFIX[];
 
     Status Init(const std::string& parent, const std::string& format_identifier,
                 const std::string& data_file_prefix,
@@ -16,14 +16,24 @@
 
 #include "paimon/core/io/data_file_writer.h"
 
-#include <cassert>
+#include <optional>
+#include <utility>
 
+#include "arrow/array.h"
 #include "arrow/c/abi.h"
+#include "arrow/c/bridge.h"
+#include "paimon/common/utils/arrow/status_utils.h"
 #include "paimon/common/utils/long_counter.h"
 #include "paimon/common/utils/path_util.h"
+#include "paimon/core/io/data_file_index_writer.h"
+#include "paimon/core/io/data_file_path_factory.h"
+#include "paimon/core/stats/column_sketch_collector.h"
+#include "paimon/core/stats/column_sketches_file.h"
 #include "paimon/core/stats/simple_stats.h"
 #include "paimon/core/stats/simple_stats_converter.h"
+#include "paimon/core/stats/value_stats_converter.h"
 #include "paimon/format/format_stats_extractor.h"
+#include "paimon/memory/bytes.h"
 
 namespace paimon {
 class MemoryPool;
@@ -33,7 +43,9 @@ DataFileWriter::DataFileWriter(
     int64_t schema_id, const std::shared_ptr<LongCounter>& seq_num_counter, FileSource file_source,
     const std::shared_ptr<FormatStatsExtractor>& stats_extractor, bool is_external_path,
     const std::optional<std::vector<std::string>>& write_cols,
-    const std::shared_ptr<MemoryPool>& pool)
+    std::unique_ptr<ValueStatsConverter> value_stats_converter,
+    std::unique_ptr<ColumnSketchCollector> sketch_collector,
+    std::unique_ptr<DataFileIndexWriter> index_writer, const std::shared_ptr<MemoryPool>& pool)
     : SingleFileWriter(compression, converter),
       pool_(pool),
       schema_id_(schema_id),
@@ -41,29 +53,81 @@ DataFileWriter::DataFileWriter(
       seq_num_counter_(seq_num_counter),
       file_source_(file_source),
       stats_extractor_(stats_extractor),
-      write_cols_(write_cols) {}
+      write_cols_(write_cols),
+      value_stats_converter_(std::move(value_stats_converter)),
+      sketch_collector_(std::move(sketch_collector)),
+      index_writer_(std::move(index_writer)) {}
+
+DataFileWriter::~DataFileWriter() = default;
 
 Status DataFileWriter::Write(ArrowArray* batch) {
     int64_t record_count = batch->length;
+    if (sketch_collector_ || index_writer_) {
+        PAIMON_RETURN_NOT_OK(CollectSketchesAndIndexes(batch));
+    }
     PAIMON_RETURN_NOT_OK(SingleFileWriter::Write(batch));
     seq_num_counter_->Add(record_count);
     return Status::OK();
 }
 
+Status DataFileWriter::CollectSketchesAndIndexes(ArrowArray* batch) {
+    const std::shared_ptr<arrow::DataType>& batch_type =
+        sketch_collector_ ? sketch_collector_->BatchType() : index_writer_->BatchType();
+    // importing and exporting back only moves the buffers, the batch is not copied
+    PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(std::shared_ptr<arrow::Array> array,
+                                      arrow::ImportArray(batch, batch_type));
+    if (sketch_collector_) {
+        PAIMON_RETURN_NOT_OK(sketch_collector_->Collect(*array));
+    }
+    if (index_writer_) {
+        PAIMON_RETURN_NOT_OK(index_writer_->Write(*array));
+    }
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(arrow::ExportArray(*array, batch));
+    return Status::OK();
+}
+
+Status DataFileWriter::Close() {
+    if (closed_) {
+        return Status::OK();
+    }
+    PAIMON_RETURN_NOT_OK(SingleFileWriter::Close());
+    if (sketch_collector_) {
+        std::string sketch_path = path_ + DataFilePathFactory::SKETCH_PATH_SUFFIX;
+        extra_paths_.push_back(sketch_path);
+        PAIMON_RETURN_NOT_OK(ColumnSketchesFile::WriteFileSketches(
+            fs_, sketch_path, sketch_collector_->GetResult(), pool_));
+    }
+    if (index_writer_) {
+        PAIMON_RETURN_NOT_OK(
+            index_writer_->WriteIndex(fs_, path_, &extra_paths_, &embedded_index_));
+    }
+    return Status::OK();
+}
+
 Result<std::shared_ptr<DataFileMeta>> DataFileWriter::GetResult() {
     PAIMON_ASSIGN_OR_RAISE(std::vector<std::shared_ptr<ColumnStats>> field_stats, GetFieldStats());
-    PAIMON_ASSIGN_OR_RAISE(SimpleStats stats,
-                           SimpleStatsConverter::ToBinary(field_stats, pool_.get()));
-    // TODO(xinyu.lxy): do not support write value stats cols & first_row_id for now
+    SimpleStats stats = SimpleStats::EmptyStats();
+    std::optional<std::vector<std::string>> value_stats_cols;
+    if (value_stats_converter_) {
+        PAIMON_RETURN_NOT_OK(value_stats_converter_->Convert(field_stats, pool_.get(), &stats,
+                                                             &value_stats_cols));
+    } else {
+        PAIMON_ASSIGN_OR_RAISE(stats, SimpleStatsConverter::ToBinary(field_stats, pool_.get()));
+    }
+    // TODO(xinyu.lxy): do not support write first_row_id for now
     std::optional<std::string> final_path;
     if (is_external_path_) {
         PAIMON_ASSIGN_OR_RAISE(Path external_path, PathUtil::ToPath(path_));
         final_path = external_path.ToString();
     }
+    std::vector<std::optional<std::string>> extra_files;
+    for (const auto& extra_path : extra_paths_) {
+        extra_files.emplace_back(PathUtil::GetName(extra_path));
+    }
     return DataFileMeta::ForAppend(
         PathUtil::GetName(path_), output_bytes_, RecordCount(), stats,
         seq_num_counter_->GetValue() - RecordCount(), seq_num_counter_->GetValue() - 1, schema_id_,
-        {}, /*embedded_index=*/nullptr, file_source_, /*value_stats_cols=*/std::nullopt, final_path,
+        extra_files, embedded_index_, file_source_, value_stats_cols, final_path,
         /*first_row_id=*/std::nullopt, write_cols_);
 }
 
@@ -71,9 +135,15 @@ Result<std::vector<std::shared_ptr<ColumnStats>>> DataFileWriter::GetFieldStats(
     if (!closed_) {
         return Status::Invalid("Cannot access metric unless the writer is closed.");
     }
+    // prefer statistics kept in memory by the format writer, which saves re-opening the file
+    PAIMON_ASSIGN_OR_RAISE(std::optional<ColumnStatsVector> writer_stats,
+                           GetFormatWriterStats(pool_));
+    if (writer_stats) {
+        return std::move(writer_stats).value();
+    }
     if (stats_extractor_ == nullptr) {
-        assert(false);
-        return Status::Invalid("simple stats extractor is null pointer.");
+        return Status::Invalid(
+            "neither format writer nor simple stats extractor provides stats of data file.");
     }
     return stats_extractor_->Extract(fs_, path_, pool_);
 }
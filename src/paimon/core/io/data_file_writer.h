@@ -33,10 +33,14 @@
 
 namespace paimon {
 
+class Bytes;
+class ColumnSketchCollector;
 class ColumnStats;
+class DataFileIndexWriter;
 class FormatStatsExtractor;
 class LongCounter;
 class MemoryPool;
+class ValueStatsConverter;
 
 class DataFileWriter : public SingleFileWriter<::ArrowArray*, std::shared_ptr<DataFileMeta>> {
  public:
@@ -45,15 +49,24 @@ class DataFileWriter : public SingleFileWriter<::ArrowArray*, std::shared_ptr<Da
                    const std::shared_ptr<LongCounter>& seq_num_counter, FileSource file_source,
                    const std::shared_ptr<FormatStatsExtractor>& stats_extractor,
                    bool is_external_path, const std::optional<std::vector<std::string>>& write_cols,
+                   std::unique_ptr<ValueStatsConverter> value_stats_converter,
+                   std::unique_ptr<ColumnSketchCollector> sketch_collector,
+                   std::unique_ptr<DataFileIndexWriter> index_writer,
                    const std::shared_ptr<MemoryPool>& pool);
 
+    ~DataFileWriter() override;
+
     Status Write(::ArrowArray* batch) override;
 
+    Status Close() override;
+
     Result<std::shared_ptr<DataFileMeta>> GetResult() override;
 
  private:
     Result<std::vector<std::shared_ptr<ColumnStats>>> GetFieldStats();
 
+    Status CollectSketchesAndIndexes(::ArrowArray* batch);
+
  private:
     std::shared_ptr<MemoryPool> pool_;
     int64_t schema_id_;
@@ -63,6 +76,14 @@ class DataFileWriter : public SingleFileWriter<::ArrowArray*, std::shared_ptr<Da
     FileSource file_source_;
     std::shared_ptr<FormatStatsExtractor> stats_extractor_;
     std::optional<std::vector<std::string>> write_cols_;
+    // nullptr if stats of all fields are stored in full
+    std::unique_ptr<ValueStatsConverter> value_stats_converter_;
+    // nullptr if column sketches are not collected
+    std::unique_ptr<ColumnSketchCollector> sketch_collector_;
+    // nullptr if no file index is built
+    std::unique_ptr<DataFileIndexWriter> index_writer_;
+    // file index small enough to be embedded in the data file meta
+    std::shared_ptr<Bytes> embedded_index_;
 };
 
 }  // namespace paimon
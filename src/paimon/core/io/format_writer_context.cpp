@@ -0,0 +1,59 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/io/format_writer_context.h"
+
+#include <utility>
+
+#include "arrow/c/abi.h"
+#include "arrow/c/bridge.h"
+#include "arrow/c/helpers.h"
+#include "arrow/type.h"
+#include "paimon/common/utils/arrow/status_utils.h"
+#include "paimon/common/utils/scope_guard.h"
+#include "paimon/format/file_format.h"
+#include "paimon/format/format_stats_extractor.h"
+#include "paimon/format/writer_builder.h"
+#include "paimon/status.h"
+
+namespace paimon {
+
+Result<std::shared_ptr<FormatWriterContext>> FormatWriterContext::Create(
+    const std::shared_ptr<FileFormat>& format, const std::shared_ptr<arrow::Schema>& schema,
+    int32_t batch_size, const std::shared_ptr<MemoryPool>& pool, bool with_stats_extractor) {
+    ::ArrowSchema arrow_schema;
+    ScopeGuard guard([&arrow_schema]() { ArrowSchemaRelease(&arrow_schema); });
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(arrow::ExportSchema(*schema, &arrow_schema));
+    PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<WriterBuilder> writer_builder,
+                           format->CreateWriterBuilder(&arrow_schema, batch_size));
+    writer_builder->WithMemoryPool(pool);
+
+    std::shared_ptr<FormatStatsExtractor> stats_extractor;
+    if (with_stats_extractor) {
+        PAIMON_RETURN_NOT_OK_FROM_ARROW(arrow::ExportSchema(*schema, &arrow_schema));
+        Result<std::unique_ptr<FormatStatsExtractor>> stats_extractor_result =
+            format->CreateStatsExtractor(&arrow_schema);
+        if (stats_extractor_result.ok()) {
+            stats_extractor = std::move(stats_extractor_result).value();
+        } else if (!stats_extractor_result.status().IsNotImplemented()) {
+            return stats_extractor_result.status();
+        }
+    }
+    return std::shared_ptr<FormatWriterContext>(
+        new FormatWriterContext(writer_builder, stats_extractor));
+}
+
+}  // namespace paimon
@@ -0,0 +1,68 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "paimon/result.h"
+
+namespace arrow {
+class Schema;
+}  // namespace arrow
+
+namespace paimon {
+
+class FileFormat;
+class FormatStatsExtractor;
+class MemoryPool;
+class WriterBuilder;
+
+/// Format specific setup shared by all data files a writer rolls to.
+///
+/// Creating a `WriterBuilder` or a `FormatStatsExtractor` exports the write schema through the
+/// C data interface and imports it again in the format, so writers create them once and reuse
+/// them for every file instead of once per file.
+class FormatWriterContext {
+ public:
+    /// @param with_stats_extractor Whether the files need a stats extractor. Formats without
+    ///        statistics in files (e.g. avro) have no stats extractor even if it is requested,
+    ///        their format writers collect statistics from the written batches instead.
+    static Result<std::shared_ptr<FormatWriterContext>> Create(
+        const std::shared_ptr<FileFormat>& format, const std::shared_ptr<arrow::Schema>& schema,
+        int32_t batch_size, const std::shared_ptr<MemoryPool>& pool,
+        bool with_stats_extractor = true);
+
+    const std::shared_ptr<WriterBuilder>& GetWriterBuilder() const {
+        return writer_builder_;
+    }
+
+    /// @return The stats extractor, or nullptr if there is none.
+    const std::shared_ptr<FormatStatsExtractor>& GetStatsExtractor() const {
+        return stats_extractor_;
+    }
+
+ private:
+    FormatWriterContext(const std::shared_ptr<WriterBuilder>& writer_builder,
+                        const std::shared_ptr<FormatStatsExtractor>& stats_extractor)
+        : writer_builder_(writer_builder), stats_extractor_(stats_extractor) {}
+
+    std::shared_ptr<WriterBuilder> writer_builder_;
+    std::shared_ptr<FormatStatsExtractor> stats_extractor_;
+};
+
+}  // namespace paimon
@@ -0,0 +1,61 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/io/format_writer_context.h"
+
+#include <memory>
+
+#include "arrow/api.h"
+#include "gtest/gtest.h"
+#include "paimon/format/file_format.h"
+#include "paimon/format/file_format_factory.h"
+#include "paimon/memory/memory_pool.h"
+#include "paimon/testing/utils/testharness.h"
+
+namespace paimon::test {
+
+TEST(FormatWriterContextTest, TestCreate) {
+    auto schema = arrow::schema({arrow::field("f0", arrow::int32()),
+                                 arrow::field("f1", arrow::utf8())});
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<FileFormat> orc_format,
+                         FileFormatFactory::Get("orc", {}));
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<FormatWriterContext> context,
+                         FormatWriterContext::Create(orc_format, schema, /*batch_size=*/1024,
+                                                     GetDefaultPool()));
+    ASSERT_TRUE(context->GetWriterBuilder());
+    ASSERT_TRUE(context->GetStatsExtractor());
+
+    ASSERT_OK_AND_ASSIGN(context, FormatWriterContext::Create(orc_format, schema,
+                                                              /*batch_size=*/1024,
+                                                              GetDefaultPool(),
+                                                              /*with_stats_extractor=*/false));
+    ASSERT_TRUE(context->GetWriterBuilder());
+    ASSERT_FALSE(context->GetStatsExtractor());
+}
+
+TEST(FormatWriterContextTest, TestFormatWithoutStatsExtractor) {
+    auto schema = arrow::schema({arrow::field("f0", arrow::int32())});
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<FileFormat> avro_format,
+                         FileFormatFactory::Get("avro", {}));
+    // avro files have no statistics, format writers collect them instead
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<FormatWriterContext> context,
+                         FormatWriterContext::Create(avro_format, schema, /*batch_size=*/1024,
+                                                     GetDefaultPool()));
+    ASSERT_TRUE(context->GetWriterBuilder());
+    ASSERT_FALSE(context->GetStatsExtractor());
+}
+
+}  // namespace paimon::test
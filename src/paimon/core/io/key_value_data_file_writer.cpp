@@ -23,6 +23,8 @@
 #include <utility>
 #include <variant>
 
+#include "arrow/array.h"
+#include "arrow/c/bridge.h"
 #include "arrow/type.h"
 #include "fmt/format.h"
 #include "paimon/common/data/binary_array.h"
@@ -32,12 +34,19 @@
 #include "paimon/common/data/data_define.h"
 #include "paimon/common/data/internal_row.h"
 #include "paimon/common/table/special_fields.h"
+#include "paimon/common/utils/arrow/status_utils.h"
 #include "paimon/common/utils/date_time_utils.h"
 #include "paimon/common/utils/path_util.h"
+#include "paimon/core/io/data_file_index_writer.h"
+#include "paimon/core/io/data_file_path_factory.h"
+#include "paimon/core/stats/column_sketch_collector.h"
+#include "paimon/core/stats/column_sketches_file.h"
 #include "paimon/core/stats/simple_stats.h"
 #include "paimon/core/stats/simple_stats_converter.h"
+#include "paimon/core/stats/value_stats_converter.h"
 #include "paimon/data/timestamp.h"
 #include "paimon/format/format_stats_extractor.h"
+#include "paimon/memory/bytes.h"
 
 struct ArrowArray;
 
@@ -49,7 +58,9 @@ KeyValueDataFileWriter::KeyValueDataFileWriter(
     int64_t schema_id, FileSource file_source, const std::vector<std::string>& primary_keys,
     const std::shared_ptr<FormatStatsExtractor>& stats_extractor,
     const std::shared_ptr<arrow::Schema>& write_schema, bool is_external_path,
-    const std::shared_ptr<MemoryPool>& pool)
+    std::unique_ptr<ValueStatsConverter> value_stats_converter,
+    std::unique_ptr<ColumnSketchCollector> sketch_collector,
+    std::unique_ptr<DataFileIndexWriter> index_writer, const std::shared_ptr<MemoryPool>& pool)
     : SingleFileWriter(compression, converter),
       pool_(pool),
       schema_id_(schema_id),
@@ -58,7 +69,12 @@ KeyValueDataFileWriter::KeyValueDataFileWriter(
       stats_extractor_(stats_extractor),
       write_schema_(write_schema),
       is_external_path_(is_external_path),
-      disable_stats_(stats_extractor == nullptr) {}
+      disable_stats_(stats_extractor == nullptr),
+      value_stats_converter_(std::move(value_stats_converter)),
+      sketch_collector_(std::move(sketch_collector)),
+      index_writer_(std::move(index_writer)) {}
+
+KeyValueDataFileWriter::~KeyValueDataFileWriter() = default;
 
 Status KeyValueDataFileWriter::Write(KeyValueBatch batch) {
     // update min and max key
@@ -71,10 +87,42 @@ Status KeyValueDataFileWriter::Write(KeyValueBatch batch) {
     max_sequence_number_ = std::max(max_sequence_number_, batch.max_sequence_number);
     // update delete row count
     delete_row_count_ += batch.delete_row_count;
+    if ((sketch_collector_ || index_writer_) && batch.batch) {
+        const std::shared_ptr<arrow::DataType>& batch_type =
+            sketch_collector_ ? sketch_collector_->BatchType() : index_writer_->BatchType();
+        // importing and exporting back only moves the buffers, the batch is not copied
+        PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(std::shared_ptr<arrow::Array> array,
+                                          arrow::ImportArray(batch.batch.get(), batch_type));
+        if (sketch_collector_) {
+            PAIMON_RETURN_NOT_OK(sketch_collector_->Collect(*array));
+        }
+        if (index_writer_) {
+            PAIMON_RETURN_NOT_OK(index_writer_->Write(*array));
+        }
+        PAIMON_RETURN_NOT_OK_FROM_ARROW(arrow::ExportArray(*array, batch.batch.get()));
+    }
     PAIMON_RETURN_NOT_OK(SingleFileWriter::Write(std::move(batch)));
     return Status::OK();
 }
 
+Status KeyValueDataFileWriter::Close() {
+    if (closed_) {
+        return Status::OK();
+    }
+    PAIMON_RETURN_NOT_OK(SingleFileWriter::Close());
+    if (sketch_collector_) {
+        std::string sketch_path = path_ + DataFilePathFactory::SKETCH_PATH_SUFFIX;
+        extra_paths_.push_back(sketch_path);
+        PAIMON_RETURN_NOT_OK(ColumnSketchesFile::WriteFileSketches(
+            fs_, sketch_path, sketch_collector_->GetResult(), pool_));
+    }
+    if (index_writer_) {
+        PAIMON_RETURN_NOT_OK(
+            index_writer_->WriteIndex(fs_, path_, &extra_paths_, &embedded_index_));
+    }
+    return Status::OK();
+}
+
 Result<std::shared_ptr<DataFileMeta>> KeyValueDataFileWriter::GetResult() {
     PAIMON_ASSIGN_OR_RAISE(std::vector<std::shared_ptr<ColumnStats>> field_stats, GetFieldStats());
     if (!disable_stats_ && field_stats.size() != static_cast<size_t>(write_schema_->num_fields())) {
@@ -88,26 +136,31 @@ Result<std::shared_ptr<DataFileMeta>> KeyValueDataFileWriter::GetResult() {
     // key value stats
     SimpleStats key_stats = SimpleStats::EmptyStats();
     SimpleStats value_stats = SimpleStats::EmptyStats();
+    std::optional<std::vector<std::string>> value_stats_cols;
     if (!disable_stats_) {
-        PAIMON_RETURN_NOT_OK(GenerateKeyValueStats(field_stats, &key_stats, &value_stats));
+        PAIMON_RETURN_NOT_OK(
+            GenerateKeyValueStats(field_stats, &key_stats, &value_stats, &value_stats_cols));
     } else {
         PAIMON_RETURN_NOT_OK(GenerateKeyStatsWithAllNull(&key_stats));
     }
-    // TODO(xinyu.lxy): do not support write value stats cols & first_row_id & write_cols for now
+    // TODO(xinyu.lxy): do not support write first_row_id & write_cols for now
     std::optional<std::string> final_path;
     if (is_external_path_) {
         PAIMON_ASSIGN_OR_RAISE(Path external_path, PathUtil::ToPath(path_));
         final_path = external_path.ToString();
     }
+    std::vector<std::optional<std::string>> extra_files;
+    for (const auto& extra_path : extra_paths_) {
+        extra_files.emplace_back(PathUtil::GetName(extra_path));
+    }
     PAIMON_ASSIGN_OR_RAISE(int64_t local_micro, DateTimeUtils::GetCurrentLocalTimeUs());
     return std::make_shared<DataFileMeta>(
         PathUtil::GetName(path_), output_bytes_, RecordCount(), min_key, max_key, key_stats,
         value_stats, min_sequence_number_, max_sequence_number_, schema_id_, /*level=*/0,
-        /*extra_files=*/std::vector<std::optional<std::string>>(),
+        extra_files,
         Timestamp(/*millisecond=*/local_micro / 1000, /*nano_of_millisecond=*/0), delete_row_count_,
-        /*embedded_index=*/nullptr, file_source_,
-        /*value_stats_cols=*/std::nullopt, final_path, /*first_row_id=*/std::nullopt,
-        /*write_cols=*/std::nullopt);
+        embedded_index_, file_source_, value_stats_cols, final_path,
+        /*first_row_id=*/std::nullopt, /*write_cols=*/std::nullopt);
 }
 
 Status KeyValueDataFileWriter::GenerateMinMaxKey(BinaryRow* min_key, BinaryRow* max_key) const {
@@ -132,7 +185,7 @@ Status KeyValueDataFileWriter::GenerateMinMaxKey(BinaryRow* min_key, BinaryRow*
 
 Status KeyValueDataFileWriter::GenerateKeyValueStats(
     const std::vector<std::shared_ptr<ColumnStats>>& field_stats, SimpleStats* key_stats,
-    SimpleStats* value_stats) const {
+    SimpleStats* value_stats, std::optional<std::vector<std::string>>* value_stats_cols) const {
     // key stats
     std::vector<std::shared_ptr<ColumnStats>> key_column_stats;
     key_column_stats.reserve(primary_keys_.size());
@@ -149,6 +202,10 @@ Status KeyValueDataFileWriter::GenerateKeyValueStats(
     // value stats
     std::vector<std::shared_ptr<ColumnStats>> value_column_stats(
         field_stats.begin() + SpecialFields::KEY_VALUE_SPECIAL_FIELD_COUNT, field_stats.end());
+    if (value_stats_converter_) {
+        return value_stats_converter_->Convert(value_column_stats, pool_.get(), value_stats,
+                                               value_stats_cols);
+    }
     PAIMON_ASSIGN_OR_RAISE(*value_stats,
                            SimpleStatsConverter::ToBinary(value_column_stats, pool_.get()));
     return Status::OK();
@@ -189,6 +246,12 @@ Result<std::vector<std::shared_ptr<ColumnStats>>> KeyValueDataFileWriter::GetFie
     if (disable_stats_) {
         return std::vector<std::shared_ptr<ColumnStats>>();
     }
+    // prefer statistics kept in memory by the format writer, which saves re-opening the file
+    PAIMON_ASSIGN_OR_RAISE(std::optional<ColumnStatsVector> writer_stats,
+                           GetFormatWriterStats(pool_));
+    if (writer_stats) {
+        return std::move(writer_stats).value();
+    }
     if (stats_extractor_ == nullptr) {
         assert(false);
         return Status::Invalid("simple stats extractor is null pointer.");
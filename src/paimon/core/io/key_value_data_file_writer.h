@@ -19,6 +19,7 @@
 #include <functional>
 #include <limits>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -35,12 +36,16 @@ class Schema;
 struct ArrowArray;
 
 namespace paimon {
+class Bytes;
+class ColumnSketchCollector;
 class ColumnStats;
+class DataFileIndexWriter;
 class FormatStatsExtractor;
 class BinaryRow;
 class InternalRow;
 class MemoryPool;
 class SimpleStats;
+class ValueStatsConverter;
 
 class KeyValueDataFileWriter
     : public SingleFileWriter<KeyValueBatch, std::shared_ptr<DataFileMeta>> {
@@ -51,10 +56,17 @@ class KeyValueDataFileWriter
                            const std::vector<std::string>& primary_keys,
                            const std::shared_ptr<FormatStatsExtractor>& stats_extractor,
                            const std::shared_ptr<arrow::Schema>& write_schema,
-                           bool is_external_path, const std::shared_ptr<MemoryPool>& pool);
+                           bool is_external_path,
+                           std::unique_ptr<ValueStatsConverter> value_stats_converter,
+                           std::unique_ptr<ColumnSketchCollector> sketch_collector,
+                           std::unique_ptr<DataFileIndexWriter> index_writer,
+                           const std::shared_ptr<MemoryPool>& pool);
+    ~KeyValueDataFileWriter() override;
 
     Status Write(KeyValueBatch batch) override;
 
+    Status Close() override;
+
     Result<std::shared_ptr<DataFileMeta>> GetResult() override;
 
  private:
@@ -63,7 +75,8 @@ class KeyValueDataFileWriter
     Status GenerateMinMaxKey(BinaryRow* min_key, BinaryRow* max_key) const;
 
     Status GenerateKeyValueStats(const std::vector<std::shared_ptr<ColumnStats>>& field_stats,
-                                 SimpleStats* key_stats, SimpleStats* value_stats) const;
+                                 SimpleStats* key_stats, SimpleStats* value_stats,
+                                 std::optional<std::vector<std::string>>* value_stats_cols) const;
     Status GenerateKeyStatsWithAllNull(SimpleStats* key_stats) const;
 
  private:
@@ -75,6 +88,14 @@ class KeyValueDataFileWriter
     std::shared_ptr<arrow::Schema> write_schema_;
     bool is_external_path_;
     bool disable_stats_;
+    // nullptr if stats of all value fields are stored in full
+    std::unique_ptr<ValueStatsConverter> value_stats_converter_;
+    // nullptr if column sketches are not collected
+    std::unique_ptr<ColumnSketchCollector> sketch_collector_;
+    // nullptr if no file index is built
+    std::unique_ptr<DataFileIndexWriter> index_writer_;
+    // file index small enough to be embedded in the data file meta
+    std::shared_ptr<Bytes> embedded_index_;
 
     int64_t delete_row_count_ = 0;
     int64_t min_sequence_number_ = std::numeric_limits<int64_t>::max();
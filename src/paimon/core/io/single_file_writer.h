@@ -20,8 +20,10 @@
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "arrow/c/abi.h"
 #include "arrow/c/helpers.h"
@@ -30,6 +32,7 @@
 #include "paimon/common/utils/scope_guard.h"
 #include "paimon/core/io/data_file_meta.h"
 #include "paimon/core/io/file_writer.h"
+#include "paimon/format/column_stats.h"
 #include "paimon/format/format_writer.h"
 #include "paimon/format/writer_builder.h"
 #include "paimon/fs/file_system.h"
@@ -54,22 +57,35 @@ class SingleFileWriter : public FileWriter<T, R> {
     /// Abort executor to just have reference of path instead of whole writer.
     class AbortExecutor {
      public:
-        AbortExecutor(const std::shared_ptr<FileSystem>& fs, const std::string& path)
-            : fs_(fs), path_(path), logger_(Logger::GetLogger("AbortExecutor")) {}
+        AbortExecutor(const std::shared_ptr<FileSystem>& fs, const std::string& path,
+                      const std::vector<std::string>& extra_paths)
+            : fs_(fs),
+              path_(path),
+              extra_paths_(extra_paths),
+              logger_(Logger::GetLogger("AbortExecutor")) {}
 
         void Abort() {
             if (fs_) {
-                auto status = fs_->Delete(path_);
-                if (!status.ok()) {
-                    PAIMON_LOG_WARN(logger_, "Exception occurs when deleting %s: %s", path_.c_str(),
-                                    status.ToString().c_str());
+                DeleteQuietly(path_);
+                for (const auto& extra_path : extra_paths_) {
+                    DeleteQuietly(extra_path);
                 }
             }
         }
 
+     private:
+        void DeleteQuietly(const std::string& path) {
+            auto status = fs_->Delete(path);
+            if (!status.ok()) {
+                PAIMON_LOG_WARN(logger_, "Exception occurs when deleting %s: %s", path.c_str(),
+                                status.ToString().c_str());
+            }
+        }
+
      private:
         std::shared_ptr<FileSystem> fs_;
         std::string path_;
+        std::vector<std::string> extra_paths_;
         std::shared_ptr<Logger> logger_;
     };
 
@@ -103,13 +119,19 @@ class SingleFileWriter : public FileWriter<T, R> {
         if (closed_ == false) {
             return Status::Invalid("Writer should be closed!");
         }
-        return AbortExecutor(fs_, path_);
+        return AbortExecutor(fs_, path_, extra_paths_);
     }
 
     std::string GetPath() const {
         return path_;
     }
 
+ protected:
+    /// @return Column statistics kept in memory by the format writer, or `std::nullopt` if the
+    ///         format writer does not keep them and the written file needs to be re-opened.
+    Result<std::optional<ColumnStatsVector>> GetFormatWriterStats(
+        const std::shared_ptr<MemoryPool>& pool) const;
+
  protected:
     int64_t output_bytes_ = -1;
     std::string compression_;
@@ -118,6 +140,8 @@ class SingleFileWriter : public FileWriter<T, R> {
     std::shared_ptr<OutputStream> out_;  // nullptr for DirectWriterBuilder
     bool closed_ = false;
     std::string path_;
+    // files written besides the data file (e.g. file index files), deleted together with it on abort
+    std::vector<std::string> extra_paths_;
 
  private:
     int64_t record_count_ = 0;
@@ -218,6 +242,19 @@ Result<bool> SingleFileWriter<T, R>::ReachTargetSize(bool suggested_check, int64
     return writer_->ReachTargetSize(suggested_check, target_size);
 }
 
+template <typename T, typename R>
+Result<std::optional<ColumnStatsVector>> SingleFileWriter<T, R>::GetFormatWriterStats(
+    const std::shared_ptr<MemoryPool>& pool) const {
+    if (!closed_) {
+        return Status::Invalid("Cannot access stats of format writer unless the writer is closed.");
+    }
+    auto stats_aware_writer = dynamic_cast<StatsAwareFormatWriter*>(writer_.get());
+    if (stats_aware_writer == nullptr) {
+        return std::optional<ColumnStatsVector>();
+    }
+    return stats_aware_writer->GetColumnStats(pool);
+}
+
 template <typename T, typename R>
 void SingleFileWriter<T, R>::Abort() {
     if (out_) {
@@ -233,6 +270,13 @@ void SingleFileWriter<T, R>::Abort() {
             PAIMON_LOG_WARN(logger_, "Exception occurs when closing %s: %s", path_.c_str(),
                             status.ToString().c_str());
         }
+        for (const auto& extra_path : extra_paths_) {
+            status = fs_->Delete(extra_path);
+            if (!status.ok()) {
+                PAIMON_LOG_WARN(logger_, "Exception occurs when deleting %s: %s",
+                                extra_path.c_str(), status.ToString().c_str());
+            }
+        }
     }
 }
 
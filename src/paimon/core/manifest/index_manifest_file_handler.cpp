@@ -16,15 +16,18 @@
 
 #include "paimon/core/manifest/index_manifest_file_handler.h"
 
+#include <algorithm>
 #include <set>
+#include <unordered_set>
 #include <utility>
 
+#include "paimon/common/data/binary_row.h"
+#include "paimon/common/utils/linked_hash_map.h"
 #include "paimon/core/deletionvectors/deletion_vectors_index_file.h"
 namespace paimon {
 std::vector<IndexManifestEntry> IndexManifestFileHandler::GlobalFileNameCombiner::Combine(
     const std::vector<IndexManifestEntry>& prev_index_files,
     const std::vector<IndexManifestEntry>& new_index_files) const {
-    // TODO(liancheng.lsz): support dv
     std::map<std::string, IndexManifestEntry> index_entries;
     for (const auto& entry : prev_index_files) {
         index_entries.emplace(entry.index_file->FileName(), entry);
@@ -59,6 +62,56 @@ std::vector<IndexManifestEntry> IndexManifestFileHandler::GlobalFileNameCombiner
     return result_entries;
 }
 
+std::vector<IndexManifestEntry> IndexManifestFileHandler::BucketedCombiner::Combine(
+    const std::vector<IndexManifestEntry>& prev_index_files,
+    const std::vector<IndexManifestEntry>& new_index_files) const {
+    using PartitionBucket = std::pair<BinaryRow, int32_t>;
+    // we use LinkedHashMap to avoid disorder
+    LinkedHashMap<PartitionBucket, std::vector<IndexManifestEntry>> index_entries;
+    for (const auto& entry : prev_index_files) {
+        index_entries[std::make_pair(entry.partition, entry.bucket)].push_back(entry);
+    }
+
+    std::vector<IndexManifestEntry> removed;
+    removed.reserve(new_index_files.size());
+    std::vector<IndexManifestEntry> added;
+    added.reserve(new_index_files.size());
+    for (const auto& entry : new_index_files) {
+        if (entry.kind == FileKind::Delete()) {
+            removed.push_back(entry);
+        } else if (entry.kind == FileKind::Add()) {
+            added.push_back(entry);
+        }
+    }
+
+    // The deleted entry is processed first to avoid overwriting a new entry.
+    for (const auto& entry : removed) {
+        auto& bucket_entries = index_entries[std::make_pair(entry.partition, entry.bucket)];
+        bucket_entries.erase(std::remove_if(bucket_entries.begin(), bucket_entries.end(),
+                                            [&](const IndexManifestEntry& bucket_entry) {
+                                                return bucket_entry.index_file->FileName() ==
+                                                       entry.index_file->FileName();
+                                            }),
+                             bucket_entries.end());
+    }
+    // The first added entry of a bucket replaces all the previous entries of the bucket.
+    std::unordered_set<PartitionBucket> replaced_buckets;
+    for (const auto& entry : added) {
+        PartitionBucket key = std::make_pair(entry.partition, entry.bucket);
+        auto& bucket_entries = index_entries[key];
+        if (replaced_buckets.insert(key).second) {
+            bucket_entries.clear();
+        }
+        bucket_entries.push_back(entry);
+    }
+
+    std::vector<IndexManifestEntry> result_entries;
+    for (const auto& [_, bucket_entries] : index_entries) {
+        result_entries.insert(result_entries.end(), bucket_entries.begin(), bucket_entries.end());
+    }
+    return result_entries;
+}
+
 Result<std::string> IndexManifestFileHandler::Write(
     const std::optional<std::string>& previous_index_manifest,
     const std::vector<IndexManifestEntry>& new_index_entries,
@@ -118,11 +171,13 @@ IndexManifestFileHandler::SeparateIndexEntries(
 
 Result<std::unique_ptr<IndexManifestFileHandler::IndexManifestFileCombiner>>
 IndexManifestFileHandler::GetIndexManifestFileCombine(const std::string& index_type) {
-    if (index_type != DeletionVectorsIndexFile::DELETION_VECTORS_INDEX && index_type != "HASH") {
+    if (index_type == DeletionVectorsIndexFile::DELETION_VECTORS_INDEX) {
+        return std::make_unique<BucketedCombiner>();
+    }
+    if (index_type != "HASH") {
         return std::make_unique<GlobalFileNameCombiner>();
     }
-    return Status::NotImplemented(
-        "Do not support handle dv index or hash index in commit process.");
+    return Status::NotImplemented("Do not support handle hash index in commit process.");
 }
 
 }  // namespace paimon
@@ -54,6 +54,15 @@ class IndexManifestFileHandler {
             const std::vector<IndexManifestEntry>& new_index_files) const override;
     };
 
+    /// Combine previous and new index files by partition and bucket, the new index files of a
+    /// bucket replace all its previous index files.
+    class BucketedCombiner : public IndexManifestFileCombiner {
+     public:
+        std::vector<IndexManifestEntry> Combine(
+            const std::vector<IndexManifestEntry>& prev_index_files,
+            const std::vector<IndexManifestEntry>& new_index_files) const override;
+    };
+
     static std::map<std::string, std::vector<IndexManifestEntry>> SeparateIndexEntries(
         const std::vector<IndexManifestEntry>& index_entries);
 
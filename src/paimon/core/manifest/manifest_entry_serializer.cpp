@@ -19,11 +19,14 @@
 #include <string>
 #include <utility>
 
+#include "arrow/api.h"
 #include "fmt/format.h"
 #include "paimon/common/data/binary_row.h"
 #include "paimon/common/data/internal_row.h"
+#include "paimon/common/utils/arrow/status_utils.h"
 #include "paimon/common/utils/serialization_utils.h"
 #include "paimon/core/manifest/file_kind.h"
+#include "paimon/core/utils/meta_builder_utils.h"
 #include "paimon/status.h"
 
 namespace paimon {
@@ -75,4 +78,22 @@ Result<BinaryRow> ManifestEntrySerializer::ToRow(const ManifestEntry& record) co
     return row;
 }
 
+Status ManifestEntrySerializer::AppendTo(const ManifestEntry& record,
+                                         arrow::StructBuilder* builder) const {
+    using Utils = MetaBuilderUtils;
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(builder->Append());
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(
+        Utils::FieldBuilder<arrow::Int32Builder>(builder, 0)->Append(GetVersion()));
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(
+        Utils::FieldBuilder<arrow::Int8Builder>(builder, 1)->Append(record.Kind().ToByteValue()));
+    PAIMON_RETURN_NOT_OK(Utils::AppendBinaryRow(
+        record.Partition(), pool_.get(), Utils::FieldBuilder<arrow::BinaryBuilder>(builder, 2)));
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(
+        Utils::FieldBuilder<arrow::Int32Builder>(builder, 3)->Append(record.Bucket()));
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(
+        Utils::FieldBuilder<arrow::Int32Builder>(builder, 4)->Append(record.TotalBuckets()));
+    return data_file_meta_serializer_.AppendTo(
+        record.File(), Utils::FieldBuilder<arrow::StructBuilder>(builder, 5));
+}
+
 }  // namespace paimon
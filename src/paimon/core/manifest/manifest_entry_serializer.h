@@ -30,6 +30,7 @@
 
 namespace arrow {
 class ArrayBuilder;
+class StructBuilder;
 }  // namespace arrow
 struct ArrowArray;
 
@@ -53,6 +54,12 @@ class ManifestEntrySerializer : public VersionedObjectSerializer<ManifestEntry>
 
     Result<BinaryRow> ToRow(const ManifestEntry& record) const override;
 
+    bool SupportAppendTo() const override {
+        return true;
+    }
+
+    Status AppendTo(const ManifestEntry& record, arrow::StructBuilder* builder) const override;
+
  private:
     static constexpr int32_t VERSION_1 = 1;
     static constexpr int32_t VERSION_2 = 2;
@@ -19,13 +19,18 @@
 #include <optional>
 #include <string>
 
+#include "arrow/api.h"
 #include "gtest/gtest.h"
 #include "paimon/common/data/binary_row.h"
+#include "paimon/common/utils/arrow/mem_utils.h"
 #include "paimon/core/io/data_file_meta.h"
+#include "paimon/core/io/meta_to_arrow_array_converter.h"
 #include "paimon/core/manifest/file_kind.h"
+#include "paimon/core/manifest/file_source.h"
 #include "paimon/core/manifest/manifest_entry.h"
 #include "paimon/core/stats/simple_stats.h"
 #include "paimon/data/timestamp.h"
+#include "paimon/memory/bytes.h"
 #include "paimon/memory/memory_pool.h"
 #include "paimon/testing/utils/binary_row_generator.h"
 #include "paimon/testing/utils/testharness.h"
@@ -59,4 +64,56 @@ TEST_F(ManifestEntrySerializerTest, TestToFromRow) {
         ASSERT_EQ(entry.ToString(), result_entry.ToString());
     }
 }
+
+TEST_F(ManifestEntrySerializerTest, TestAppendTo) {
+    auto pool = GetDefaultPool();
+    auto meta = std::make_shared<DataFileMeta>(
+        "data-file.orc", /*file_size=*/943, /*row_count=*/4,
+        /*min_key=*/BinaryRowGenerator::GenerateRow({"Alex", 0}, pool.get()),
+        /*max_key=*/BinaryRowGenerator::GenerateRow({"Tony", 0}, pool.get()),
+        /*key_stats=*/
+        BinaryRowGenerator::GenerateStats({"Alex", 0}, {"Tony", 0}, {0, 0}, pool.get()),
+        /*value_stats=*/
+        BinaryRowGenerator::GenerateStats({"Alex", 20, 0, 12.1}, {"Tony", 20, 0, 16.1},
+                                          {0, 1, 2, 3}, pool.get()),
+        /*min_seq_no=*/0, /*max_seq_no=*/3, /*schema_id=*/1, /*level=*/5,
+        /*extra_files=*/std::vector<std::optional<std::string>>({"data-file.orc.index"}),
+        /*creation_time=*/Timestamp(1743525392921ll, 123456), /*delete_row_count=*/1,
+        /*embedded_index=*/std::make_shared<Bytes>("embedded index", pool.get()),
+        FileSource::Compact(),
+        /*value_stats_cols=*/std::vector<std::string>({"f0", "f1", "f2", "f3"}),
+        /*external_path=*/"oss://bucket/data-file.orc", /*first_row_id=*/5000000000l,
+        /*write_cols=*/std::vector<std::string>({"f0", "f1"}));
+    std::vector<ManifestEntry> entries = {
+        ManifestEntry(FileKind::Add(), BinaryRow::EmptyRow(), 0, 2, GetDataFileMeta()),
+        ManifestEntry(FileKind::Delete(), BinaryRowGenerator::GenerateRow({10}, pool.get()), 1, 2,
+                      meta)};
+    ManifestEntrySerializer serializer(pool);
+    ASSERT_TRUE(serializer.SupportAppendTo());
+
+    // arrays converted from rows are the expected ones
+    std::vector<BinaryRow> rows;
+    for (const auto& entry : entries) {
+        ASSERT_OK_AND_ASSIGN(BinaryRow row, serializer.ToRow(entry));
+        rows.push_back(row);
+    }
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<MetaToArrowArrayConverter> converter,
+                         MetaToArrowArrayConverter::Create(serializer.GetDataType(), pool));
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<arrow::Array> expected, converter->NextBatch(rows));
+
+    auto arrow_pool = GetArrowPool(pool);
+    std::unique_ptr<arrow::ArrayBuilder> array_builder;
+    ASSERT_TRUE(
+        arrow::MakeBuilder(arrow_pool.get(), serializer.GetDataType(), &array_builder).ok());
+    auto* struct_builder = dynamic_cast<arrow::StructBuilder*>(array_builder.get());
+    ASSERT_TRUE(struct_builder);
+    for (const auto& entry : entries) {
+        ASSERT_OK(serializer.AppendTo(entry, struct_builder));
+    }
+    std::shared_ptr<arrow::Array> result;
+    ASSERT_TRUE(struct_builder->Finish(&result).ok());
+    ASSERT_TRUE(result->Equals(expected)) << result->ToString() << std::endl
+                                          << expected->ToString();
+}
+
 }  // namespace paimon::test
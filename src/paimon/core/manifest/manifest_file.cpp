@@ -88,37 +88,36 @@ Result<std::vector<ManifestFileMeta>> ManifestFile::Write(
     if (entries.empty()) {
         return std::vector<ManifestFileMeta>();
     }
-    auto converter = [this](ManifestEntry entry, ::ArrowArray* dest) -> Status {
-        if (!to_array_converter_) {
-            PAIMON_ASSIGN_OR_RAISE(to_array_converter_, MetaToArrowArrayConverter::Create(
-                                                            serializer_->GetDataType(), pool_));
+    std::unique_ptr<RollingFileWriter<const ManifestEntry&, ManifestFileMeta>> writer =
+        CreateRollingWriter();
+    for (const auto& entry : entries) {
+        auto s = writer->Write(entry);
+        if (!s.ok()) {
+            writer->Abort();
+            return s;
         }
-        PAIMON_ASSIGN_OR_RAISE(BinaryRow entry_row, serializer_->ToRow(entry));
+    }
+    PAIMON_RETURN_NOT_OK(writer->Close());
+    return writer->GetResult();
+}
+
+std::unique_ptr<RollingFileWriter<const ManifestEntry&, ManifestFileMeta>>
+ManifestFile::CreateRollingWriter() {
+    auto converter = [this](const ManifestEntry& entry, ::ArrowArray* dest) -> Status {
         PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<arrow::Array> array,
-                               to_array_converter_->NextBatch({entry_row}));
+                               ToArrowArray(&entry, /*num_records=*/1));
         PAIMON_RETURN_NOT_OK_FROM_ARROW(arrow::ExportArray(*array, dest));
         return Status::OK();
     };
-
-    auto create_file_writer = [&]() -> Result<std::unique_ptr<ManifestEntryWriter>> {
+    auto create_file_writer = [this, converter]() -> Result<std::unique_ptr<ManifestEntryWriter>> {
         auto writer = std::make_unique<ManifestEntryWriter>(options_.GetManifestCompression(),
                                                             converter, pool_, partition_type_);
         PAIMON_RETURN_NOT_OK(
             writer->Init(options_.GetFileSystem(), path_factory_->NewPath(), writer_builder_));
         return writer;
     };
-    std::unique_ptr<RollingFileWriter<const ManifestEntry&, ManifestFileMeta>> writer =
-        std::make_unique<RollingFileWriter<const ManifestEntry&, ManifestFileMeta>>(
-            target_file_size_, create_file_writer);
-    for (const auto& entry : entries) {
-        auto s = writer->Write(entry);
-        if (!s.ok()) {
-            writer->Abort();
-            return s;
-        }
-    }
-    PAIMON_RETURN_NOT_OK(writer->Close());
-    return writer->GetResult();
+    return std::make_unique<RollingFileWriter<const ManifestEntry&, ManifestFileMeta>>(
+        target_file_size_, create_file_writer);
 }
 
 }  // namespace paimon
@@ -44,6 +44,8 @@ class PathFactory;
 class ManifestFileMeta;
 class ManifestEntry;
 class MemoryPool;
+template <typename T, typename R>
+class RollingFileWriter;
 
 /// This file includes several `ManifestEntry`s, representing the additional changes since last
 /// snapshot.
@@ -60,6 +62,11 @@ class ManifestFile : public ObjectsFile<ManifestEntry> {
     /// @note This method is atomic.
     Result<std::vector<ManifestFileMeta>> Write(const std::vector<ManifestEntry>& entries);
 
+    /// Create a writer which rolls `ManifestEntry`s over manifest files of the target file size,
+    /// for entries which are not in memory at once.
+    std::unique_ptr<RollingFileWriter<const ManifestEntry&, ManifestFileMeta>>
+    CreateRollingWriter();
+
  private:
     ManifestFile(const std::shared_ptr<FileSystem>& file_system,
                  const std::shared_ptr<ReaderBuilder>& reader_builder,
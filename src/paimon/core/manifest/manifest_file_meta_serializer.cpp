@@ -20,10 +20,13 @@
 #include <string>
 #include <utility>
 
+#include "arrow/api.h"
 #include "fmt/format.h"
 #include "paimon/common/data/binary_string.h"
 #include "paimon/common/data/internal_row.h"
+#include "paimon/common/utils/arrow/status_utils.h"
 #include "paimon/core/stats/simple_stats.h"
+#include "paimon/core/utils/meta_builder_utils.h"
 #include "paimon/status.h"
 
 namespace paimon {
@@ -71,19 +74,50 @@ Result<BinaryRow> ManifestFileMetaSerializer::ToRow(const ManifestFileMeta& reco
     if (!min_row_id) {
         writer.SetNullAt(11);
     } else {
-        writer.WriteInt(11, min_row_id.value());
+        writer.WriteLong(11, min_row_id.value());
     }
 
     auto max_row_id = record.MaxRowId();
     if (!max_row_id) {
         writer.SetNullAt(12);
     } else {
-        writer.WriteInt(12, max_row_id.value());
+        writer.WriteLong(12, max_row_id.value());
     }
     writer.Complete();
     return row;
 }
 
+Status ManifestFileMetaSerializer::AppendTo(const ManifestFileMeta& record,
+                                            arrow::StructBuilder* builder) const {
+    using Utils = MetaBuilderUtils;
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(builder->Append());
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(
+        Utils::FieldBuilder<arrow::Int32Builder>(builder, 0)->Append(GetVersion()));
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(
+        Utils::FieldBuilder<arrow::StringBuilder>(builder, 1)->Append(record.FileName()));
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(
+        Utils::FieldBuilder<arrow::Int64Builder>(builder, 2)->Append(record.FileSize()));
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(
+        Utils::FieldBuilder<arrow::Int64Builder>(builder, 3)->Append(record.NumAddedFiles()));
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(
+        Utils::FieldBuilder<arrow::Int64Builder>(builder, 4)->Append(record.NumDeletedFiles()));
+    PAIMON_RETURN_NOT_OK(record.PartitionStats().AppendTo(
+        Utils::FieldBuilder<arrow::StructBuilder>(builder, 5), pool_.get()));
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(
+        Utils::FieldBuilder<arrow::Int64Builder>(builder, 6)->Append(record.SchemaId()));
+    PAIMON_RETURN_NOT_OK(
+        Utils::AppendOptional<arrow::Int32Builder>(builder, 7, record.MinBucket()));
+    PAIMON_RETURN_NOT_OK(
+        Utils::AppendOptional<arrow::Int32Builder>(builder, 8, record.MaxBucket()));
+    PAIMON_RETURN_NOT_OK(
+        Utils::AppendOptional<arrow::Int32Builder>(builder, 9, record.MinLevel()));
+    PAIMON_RETURN_NOT_OK(
+        Utils::AppendOptional<arrow::Int32Builder>(builder, 10, record.MaxLevel()));
+    PAIMON_RETURN_NOT_OK(
+        Utils::AppendOptional<arrow::Int64Builder>(builder, 11, record.MinRowId()));
+    return Utils::AppendOptional<arrow::Int64Builder>(builder, 12, record.MaxRowId());
+}
+
 Result<ManifestFileMeta> ManifestFileMetaSerializer::ConvertFrom(int32_t version,
                                                                  const InternalRow& row) const {
     if (version != VERSION_2) {
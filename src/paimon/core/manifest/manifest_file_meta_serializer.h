@@ -31,6 +31,7 @@ struct ArrowArray;
 
 namespace arrow {
 class ArrayBuilder;
+class StructBuilder;
 }  // namespace arrow
 
 namespace paimon {
@@ -51,6 +52,12 @@ class ManifestFileMetaSerializer : public VersionedObjectSerializer<ManifestFile
 
     Result<BinaryRow> ToRow(const ManifestFileMeta& record) const override;
 
+    bool SupportAppendTo() const override {
+        return true;
+    }
+
+    Status AppendTo(const ManifestFileMeta& record, arrow::StructBuilder* builder) const override;
+
  private:
     static constexpr int32_t VERSION_2 = 2;
     static constexpr int32_t VERSION_1 = 1;
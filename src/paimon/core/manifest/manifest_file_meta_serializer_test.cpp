@@ -20,11 +20,14 @@
 #include <string>
 #include <variant>
 
+#include "arrow/api.h"
 #include "gtest/gtest.h"
 #include "paimon/common/data/binary_row.h"
 #include "paimon/common/data/binary_string.h"
 #include "paimon/common/data/data_define.h"
 #include "paimon/common/data/generic_row.h"
+#include "paimon/common/utils/arrow/mem_utils.h"
+#include "paimon/core/io/meta_to_arrow_array_converter.h"
 #include "paimon/core/manifest/manifest_file_meta.h"
 #include "paimon/core/stats/simple_stats.h"
 #include "paimon/memory/memory_pool.h"
@@ -54,6 +57,47 @@ TEST(ManifestFileMetaSerializerTest, TestToFromRow) {
     }
 }
 
+TEST(ManifestFileMetaSerializerTest, TestAppendTo) {
+    auto pool = GetDefaultPool();
+    ManifestFileMeta meta1(/*file_name=*/"meta1", /*file_size=*/10, /*num_added_files=*/15,
+                           /*num_deleted_files=*/20, SimpleStats::EmptyStats(), /*schema_id=*/0,
+                           /*min_bucket=*/std::nullopt, /*max_bucket=*/std::nullopt,
+                           /*min_level=*/std::nullopt, /*max_level=*/std::nullopt,
+                           /*min_row_id=*/std::nullopt, /*max_row_id=*/std::nullopt);
+    ManifestFileMeta meta2(
+        /*file_name=*/"meta2", /*file_size=*/25, /*num_added_files=*/30,
+        /*num_deleted_files=*/35,
+        BinaryRowGenerator::GenerateStats({10, "a"}, {20, "b"}, {0, 2}, pool.get()),
+        /*schema_id=*/1, /*min_bucket=*/0, /*max_bucket=*/3, /*min_level=*/0, /*max_level=*/5,
+        /*min_row_id=*/200, /*max_row_id=*/5000000000l);
+    std::vector<ManifestFileMeta> metas = {meta1, meta2};
+    ManifestFileMetaSerializer serializer(pool);
+    ASSERT_TRUE(serializer.SupportAppendTo());
+
+    std::vector<BinaryRow> rows;
+    for (const auto& meta : metas) {
+        ASSERT_OK_AND_ASSIGN(BinaryRow row, serializer.ToRow(meta));
+        rows.push_back(row);
+    }
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<MetaToArrowArrayConverter> converter,
+                         MetaToArrowArrayConverter::Create(serializer.GetDataType(), pool));
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<arrow::Array> expected, converter->NextBatch(rows));
+
+    auto arrow_pool = GetArrowPool(pool);
+    std::unique_ptr<arrow::ArrayBuilder> array_builder;
+    ASSERT_TRUE(
+        arrow::MakeBuilder(arrow_pool.get(), serializer.GetDataType(), &array_builder).ok());
+    auto* struct_builder = dynamic_cast<arrow::StructBuilder*>(array_builder.get());
+    ASSERT_TRUE(struct_builder);
+    for (const auto& meta : metas) {
+        ASSERT_OK(serializer.AppendTo(meta, struct_builder));
+    }
+    std::shared_ptr<arrow::Array> result;
+    ASSERT_TRUE(struct_builder->Finish(&result).ok());
+    ASSERT_TRUE(result->Equals(expected)) << result->ToString() << std::endl
+                                          << expected->ToString();
+}
+
 TEST(ManifestFileMetaSerializerTest, TestInvalidCase) {
     auto pool = GetDefaultPool();
 
@@ -22,6 +22,7 @@
 #include <tuple>
 #include <utility>
 
+#include "arrow/api.h"
 #include "paimon/common/utils/binary_row_partition_computer.h"
 #include "paimon/core/io/data_file_meta.h"
 #include "paimon/core/manifest/file_kind.h"
@@ -43,6 +44,16 @@ PartitionEntry PartitionEntry::Merge(const PartitionEntry& entry) const {
                           std::max(last_file_creation_time_, entry.last_file_creation_time_));
 }
 
+const std::shared_ptr<arrow::DataType>& PartitionEntry::DataType() {
+    static std::shared_ptr<arrow::DataType> data_type = arrow::struct_(
+        {arrow::field("_PARTITION", arrow::binary(), /*nullable=*/false),
+         arrow::field("_RECORD_COUNT", arrow::int64(), /*nullable=*/false),
+         arrow::field("_FILE_SIZE_IN_BYTES", arrow::int64(), /*nullable=*/false),
+         arrow::field("_FILE_COUNT", arrow::int64(), /*nullable=*/false),
+         arrow::field("_LAST_FILE_CREATION_TIME", arrow::int64(), /*nullable=*/false)});
+    return data_type;
+}
+
 Result<PartitionEntry> PartitionEntry::FromDataFile(const BinaryRow& partition,
                                                     const FileKind& kind,
                                                     const std::shared_ptr<DataFileMeta>& file) {
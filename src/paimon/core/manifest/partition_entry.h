@@ -31,6 +31,10 @@
 #include "paimon/result.h"
 #include "paimon/status.h"
 
+namespace arrow {
+class DataType;
+}  // namespace arrow
+
 namespace paimon {
 class FileKind;
 struct DataFileMeta;
@@ -60,6 +64,8 @@ class PartitionEntry {
     }
     PartitionEntry Merge(const PartitionEntry& entry) const;
 
+    static const std::shared_ptr<arrow::DataType>& DataType();
+
     static Result<PartitionEntry> FromManifestEntry(const ManifestEntry& entry) {
         return FromDataFile(entry.Partition(), entry.Kind(), entry.File());
     }
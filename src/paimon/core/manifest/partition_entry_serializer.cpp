@@ -0,0 +1,60 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/manifest/partition_entry_serializer.h"
+
+#include <cassert>
+#include <string>
+
+#include "fmt/format.h"
+#include "paimon/common/data/binary_row.h"
+#include "paimon/common/data/binary_row_writer.h"
+#include "paimon/common/data/internal_row.h"
+#include "paimon/common/utils/serialization_utils.h"
+#include "paimon/status.h"
+
+namespace paimon {
+
+Result<PartitionEntry> PartitionEntrySerializer::ConvertFrom(int32_t version,
+                                                             const InternalRow& row) const {
+    if (version != VERSION_1) {
+        return Status::Invalid(fmt::format("Unsupported version: {}", version));
+    }
+    auto partition_bytes = row.GetBinary(0);
+    PAIMON_ASSIGN_OR_RAISE(BinaryRow partition,
+                           SerializationUtils::DeserializeBinaryRow(partition_bytes));
+    return PartitionEntry(partition, /*record_count=*/row.GetLong(1),
+                          /*file_size_in_bytes=*/row.GetLong(2), /*file_count=*/row.GetLong(3),
+                          /*last_file_creation_time=*/row.GetLong(4));
+}
+
+Result<BinaryRow> PartitionEntrySerializer::ToRow(const PartitionEntry& record) const {
+    BinaryRow row(GetDataType()->num_fields());
+    BinaryRowWriter writer(&row, 1024, pool_.get());
+
+    writer.WriteInt(0, GetVersion());
+    auto partition_bytes = SerializationUtils::SerializeBinaryRow(record.Partition(), pool_.get());
+    assert(partition_bytes);
+    writer.WriteBinary(1, *partition_bytes);
+    writer.WriteLong(2, record.RecordCount());
+    writer.WriteLong(3, record.FileSizeInBytes());
+    writer.WriteLong(4, record.FileCount());
+    writer.WriteLong(5, record.LastFileCreationTime());
+    writer.Complete();
+    return row;
+}
+
+}  // namespace paimon
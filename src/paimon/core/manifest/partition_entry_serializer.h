@@ -0,0 +1,48 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "paimon/core/manifest/partition_entry.h"
+#include "paimon/core/utils/versioned_object_serializer.h"
+#include "paimon/result.h"
+
+namespace paimon {
+class InternalRow;
+class MemoryPool;
+
+/// Serializer for `PartitionEntry`.
+class PartitionEntrySerializer : public VersionedObjectSerializer<PartitionEntry> {
+ public:
+    explicit PartitionEntrySerializer(const std::shared_ptr<MemoryPool>& pool)
+        : VersionedObjectSerializer<PartitionEntry>(pool) {}
+
+    int32_t GetVersion() const override {
+        return VERSION_1;
+    }
+
+    Result<PartitionEntry> ConvertFrom(int32_t version, const InternalRow& row) const override;
+
+    Result<BinaryRow> ToRow(const PartitionEntry& record) const override;
+
+ private:
+    static constexpr int32_t VERSION_1 = 1;
+};
+
+}  // namespace paimon
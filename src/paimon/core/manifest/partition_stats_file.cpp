@@ -0,0 +1,106 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/manifest/partition_stats_file.h"
+
+#include <unordered_map>
+#include <utility>
+
+#include "arrow/c/abi.h"
+#include "arrow/c/bridge.h"
+#include "paimon/common/utils/arrow/status_utils.h"
+#include "paimon/common/utils/linked_hash_map.h"
+#include "paimon/core/manifest/partition_entry_serializer.h"
+#include "paimon/core/utils/file_store_path_factory.h"
+#include "paimon/core/utils/path_factory.h"
+#include "paimon/core/utils/versioned_object_serializer.h"
+#include "paimon/format/file_format.h"
+#include "paimon/format/reader_builder.h"
+#include "paimon/format/writer_builder.h"
+
+namespace paimon {
+
+PartitionStatsFile::PartitionStatsFile(const std::shared_ptr<FileSystem>& file_system,
+                                       const std::shared_ptr<ReaderBuilder>& reader_builder,
+                                       const std::shared_ptr<WriterBuilder>& writer_builder,
+                                       const std::string& compression,
+                                       const std::shared_ptr<PathFactory>& path_factory,
+                                       const std::shared_ptr<MemoryPool>& pool)
+    : ObjectsFile<PartitionEntry>(file_system, reader_builder, writer_builder,
+                                  std::make_unique<PartitionEntrySerializer>(pool), compression,
+                                  path_factory, pool) {}
+
+Result<std::unique_ptr<PartitionStatsFile>> PartitionStatsFile::Create(
+    const std::shared_ptr<FileSystem>& file_system, const std::shared_ptr<FileFormat>& file_format,
+    const std::string& compression, const std::shared_ptr<FileStorePathFactory>& path_factory,
+    const std::shared_ptr<MemoryPool>& pool) {
+    std::shared_ptr<arrow::DataType> data_type =
+        VersionedObjectSerializer<PartitionEntry>::VersionType(PartitionEntry::DataType());
+    PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<ReaderBuilder> reader_builder,
+                           file_format->CreateReaderBuilder(/*batch_size=*/1024));
+    reader_builder->WithMemoryPool(pool);
+
+    ArrowSchema schema;
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(arrow::ExportType(*data_type, &schema));
+    PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<WriterBuilder> writer_builder,
+                           file_format->CreateWriterBuilder(&schema, /*batch_size=*/1024));
+    writer_builder->WithMemoryPool(pool);
+
+    std::shared_ptr<PathFactory> partition_stats_path_factory =
+        path_factory->CreatePartitionStatsFileFactory();
+    return std::unique_ptr<PartitionStatsFile>(
+        new PartitionStatsFile(file_system, reader_builder, writer_builder, compression,
+                               partition_stats_path_factory, pool));
+}
+
+Result<std::string> PartitionStatsFile::Write(const std::vector<PartitionEntry>& entries) {
+    PAIMON_ASSIGN_OR_RAISE(auto file, WriteWithoutRolling(entries));
+    return file.first;
+}
+
+Result<std::vector<PartitionEntry>> PartitionStatsFile::ReadAll(
+    const std::string& file_name) const {
+    std::vector<PartitionEntry> entries;
+    PAIMON_RETURN_NOT_OK(Read(file_name, /*filter=*/nullptr, &entries));
+    return entries;
+}
+
+std::vector<PartitionEntry> PartitionStatsFile::Apply(const std::vector<PartitionEntry>& base,
+                                                      const std::vector<PartitionEntry>& delta) {
+    // keep the order of base partitions stable, new partitions are appended at the end
+    LinkedHashMap<BinaryRow, PartitionEntry> merged;
+    for (const auto& entry : base) {
+        merged.insert(entry.Partition(), entry);
+    }
+    for (const auto& entry : delta) {
+        auto iter = merged.find(entry.Partition());
+        if (iter == merged.end()) {
+            merged.insert(entry.Partition(), entry);
+        } else {
+            merged.insert_or_assign(entry.Partition(), iter->second.Merge(entry));
+        }
+    }
+    std::vector<PartitionEntry> result;
+    result.reserve(merged.size());
+    for (const auto& [_, entry] : merged) {
+        if (entry.FileCount() > 0) {
+            result.push_back(entry);
+        }
+    }
+    return result;
+}
+
+}  // namespace paimon
@@ -0,0 +1,68 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "paimon/core/manifest/partition_entry.h"
+#include "paimon/core/utils/objects_file.h"
+#include "paimon/memory/memory_pool.h"
+#include "paimon/result.h"
+
+namespace paimon {
+class FileFormat;
+class FileStorePathFactory;
+class FileSystem;
+class MemoryPool;
+class PathFactory;
+class ReaderBuilder;
+class WriterBuilder;
+
+/// This file includes one `PartitionEntry` for every live partition of the table at the
+/// corresponding snapshot. It is maintained incrementally at commit time, so listing partitions
+/// only needs a single small read instead of a scan of all manifests.
+class PartitionStatsFile : public ObjectsFile<PartitionEntry> {
+ public:
+    static Result<std::unique_ptr<PartitionStatsFile>> Create(
+        const std::shared_ptr<FileSystem>& file_system,
+        const std::shared_ptr<FileFormat>& file_format, const std::string& compression,
+        const std::shared_ptr<FileStorePathFactory>& path_factory,
+        const std::shared_ptr<MemoryPool>& pool);
+
+    /// Write the partition entries into a new partition stats file and return its file name.
+    Result<std::string> Write(const std::vector<PartitionEntry>& entries);
+
+    /// Read all partition entries of a partition stats file.
+    Result<std::vector<PartitionEntry>> ReadAll(const std::string& file_name) const;
+
+    /// Apply `delta` to `base`. Entries of the same partition are merged, partitions without any
+    /// remaining file are dropped.
+    static std::vector<PartitionEntry> Apply(const std::vector<PartitionEntry>& base,
+                                             const std::vector<PartitionEntry>& delta);
+
+ private:
+    PartitionStatsFile(const std::shared_ptr<FileSystem>& file_system,
+                       const std::shared_ptr<ReaderBuilder>& reader_builder,
+                       const std::shared_ptr<WriterBuilder>& writer_builder,
+                       const std::string& compression,
+                       const std::shared_ptr<PathFactory>& path_factory,
+                       const std::shared_ptr<MemoryPool>& pool);
+};
+
+}  // namespace paimon
@@ -0,0 +1,141 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/manifest/partition_stats_file.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/type.h"
+#include "gtest/gtest.h"
+#include "paimon/common/utils/string_utils.h"
+#include "paimon/core/utils/file_store_path_factory.h"
+#include "paimon/format/file_format.h"
+#include "paimon/format/file_format_factory.h"
+#include "paimon/fs/local/local_file_system.h"
+#include "paimon/memory/memory_pool.h"
+#include "paimon/testing/utils/binary_row_generator.h"
+#include "paimon/testing/utils/testharness.h"
+
+namespace paimon::test {
+class PartitionStatsFileTest : public testing::Test,
+                               public ::testing::WithParamInterface<std::string> {
+ public:
+    void SetUp() override {
+        pool_ = GetDefaultPool();
+        dir_ = UniqueTestDirectory::Create();
+        ASSERT_TRUE(dir_);
+    }
+
+    std::unique_ptr<PartitionStatsFile> CreatePartitionStatsFile(
+        const std::string& file_format_str) const {
+        std::shared_ptr<FileSystem> file_system = std::make_shared<LocalFileSystem>();
+        EXPECT_OK_AND_ASSIGN(std::shared_ptr<FileFormat> file_format,
+                             FileFormatFactory::Get(file_format_str, {}));
+        auto schema = arrow::schema(arrow::FieldVector(
+            {arrow::field("f0", arrow::utf8()), arrow::field("p0", arrow::int32())}));
+        EXPECT_OK_AND_ASSIGN(std::shared_ptr<FileStorePathFactory> path_factory,
+                             FileStorePathFactory::Create(
+                                 dir_->Str(), schema, /*partition_keys=*/{"p0"},
+                                 /*default_part_value=*/"", file_format->Identifier(),
+                                 /*data_file_prefix=*/"data-",
+                                 /*legacy_partition_name_enabled=*/true, /*external_paths=*/{},
+                                 /*index_file_in_data_file_dir=*/false, pool_));
+        EXPECT_OK_AND_ASSIGN(auto partition_stats_file,
+                             PartitionStatsFile::Create(file_system, file_format, "zstd",
+                                                        path_factory, pool_));
+        return partition_stats_file;
+    }
+
+    BinaryRow Partition(int32_t value) const {
+        return BinaryRowGenerator::GenerateRow({value}, pool_.get());
+    }
+
+ protected:
+    std::shared_ptr<MemoryPool> pool_;
+    std::unique_ptr<UniqueTestDirectory> dir_;
+};
+
+TEST(PartitionStatsFileApplyTest, TestApply) {
+    auto pool = GetDefaultPool();
+    auto Partition = [&](int32_t value) {
+        return BinaryRowGenerator::GenerateRow({value}, pool.get());
+    };
+    std::vector<PartitionEntry> base = {
+        PartitionEntry(Partition(10), /*record_count=*/9, /*file_size_in_bytes=*/1000,
+                       /*file_count=*/2, /*last_file_creation_time=*/100),
+        PartitionEntry(Partition(20), /*record_count=*/2, /*file_size_in_bytes=*/500,
+                       /*file_count=*/1, /*last_file_creation_time=*/200)};
+    std::vector<PartitionEntry> delta = {
+        // add a file to partition 10
+        PartitionEntry(Partition(10), /*record_count=*/1, /*file_size_in_bytes=*/100,
+                       /*file_count=*/1, /*last_file_creation_time=*/300),
+        // drop the only file of partition 20
+        PartitionEntry(Partition(20), /*record_count=*/-2, /*file_size_in_bytes=*/-500,
+                       /*file_count=*/-1, /*last_file_creation_time=*/50),
+        // a new partition
+        PartitionEntry(Partition(30), /*record_count=*/5, /*file_size_in_bytes=*/200,
+                       /*file_count=*/1, /*last_file_creation_time=*/400)};
+
+    std::vector<PartitionEntry> expected = {
+        PartitionEntry(Partition(10), /*record_count=*/10, /*file_size_in_bytes=*/1100,
+                       /*file_count=*/3, /*last_file_creation_time=*/300),
+        PartitionEntry(Partition(30), /*record_count=*/5, /*file_size_in_bytes=*/200,
+                       /*file_count=*/1, /*last_file_creation_time=*/400)};
+    ASSERT_EQ(PartitionStatsFile::Apply(base, delta), expected);
+    ASSERT_EQ(PartitionStatsFile::Apply({}, base), base);
+    ASSERT_EQ(PartitionStatsFile::Apply(base, {}), base);
+}
+
+TEST_P(PartitionStatsFileTest, TestWriteAndRead) {
+    auto partition_stats_file = CreatePartitionStatsFile(GetParam());
+    std::vector<PartitionEntry> entries = {
+        PartitionEntry(Partition(10), /*record_count=*/9, /*file_size_in_bytes=*/1183,
+                       /*file_count=*/2, /*last_file_creation_time=*/1721614434472l),
+        PartitionEntry(Partition(20), /*record_count=*/2, /*file_size_in_bytes=*/1047,
+                       /*file_count=*/2, /*last_file_creation_time=*/1721614467404l)};
+    ASSERT_OK_AND_ASSIGN(std::string file_name, partition_stats_file->Write(entries));
+    ASSERT_TRUE(StringUtils::StartsWith(file_name, "partition-stats-"));
+    ASSERT_OK_AND_ASSIGN(std::vector<PartitionEntry> result,
+                         partition_stats_file->ReadAll(file_name));
+    ASSERT_EQ(result, entries);
+
+    // empty table
+    ASSERT_OK_AND_ASSIGN(std::string empty_file_name, partition_stats_file->Write({}));
+    ASSERT_NE(empty_file_name, file_name);
+    ASSERT_OK_AND_ASSIGN(result, partition_stats_file->ReadAll(empty_file_name));
+    ASSERT_TRUE(result.empty());
+
+    partition_stats_file->DeleteQuietly(file_name);
+    ASSERT_NOK(partition_stats_file->ReadAll(file_name));
+}
+
+std::vector<std::string> GetTestValuesForPartitionStatsFileTest() {
+    std::vector<std::string> values = {"parquet"};
+#ifdef PAIMON_ENABLE_ORC
+    values.emplace_back("orc");
+#endif
+#ifdef PAIMON_ENABLE_AVRO
+    values.emplace_back("avro");
+#endif
+    return values;
+}
+
+INSTANTIATE_TEST_SUITE_P(FileFormat, PartitionStatsFileTest,
+                         ::testing::ValuesIn(GetTestValuesForPartitionStatsFileTest()));
+
+}  // namespace paimon::test
@@ -0,0 +1,53 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/mergetree/compact/sort_merge_reader.h"
+
+#include <cstdint>
+#include <utility>
+
+#include "fmt/format.h"
+#include "paimon/core/mergetree/compact/sort_merge_reader_with_loser_tree.h"
+#include "paimon/core/mergetree/compact/sort_merge_reader_with_min_heap.h"
+#include "paimon/core/mergetree/compact/sort_merge_reader_with_two_way.h"
+#include "paimon/status.h"
+
+namespace paimon {
+
+Result<std::unique_ptr<SortMergeReader>> SortMergeReader::Create(
+    SortEngine sort_engine, std::vector<std::unique_ptr<KeyValueRecordReader>>&& readers,
+    const std::shared_ptr<FieldsComparator>& user_key_comparator,
+    const std::shared_ptr<FieldsComparator>& user_defined_seq_comparator,
+    const std::shared_ptr<MergeFunctionWrapper<KeyValue>>& merge_function_wrapper) {
+    if (readers.size() <= SortMergeReaderWithTwoWay::kMaxReaders) {
+        return std::make_unique<SortMergeReaderWithTwoWay>(std::move(readers), user_key_comparator,
+                                                           user_defined_seq_comparator,
+                                                           merge_function_wrapper);
+    }
+    if (sort_engine == SortEngine::MIN_HEAP) {
+        return std::make_unique<SortMergeReaderWithMinHeap>(
+            std::move(readers), user_key_comparator, user_defined_seq_comparator,
+            merge_function_wrapper);
+    } else if (sort_engine == SortEngine::LOSER_TREE) {
+        return std::make_unique<SortMergeReaderWithLoserTree>(
+            std::move(readers), user_key_comparator, user_defined_seq_comparator,
+            merge_function_wrapper);
+    }
+    return Status::Invalid(fmt::format("unsupported sort engine: {}",
+                                       static_cast<int32_t>(sort_engine)));
+}
+
+}  // namespace paimon
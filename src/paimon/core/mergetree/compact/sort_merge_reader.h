@@ -16,15 +16,31 @@
 
 #pragma once
 #include <memory>
+#include <vector>
 
 #include "paimon/core/key_value.h"
+#include "paimon/core/options/sort_engine.h"
 #include "paimon/metrics.h"
 #include "paimon/result.h"
 
 namespace paimon {
+class FieldsComparator;
+class KeyValueRecordReader;
+template <typename T>
+class MergeFunctionWrapper;
+
 class SortMergeReader {
  public:
     virtual ~SortMergeReader() = default;
+
+    /// Create a `SortMergeReader` of `sort_engine`. At most two readers are merged with the
+    /// two-way merge regardless of `sort_engine`, which needs no heap or loser tree.
+    static Result<std::unique_ptr<SortMergeReader>> Create(
+        SortEngine sort_engine, std::vector<std::unique_ptr<KeyValueRecordReader>>&& readers,
+        const std::shared_ptr<FieldsComparator>& user_key_comparator,
+        const std::shared_ptr<FieldsComparator>& user_defined_seq_comparator,
+        const std::shared_ptr<MergeFunctionWrapper<KeyValue>>& merge_function_wrapper);
+
     class Iterator {
      public:
         virtual ~Iterator() = default;
@@ -36,6 +36,8 @@
 #include "paimon/core/mergetree/compact/reducer_merge_function_wrapper.h"
 #include "paimon/core/mergetree/compact/sort_merge_reader_with_loser_tree.h"
 #include "paimon/core/mergetree/compact/sort_merge_reader_with_min_heap.h"
+#include "paimon/core/mergetree/compact/sort_merge_reader_with_two_way.h"
+#include "paimon/core/options/sort_engine.h"
 #include "paimon/core/utils/fields_comparator.h"
 #include "paimon/memory/memory_pool.h"
 #include "paimon/result.h"
@@ -74,6 +76,33 @@ class SortMergeReaderTest : public testing::Test {
         CheckSortMergeResult<SortMergeReaderWithMinHeap>(src_array_vec, user_key_comparator,
                                                          user_defined_seq_comparator, key_arity,
                                                          value_schema, expected);
+        if (src_array_vec.size() <= SortMergeReaderWithTwoWay::kMaxReaders) {
+            CheckSortMergeResult<SortMergeReaderWithTwoWay>(src_array_vec, user_key_comparator,
+                                                            user_defined_seq_comparator,
+                                                            key_arity, value_schema, expected);
+        }
+    }
+
+    template <typename SortMergeReaderType>
+    void CheckCreateSortMergeReader(SortEngine sort_engine, size_t reader_count) const {
+        std::vector<std::unique_ptr<KeyValueRecordReader>> readers;
+        for (size_t i = 0; i < reader_count; ++i) {
+            readers.push_back(std::make_unique<ConcatKeyValueRecordReader>(
+                std::vector<std::unique_ptr<KeyValueRecordReader>>()));
+        }
+        auto mfunc = std::make_unique<DeduplicateMergeFunction>(/*ignore_delete=*/false);
+        auto merge_function_wrapper =
+            std::make_shared<ReducerMergeFunctionWrapper>(std::move(mfunc));
+        ASSERT_OK_AND_ASSIGN(
+            std::shared_ptr<FieldsComparator> user_key_comparator,
+            FieldsComparator::Create({DataField(/*id=*/0, arrow::field("k0", arrow::int32()))},
+                                     /*is_ascending_order=*/true, /*use_view=*/true));
+        ASSERT_OK_AND_ASSIGN(
+            std::unique_ptr<SortMergeReader> sort_merge_reader,
+            SortMergeReader::Create(sort_engine, std::move(readers), user_key_comparator,
+                                    /*user_defined_seq_comparator=*/nullptr,
+                                    merge_function_wrapper));
+        ASSERT_TRUE(dynamic_cast<SortMergeReaderType*>(sort_merge_reader.get()));
     }
 
  private:
@@ -570,4 +599,41 @@ TEST_F(SortMergeReaderTest, TestSortMergeIn3WaysWithUserDefinedSeq) {
                 /*key_arity=*/2, value_schema, expected);
 }
 
+TEST_F(SortMergeReaderTest, TestSortMergeWithSingleReader) {
+    arrow::FieldVector fields = {arrow::field("_SEQUENCE_NUMBER", arrow::int64()),
+                                 arrow::field("_VALUE_KIND", arrow::int8()),
+                                 arrow::field("k0", arrow::int32()),
+                                 arrow::field("v0", arrow::int32())};
+
+    auto data_fields = CreateDataField(fields);
+    std::shared_ptr<arrow::Schema> value_schema =
+        arrow::schema(arrow::FieldVector({fields[2], fields[3]}));
+    std::shared_ptr<arrow::DataType> src_type = arrow::struct_({fields});
+
+    auto src_array = std::dynamic_pointer_cast<arrow::StructArray>(
+        arrow::ipc::internal::json::ArrayFromJSON(src_type, R"([
+        [0, 0, 1, 10],
+        [1, 0, 2, 11],
+        [2, 0, 4, 12]
+    ])")
+            .ValueOrDie());
+
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<FieldsComparator> user_key_comparator,
+                         FieldsComparator::Create({data_fields[2]}, std::vector<int32_t>({0}),
+                                                  /*is_ascending_order=*/true, /*use_view=*/true));
+    std::vector<KeyValue> expected = KeyValueChecker::GenerateKeyValues(
+        {0, 1, 2}, {{1}, {2}, {4}}, {{1, 10}, {2, 11}, {4, 12}}, pool_);
+    CheckResult({src_array}, user_key_comparator, /*user_defined_seq_comparator=*/nullptr,
+                /*key_arity=*/1, value_schema, expected);
+}
+
+TEST_F(SortMergeReaderTest, TestCreateSortMergeReader) {
+    CheckCreateSortMergeReader<SortMergeReaderWithTwoWay>(SortEngine::MIN_HEAP, 1);
+    CheckCreateSortMergeReader<SortMergeReaderWithTwoWay>(SortEngine::MIN_HEAP, 2);
+    CheckCreateSortMergeReader<SortMergeReaderWithMinHeap>(SortEngine::MIN_HEAP, 3);
+    CheckCreateSortMergeReader<SortMergeReaderWithTwoWay>(SortEngine::LOSER_TREE, 1);
+    CheckCreateSortMergeReader<SortMergeReaderWithTwoWay>(SortEngine::LOSER_TREE, 2);
+    CheckCreateSortMergeReader<SortMergeReaderWithLoserTree>(SortEngine::LOSER_TREE, 3);
+}
+
 }  // namespace paimon::test
@@ -0,0 +1,144 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/mergetree/compact/sort_merge_reader_with_two_way.h"
+
+#include <cstdint>
+
+#include "paimon/status.h"
+
+namespace paimon {
+
+SortMergeReaderWithTwoWay::SortMergeReaderWithTwoWay(
+    std::vector<std::unique_ptr<KeyValueRecordReader>>&& readers,
+    const std::shared_ptr<FieldsComparator>& user_key_comparator,
+    const std::shared_ptr<FieldsComparator>& user_defined_seq_comparator,
+    const std::shared_ptr<MergeFunctionWrapper<KeyValue>>& merge_function_wrapper)
+    : readers_holder_(std::move(readers)),
+      user_key_comparator_(user_key_comparator),
+      user_defined_seq_comparator_(user_defined_seq_comparator),
+      merge_function_wrapper_(merge_function_wrapper) {
+    assert(readers_holder_.size() <= kMaxReaders);
+    assert(user_key_comparator_);
+    next_batch_slots_.reserve(kMaxReaders);
+    for (size_t i = 0; i < readers_holder_.size(); ++i) {
+        next_batch_slots_.push_back(i);
+    }
+}
+
+Result<std::unique_ptr<SortMergeReader::Iterator>> SortMergeReaderWithTwoWay::NextBatch() {
+    for (size_t slot : next_batch_slots_) {
+        KeyValueRecordReader* reader = readers_holder_[slot].get();
+        while (true) {
+            PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<KeyValueRecordReader::Iterator> iterator,
+                                   reader->NextBatch());
+            if (!iterator) {
+                // no more batches, permanently leave this slot empty
+                reader->Close();
+                break;
+            }
+            if (iterator->HasNext()) {
+                PAIMON_ASSIGN_OR_RAISE(KeyValue kv, iterator->Next());
+                elements_[slot].emplace(std::move(kv), std::move(iterator));
+                break;
+            }
+        }
+    }
+    next_batch_slots_.clear();
+    if (!elements_[0] && !elements_[1]) {
+        return std::unique_ptr<SortMergeReader::Iterator>();
+    }
+    return std::make_unique<SortMergeReaderWithTwoWay::Iterator>(this);
+}
+
+bool SortMergeReaderWithTwoWay::AddBefore(const KeyValue& lhs, const KeyValue& rhs) const {
+    if (user_defined_seq_comparator_ != nullptr) {
+        int32_t seq_result = user_defined_seq_comparator_->CompareTo(*(lhs.value), *(rhs.value));
+        if (seq_result != 0) {
+            return seq_result < 0;
+        }
+    }
+    return lhs.sequence_number < rhs.sequence_number;
+}
+
+Status SortMergeReaderWithTwoWay::Poll(size_t slot) {
+    PAIMON_RETURN_NOT_OK(merge_function_wrapper_->Add(std::move(elements_[slot]->kv)));
+    polled_[slot] = true;
+    return Status::OK();
+}
+
+Result<bool> SortMergeReaderWithTwoWay::Iterator::HasNext() {
+    while (true) {
+        PAIMON_ASSIGN_OR_RAISE(bool has_more, NextImpl());
+        if (!has_more) {
+            return false;
+        }
+        PAIMON_ASSIGN_OR_RAISE(std::optional<KeyValue> result,
+                               reader_->merge_function_wrapper_->GetResult());
+        if (result) {
+            result_ = std::move(result);
+            return true;
+        }
+    }
+}
+
+Result<bool> SortMergeReaderWithTwoWay::Iterator::NextImpl() {
+    assert(reader_->next_batch_slots_.empty());
+    auto& elements = reader_->elements_;
+    // advance the elements polled by the previous key
+    for (size_t slot = 0; slot < kMaxReaders; ++slot) {
+        if (!reader_->polled_[slot]) {
+            continue;
+        }
+        reader_->polled_[slot] = false;
+        PAIMON_ASSIGN_OR_RAISE(bool updated, elements[slot]->Update());
+        if (!updated) {
+            // reach end of batch, clean up
+            elements[slot].reset();
+            reader_->next_batch_slots_.push_back(slot);
+        }
+    }
+    if (!reader_->next_batch_slots_.empty()) {
+        return false;
+    }
+    if (!elements[0] && !elements[1]) {
+        return Status::Invalid("Both slots of two-way merge are empty. This is a bug.");
+    }
+
+    reader_->merge_function_wrapper_->Reset();
+    if (!elements[0] || !elements[1]) {
+        // only one reader left, no comparison is needed
+        PAIMON_RETURN_NOT_OK(reader_->Poll(elements[0] ? 0 : 1));
+        return true;
+    }
+    const KeyValue& kv0 = elements[0]->kv;
+    const KeyValue& kv1 = elements[1]->kv;
+    int32_t result = reader_->user_key_comparator_->CompareTo(*(kv0.key), *(kv1.key));
+    if (result < 0) {
+        PAIMON_RETURN_NOT_OK(reader_->Poll(0));
+    } else if (result > 0) {
+        PAIMON_RETURN_NOT_OK(reader_->Poll(1));
+    } else {
+        // note that the same iterator should not produce the same keys, so each slot is polled
+        // at most once for a key
+        size_t first = reader_->AddBefore(kv0, kv1) ? 0 : 1;
+        PAIMON_RETURN_NOT_OK(reader_->Poll(first));
+        PAIMON_RETURN_NOT_OK(reader_->Poll(1 - first));
+    }
+    return true;
+}
+
+}  // namespace paimon
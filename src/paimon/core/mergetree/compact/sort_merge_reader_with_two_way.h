@@ -0,0 +1,117 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "paimon/common/metrics/metrics_impl.h"
+#include "paimon/core/io/key_value_record_reader.h"
+#include "paimon/core/key_value.h"
+#include "paimon/core/mergetree/compact/merge_function_wrapper.h"
+#include "paimon/core/mergetree/compact/sort_merge_reader.h"
+#include "paimon/core/utils/fields_comparator.h"
+#include "paimon/result.h"
+
+namespace paimon {
+class Metrics;
+
+/// `SortMergeReader` specialized for at most two readers. Instead of maintaining a heap or a
+/// loser tree, the current KeyValue of each reader is kept in a fixed slot, so producing the
+/// next key costs a single key comparison. It follows the same batch protocol and ordering
+/// (key, then user defined sequence, then sequence number) as `SortMergeReaderWithMinHeap`.
+class SortMergeReaderWithTwoWay : public SortMergeReader {
+ public:
+    static constexpr size_t kMaxReaders = 2;
+
+    SortMergeReaderWithTwoWay(
+        std::vector<std::unique_ptr<KeyValueRecordReader>>&& readers,
+        const std::shared_ptr<FieldsComparator>& user_key_comparator,
+        const std::shared_ptr<FieldsComparator>& user_defined_seq_comparator,
+        const std::shared_ptr<MergeFunctionWrapper<KeyValue>>& merge_function_wrapper);
+
+    class Iterator : public SortMergeReader::Iterator {
+     public:
+        explicit Iterator(SortMergeReaderWithTwoWay* reader) : reader_(reader) {}
+        Result<bool> HasNext() override;
+        KeyValue&& Next() override {
+            return std::move(result_).value();
+        }
+
+     private:
+        Result<bool> NextImpl();
+
+     private:
+        SortMergeReaderWithTwoWay* reader_;
+        std::optional<KeyValue> result_;
+    };
+
+    Result<std::unique_ptr<SortMergeReader::Iterator>> NextBatch() override;
+
+    void Close() override {
+        for (const auto& reader : readers_holder_) {
+            reader->Close();
+        }
+    }
+
+    std::shared_ptr<Metrics> GetReaderMetrics() const override {
+        return MetricsImpl::CollectReadMetrics(readers_holder_);
+    }
+
+ private:
+    struct Element {
+        Element(KeyValue&& _kv, std::unique_ptr<KeyValueRecordReader::Iterator>&& _iterator)
+            : kv(std::move(_kv)), iterator(std::move(_iterator)) {
+            assert(iterator);
+        }
+
+        Result<bool> Update() {
+            if (!iterator->HasNext()) {
+                return false;
+            }
+            PAIMON_ASSIGN_OR_RAISE(KeyValue tmp_kv, iterator->Next());
+            kv = std::move(tmp_kv);
+            return true;
+        }
+
+        KeyValue kv;
+        std::unique_ptr<KeyValueRecordReader::Iterator> iterator;
+    };
+
+    /// Returns true if `lhs` must be added to the merge function before `rhs`, where both have
+    /// the same key.
+    bool AddBefore(const KeyValue& lhs, const KeyValue& rhs) const;
+
+    Status Poll(size_t slot);
+
+ private:
+    // must hold all readers, as data array is allocated by the pool of data file reader
+    std::vector<std::unique_ptr<KeyValueRecordReader>> readers_holder_;
+    // slots of the readers whose current batch is consumed
+    std::vector<size_t> next_batch_slots_;
+    std::shared_ptr<FieldsComparator> user_key_comparator_;
+    std::shared_ptr<FieldsComparator> user_defined_seq_comparator_;
+    std::shared_ptr<MergeFunctionWrapper<KeyValue>> merge_function_wrapper_;
+    std::array<std::optional<Element>, kMaxReaders> elements_;
+    std::array<bool, kMaxReaders> polled_ = {false, false};
+};
+}  // namespace paimon
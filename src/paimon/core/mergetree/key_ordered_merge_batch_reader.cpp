@@ -0,0 +1,264 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/mergetree/key_ordered_merge_batch_reader.h"
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+
+#include "arrow/array/array_nested.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/c/abi.h"
+#include "arrow/c/bridge.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec.h"
+#include "fmt/format.h"
+#include "paimon/common/metrics/metrics_impl.h"
+#include "paimon/common/types/data_field.h"
+#include "paimon/common/utils/arrow/mem_utils.h"
+#include "paimon/common/utils/arrow/status_utils.h"
+#include "paimon/status.h"
+
+namespace paimon {
+class MemoryPool;
+
+KeyOrderedMergeBatchReader::KeyOrderedMergeBatchReader(
+    std::vector<std::unique_ptr<BatchReader>>&& readers, std::vector<std::string>&& key_names,
+    std::unique_ptr<FieldsComparator>&& key_comparator, int32_t batch_size,
+    const std::shared_ptr<MemoryPool>& pool)
+    : pool_(pool),
+      arrow_pool_(GetArrowPool(pool)),
+      readers_(std::move(readers)),
+      key_names_(std::move(key_names)),
+      key_comparator_(std::move(key_comparator)),
+      batch_size_(batch_size),
+      inputs_(readers_.size()) {
+    heap_.reserve(readers_.size());
+}
+
+Result<std::unique_ptr<KeyOrderedMergeBatchReader>> KeyOrderedMergeBatchReader::Create(
+    std::vector<std::unique_ptr<BatchReader>>&& readers, const std::vector<DataField>& key_fields,
+    int32_t batch_size, const std::shared_ptr<MemoryPool>& pool) {
+    if (key_fields.empty()) {
+        return Status::Invalid("key ordered merge requires at least one key field");
+    }
+    if (batch_size <= 0) {
+        return Status::Invalid(
+            fmt::format("key ordered merge requires a positive batch size, but is {}", batch_size));
+    }
+    std::vector<std::string> key_names;
+    key_names.reserve(key_fields.size());
+    for (const auto& field : key_fields) {
+        key_names.push_back(field.Name());
+    }
+    // the key row of each input only contains the key columns, in the order of key_fields
+    PAIMON_ASSIGN_OR_RAISE(
+        std::unique_ptr<FieldsComparator> key_comparator,
+        FieldsComparator::Create(key_fields, /*is_ascending_order=*/true, /*use_view=*/true));
+    return std::unique_ptr<KeyOrderedMergeBatchReader>(new KeyOrderedMergeBatchReader(
+        std::move(readers), std::move(key_names), std::move(key_comparator), batch_size, pool));
+}
+
+Result<bool> KeyOrderedMergeBatchReader::LoadNextBatch(size_t index) {
+    Input& input = inputs_[index];
+    while (true) {
+        PAIMON_ASSIGN_OR_RAISE(BatchReader::ReadBatch batch, readers_[index]->NextBatch());
+        if (BatchReader::IsEofBatch(batch)) {
+            input.key.reset();
+            input.batch.reset();
+            input.exhausted = true;
+            readers_[index]->Close();
+            return false;
+        }
+        auto& [c_array, c_schema] = batch;
+        PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(std::shared_ptr<arrow::Array> array,
+                                          arrow::ImportArray(c_array.get(), c_schema.get()));
+        if (array->length() == 0) {
+            continue;
+        }
+        auto struct_array = std::dynamic_pointer_cast<arrow::StructArray>(array);
+        if (!struct_array) {
+            return Status::Invalid(
+                fmt::format("key ordered merge expects struct arrays, but got {}",
+                            array->type()->ToString()));
+        }
+        arrow::ArrayVector key_columns;
+        key_columns.reserve(key_names_.size());
+        for (const auto& key_name : key_names_) {
+            std::shared_ptr<arrow::Array> key_column = struct_array->GetFieldByName(key_name);
+            if (!key_column) {
+                return Status::Invalid(fmt::format("key field {} not found in read batch {}",
+                                                   key_name, array->type()->ToString()));
+            }
+            key_columns.push_back(std::move(key_column));
+        }
+        // the key row only references the columns, which are held by input.batch
+        input.key.emplace(key_columns, pool_, /*row_id=*/0);
+        input.batch = std::move(array);
+        input.cursor = 0;
+        return true;
+    }
+}
+
+bool KeyOrderedMergeBatchReader::Greater(size_t lhs, size_t rhs) const {
+    int32_t result = key_comparator_->CompareTo(*inputs_[lhs].key, *inputs_[rhs].key);
+    if (result != 0) {
+        return result > 0;
+    }
+    // rows with equal keys keep the order of the inputs
+    return lhs > rhs;
+}
+
+void KeyOrderedMergeBatchReader::PushHeap(size_t index) {
+    heap_.push_back(index);
+    std::push_heap(heap_.begin(), heap_.end(),
+                   [this](size_t lhs, size_t rhs) { return Greater(lhs, rhs); });
+}
+
+size_t KeyOrderedMergeBatchReader::PopHeap() {
+    std::pop_heap(heap_.begin(), heap_.end(),
+                  [this](size_t lhs, size_t rhs) { return Greater(lhs, rhs); });
+    size_t index = heap_.back();
+    heap_.pop_back();
+    return index;
+}
+
+Result<BatchReader::ReadBatch> KeyOrderedMergeBatchReader::NextBatch() {
+    if (!initialized_) {
+        for (size_t i = 0; i < inputs_.size(); i++) {
+            PAIMON_ASSIGN_OR_RAISE(bool has_rows, LoadNextBatch(i));
+            if (has_rows) {
+                PushHeap(i);
+            }
+        }
+        initialized_ = true;
+    }
+    // the rows of an input batch are taken in order, so the rows taken from each batch are a
+    // contiguous range of it; runs record which range of which batch goes into the output in turn
+    struct Source {
+        std::shared_ptr<arrow::Array> batch;
+        int64_t begin;
+        int64_t end;
+    };
+    struct Run {
+        size_t source;
+        int64_t start;
+        int64_t length;
+    };
+    std::vector<Source> sources;
+    std::vector<Run> runs;
+    // source of the current batch of each input, if any rows of it are in the output
+    std::vector<std::optional<size_t>> input_sources(inputs_.size());
+    int64_t row_count = 0;
+    while (!heap_.empty() && row_count < batch_size_) {
+        size_t index = PopHeap();
+        Input& input = inputs_[index];
+        int64_t start = input.cursor;
+        int64_t limit = std::min(input.batch->length(), start + (batch_size_ - row_count));
+        // take the smallest row, and the following rows of the same input as long as they do
+        // not go after the smallest row of the other inputs
+        do {
+            input.key->SetRowId(++input.cursor);
+        } while (input.cursor < limit && (heap_.empty() || !Greater(index, heap_.front())));
+        if (!input_sources[index]) {
+            input_sources[index] = sources.size();
+            sources.push_back({input.batch, start, start});
+        }
+        size_t source = input_sources[index].value();
+        sources[source].end = input.cursor;
+        runs.push_back({source, start, input.cursor - start});
+        row_count += input.cursor - start;
+        if (input.cursor < input.batch->length()) {
+            PushHeap(index);
+            continue;
+        }
+        input_sources[index].reset();
+        PAIMON_ASSIGN_OR_RAISE(bool has_rows, LoadNextBatch(index));
+        if (has_rows) {
+            PushHeap(index);
+        }
+    }
+    if (runs.empty()) {
+        return BatchReader::MakeEofBatch();
+    }
+    std::shared_ptr<arrow::Array> result;
+    if (runs.size() == 1) {
+        result = sources[0].batch->Slice(runs[0].start, runs[0].length);
+    } else {
+        // copy the used rows of each source batch once, then gather the output rows from them
+        arrow::ArrayVector source_slices;
+        std::vector<int64_t> source_offsets;
+        source_slices.reserve(sources.size());
+        source_offsets.reserve(sources.size());
+        int64_t offset = 0;
+        for (const auto& source : sources) {
+            source_slices.push_back(source.batch->Slice(source.begin, source.end - source.begin));
+            source_offsets.push_back(offset);
+            offset += source.end - source.begin;
+        }
+        std::shared_ptr<arrow::Array> rows = source_slices[0];
+        if (source_slices.size() > 1) {
+            PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(rows,
+                                              arrow::Concatenate(source_slices, arrow_pool_.get()));
+        }
+        arrow::Int64Builder indices_builder(arrow_pool_.get());
+        PAIMON_RETURN_NOT_OK_FROM_ARROW(indices_builder.Reserve(row_count));
+        bool in_order = true;
+        int64_t next_index = 0;
+        for (const auto& run : runs) {
+            int64_t first = source_offsets[run.source] + run.start - sources[run.source].begin;
+            in_order = in_order && first == next_index;
+            next_index = first + run.length;
+            for (int64_t i = first; i < next_index; i++) {
+                indices_builder.UnsafeAppend(i);
+            }
+        }
+        if (in_order) {
+            // e.g. the rows of an input batch all go before the rows of the next one
+            result = rows;
+        } else {
+            std::shared_ptr<arrow::Array> indices;
+            PAIMON_RETURN_NOT_OK_FROM_ARROW(indices_builder.Finish(&indices));
+            arrow::compute::ExecContext exec_context(arrow_pool_.get());
+            PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(
+                result, arrow::compute::Take(*rows, *indices,
+                                             arrow::compute::TakeOptions::Defaults(),
+                                             &exec_context));
+        }
+    }
+    assert(result->length() == row_count);
+    auto c_array = std::make_unique<ArrowArray>();
+    auto c_schema = std::make_unique<ArrowSchema>();
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(arrow::ExportArray(*result, c_array.get(), c_schema.get()));
+    return std::make_pair(std::move(c_array), std::move(c_schema));
+}
+
+void KeyOrderedMergeBatchReader::Close() {
+    for (size_t i = 0; i < readers_.size(); i++) {
+        if (!inputs_[i].exhausted) {
+            readers_[i]->Close();
+            inputs_[i].exhausted = true;
+        }
+    }
+    heap_.clear();
+}
+
+std::shared_ptr<Metrics> KeyOrderedMergeBatchReader::GetReaderMetrics() const {
+    return MetricsImpl::CollectReadMetrics(readers_);
+}
+
+}  // namespace paimon
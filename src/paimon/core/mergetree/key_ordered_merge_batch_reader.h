@@ -0,0 +1,94 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "arrow/api.h"
+#include "paimon/common/data/columnar/columnar_row.h"
+#include "paimon/core/utils/fields_comparator.h"
+#include "paimon/metrics.h"
+#include "paimon/reader/batch_reader.h"
+#include "paimon/result.h"
+
+namespace paimon {
+class DataField;
+class MemoryPool;
+
+/// Merges several `BatchReader`s, each of which returns rows in ascending key order, into one
+/// reader which returns all rows in ascending key order.
+///
+/// Keys are compared with `FieldsComparator` directly on the columns of the read batches, and rows
+/// with equal keys are returned in the order of the input readers. An output batch of a single
+/// input batch is a slice of it; otherwise the rows taken from each input batch are copied once
+/// and the output rows are gathered from them with a single `arrow::compute::Take`. The reader
+/// holds at most one batch of each input plus the rows of the output batch being assembled.
+class KeyOrderedMergeBatchReader : public BatchReader {
+ public:
+    /// @param readers Inputs, each returning rows in ascending key order.
+    /// @param key_fields Key fields, looked up by name in the batches of the inputs.
+    /// @param batch_size Maximum number of rows of an output batch.
+    static Result<std::unique_ptr<KeyOrderedMergeBatchReader>> Create(
+        std::vector<std::unique_ptr<BatchReader>>&& readers,
+        const std::vector<DataField>& key_fields, int32_t batch_size,
+        const std::shared_ptr<MemoryPool>& pool);
+
+    Result<ReadBatch> NextBatch() override;
+    void Close() override;
+    std::shared_ptr<Metrics> GetReaderMetrics() const override;
+
+ private:
+    struct Input {
+        std::shared_ptr<arrow::Array> batch;
+        // view on the key columns of the current row of `batch`
+        std::optional<ColumnarRow> key;
+        int64_t cursor = 0;
+        bool exhausted = false;
+    };
+
+    KeyOrderedMergeBatchReader(std::vector<std::unique_ptr<BatchReader>>&& readers,
+                               std::vector<std::string>&& key_names,
+                               std::unique_ptr<FieldsComparator>&& key_comparator,
+                               int32_t batch_size, const std::shared_ptr<MemoryPool>& pool);
+
+    /// Loads the next non-empty batch of input `index`, returns false if the input is exhausted.
+    Result<bool> LoadNextBatch(size_t index);
+
+    /// Whether the current row of input `lhs` goes after the current row of input `rhs`.
+    bool Greater(size_t lhs, size_t rhs) const;
+
+    void PushHeap(size_t index);
+    size_t PopHeap();
+
+ private:
+    std::shared_ptr<MemoryPool> pool_;
+    std::unique_ptr<arrow::MemoryPool> arrow_pool_;
+    std::vector<std::unique_ptr<BatchReader>> readers_;
+    std::vector<std::string> key_names_;
+    std::unique_ptr<FieldsComparator> key_comparator_;
+    int32_t batch_size_;
+    std::vector<Input> inputs_;
+    // min-heap of the indexes of inputs which still have rows
+    std::vector<size_t> heap_;
+    bool initialized_ = false;
+};
+}  // namespace paimon
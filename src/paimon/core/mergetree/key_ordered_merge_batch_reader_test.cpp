@@ -0,0 +1,131 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/mergetree/key_ordered_merge_batch_reader.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/api.h"
+#include "arrow/array/array_base.h"
+#include "arrow/ipc/json_simple.h"
+#include "gtest/gtest.h"
+#include "paimon/common/types/data_field.h"
+#include "paimon/memory/memory_pool.h"
+#include "paimon/status.h"
+#include "paimon/testing/mock/mock_file_batch_reader.h"
+#include "paimon/testing/utils/read_result_collector.h"
+#include "paimon/testing/utils/testharness.h"
+
+namespace paimon::test {
+class KeyOrderedMergeBatchReaderTest : public ::testing::Test {
+ public:
+    void SetUp() override {
+        pool_ = GetDefaultPool();
+        type_ = arrow::struct_({arrow::field("v", arrow::int32()),
+                                arrow::field("k1", arrow::utf8()),
+                                arrow::field("k2", arrow::int32())});
+        key_fields_ = {DataField(1, arrow::field("k1", arrow::utf8())),
+                       DataField(2, arrow::field("k2", arrow::int32()))};
+    }
+
+    std::vector<std::unique_ptr<BatchReader>> CreateReaders(const std::vector<std::string>& inputs,
+                                                            int32_t input_batch_size) const {
+        std::vector<std::unique_ptr<BatchReader>> readers;
+        for (const auto& input : inputs) {
+            auto data = arrow::ipc::internal::json::ArrayFromJSON(type_, input).ValueOrDie();
+            readers.push_back(std::make_unique<MockFileBatchReader>(data, type_, input_batch_size));
+        }
+        return readers;
+    }
+
+    void CheckResult(const std::vector<std::string>& inputs, const std::string& expected) const {
+        auto expected_array =
+            arrow::ipc::internal::json::ArrayFromJSON(type_, expected).ValueOrDie();
+        for (int32_t input_batch_size : {1, 2, 3, 10}) {
+            for (int32_t batch_size : {1, 2, 5, 1024}) {
+                ASSERT_OK_AND_ASSIGN(
+                    auto reader,
+                    KeyOrderedMergeBatchReader::Create(CreateReaders(inputs, input_batch_size),
+                                                       key_fields_, batch_size, pool_));
+                ASSERT_OK_AND_ASSIGN(auto result, ReadResultCollector::CollectResult(reader.get()));
+                reader->Close();
+                if (expected_array->length() == 0) {
+                    ASSERT_FALSE(result);
+                    continue;
+                }
+                ASSERT_TRUE(result);
+                for (const auto& chunk : result->chunks()) {
+                    ASSERT_LE(chunk->length(), batch_size);
+                }
+                auto expected_chunk_array = std::make_shared<arrow::ChunkedArray>(expected_array);
+                ASSERT_TRUE(expected_chunk_array->Equals(result)) << result->ToString();
+            }
+        }
+    }
+
+ protected:
+    std::shared_ptr<MemoryPool> pool_;
+    std::shared_ptr<arrow::DataType> type_;
+    std::vector<DataField> key_fields_;
+};
+
+TEST_F(KeyOrderedMergeBatchReaderTest, TestMerge) {
+    CheckResult({R"([[1, "a", 1], [2, "c", 0], [3, "d", 5]])",
+                 R"([[4, "a", 2], [5, "b", 0], [6, "e", 1]])", R"([[7, "c", 1]])"},
+                R"([[1, "a", 1], [4, "a", 2], [5, "b", 0], [2, "c", 0], [7, "c", 1],
+                    [3, "d", 5], [6, "e", 1]])");
+}
+
+TEST_F(KeyOrderedMergeBatchReaderTest, TestNonOverlappingInputs) {
+    CheckResult({R"([[3, "c", 0], [4, "d", 0]])", R"([[1, "a", 0], [2, "b", 0]])"},
+                R"([[1, "a", 0], [2, "b", 0], [3, "c", 0], [4, "d", 0]])");
+}
+
+TEST_F(KeyOrderedMergeBatchReaderTest, TestEqualKeysKeepInputOrder) {
+    CheckResult({R"([[1, "a", 1], [2, "b", 1]])", R"([[3, "a", 1], [4, "b", 1]])",
+                 R"([[5, "a", 1]])"},
+                R"([[1, "a", 1], [3, "a", 1], [5, "a", 1], [2, "b", 1], [4, "b", 1]])");
+}
+
+TEST_F(KeyOrderedMergeBatchReaderTest, TestNullKeysFirst) {
+    CheckResult({R"([[1, null, 1], [2, "a", 1]])", R"([[3, "a", null], [4, "b", 1]])"},
+                R"([[1, null, 1], [3, "a", null], [2, "a", 1], [4, "b", 1]])");
+}
+
+TEST_F(KeyOrderedMergeBatchReaderTest, TestEmptyInputs) {
+    CheckResult({R"([])", R"([[1, "a", 1]])", R"([])"}, R"([[1, "a", 1]])");
+    CheckResult({R"([])", R"([])"}, R"([])");
+    CheckResult({}, R"([])");
+}
+
+TEST_F(KeyOrderedMergeBatchReaderTest, TestInvalid) {
+    ASSERT_NOK_WITH_MSG(KeyOrderedMergeBatchReader::Create(CreateReaders({R"([])"}, 1), {}, 10,
+                                                           GetDefaultPool()),
+                        "at least one key field");
+    ASSERT_NOK_WITH_MSG(KeyOrderedMergeBatchReader::Create(CreateReaders({R"([])"}, 1), key_fields_,
+                                                           0, GetDefaultPool()),
+                        "positive batch size");
+    ASSERT_OK_AND_ASSIGN(
+        auto reader, KeyOrderedMergeBatchReader::Create(
+                         CreateReaders({R"([[1, "a", 1]])"}, 1),
+                         {DataField(3, arrow::field("k3", arrow::int32()))}, 10, GetDefaultPool()));
+    ASSERT_NOK_WITH_MSG(reader->NextBatch(), "key field k3 not found in read batch");
+}
+
+}  // namespace paimon::test
@@ -19,7 +19,10 @@
 #include <algorithm>
 #include <cassert>
 #include <cstddef>
+#include <map>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "arrow/api.h"
 #include "arrow/array/array_base.h"
@@ -30,15 +33,18 @@
 #include "arrow/c/helpers.h"
 #include "arrow/util/checked_cast.h"
 #include "fmt/format.h"
+#include "paimon/common/data/columnar/columnar_row.h"
 #include "paimon/common/metrics/metrics_impl.h"
 #include "paimon/common/table/special_fields.h"
 #include "paimon/common/types/data_field.h"
+#include "paimon/common/utils/arrow/mem_utils.h"
 #include "paimon/common/utils/arrow/status_utils.h"
-#include "paimon/common/utils/scope_guard.h"
 #include "paimon/core/io/async_key_value_producer_and_consumer.h"
 #include "paimon/core/io/compact_increment.h"
+#include "paimon/core/io/data_file_index_writer.h"
 #include "paimon/core/io/data_file_path_factory.h"
 #include "paimon/core/io/data_increment.h"
+#include "paimon/core/io/format_writer_context.h"
 #include "paimon/core/io/key_value_data_file_writer.h"
 #include "paimon/core/io/key_value_in_memory_record_reader.h"
 #include "paimon/core/io/key_value_meta_projection_consumer.h"
@@ -46,7 +52,10 @@
 #include "paimon/core/io/row_to_arrow_array_converter.h"
 #include "paimon/core/io/single_file_writer.h"
 #include "paimon/core/manifest/file_source.h"
-#include "paimon/core/mergetree/compact/sort_merge_reader_with_loser_tree.h"
+#include "paimon/core/mergetree/compact/sort_merge_reader.h"
+#include "paimon/core/options/changelog_producer.h"
+#include "paimon/core/stats/column_sketch_collector.h"
+#include "paimon/core/stats/value_stats_converter.h"
 #include "paimon/core/utils/commit_increment.h"
 #include "paimon/data/decimal.h"
 #include "paimon/format/file_format.h"
@@ -58,7 +67,6 @@ class FieldsComparator;
 class MemoryPool;
 template <typename T>
 class MergeFunctionWrapper;
-class FormatStatsExtractor;
 
 MergeTreeWriter::MergeTreeWriter(
     int64_t last_sequence_number, const std::vector<std::string>& trimmed_primary_keys,
@@ -71,6 +79,7 @@ MergeTreeWriter::MergeTreeWriter(
     : last_sequence_number_(last_sequence_number + 1),
       current_memory_in_bytes_(0),
       pool_(pool),
+      arrow_pool_(GetArrowPool(pool)),
       trimmed_primary_keys_(trimmed_primary_keys),
       options_(options),
       path_factory_(path_factory),
@@ -122,6 +131,9 @@ Status MergeTreeWriter::Flush() {
     if (batch_vec_.empty()) {
         return Status::OK();
     }
+    if (options_.GetChangelogProducer() == ChangelogProducer::INPUT) {
+        PAIMON_RETURN_NOT_OK(WriteChangelog());
+    }
     // 1. create key value iter for each record batch
     std::vector<std::unique_ptr<KeyValueRecordReader>> readers;
     readers.reserve(batch_vec_.size());
@@ -137,9 +149,11 @@ Status MergeTreeWriter::Flush() {
     batch_vec_.clear();
     row_kinds_vec_.clear();
     current_memory_in_bytes_ = 0;
-    // 2. prepare loser tree sort merge reader
-    auto sort_merge_reader = std::make_unique<SortMergeReaderWithLoserTree>(
-        std::move(readers), key_comparator_, user_defined_seq_comparator_, merge_function_wrapper_);
+    // 2. prepare sort merge reader
+    PAIMON_ASSIGN_OR_RAISE(
+        std::unique_ptr<SortMergeReader> sort_merge_reader,
+        SortMergeReader::Create(options_.GetSortEngine(), std::move(readers), key_comparator_,
+                                user_defined_seq_comparator_, merge_function_wrapper_));
     // 3. project key value to arrow array
     auto create_consumer = [target_schema = write_schema_, pool = pool_]()
         -> Result<std::unique_ptr<RowToArrowArrayConverter<KeyValue, KeyValueBatch>>> {
@@ -151,7 +165,7 @@ Status MergeTreeWriter::Flush() {
             std::move(sort_merge_reader), create_consumer,
             std::min(options_.GetWriteBatchSize(), MAX_PROJECTION_BATCH_SIZE),
             /*projection_thread_num=*/1, pool_);
-    auto rolling_writer = CreateRollingRowWriter();
+    PAIMON_ASSIGN_OR_RAISE(auto rolling_writer, CreateRollingRowWriter(/*is_changelog=*/false));
     while (true) {
         PAIMON_ASSIGN_OR_RAISE(KeyValueBatch key_value_batch,
                                async_key_value_producer_consumer->NextBatch());
@@ -168,39 +182,140 @@ Status MergeTreeWriter::Flush() {
     return Status::OK();
 }
 
+Status MergeTreeWriter::WriteChangelog() {
+    PAIMON_ASSIGN_OR_RAISE(auto rolling_writer, CreateRollingRowWriter(/*is_changelog=*/true));
+    // records are assigned the same sequence numbers as in Flush()
+    int64_t sequence_number = last_sequence_number_;
+    for (size_t i = 0; i < batch_vec_.size(); ++i) {
+        const std::shared_ptr<arrow::StructArray>& value_struct_array = batch_vec_[i];
+        const std::vector<RecordBatch::RowKind>& row_kinds = row_kinds_vec_[i];
+        int64_t length = value_struct_array->length();
+        if (length == 0) {
+            continue;
+        }
+        if (!row_kinds.empty() && row_kinds.size() != static_cast<size_t>(length)) {
+            return Status::Invalid(
+                fmt::format("length of row_kind {} mismatches length of value array {}",
+                            row_kinds.size(), length));
+        }
+        arrow::Int64Builder sequence_number_builder(arrow_pool_.get());
+        PAIMON_RETURN_NOT_OK_FROM_ARROW(sequence_number_builder.Reserve(length));
+        for (int64_t row = 0; row < length; ++row) {
+            sequence_number_builder.UnsafeAppend(sequence_number + row);
+        }
+        arrow::Int8Builder row_kind_builder(arrow_pool_.get());
+        PAIMON_RETURN_NOT_OK_FROM_ARROW(row_kind_builder.Reserve(length));
+        int64_t delete_row_count = 0;
+        for (int64_t row = 0; row < length; ++row) {
+            RecordBatch::RowKind row_kind =
+                row_kinds.empty() ? RecordBatch::RowKind::INSERT : row_kinds[row];
+            if (row_kind == RecordBatch::RowKind::UPDATE_BEFORE ||
+                row_kind == RecordBatch::RowKind::DELETE) {
+                delete_row_count++;
+            }
+            row_kind_builder.UnsafeAppend(static_cast<int8_t>(row_kind));
+        }
+        std::shared_ptr<arrow::Array> sequence_number_array;
+        PAIMON_RETURN_NOT_OK_FROM_ARROW(sequence_number_builder.Finish(&sequence_number_array));
+        std::shared_ptr<arrow::Array> row_kind_array;
+        PAIMON_RETURN_NOT_OK_FROM_ARROW(row_kind_builder.Finish(&row_kind_array));
+
+        arrow::ArrayVector write_fields = {sequence_number_array, row_kind_array};
+        write_fields.insert(write_fields.end(), value_struct_array->fields().begin(),
+                            value_struct_array->fields().end());
+        PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(
+            std::shared_ptr<arrow::Array> write_array,
+            arrow::StructArray::Make(write_fields, write_schema_->field_names()));
+
+        // same as java, changelog records are not sorted, min and max key simply use the first
+        // and last key
+        arrow::ArrayVector key_array_vec;
+        key_array_vec.reserve(trimmed_primary_keys_.size());
+        for (const auto& pk : trimmed_primary_keys_) {
+            auto key_array = value_struct_array->GetFieldByName(pk);
+            if (key_array == nullptr) {
+                return Status::Invalid(
+                    fmt::format("primary key {} not in input array in MergeTreeWriter", pk));
+            }
+            key_array_vec.push_back(key_array);
+        }
+        KeyValueBatch key_value_batch;
+        key_value_batch.min_sequence_number = sequence_number;
+        key_value_batch.max_sequence_number = sequence_number + length - 1;
+        key_value_batch.delete_row_count = delete_row_count;
+        key_value_batch.min_key =
+            std::make_shared<ColumnarRow>(value_struct_array, key_array_vec, pool_, 0);
+        key_value_batch.max_key =
+            std::make_shared<ColumnarRow>(value_struct_array, key_array_vec, pool_, length - 1);
+        key_value_batch.batch = std::make_unique<ArrowArray>();
+        PAIMON_RETURN_NOT_OK_FROM_ARROW(
+            arrow::ExportArray(*write_array, key_value_batch.batch.get()));
+        PAIMON_RETURN_NOT_OK(rolling_writer->Write(std::move(key_value_batch)));
+        sequence_number += length;
+    }
+    PAIMON_RETURN_NOT_OK(rolling_writer->Close());
+    PAIMON_ASSIGN_OR_RAISE(std::vector<std::shared_ptr<DataFileMeta>> flushed_files,
+                           rolling_writer->GetResult());
+    changelog_files_.insert(changelog_files_.end(), flushed_files.begin(), flushed_files.end());
+    return Status::OK();
+}
+
 Result<CommitIncrement> MergeTreeWriter::DrainIncrement() {
-    DataIncrement data_increment(std::move(new_files_), std::move(deleted_files_), {});
+    DataIncrement data_increment(std::move(new_files_), std::move(deleted_files_),
+                                 std::move(changelog_files_));
     CompactIncrement compact_increment({}, {}, {});
     new_files_.clear();
     deleted_files_.clear();
+    changelog_files_.clear();
     return CommitIncrement(data_increment, compact_increment);
 }
 
-std::unique_ptr<RollingFileWriter<KeyValueBatch, std::shared_ptr<DataFileMeta>>>
-MergeTreeWriter::CreateRollingRowWriter() const {
-    auto create_file_writer = [&]()
-        -> Result<std::unique_ptr<SingleFileWriter<KeyValueBatch, std::shared_ptr<DataFileMeta>>>> {
-        ::ArrowSchema arrow_schema;
-        ScopeGuard guard([&arrow_schema]() { ArrowSchemaRelease(&arrow_schema); });
-        PAIMON_RETURN_NOT_OK_FROM_ARROW(arrow::ExportSchema(*write_schema_, &arrow_schema));
-        auto format = options_.GetWriteFileFormat();
+Result<std::unique_ptr<RollingFileWriter<KeyValueBatch, std::shared_ptr<DataFileMeta>>>>
+MergeTreeWriter::CreateRollingRowWriter(bool is_changelog) {
+    if (format_context_ == nullptr) {
         PAIMON_ASSIGN_OR_RAISE(
-            std::shared_ptr<WriterBuilder> writer_builder,
-            format->CreateWriterBuilder(&arrow_schema, options_.GetWriteBatchSize()));
-        writer_builder->WithMemoryPool(pool_);
-        PAIMON_RETURN_NOT_OK_FROM_ARROW(arrow::ExportSchema(*write_schema_, &arrow_schema));
-        PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<FormatStatsExtractor> stats_extractor,
-                               format->CreateStatsExtractor(&arrow_schema));
+            format_context_,
+            FormatWriterContext::Create(options_.GetWriteFileFormat(), write_schema_,
+                                        options_.GetWriteBatchSize(), pool_));
+    }
+    // file indexes are built on the value fields of data files, changelog files are not filtered
+    std::map<std::string, std::map<std::string, std::map<std::string, std::string>>>
+        index_columns;
+    if (!is_changelog) {
+        index_columns = options_.GetFileIndexColumns();
+    }
+    auto create_file_writer = [this, is_changelog, format_context = format_context_,
+                               index_columns = std::move(index_columns)]()
+        -> Result<std::unique_ptr<SingleFileWriter<KeyValueBatch, std::shared_ptr<DataFileMeta>>>> {
         auto converter = [](KeyValueBatch key_value_batch, ArrowArray* array) -> Status {
             ArrowArrayMove(key_value_batch.batch.get(), array);
             return Status::OK();
         };
+        PAIMON_ASSIGN_OR_RAISE(
+            std::unique_ptr<DataFileIndexWriter> index_writer,
+            DataFileIndexWriter::Create(write_schema_, index_columns,
+                                        options_.GetFileIndexInManifestThreshold(), pool_));
+        // value fields follow the special fields in write schema
+        std::vector<std::string> value_field_names = write_schema_->field_names();
+        value_field_names.erase(
+            value_field_names.begin(),
+            value_field_names.begin() + SpecialFields::KEY_VALUE_SPECIAL_FIELD_COUNT);
+        PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<ValueStatsConverter> value_stats_converter,
+                               ValueStatsConverter::Create(options_, value_field_names));
+        // like file indexes, column sketches are only collected for data files
+        std::unique_ptr<ColumnSketchCollector> sketch_collector;
+        if (!is_changelog && options_.ColumnSketchesEnabled()) {
+            PAIMON_ASSIGN_OR_RAISE(sketch_collector, ColumnSketchCollector::Create(write_schema_));
+        }
         auto writer = std::make_unique<KeyValueDataFileWriter>(
             options_.GetFileCompression(), converter, schema_id_, FileSource::Append(),
-            trimmed_primary_keys_, stats_extractor, write_schema_, path_factory_->IsExternalPath(),
-            pool_);
+            trimmed_primary_keys_, format_context->GetStatsExtractor(), write_schema_,
+            path_factory_->IsExternalPath(), std::move(value_stats_converter),
+            std::move(sketch_collector), std::move(index_writer), pool_);
+        std::string path =
+            is_changelog ? path_factory_->NewChangelogPath() : path_factory_->NewPath();
         PAIMON_RETURN_NOT_OK(
-            writer->Init(options_.GetFileSystem(), path_factory_->NewPath(), writer_builder));
+            writer->Init(options_.GetFileSystem(), path, format_context->GetWriterBuilder()));
         return writer;
     };
     return std::make_unique<RollingFileWriter<KeyValueBatch, std::shared_ptr<DataFileMeta>>>(
@@ -38,6 +38,7 @@
 namespace arrow {
 class Array;
 class DataType;
+class MemoryPool;
 class Schema;
 class StructArray;
 }  // namespace arrow
@@ -45,6 +46,7 @@ class StructArray;
 namespace paimon {
 class DataFilePathFactory;
 class FieldsComparator;
+class FormatWriterContext;
 class MemoryPool;
 class Metrics;
 template <typename T>
@@ -87,10 +89,13 @@ class MergeTreeWriter : public BatchWriter {
     }
 
     Status Flush();
+    // write the buffered input records with their row kinds into changelog files, only for
+    // changelog-producer = input
+    Status WriteChangelog();
     Result<CommitIncrement> DrainIncrement();
 
-    std::unique_ptr<RollingFileWriter<KeyValueBatch, std::shared_ptr<DataFileMeta>>>
-    CreateRollingRowWriter() const;
+    Result<std::unique_ptr<RollingFileWriter<KeyValueBatch, std::shared_ptr<DataFileMeta>>>>
+    CreateRollingRowWriter(bool is_changelog);
     static Result<int64_t> EstimateMemoryUse(const std::shared_ptr<arrow::Array>& array);
 
     // in case write batch size is too large and overflow arrow array
@@ -100,6 +105,7 @@ class MergeTreeWriter : public BatchWriter {
     int64_t last_sequence_number_;
     int64_t current_memory_in_bytes_;
     std::shared_ptr<MemoryPool> pool_;
+    std::unique_ptr<arrow::MemoryPool> arrow_pool_;
     std::vector<std::string> trimmed_primary_keys_;
     CoreOptions options_;
     std::shared_ptr<DataFilePathFactory> path_factory_;
@@ -110,6 +116,8 @@ class MergeTreeWriter : public BatchWriter {
     // write_schema = value_schema + special fields
     std::shared_ptr<arrow::DataType> value_type_;
     std::shared_ptr<arrow::Schema> write_schema_;
+    // created on first flush and shared by all rolling writers
+    std::shared_ptr<FormatWriterContext> format_context_;
 
     std::vector<std::shared_ptr<arrow::StructArray>> batch_vec_;
     std::vector<std::vector<RecordBatch::RowKind>> row_kinds_vec_;
@@ -117,5 +125,6 @@ class MergeTreeWriter : public BatchWriter {
     std::shared_ptr<Metrics> metrics_;
     std::vector<std::shared_ptr<DataFileMeta>> new_files_;
     std::vector<std::shared_ptr<DataFileMeta>> deleted_files_;
+    std::vector<std::shared_ptr<DataFileMeta>> changelog_files_;
 };
 }  // namespace paimon
@@ -349,6 +349,91 @@ TEST_F(MergeTreeWriterTest, TestWriteWithDeleteRow) {
     ASSERT_EQ(expected_data_increment, commit_increment.GetNewFilesIncrement());
 }
 
+TEST_F(MergeTreeWriterTest, TestWriteWithInputChangelog) {
+    ASSERT_OK_AND_ASSIGN(CoreOptions options,
+                         CoreOptions::FromMap({{Options::FILE_FORMAT, "orc"},
+                                               {Options::CHANGELOG_PRODUCER, "input"}}));
+
+    auto dir = UniqueTestDirectory::Create();
+    ASSERT_TRUE(dir);
+    auto path_factory = std::make_shared<DataFilePathFactory>();
+    ASSERT_OK(path_factory->Init(dir->Str(), "orc", options.DataFilePrefix(), nullptr));
+    std::string uuid = path_factory->uuid_;
+
+    auto merge_writer = std::make_shared<MergeTreeWriter>(
+        /*last_sequence_number=*/9, primary_keys_, path_factory, key_comparator_,
+        /*user_defined_seq_comparator=*/nullptr, merge_function_wrapper_, /*schema_id=*/0,
+        value_schema_, options, pool_);
+    std::shared_ptr<arrow::Array> array1 =
+        arrow::ipc::internal::json::ArrayFromJSON(value_type_, R"([
+      ["Lucy", 20, 1, 14.1],
+      ["Paul", 20, 1, null],
+      ["Alice", 10, 0, 13.1],
+      ["Paul", 10, 1, 15.1]
+    ])")
+            .ValueOrDie();
+    WriteBatch(array1,
+               {RecordBatch::RowKind::INSERT, RecordBatch::RowKind::INSERT,
+                RecordBatch::RowKind::DELETE, RecordBatch::RowKind::UPDATE_AFTER},
+               merge_writer.get());
+    ASSERT_OK_AND_ASSIGN(CommitIncrement commit_increment,
+                         merge_writer->PrepareCommit(/*wait_compaction=*/false));
+    ASSERT_OK(merge_writer->Close());
+
+    // changelog file keeps all input records in input order, with their row kinds
+    const DataIncrement& data_increment = commit_increment.GetNewFilesIncrement();
+    ASSERT_EQ(1, data_increment.ChangelogFiles().size());
+    const auto& changelog_file = data_increment.ChangelogFiles()[0];
+    ASSERT_EQ("changelog-" + uuid + "-0.orc", changelog_file->file_name);
+    ASSERT_EQ(4, changelog_file->row_count);
+    ASSERT_EQ(BinaryRowGenerator::GenerateRow({"Lucy"}, pool_.get()), changelog_file->min_key);
+    ASSERT_EQ(BinaryRowGenerator::GenerateRow({"Paul"}, pool_.get()), changelog_file->max_key);
+    ASSERT_EQ(10, changelog_file->min_sequence_number);
+    ASSERT_EQ(13, changelog_file->max_sequence_number);
+    ASSERT_EQ(1, changelog_file->delete_row_count.value());
+    ASSERT_EQ(0, changelog_file->level);
+
+    std::shared_ptr<arrow::ChunkedArray> expected_changelog_array;
+    auto array_status =
+        arrow::ipc::internal::json::ChunkedArrayFromJSON(write_type_, {R"([
+      [10, 0, "Lucy", 20, 1, 14.1],
+      [11, 0, "Paul", 20, 1, null],
+      [12, 3, "Alice", 10, 0, 13.1],
+      [13, 2, "Paul", 10, 1, 15.1]
+    ])"},
+                                                         &expected_changelog_array);
+    ASSERT_TRUE(array_status.ok());
+    CheckFileContent(dir->Str() + "/" + changelog_file->file_name, expected_changelog_array);
+
+    // data file is merged as usual
+    ASSERT_EQ(1, data_increment.NewFiles().size());
+    ASSERT_EQ("data-" + uuid + "-1.orc", data_increment.NewFiles()[0]->file_name);
+    std::shared_ptr<arrow::ChunkedArray> expected_data_array;
+    array_status = arrow::ipc::internal::json::ChunkedArrayFromJSON(write_type_, {R"([
+      [12, 3, "Alice", 10, 0, 13.1],
+      [10, 0, "Lucy", 20, 1, 14.1],
+      [13, 2, "Paul", 10, 1, 15.1]
+    ])"},
+                                                                    &expected_data_array);
+    ASSERT_TRUE(array_status.ok());
+    CheckFileContent(dir->Str() + "/" + data_increment.NewFiles()[0]->file_name,
+                     expected_data_array);
+
+    // no changelog file without changelog producer
+    ASSERT_OK_AND_ASSIGN(CoreOptions none_options,
+                         CoreOptions::FromMap({{Options::FILE_FORMAT, "orc"}}));
+    auto none_writer = std::make_shared<MergeTreeWriter>(
+        /*last_sequence_number=*/9, primary_keys_, path_factory, key_comparator_,
+        /*user_defined_seq_comparator=*/nullptr, merge_function_wrapper_, /*schema_id=*/0,
+        value_schema_, none_options, pool_);
+    WriteBatch(array1, {}, none_writer.get());
+    ASSERT_OK_AND_ASSIGN(CommitIncrement none_increment,
+                         none_writer->PrepareCommit(/*wait_compaction=*/false));
+    ASSERT_OK(none_writer->Close());
+    ASSERT_EQ(1, none_increment.GetNewFilesIncrement().NewFiles().size());
+    ASSERT_TRUE(none_increment.GetNewFilesIncrement().ChangelogFiles().empty());
+}
+
 TEST_F(MergeTreeWriterTest, TestMultiplePrepareCommit) {
     ASSERT_OK_AND_ASSIGN(CoreOptions options,
                          CoreOptions::FromMap({{Options::FILE_FORMAT, "orc"},
@@ -16,28 +16,46 @@
 
 #include "paimon/migrate/file_meta_utils.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cstddef>
 #include <cstdint>
+#include <deque>
+#include <future>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 
 #include "fmt/format.h"
 #include "paimon/common/data/binary_row.h"
+#include "paimon/common/executor/future.h"
 #include "paimon/common/types/data_field.h"
 #include "paimon/common/utils/arrow/status_utils.h"
 #include "paimon/common/utils/binary_row_partition_computer.h"
 #include "paimon/common/utils/path_util.h"
+#include "paimon/common/utils/scope_guard.h"
 #include "paimon/common/utils/string_utils.h"
 #include "paimon/core/core_options.h"
 #include "paimon/core/io/compact_increment.h"
 #include "paimon/core/io/data_file_meta.h"
 #include "paimon/core/io/data_increment.h"
+#include "paimon/core/manifest/file_entry.h"
+#include "paimon/core/manifest/file_kind.h"
 #include "paimon/core/manifest/file_source.h"
+#include "paimon/core/manifest/manifest_entry.h"
+#include "paimon/core/manifest/manifest_file.h"
+#include "paimon/core/manifest/manifest_file_meta.h"
+#include "paimon/core/manifest/manifest_list.h"
 #include "paimon/core/schema/schema_manager.h"
 #include "paimon/core/schema/table_schema.h"
+#include "paimon/core/snapshot.h"
 #include "paimon/core/stats/simple_stats.h"
 #include "paimon/core/stats/simple_stats_converter.h"
 #include "paimon/core/table/sink/commit_message_impl.h"
+#include "paimon/core/utils/field_mapping.h"
 #include "paimon/core/utils/file_store_path_factory.h"
+#include "paimon/core/utils/snapshot_manager.h"
+#include "paimon/executor.h"
 #include "paimon/format/file_format.h"
 #include "paimon/format/format_stats_extractor.h"
 #include "paimon/fs/file_system.h"
@@ -60,16 +78,21 @@ Result<std::shared_ptr<TableSchema>> LoadTableSchema(const std::shared_ptr<FileS
     return table_schema.value();
 }
 
+std::string MigratedFileName(const std::string& src_file_path,
+                             const std::string& format_identifier) {
+    std::string file_name = PathUtil::GetName(src_file_path);
+    return StringUtils::EndsWith(file_name, "." + format_identifier)
+               ? file_name
+               : (file_name + "." + format_identifier);
+}
+
 Result<std::shared_ptr<DataFileMeta>> ConstructFileMeta(
     const std::string& src_file_path, const std::string& format_identifier,
     const std::string& bucket_path, int64_t schema_id,
     const std::shared_ptr<FormatStatsExtractor>& stats_extractor,
     const std::shared_ptr<FileSystem>& fs, const std::shared_ptr<MemoryPool>& memory_pool) {
-    std::string file_name = PathUtil::GetName(src_file_path);
     // rename
-    std::string new_file_name = StringUtils::EndsWith(file_name, "." + format_identifier)
-                                    ? file_name
-                                    : (file_name + "." + format_identifier);
+    std::string new_file_name = MigratedFileName(src_file_path, format_identifier);
     std::string dst_file_path = PathUtil::JoinPath(bucket_path, new_file_name);
     PAIMON_ASSIGN_OR_RAISE(bool dst_exist, fs->Exists(dst_file_path));
     if (!dst_exist) {
@@ -100,17 +123,27 @@ Status ValidateNonObjectPath(const std::vector<std::string>& files) {
     }
     return Status::OK();
 }
-}  // namespace
 
-Result<std::unique_ptr<CommitMessage>> FileMetaUtils::GenerateCommitMessage(
-    const std::vector<std::string>& src_data_files, const std::string& dst_table_path,
-    const std::map<std::string, std::string>& partition_values,
-    const std::map<std::string, std::string>& options) {
-    auto memory_pool = GetDefaultPool();
+/// Table level states shared by migrating the files of all partitions.
+struct MigrateContext {
+    std::shared_ptr<TableSchema> table_schema;
+    CoreOptions core_options;
+    std::shared_ptr<FileSystem> fs;
+    std::shared_ptr<FileFormat> format;
+    std::shared_ptr<arrow::Schema> schema;
+    std::unique_ptr<BinaryRowPartitionComputer> partition_computer;
+    std::shared_ptr<FileStorePathFactory> path_factory;
+};
+
+Result<std::unique_ptr<MigrateContext>> CreateMigrateContext(
+    const std::string& dst_table_path, const std::map<std::string, std::string>& options,
+    const std::shared_ptr<MemoryPool>& memory_pool) {
+    auto context = std::make_unique<MigrateContext>();
     // load table schema
     PAIMON_ASSIGN_OR_RAISE(CoreOptions tmp_options, CoreOptions::FromMap(options));
-    PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<TableSchema> table_schema,
+    PAIMON_ASSIGN_OR_RAISE(context->table_schema,
                            LoadTableSchema(tmp_options.GetFileSystem(), dst_table_path));
+    const std::shared_ptr<TableSchema>& table_schema = context->table_schema;
     if (!table_schema->PrimaryKeys().empty() || table_schema->NumBuckets() != -1) {
         return Status::Invalid("migrate only support append table with unaware-bucket");
     }
@@ -119,14 +152,13 @@ Result<std::unique_ptr<CommitMessage>> FileMetaUtils::GenerateCommitMessage(
     for (const auto& [key, value] : options) {
         table_options[key] = value;
     }
-    PAIMON_ASSIGN_OR_RAISE(CoreOptions core_options, CoreOptions::FromMap(table_options));
+    PAIMON_ASSIGN_OR_RAISE(context->core_options, CoreOptions::FromMap(table_options));
+    const CoreOptions& core_options = context->core_options;
 
-    std::shared_ptr<FileSystem> fs = core_options.GetFileSystem();
-    std::shared_ptr<FileFormat> format = core_options.GetWriteFileFormat();
-    assert(fs);
-    assert(format);
-    PAIMON_RETURN_NOT_OK(ValidateNonObjectPath(src_data_files));
-    PAIMON_RETURN_NOT_OK(ValidateNonObjectPath({dst_table_path}));
+    context->fs = core_options.GetFileSystem();
+    context->format = core_options.GetWriteFileFormat();
+    assert(context->fs);
+    assert(context->format);
     PAIMON_ASSIGN_OR_RAISE(std::vector<std::string> external_paths,
                            core_options.CreateExternalPaths());
     if (!external_paths.empty() || core_options.IndexFileInDataFileDir()) {
@@ -134,33 +166,125 @@ Result<std::unique_ptr<CommitMessage>> FileMetaUtils::GenerateCommitMessage(
             "migrate only support schema without external paths and index not in data file dir");
     }
 
-    // generate partition
-    auto schema = DataField::ConvertDataFieldsToArrowSchema(table_schema->Fields());
+    context->schema = DataField::ConvertDataFieldsToArrowSchema(table_schema->Fields());
     PAIMON_ASSIGN_OR_RAISE(
-        std::unique_ptr<BinaryRowPartitionComputer> partition_computer,
-        BinaryRowPartitionComputer::Create(table_schema->PartitionKeys(), schema,
+        context->partition_computer,
+        BinaryRowPartitionComputer::Create(table_schema->PartitionKeys(), context->schema,
                                            core_options.GetPartitionDefaultName(),
                                            core_options.LegacyPartitionNameEnabled(), memory_pool));
-    PAIMON_ASSIGN_OR_RAISE(BinaryRow partition_row,
-                           partition_computer->ToBinaryRow(partition_values));
+    PAIMON_ASSIGN_OR_RAISE(
+        context->path_factory,
+        FileStorePathFactory::Create(
+            dst_table_path, context->schema, table_schema->PartitionKeys(),
+            core_options.GetPartitionDefaultName(), context->format->Identifier(),
+            core_options.DataFilePrefix(), core_options.LegacyPartitionNameEnabled(),
+            /*external_paths=*/std::vector<std::string>(),
+            /*index_file_in_data_file_dir=*/false, memory_pool));
+    return context;
+}
 
-    // generate bucket path
+Result<std::unique_ptr<FormatStatsExtractor>> CreateStatsExtractor(
+    const MigrateContext& context) {
+    ::ArrowSchema arrow_schema;
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(arrow::ExportSchema(*context.schema, &arrow_schema));
+    return context.format->CreateStatsExtractor(&arrow_schema);
+}
+
+/// Names of the data files of `partitions` in the latest snapshot of the table.
+Result<std::unordered_map<BinaryRow, std::unordered_set<std::string>>> ListCommittedFiles(
+    const MigrateContext& context, const std::string& table_path,
+    const std::unordered_set<BinaryRow>& partitions,
+    const std::shared_ptr<MemoryPool>& memory_pool) {
+    std::unordered_map<BinaryRow, std::unordered_set<std::string>> committed_files;
+    SnapshotManager snapshot_manager(context.fs, table_path);
+    PAIMON_ASSIGN_OR_RAISE(std::optional<Snapshot> snapshot, snapshot_manager.LatestSnapshot());
+    if (snapshot == std::nullopt) {
+        return committed_files;
+    }
+    const CoreOptions& options = context.core_options;
+    PAIMON_ASSIGN_OR_RAISE(
+        std::unique_ptr<ManifestList> manifest_list,
+        ManifestList::Create(context.fs, options.GetManifestFormat(),
+                             options.GetManifestCompression(), context.path_factory, memory_pool));
+    PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<arrow::Schema> partition_schema,
+                           FieldMapping::GetPartitionSchema(
+                               context.schema, context.table_schema->PartitionKeys()));
     PAIMON_ASSIGN_OR_RAISE(
-        std::unique_ptr<FileStorePathFactory> file_store_path_factory,
-        FileStorePathFactory::Create(dst_table_path, schema, table_schema->PartitionKeys(),
-                                     core_options.GetPartitionDefaultName(), format->Identifier(),
-                                     core_options.DataFilePrefix(),
-                                     core_options.LegacyPartitionNameEnabled(),
-                                     /*external_paths=*/std::vector<std::string>(),
-                                     /*index_file_in_data_file_dir=*/false, memory_pool));
+        std::unique_ptr<ManifestFile> manifest_file,
+        ManifestFile::Create(context.fs, options.GetManifestFormat(),
+                             options.GetManifestCompression(), context.path_factory,
+                             options.GetManifestTargetFileSize(), memory_pool, options,
+                             partition_schema));
+    std::vector<ManifestFileMeta> manifests;
+    PAIMON_RETURN_NOT_OK(manifest_list->ReadDataManifests(snapshot.value(), &manifests));
+    auto filter = [&partitions](const ManifestEntry& entry) -> Result<bool> {
+        return partitions.count(entry.Partition()) > 0;
+    };
+    std::vector<ManifestEntry> entries;
+    for (const auto& manifest : manifests) {
+        PAIMON_RETURN_NOT_OK(manifest_file->Read(manifest.FileName(), filter, &entries));
+    }
+    std::vector<ManifestEntry> merged_entries;
+    PAIMON_RETURN_NOT_OK(FileEntry::MergeEntries(entries, &merged_entries));
+    for (const auto& entry : merged_entries) {
+        if (entry.Kind() == FileKind::Add()) {
+            committed_files[entry.Partition()].insert(entry.FileName());
+        }
+    }
+    return committed_files;
+}
+
+std::unique_ptr<CommitMessage> CreateCommitMessage(
+    const BinaryRow& partition_row, const CoreOptions& core_options,
+    std::vector<std::shared_ptr<DataFileMeta>>&& data_file_metas) {
+    return std::make_unique<CommitMessageImpl>(
+        partition_row, /*bucket=*/0, /*total_buckets=*/core_options.GetBucket(),
+        DataIncrement(std::move(data_file_metas), /*deleted_files=*/{}, /*changelog_files=*/{}),
+        CompactIncrement(/*compact_before=*/{}, /*compact_after=*/{}, /*changelog_files=*/{}));
+}
+
+bool IsHiddenFile(const std::string& path) {
+    std::string name = PathUtil::GetName(path);
+    return StringUtils::StartsWith(name, ".") || StringUtils::StartsWith(name, "_");
+}
+
+Result<FileMetaUtils::MigratePartition> ListPartition(
+    const std::shared_ptr<FileSystem>& fs, const std::string& src_dir,
+    const std::map<std::string, std::string>& partition_values) {
+    std::vector<std::unique_ptr<FileStatus>> file_status_list;
+    PAIMON_RETURN_NOT_OK(fs->ListFileStatus(src_dir, &file_status_list));
+    FileMetaUtils::MigratePartition partition;
+    partition.partition_values = partition_values;
+    for (const auto& file_status : file_status_list) {
+        if (file_status->IsDir() || IsHiddenFile(file_status->GetPath())) {
+            continue;
+        }
+        partition.src_data_files.push_back(file_status->GetPath());
+    }
+    std::sort(partition.src_data_files.begin(), partition.src_data_files.end());
+    return partition;
+}
+}  // namespace
+
+Result<std::unique_ptr<CommitMessage>> FileMetaUtils::GenerateCommitMessage(
+    const std::vector<std::string>& src_data_files, const std::string& dst_table_path,
+    const std::map<std::string, std::string>& partition_values,
+    const std::map<std::string, std::string>& options) {
+    auto memory_pool = GetDefaultPool();
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<MigrateContext> context,
+                           CreateMigrateContext(dst_table_path, options, memory_pool));
+    PAIMON_RETURN_NOT_OK(ValidateNonObjectPath({dst_table_path}));
+    PAIMON_RETURN_NOT_OK(ValidateNonObjectPath(src_data_files));
+
+    // generate partition and bucket path
+    PAIMON_ASSIGN_OR_RAISE(BinaryRow partition_row,
+                           context->partition_computer->ToBinaryRow(partition_values));
     PAIMON_ASSIGN_OR_RAISE(std::string bucket_path,
-                           file_store_path_factory->BucketPath(partition_row, /*bucket=*/0));
+                           context->path_factory->BucketPath(partition_row, /*bucket=*/0));
 
     // prepare stats extractor
-    ::ArrowSchema arrow_schema;
-    PAIMON_RETURN_NOT_OK_FROM_ARROW(arrow::ExportSchema(*schema, &arrow_schema));
     PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<FormatStatsExtractor> stats_extractor,
-                           format->CreateStatsExtractor(&arrow_schema));
+                           CreateStatsExtractor(*context));
 
     // prepare data file meta
     std::vector<std::shared_ptr<DataFileMeta>> data_file_metas;
@@ -168,14 +292,171 @@ Result<std::unique_ptr<CommitMessage>> FileMetaUtils::GenerateCommitMessage(
     for (const auto& file : src_data_files) {
         PAIMON_ASSIGN_OR_RAISE(
             std::shared_ptr<DataFileMeta> meta,
-            ConstructFileMeta(file, format->Identifier(), bucket_path, table_schema->Id(),
-                              stats_extractor, fs, memory_pool));
+            ConstructFileMeta(file, context->format->Identifier(), bucket_path,
+                              context->table_schema->Id(), stats_extractor, context->fs,
+                              memory_pool));
         data_file_metas.push_back(meta);
     }
+    return CreateCommitMessage(partition_row, context->core_options, std::move(data_file_metas));
+}
 
-    return std::make_unique<CommitMessageImpl>(
-        partition_row, /*bucket=*/0, /*total_buckets=*/core_options.GetBucket(),
-        DataIncrement(std::move(data_file_metas), /*deleted_files=*/{}, /*changelog_files=*/{}),
-        CompactIncrement(/*compact_before=*/{}, /*compact_after=*/{}, /*changelog_files=*/{}));
+Result<std::vector<FileMetaUtils::MigratePartition>> FileMetaUtils::ListPartitions(
+    const std::map<std::string, std::map<std::string, std::string>>& src_partition_dirs,
+    const std::map<std::string, std::string>& options,
+    const std::shared_ptr<Executor>& executor) {
+    if (executor == nullptr) {
+        return Status::Invalid("list partitions requires an executor");
+    }
+    PAIMON_ASSIGN_OR_RAISE(CoreOptions core_options, CoreOptions::FromMap(options));
+    std::shared_ptr<FileSystem> fs = core_options.GetFileSystem();
+    std::vector<std::future<Result<MigratePartition>>> futures;
+    futures.reserve(src_partition_dirs.size());
+    for (const auto& [src_dir, partition_values] : src_partition_dirs) {
+        futures.push_back(Via(executor.get(), [&fs, src_dir = &src_dir,
+                                               partition_values = &partition_values]() {
+            return ListPartition(fs, *src_dir, *partition_values);
+        }));
+    }
+    std::vector<MigratePartition> partitions;
+    partitions.reserve(futures.size());
+    for (auto& partition : CollectAll(futures)) {
+        PAIMON_ASSIGN_OR_RAISE(MigratePartition listed, std::move(partition));
+        partitions.push_back(std::move(listed));
+    }
+    return partitions;
+}
+
+Status FileMetaUtils::GenerateCommitMessages(
+    const std::vector<MigratePartition>& partitions, const std::string& dst_table_path,
+    const std::map<std::string, std::string>& options, int32_t max_files_per_message,
+    int32_t max_messages_per_batch, int32_t max_concurrent_files,
+    const std::shared_ptr<Executor>& executor,
+    const std::function<Status(std::vector<std::unique_ptr<CommitMessage>>&&)>& batch_consumer) {
+    if (max_files_per_message <= 0) {
+        return Status::Invalid(fmt::format("max files per message must be positive, but is {}",
+                                           max_files_per_message));
+    }
+    if (max_messages_per_batch <= 0) {
+        return Status::Invalid(fmt::format("max messages per batch must be positive, but is {}",
+                                           max_messages_per_batch));
+    }
+    if (max_concurrent_files <= 0) {
+        return Status::Invalid(fmt::format("max concurrent files must be positive, but is {}",
+                                           max_concurrent_files));
+    }
+    if (executor == nullptr) {
+        return Status::Invalid("generate commit messages requires an executor");
+    }
+    if (!batch_consumer) {
+        return Status::Invalid("generate commit messages requires a batch consumer");
+    }
+    auto memory_pool = GetDefaultPool();
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<MigrateContext> context,
+                           CreateMigrateContext(dst_table_path, options, memory_pool));
+    const std::string& format_identifier = context->format->Identifier();
+
+    std::vector<BinaryRow> partition_rows;
+    std::vector<std::string> bucket_paths;
+    partition_rows.reserve(partitions.size());
+    bucket_paths.reserve(partitions.size());
+    for (const auto& partition : partitions) {
+        PAIMON_ASSIGN_OR_RAISE(
+            BinaryRow partition_row,
+            context->partition_computer->ToBinaryRow(partition.partition_values));
+        PAIMON_ASSIGN_OR_RAISE(std::string bucket_path,
+                               context->path_factory->BucketPath(partition_row, /*bucket=*/0));
+        partition_rows.push_back(std::move(partition_row));
+        bucket_paths.push_back(std::move(bucket_path));
+    }
+    // files committed by an earlier run, e.g. with some batches committed before a failure, are
+    // skipped so that a restart does not add them again
+    PAIMON_ASSIGN_OR_RAISE(
+        auto committed_files,
+        ListCommittedFiles(*context, dst_table_path,
+                           std::unordered_set<BinaryRow>(partition_rows.begin(),
+                                                         partition_rows.end()),
+                           memory_pool));
+    std::vector<std::vector<const std::string*>> pending_files(partitions.size());
+    for (size_t i = 0; i < partitions.size(); ++i) {
+        auto committed_iter = committed_files.find(partition_rows[i]);
+        for (const auto& file : partitions[i].src_data_files) {
+            if (committed_iter != committed_files.end() &&
+                committed_iter->second.count(MigratedFileName(file, format_identifier)) > 0) {
+                continue;
+            }
+            pending_files[i].push_back(&file);
+        }
+    }
+
+    // a message is made of the pending files [begin, end) of a partition
+    struct MessageFiles {
+        size_t partition_index;
+        size_t begin;
+        size_t end;
+    };
+    std::vector<MessageFiles> messages;
+    for (size_t i = 0; i < partitions.size(); ++i) {
+        size_t file_count = pending_files[i].size();
+        for (size_t begin = 0; begin < file_count; begin += max_files_per_message) {
+            messages.push_back({i, begin, std::min(file_count, begin + max_files_per_message)});
+        }
+    }
+
+    // files are submitted in message order across partitions, and the next one as soon as the
+    // oldest in flight is done, so that at most max_concurrent_files files are in flight
+    std::deque<std::future<Result<std::shared_ptr<DataFileMeta>>>> in_flight;
+    ScopeGuard guard([&in_flight]() {
+        for (auto& future : in_flight) {
+            future.wait();
+        }
+    });
+    size_t next_file = 0;
+    size_t next_message = 0;
+    auto submit_files = [&]() {
+        while (next_message < messages.size() &&
+               in_flight.size() < static_cast<size_t>(max_concurrent_files)) {
+            const MessageFiles& message = messages[next_message];
+            const std::string* file = pending_files[message.partition_index][next_file];
+            const std::string* bucket_path = &bucket_paths[message.partition_index];
+            in_flight.push_back(Via(
+                executor.get(),
+                [&context, &memory_pool, file,
+                 bucket_path]() -> Result<std::shared_ptr<DataFileMeta>> {
+                    // stats extractors are not thread-safe, each task creates its own
+                    PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<FormatStatsExtractor> extractor,
+                                           CreateStatsExtractor(*context));
+                    return ConstructFileMeta(*file, context->format->Identifier(), *bucket_path,
+                                             context->table_schema->Id(), extractor, context->fs,
+                                             memory_pool);
+                }));
+            if (++next_file == message.end) {
+                ++next_message;
+                next_file = next_message < messages.size() ? messages[next_message].begin : 0;
+            }
+        }
+    };
+
+    std::vector<std::unique_ptr<CommitMessage>> batch;
+    for (const auto& message : messages) {
+        std::vector<std::shared_ptr<DataFileMeta>> data_file_metas;
+        data_file_metas.reserve(message.end - message.begin);
+        for (size_t i = message.begin; i < message.end; ++i) {
+            submit_files();
+            Result<std::shared_ptr<DataFileMeta>> meta = in_flight.front().get();
+            in_flight.pop_front();
+            PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<DataFileMeta> data_file_meta, std::move(meta));
+            data_file_metas.push_back(std::move(data_file_meta));
+        }
+        batch.push_back(CreateCommitMessage(partition_rows[message.partition_index],
+                                            context->core_options, std::move(data_file_metas)));
+        if (batch.size() == static_cast<size_t>(max_messages_per_batch)) {
+            PAIMON_RETURN_NOT_OK(batch_consumer(std::move(batch)));
+            batch.clear();
+        }
+    }
+    if (!batch.empty()) {
+        PAIMON_RETURN_NOT_OK(batch_consumer(std::move(batch)));
+    }
+    return Status::OK();
 }
 }  // namespace paimon
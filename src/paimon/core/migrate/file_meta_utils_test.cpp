@@ -16,12 +16,14 @@
 
 #include "paimon/migrate/file_meta_utils.h"
 
+#include <map>
 #include <optional>
 #include <ostream>
 #include <utility>
 #include <variant>
 
 #include "gtest/gtest.h"
+#include "paimon/commit_context.h"
 #include "paimon/common/data/binary_row.h"
 #include "paimon/common/data/data_define.h"
 #include "paimon/common/utils/path_util.h"
@@ -34,6 +36,9 @@
 #include "paimon/data/decimal.h"
 #include "paimon/data/timestamp.h"
 #include "paimon/defs.h"
+#include "paimon/executor.h"
+#include "paimon/file_store_commit.h"
+#include "paimon/fs/file_system.h"
 #include "paimon/fs/local/local_file_system.h"
 #include "paimon/memory/memory_pool.h"
 #include "paimon/status.h"
@@ -530,4 +535,138 @@ TEST_F(FileMetaUtilsTest, TestInvalidFile) {
         "extract file info failed");
 }
 
+TEST_F(FileMetaUtilsTest, TestGenerateCommitMessagesOfPartitions) {
+    std::string table_dir = paimon::test::GetDataDir() +
+                            "/orc/multi_partition_append_table.db/multi_partition_append_table";
+    std::string dst_table_name = "test_table";
+    CreateTable(dst_table_name, table_dir + "/schema/schema-0");
+    // copy the files of two partitions into source partition directories
+    std::map<std::string, std::map<std::string, std::string>> src_partition_dirs;
+    std::vector<std::pair<std::string, std::map<std::string, std::string>>> partitions = {
+        {"f1=10/f2=0", {{"f1", "10"}, {"f2", "0"}}}, {"f1=20/f2=1", {{"f1", "20"}, {"f2", "1"}}}};
+    for (const auto& [partition_path, partition_values] : partitions) {
+        std::string src_dir = tmp_dir_->Str() + "/" + partition_path;
+        ASSERT_OK(fs_->Mkdirs(src_dir));
+        std::vector<std::unique_ptr<FileStatus>> file_status_list;
+        ASSERT_OK(
+            fs_->ListFileStatus(table_dir + "/" + partition_path + "/bucket-0", &file_status_list));
+        for (const auto& file_status : file_status_list) {
+            CopyFile(file_status->GetPath(),
+                     src_dir + "/" + PathUtil::GetName(file_status->GetPath()));
+        }
+        src_partition_dirs[src_dir] = partition_values;
+    }
+    // hidden files are not listed
+    ASSERT_OK(fs_->WriteFile(tmp_dir_->Str() + "/f1=10/f2=0/_SUCCESS", "", /*overwrite=*/false));
+
+    std::shared_ptr<Executor> executor = CreateDefaultExecutor(/*thread_count=*/2);
+    std::map<std::string, std::string> options = {{Options::FILE_FORMAT, "orc"}};
+    ASSERT_OK_AND_ASSIGN(std::vector<FileMetaUtils::MigratePartition> migrate_partitions,
+                         FileMetaUtils::ListPartitions(src_partition_dirs, options, executor));
+    ASSERT_EQ(2, migrate_partitions.size());
+    ASSERT_EQ(3, migrate_partitions[0].src_data_files.size());
+    ASSERT_EQ(2, migrate_partitions[1].src_data_files.size());
+
+    std::string dst_table_path = dst_table_dir_->Str() + "/" + dst_table_name;
+    auto check_commit_messages = [&](const std::vector<std::unique_ptr<CommitMessage>>& msgs) {
+        // at most 2 files in a message
+        ASSERT_EQ(3, msgs.size());
+        std::vector<BinaryRow> expected_partitions = {
+            BinaryRowGenerator::GenerateRow({10, 0}, pool_.get()),
+            BinaryRowGenerator::GenerateRow({10, 0}, pool_.get()),
+            BinaryRowGenerator::GenerateRow({20, 1}, pool_.get())};
+        std::vector<size_t> expected_file_counts = {2, 1, 2};
+        for (size_t i = 0; i < msgs.size(); ++i) {
+            auto msg_impl = dynamic_cast<CommitMessageImpl*>(msgs[i].get());
+            ASSERT_TRUE(msg_impl);
+            ASSERT_EQ(expected_partitions[i], msg_impl->Partition());
+            const auto& new_files = msg_impl->GetNewFilesIncrement().NewFiles();
+            ASSERT_EQ(expected_file_counts[i], new_files.size());
+            for (const auto& file : new_files) {
+                ASSERT_GT(file->row_count, 0);
+            }
+        }
+        for (const auto& migrate_partition : migrate_partitions) {
+            for (const auto& src_file : migrate_partition.src_data_files) {
+                ASSERT_OK_AND_ASSIGN(bool exist, fs_->Exists(src_file));
+                ASSERT_FALSE(exist);
+            }
+        }
+    };
+    // messages are handed over in batches of at most 2
+    auto generate_commit_messages = [&](std::vector<std::unique_ptr<CommitMessage>>* msgs,
+                                        std::vector<size_t>* batch_sizes) {
+        return FileMetaUtils::GenerateCommitMessages(
+            migrate_partitions, dst_table_path, options, /*max_files_per_message=*/2,
+            /*max_messages_per_batch=*/2, /*max_concurrent_files=*/3, executor,
+            [msgs, batch_sizes](std::vector<std::unique_ptr<CommitMessage>>&& batch) {
+                batch_sizes->push_back(batch.size());
+                for (auto& msg : batch) {
+                    msgs->push_back(std::move(msg));
+                }
+                return Status::OK();
+            });
+    };
+    std::vector<std::unique_ptr<CommitMessage>> msgs;
+    std::vector<size_t> batch_sizes;
+    ASSERT_OK(generate_commit_messages(&msgs, &batch_sizes));
+    check_commit_messages(msgs);
+    ASSERT_EQ(std::vector<size_t>({2, 1}), batch_sizes);
+
+    // restart with the same partitions reuses the files already moved
+    std::vector<std::unique_ptr<CommitMessage>> restarted_msgs;
+    batch_sizes.clear();
+    ASSERT_OK(generate_commit_messages(&restarted_msgs, &batch_sizes));
+    check_commit_messages(restarted_msgs);
+
+    // after the first batch is committed, a restart only migrates the files not committed yet
+    CommitContextBuilder commit_context_builder(dst_table_path, "commit_user");
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<CommitContext> commit_context,
+                         commit_context_builder.AddOption(Options::FILE_SYSTEM, "local").Finish());
+    ASSERT_OK_AND_ASSIGN(auto commit, FileStoreCommit::Create(std::move(commit_context)));
+    std::vector<std::shared_ptr<CommitMessage>> first_batch;
+    first_batch.emplace_back(std::move(restarted_msgs[0]));
+    first_batch.emplace_back(std::move(restarted_msgs[1]));
+    ASSERT_OK(commit->Commit(first_batch));
+    std::vector<std::unique_ptr<CommitMessage>> remaining_msgs;
+    batch_sizes.clear();
+    ASSERT_OK(generate_commit_messages(&remaining_msgs, &batch_sizes));
+    ASSERT_EQ(1, remaining_msgs.size());
+    auto remaining_msg = dynamic_cast<CommitMessageImpl*>(remaining_msgs[0].get());
+    ASSERT_TRUE(remaining_msg);
+    ASSERT_EQ(BinaryRowGenerator::GenerateRow({20, 1}, pool_.get()), remaining_msg->Partition());
+    ASSERT_EQ(2, remaining_msg->GetNewFilesIncrement().NewFiles().size());
+
+    // an error of the batch consumer stops the migration
+    int32_t batch_count = 0;
+    ASSERT_NOK_WITH_MSG(FileMetaUtils::GenerateCommitMessages(
+                            migrate_partitions, dst_table_path, options,
+                            /*max_files_per_message=*/1, /*max_messages_per_batch=*/1,
+                            /*max_concurrent_files=*/1, executor, [&batch_count](std::vector<std::unique_ptr<CommitMessage>>&& batch) {
+                                ++batch_count;
+                                return Status::IOError("commit failed");
+                            }),
+                        "commit failed");
+    ASSERT_EQ(1, batch_count);
+
+    auto consume_nothing = [](std::vector<std::unique_ptr<CommitMessage>>&& batch) {
+        return Status::OK();
+    };
+    ASSERT_NOK_WITH_MSG(FileMetaUtils::GenerateCommitMessages(
+                            migrate_partitions, dst_table_path, options,
+                            /*max_files_per_message=*/0, /*max_messages_per_batch=*/1,
+                            /*max_concurrent_files=*/1, executor, consume_nothing),
+                        "max files per message must be positive");
+    ASSERT_NOK_WITH_MSG(FileMetaUtils::GenerateCommitMessages(
+                            migrate_partitions, dst_table_path, options,
+                            /*max_files_per_message=*/1, /*max_messages_per_batch=*/0,
+                            /*max_concurrent_files=*/1, executor, consume_nothing),
+                        "max messages per batch must be positive");
+    ASSERT_NOK_WITH_MSG(FileMetaUtils::GenerateCommitMessages(
+                            migrate_partitions, dst_table_path, options,
+                            /*max_files_per_message=*/1, /*max_messages_per_batch=*/1,
+                            /*max_concurrent_files=*/0, executor, consume_nothing),
+                        "max concurrent files must be positive");
+}
+
 }  // namespace paimon::test
@@ -18,11 +18,14 @@
 
 #include <algorithm>
 #include <cassert>
+#include <functional>
+#include <future>
 #include <map>
 #include <optional>
 
 #include "fmt/format.h"
 #include "paimon/common/data/binary_row.h"
+#include "paimon/common/executor/future.h"
 #include "paimon/common/metrics/metrics_impl.h"
 #include "paimon/core/manifest/manifest_entry.h"
 #include "paimon/core/operation/file_store_scan.h"
@@ -107,14 +110,23 @@ Status AbstractFileStoreWrite::Write(std::unique_ptr<RecordBatch>&& batch) {
     }
     PAIMON_ASSIGN_OR_RAISE(BinaryRow partition,
                            file_store_path_factory_->ToBinaryRow(batch->GetPartition()))
-    PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<BatchWriter> writer,
-                           GetWriter(partition, batch->GetBucket()));
-    assert(writer);
-    return writer->Write(std::move(batch));
+    while (true) {
+        PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<WriterContainer<BatchWriter>> writer_container,
+                               GetWriter(partition, batch->GetBucket()));
+        assert(writer_container && writer_container->writer);
+        std::lock_guard<std::mutex> writer_lock(writer_container->mutex);
+        if (PAIMON_UNLIKELY(writer_container->closed)) {
+            // closed by a concurrent commit as it had nothing to commit, it is already removed
+            // from the shard, so the next lookup creates a new writer
+            continue;
+        }
+        return writer_container->writer->Write(std::move(batch));
+    }
 }
 
 Result<std::vector<std::shared_ptr<CommitMessage>>> AbstractFileStoreWrite::PrepareCommit(
     bool wait_compaction, int64_t commit_identifier) {
+    std::lock_guard<std::mutex> commit_lock(commit_mutex_);
     if (batch_committed_) {
         return Status::Invalid("batch write mode only support one-time committing.");
     }
@@ -124,14 +136,13 @@ Result<std::vector<std::shared_ptr<CommitMessage>>> AbstractFileStoreWrite::Prep
         wait_compaction = true;
         commit_identifier = std::numeric_limits<int64_t>::max();
     }
+    // last modified commit identifiers are only updated under the commit lock
+    std::vector<ActiveWriter> active_writers = CollectWriters();
     int64_t latest_committed_identifier = std::numeric_limits<int64_t>::min();
-    for (const auto& kv : writers_) {
-        const auto& buckets = kv.second;
-        for (const auto& kv : buckets) {
-            const auto& writer_container = kv.second;
-            latest_committed_identifier = std::max(
-                latest_committed_identifier, writer_container.last_modified_commit_identifier);
-        }
+    for (const auto& active_writer : active_writers) {
+        latest_committed_identifier =
+            std::max(latest_committed_identifier,
+                     active_writer.container->last_modified_commit_identifier);
     }
     if (latest_committed_identifier == std::numeric_limits<int64_t>::min()) {
         // Optimization for the first commit.
@@ -151,75 +162,103 @@ Result<std::vector<std::shared_ptr<CommitMessage>>> AbstractFileStoreWrite::Prep
         }
     }
 
+    // writers flush and close their files independently, fan them out to the executor
+    std::vector<std::future<Result<PreparedWriter>>> futures;
+    futures.reserve(active_writers.size());
+    for (const auto& active_writer : active_writers) {
+        futures.push_back(Via(executor_.get(), [this, &active_writer, wait_compaction,
+                                                commit_identifier, latest_committed_identifier]() {
+            return PrepareCommitWriter(active_writer, wait_compaction, commit_identifier,
+                                       latest_committed_identifier);
+        }));
+    }
+    std::vector<Result<PreparedWriter>> prepared_writers = CollectAll(futures);
+
     std::vector<std::shared_ptr<CommitMessage>> result;
+    result.reserve(prepared_writers.size());
     auto metrics = std::make_shared<MetricsImpl>();
-    for (auto partition_iter = writers_.begin(); partition_iter != writers_.end();) {
-        auto& partition = partition_iter->first;
-        auto& buckets = partition_iter->second;
-        for (auto bucket_iter = buckets.begin(); bucket_iter != buckets.end();) {
-            int32_t bucket = bucket_iter->first;
-            WriterContainer<BatchWriter>& writer_container = bucket_iter->second;
-            PAIMON_ASSIGN_OR_RAISE(CommitIncrement increment,
-                                   writer_container.writer->PrepareCommit(wait_compaction));
-            auto committable = std::make_shared<CommitMessageImpl>(
-                partition, bucket, writer_container.total_buckets, increment.GetNewFilesIncrement(),
-                increment.GetCompactIncrement());
-            result.push_back(committable);
-            if (committable->IsEmpty()) {
-                // Condition 1: There is no more record waiting to be committed. Note that the
-                // condition is < (instead of <=), because each commit identifier may have
-                // multiple snapshots. We must make sure all snapshots of this identifier are
-                // committed.
-                // Condition 2: No compaction is in progress. That is, no more changelog will be
-                // produced.
-                //
-                // Condition 3: The writer has no postponed compaction like gentle lookup
-                // compaction.
-                if (writer_container.last_modified_commit_identifier <
-                        latest_committed_identifier &&
-                    !writer_container.writer->IsCompacting()) {
-                    // Clear writer if no update, and if its latest modification has committed.
-                    //
-                    // We need a mechanism to clear writers, otherwise there will be more and
-                    // more such as yesterday's partition that no longer needs to be written.
-                    PAIMON_LOG_DEBUG(logger_,
-                                     "Closing writer for partition %s, bucket %d. "
-                                     "Writer's last modified identifier is %ld, "
-                                     "while latest committed identifier is %ld, "
-                                     "current commit identifier is %ld.",
-                                     partition.ToString().c_str(), bucket,
-                                     writer_container.last_modified_commit_identifier,
-                                     latest_committed_identifier, commit_identifier);
-                    PAIMON_RETURN_NOT_OK(writer_container.writer->Close());
-                    bucket_iter = buckets.erase(bucket_iter);
-                } else {
-                    metrics->Merge(writer_container.writer->GetMetrics());
-                    ++bucket_iter;
-                }
-            } else {
-                writer_container.last_modified_commit_identifier = commit_identifier;
-                metrics->Merge(writer_container.writer->GetMetrics());
-                ++bucket_iter;
-            }
-        }
-
-        if (buckets.empty()) {
-            partition_iter = writers_.erase(partition_iter);
-        } else {
-            ++partition_iter;
+    for (auto& prepared_writer_result : prepared_writers) {
+        PAIMON_ASSIGN_OR_RAISE(PreparedWriter prepared_writer, std::move(prepared_writer_result));
+        result.push_back(std::move(prepared_writer.committable));
+        if (prepared_writer.metrics) {
+            metrics->Merge(prepared_writer.metrics);
         }
     }
     metrics_->Overwrite(metrics);
     return result;
 }
 
-Status AbstractFileStoreWrite::Close() {
-    for (auto& [_, bucket_writers] : writers_) {
-        for (auto& [_, writer_container] : bucket_writers) {
+Result<AbstractFileStoreWrite::PreparedWriter> AbstractFileStoreWrite::PrepareCommitWriter(
+    const ActiveWriter& active_writer, bool wait_compaction, int64_t commit_identifier,
+    int64_t latest_committed_identifier) {
+    const BinaryRow& partition = active_writer.partition;
+    int32_t bucket = active_writer.bucket;
+    WriterContainer<BatchWriter>& writer_container = *active_writer.container;
+    std::lock_guard<std::mutex> writer_lock(writer_container.mutex);
+    PAIMON_ASSIGN_OR_RAISE(CommitIncrement increment,
+                           writer_container.writer->PrepareCommit(wait_compaction));
+    auto committable = std::make_shared<CommitMessageImpl>(
+        partition, bucket, writer_container.total_buckets, increment.GetNewFilesIncrement(),
+        increment.GetCompactIncrement());
+    PreparedWriter prepared_writer;
+    prepared_writer.committable = committable;
+    if (committable->IsEmpty()) {
+        // Condition 1: There is no more record waiting to be committed. Note that the
+        // condition is < (instead of <=), because each commit identifier may have
+        // multiple snapshots. We must make sure all snapshots of this identifier are
+        // committed.
+        // Condition 2: No compaction is in progress. That is, no more changelog will be
+        // produced.
+        //
+        // Condition 3: The writer has no postponed compaction like gentle lookup
+        // compaction.
+        if (writer_container.last_modified_commit_identifier < latest_committed_identifier &&
+            !writer_container.writer->IsCompacting()) {
+            // Clear writer if no update, and if its latest modification has committed.
+            //
+            // We need a mechanism to clear writers, otherwise there will be more and
+            // more such as yesterday's partition that no longer needs to be written.
+            PAIMON_LOG_DEBUG(logger_,
+                             "Closing writer for partition %s, bucket %d. "
+                             "Writer's last modified identifier is %ld, "
+                             "while latest committed identifier is %ld, "
+                             "current commit identifier is %ld.",
+                             partition.ToString().c_str(), bucket,
+                             writer_container.last_modified_commit_identifier,
+                             latest_committed_identifier, commit_identifier);
+            writer_container.closed = true;
+            WriterShard& shard = GetShard(partition, bucket);
+            {
+                std::lock_guard<std::mutex> shard_lock(shard.mutex);
+                auto partition_iter = shard.writers.find(partition);
+                assert(partition_iter != shard.writers.end());
+                partition_iter->second.erase(bucket);
+                if (partition_iter->second.empty()) {
+                    shard.writers.erase(partition_iter);
+                }
+            }
             PAIMON_RETURN_NOT_OK(writer_container.writer->Close());
+            return prepared_writer;
         }
+    } else {
+        writer_container.last_modified_commit_identifier = commit_identifier;
+    }
+    prepared_writer.metrics = writer_container.writer->GetMetrics();
+    return prepared_writer;
+}
+
+Status AbstractFileStoreWrite::Close() {
+    std::lock_guard<std::mutex> commit_lock(commit_mutex_);
+    for (const auto& active_writer : CollectWriters()) {
+        WriterContainer<BatchWriter>& writer_container = *active_writer.container;
+        std::lock_guard<std::mutex> writer_lock(writer_container.mutex);
+        writer_container.closed = true;
+        PAIMON_RETURN_NOT_OK(writer_container.writer->Close());
+    }
+    for (auto& shard : writer_shards_) {
+        std::lock_guard<std::mutex> shard_lock(shard.mutex);
+        shard.writers.clear();
     }
-    writers_.clear();
     return Status::OK();
 }
 
@@ -266,32 +305,51 @@ Result<int32_t> AbstractFileStoreWrite::ScanExistingFileMetas(
     return total_buckets;
 }
 
-Result<std::shared_ptr<BatchWriter>> AbstractFileStoreWrite::GetWriter(const BinaryRow& partition,
-                                                                       int32_t bucket) {
-    auto iter = writers_.find(partition);
-    if (PAIMON_UNLIKELY(iter == writers_.end())) {
-        PAIMON_ASSIGN_OR_RAISE(auto result,
-                               CreateWriter(partition, bucket, ignore_previous_files_));
-        int32_t total_buckets = result.first;
-        std::shared_ptr<BatchWriter> writer = result.second;
-        writers_.emplace(partition,
-                         std::unordered_map<int32_t, WriterContainer<BatchWriter>>(
-                             {{bucket, WriterContainer<BatchWriter>(writer, total_buckets)}}));
-        return writer;
-    } else {
-        auto& buckets = iter->second;
-        auto iter = buckets.find(bucket);
-        if (PAIMON_LIKELY(iter != buckets.end())) {
-            return iter->second.writer;
-        } else {
-            PAIMON_ASSIGN_OR_RAISE(auto result,
-                                   CreateWriter(partition, bucket, ignore_previous_files_));
-            int32_t total_buckets = result.first;
-            std::shared_ptr<BatchWriter> writer = result.second;
-            buckets.emplace(bucket, WriterContainer<BatchWriter>(writer, total_buckets));
-            return writer;
+AbstractFileStoreWrite::WriterShard& AbstractFileStoreWrite::GetShard(const BinaryRow& partition,
+                                                                     int32_t bucket) {
+    size_t hash = std::hash<std::pair<BinaryRow, int32_t>>{}(std::make_pair(partition, bucket));
+    return writer_shards_[hash % WRITER_SHARD_NUM];
+}
+
+Result<std::shared_ptr<AbstractFileStoreWrite::WriterContainer<BatchWriter>>>
+AbstractFileStoreWrite::GetWriter(const BinaryRow& partition, int32_t bucket) {
+    WriterShard& shard = GetShard(partition, bucket);
+    std::lock_guard<std::mutex> shard_lock(shard.mutex);
+    auto& buckets = shard.writers[partition];
+    auto iter = buckets.find(bucket);
+    if (PAIMON_LIKELY(iter != buckets.end())) {
+        return iter->second;
+    }
+    // only writes of the same shard wait for the creation, which may restore files of the bucket
+    auto result = CreateWriter(partition, bucket, ignore_previous_files_);
+    if (PAIMON_UNLIKELY(!result.ok())) {
+        if (buckets.empty()) {
+            shard.writers.erase(partition);
+        }
+        return result.status();
+    }
+    auto [total_buckets, writer] = std::move(result).value();
+    auto writer_container = std::make_shared<WriterContainer<BatchWriter>>(writer, total_buckets);
+    writer_container->creation_order = writer_creation_count_++;
+    buckets.emplace(bucket, writer_container);
+    return writer_container;
+}
+
+std::vector<AbstractFileStoreWrite::ActiveWriter> AbstractFileStoreWrite::CollectWriters() {
+    std::vector<ActiveWriter> active_writers;
+    for (auto& shard : writer_shards_) {
+        std::lock_guard<std::mutex> shard_lock(shard.mutex);
+        for (const auto& [partition, buckets] : shard.writers) {
+            for (const auto& [bucket, writer_container] : buckets) {
+                active_writers.push_back({partition, bucket, writer_container});
+            }
         }
     }
+    std::sort(active_writers.begin(), active_writers.end(),
+              [](const ActiveWriter& lhs, const ActiveWriter& rhs) {
+                  return lhs.container->creation_order < rhs.container->creation_order;
+              });
+    return active_writers;
 }
 
 }  // namespace paimon
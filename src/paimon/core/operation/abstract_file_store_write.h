@@ -16,9 +16,12 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <cstdint>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -58,6 +61,9 @@ class Executor;
 class MemoryPool;
 class RecordBatch;
 
+/// `Write()` may be called from multiple threads concurrently. Writers are sharded by (partition,
+/// bucket), and writes and commits of one writer are serialized by the lock of the writer.
+/// `PrepareCommit()` flushes all writers concurrently on the executor.
 class AbstractFileStoreWrite : public FileStoreWrite {
  public:
     // schema indicates all fields in table schema, write_schema indicates actual write fields while
@@ -94,6 +100,13 @@ class AbstractFileStoreWrite : public FileStoreWrite {
         std::shared_ptr<T> writer;
         int64_t last_modified_commit_identifier = std::numeric_limits<int64_t>::min();
         int32_t total_buckets = -1;
+        // commit messages are generated in the creation order of writers
+        int64_t creation_order = 0;
+        // serializes writes and commits of the writer
+        std::mutex mutex;
+        // set when the writer is closed by commit, a concurrent write then retries with a new
+        // writer
+        bool closed = false;
     };
 
  protected:
@@ -124,11 +137,42 @@ class AbstractFileStoreWrite : public FileStoreWrite {
     CoreOptions options_;
 
  private:
-    Result<std::shared_ptr<BatchWriter>> GetWriter(const BinaryRow& partition, int32_t bucket);
+    static constexpr size_t WRITER_SHARD_NUM = 16;
+
+    using BucketWriters =
+        std::unordered_map<int32_t, std::shared_ptr<WriterContainer<BatchWriter>>>;
+
+    struct WriterShard {
+        std::mutex mutex;
+        std::unordered_map<BinaryRow, BucketWriters> writers;
+    };
+
+    struct ActiveWriter {
+        BinaryRow partition;
+        int32_t bucket;
+        std::shared_ptr<WriterContainer<BatchWriter>> container;
+    };
+
+    struct PreparedWriter {
+        std::shared_ptr<CommitMessage> committable;
+        // metrics of the writer, null if the writer is closed
+        std::shared_ptr<Metrics> metrics;
+    };
+
+    WriterShard& GetShard(const BinaryRow& partition, int32_t bucket);
+    Result<std::shared_ptr<WriterContainer<BatchWriter>>> GetWriter(const BinaryRow& partition,
+                                                                    int32_t bucket);
+    // all writers in their creation order
+    std::vector<ActiveWriter> CollectWriters();
+    Result<PreparedWriter> PrepareCommitWriter(const ActiveWriter& active_writer,
+                                               bool wait_compaction, int64_t commit_identifier,
+                                               int64_t latest_committed_identifier);
 
  private:
-    std::unordered_map<BinaryRow, std::unordered_map<int32_t, WriterContainer<BatchWriter>>>
-        writers_;
+    std::array<WriterShard, WRITER_SHARD_NUM> writer_shards_;
+    std::atomic<int64_t> writer_creation_count_ = 0;
+    // serializes PrepareCommit() and Close()
+    std::mutex commit_mutex_;
     bool ignore_previous_files_ = false;
     bool is_streaming_mode_ = false;
     bool ignore_num_bucket_check_ = false;
@@ -125,5 +125,18 @@ TEST(AppendOnlyFileStoreScanTest, TestReadPartitionEntries) {
                      ComparePartitionEntryByPartition);
 
     ASSERT_EQ(result_partition_entries, expected_partition_entries);
+
+    // excluded partitions are skipped while reading manifests
+    file_store_scan->WithExcludedPartitions({GenerateRow(10)});
+    ASSERT_OK_AND_ASSIGN(result_partition_entries, file_store_scan->ReadPartitionEntries());
+    ASSERT_EQ(result_partition_entries,
+              std::vector<PartitionEntry>({expected_partition_entries[1]}));
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<FileStoreScan::RawPlan> plan,
+                         file_store_scan->CreatePlan());
+    std::vector<ManifestEntry> entries = plan->Files();
+    ASSERT_EQ(2, entries.size());
+    for (const auto& entry : entries) {
+        ASSERT_EQ(20, entry.Partition().GetInt(0));
+    }
 }
 }  // namespace paimon::test
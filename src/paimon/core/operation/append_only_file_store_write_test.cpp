@@ -18,6 +18,7 @@
 
 #include <cstddef>
 #include <map>
+#include <thread>
 #include <vector>
 
 #include "arrow/array/array_base.h"
@@ -35,11 +36,13 @@
 #include "paimon/common/utils/path_util.h"
 #include "paimon/core/io/data_file_meta.h"
 #include "paimon/core/snapshot.h"
+#include "paimon/core/table/sink/commit_message_impl.h"
 #include "paimon/core/utils/snapshot_manager.h"
 #include "paimon/file_store_write.h"
 #include "paimon/memory/memory_pool.h"
 #include "paimon/record_batch.h"
 #include "paimon/status.h"
+#include "paimon/testing/utils/test_helper.h"
 #include "paimon/testing/utils/testharness.h"
 #include "paimon/write_context.h"
 
@@ -176,4 +179,92 @@ TEST_F(AppendOnlyFileStoreWriteTest, TestGetMaxSequenceNumberFromMultiPartition)
     }
 }
 
+TEST_F(AppendOnlyFileStoreWriteTest, TestConcurrentWrite) {
+    arrow::FieldVector fields = {arrow::field("pt", arrow::int32()),
+                                 arrow::field("value", arrow::int32())};
+    arrow::Schema typed_schema(fields);
+    ::ArrowSchema schema;
+    ASSERT_TRUE(arrow::ExportSchema(typed_schema, &schema).ok());
+    auto dir = UniqueTestDirectory::Create();
+    ASSERT_TRUE(dir);
+    ASSERT_OK_AND_ASSIGN(auto catalog, Catalog::Create(dir->Str(), {}));
+    ASSERT_OK(catalog->CreateDatabase("foo", {}, /*ignore_if_exists=*/false));
+    ASSERT_OK(catalog->CreateTable(Identifier("foo", "bar"), &schema, /*partition_keys=*/{"pt"},
+                                   /*primary_keys=*/{}, /*options=*/{},
+                                   /*ignore_if_exists=*/false));
+    WriteContextBuilder builder(PathUtil::JoinPath(dir->Str(), "foo.db/bar"), commit_user_);
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<WriteContext> write_context,
+                         builder.WithStreamingMode(true).Finish());
+    ASSERT_OK_AND_ASSIGN(auto file_store_write, FileStoreWrite::Create(std::move(write_context)));
+
+    // each thread writes its own partition and the last one, which is shared by all threads
+    constexpr int32_t thread_num = 8;
+    constexpr int32_t batch_num = 20;
+    auto write_partition = [&](int32_t pt) -> Status {
+        for (int32_t i = 0; i < batch_num; ++i) {
+            for (int32_t target : {pt, thread_num}) {
+                std::string data = "[[" + std::to_string(target) + ", " + std::to_string(i) + "]]";
+                PAIMON_ASSIGN_OR_RAISE(
+                    std::unique_ptr<RecordBatch> batch,
+                    TestHelper::MakeRecordBatch(arrow::struct_(fields), data,
+                                                {{"pt", std::to_string(target)}},
+                                                /*bucket=*/-1, {}));
+                PAIMON_RETURN_NOT_OK(file_store_write->Write(std::move(batch)));
+            }
+        }
+        return Status::OK();
+    };
+    std::vector<Status> statuses(thread_num);
+    std::vector<std::thread> threads;
+    for (int32_t pt = 0; pt < thread_num; ++pt) {
+        threads.emplace_back([&, pt]() { statuses[pt] = write_partition(pt); });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (const auto& status : statuses) {
+        ASSERT_OK(status);
+    }
+
+    ASSERT_OK_AND_ASSIGN(std::vector<std::shared_ptr<CommitMessage>> commit_messages,
+                         file_store_write->PrepareCommit(/*wait_compaction=*/false,
+                                                         /*commit_identifier=*/0));
+    ASSERT_EQ(thread_num + 1, commit_messages.size());
+    std::map<int32_t, int64_t> partition_row_counts;
+    for (const auto& commit_message : commit_messages) {
+        auto message = std::dynamic_pointer_cast<CommitMessageImpl>(commit_message);
+        ASSERT_TRUE(message);
+        for (const auto& file : message->GetNewFilesIncrement().NewFiles()) {
+            partition_row_counts[message->Partition().GetInt(0)] += file->row_count;
+        }
+    }
+    ASSERT_EQ(thread_num + 1, partition_row_counts.size());
+    for (int32_t pt = 0; pt < thread_num; ++pt) {
+        ASSERT_EQ(batch_num, partition_row_counts[pt]);
+    }
+    ASSERT_EQ(batch_num * thread_num, partition_row_counts[thread_num]);
+
+    // commit messages follow the order in which writers are created
+    for (int32_t pt : {12, 10, 11}) {
+        std::string data = "[[" + std::to_string(pt) + ", 0]]";
+        ASSERT_OK_AND_ASSIGN(std::unique_ptr<RecordBatch> batch,
+                             TestHelper::MakeRecordBatch(arrow::struct_(fields), data,
+                                                         {{"pt", std::to_string(pt)}},
+                                                         /*bucket=*/-1, {}));
+        ASSERT_OK(file_store_write->Write(std::move(batch)));
+    }
+    ASSERT_OK_AND_ASSIGN(commit_messages, file_store_write->PrepareCommit(
+                                              /*wait_compaction=*/false, /*commit_identifier=*/1));
+    std::vector<int32_t> non_empty_partitions;
+    for (const auto& commit_message : commit_messages) {
+        auto message = std::dynamic_pointer_cast<CommitMessageImpl>(commit_message);
+        ASSERT_TRUE(message);
+        if (!message->IsEmpty()) {
+            non_empty_partitions.push_back(message->Partition().GetInt(0));
+        }
+    }
+    ASSERT_EQ(std::vector<int32_t>({12, 10, 11}), non_empty_partitions);
+    ASSERT_OK(file_store_write->Close());
+}
+
 }  // namespace paimon::test
@@ -37,9 +37,11 @@
 #include "paimon/core/manifest/manifest_file_meta.h"
 #include "paimon/core/manifest/manifest_list.h"
 #include "paimon/core/snapshot.h"
+#include "paimon/core/stats/column_sketches_file.h"
 #include "paimon/core/utils/file_store_path_factory.h"
 #include "paimon/core/utils/snapshot_manager.h"
 #include "paimon/fs/file_system.h"
+#include "paimon/memory/memory_pool.h"
 
 namespace paimon {
 
@@ -142,7 +144,17 @@ Result<int32_t> ExpireSnapshots::ExpireUntil(int64_t earliest_snapshot_id,
         PAIMON_ASSIGN_OR_RAISE(Snapshot snapshot, snapshot_manager_->LoadSnapshot(id));
         PAIMON_RETURN_NOT_OK(CleanUnusedDataFiles(snapshot.DeltaManifestList()));
     }
-    // TODO(jinli.zjw): support delete changelog files
+    // changelog files are only referenced by the snapshot which produces them
+    for (int64_t id = begin_inclusive_id; id < end_exclusive_id; id++) {
+        PAIMON_ASSIGN_OR_RAISE(bool exist, snapshot_manager_->SnapshotExists(id));
+        if (!exist) {
+            continue;
+        }
+        PAIMON_ASSIGN_OR_RAISE(Snapshot snapshot, snapshot_manager_->LoadSnapshot(id));
+        if (snapshot.ChangelogManifestList()) {
+            PAIMON_RETURN_NOT_OK(CleanChangelogFiles(snapshot.ChangelogManifestList().value()));
+        }
+    }
 
     // data files in bucket directories has been deleted
     // then delete changed bucket directories if they are empty
@@ -167,6 +179,11 @@ Result<int32_t> ExpireSnapshots::ExpireUntil(int64_t earliest_snapshot_id,
         PAIMON_ASSIGN_OR_RAISE(Snapshot snapshot, snapshot_manager_->LoadSnapshot(id));
         PAIMON_RETURN_NOT_OK(CleanUnusedManifests(snapshot.BaseManifestList(), skipping_sets));
         PAIMON_RETURN_NOT_OK(CleanUnusedManifests(snapshot.DeltaManifestList(), skipping_sets));
+        if (snapshot.ChangelogManifestList()) {
+            PAIMON_RETURN_NOT_OK(
+                CleanUnusedManifests(snapshot.ChangelogManifestList().value(), skipping_sets));
+        }
+        CleanUnusedStatsFiles(snapshot, skipping_sets);
         auto status = fs_->Delete(snapshot_manager_->SnapshotPath(id));
         // delete quietly will ignore any status error
         (void)status;
@@ -256,6 +273,35 @@ Status ExpireSnapshots::CleanUnusedManifests(const std::string& manifest_list_na
     return Status::OK();
 }
 
+void ExpireSnapshots::CleanUnusedStatsFiles(const Snapshot& snapshot,
+                                            const std::set<std::string>& skipping_sets) {
+    std::optional<std::string> partition_stats_file = snapshot.PartitionStatsFileName();
+    if (partition_stats_file && skipping_sets.count(partition_stats_file.value()) == 0) {
+        auto status =
+            fs_->Delete(path_factory_->ToManifestFilePath(partition_stats_file.value()));
+        // delete quietly will ignore any status error
+        (void)status;
+    }
+    std::optional<std::string> column_sketches_file = snapshot.ColumnSketchesFileName();
+    if (column_sketches_file && skipping_sets.count(column_sketches_file.value()) == 0) {
+        Result<TableColumnSketches> sketches = ColumnSketchesFile::ReadTableSketches(
+            fs_, FileStorePathFactory::StatisticsPath(path_factory_->RootPath()),
+            column_sketches_file.value(), GetDefaultPool());
+        if (sketches.ok()) {
+            for (const auto& bucket : sketches.value().buckets) {
+                if (skipping_sets.count(bucket.file_name) == 0) {
+                    auto status = fs_->Delete(path_factory_->ToStatsFilePath(bucket.file_name));
+                    // delete quietly will ignore any status error
+                    (void)status;
+                }
+            }
+        }
+        auto status = fs_->Delete(path_factory_->ToStatsFilePath(column_sketches_file.value()));
+        // delete quietly will ignore any status error
+        (void)status;
+    }
+}
+
 Status ExpireSnapshots::CleanUnusedDataFiles(const std::string& manifest_list_name) {
     std::vector<ManifestFileMeta> manifest_file_metas;
     auto status = manifest_list_->Read(manifest_list_name, nullptr, &manifest_file_metas);
@@ -274,34 +320,81 @@ Status ExpireSnapshots::CleanUnusedDataFiles(const std::string& manifest_list_na
                 PAIMON_RETURN_NOT_OK(GetDataFilesToDelete(manifest_entries, &data_files_to_delete));
             }
         }
+        DeleteDataFiles(data_files_to_delete);
+    }
+    return Status::OK();
+}
 
-        std::vector<std::future<void>> futures;
-        ScopeGuard guard([&futures]() { Wait(futures); });
-        for (const auto& [data_file_to_delete, entry] : data_files_to_delete) {
-            auto delete_file_path = data_file_to_delete;
-            futures.push_back(Via(executor_.get(), [this, delete_file_path]() {
-                auto status = fs_->Delete(delete_file_path);
-                // delete quietly will ignore any status error
-                (void)status;
-            }));
-            deletion_buckets_[entry.Partition()].insert(entry.Bucket());
+Status ExpireSnapshots::CleanChangelogFiles(const std::string& changelog_manifest_list_name) {
+    std::vector<ManifestFileMeta> manifest_file_metas;
+    auto status = manifest_list_->Read(changelog_manifest_list_name, nullptr, &manifest_file_metas);
+    if (status.ok()) {
+        std::map<std::string, ManifestEntry> changelog_files_to_delete;
+        for (const auto& manifest_file_meta : manifest_file_metas) {
+            std::vector<ManifestEntry> manifest_entries;
+            auto status =
+                manifest_file_->Read(manifest_file_meta.FileName(), nullptr, &manifest_entries);
+            if (!status.ok()) {
+                // cancel deletion if any exception occurs
+                PAIMON_LOG_WARN(logger_, "Failed to read some manifest files. Cancel deletion. %s",
+                                status.ToString().c_str());
+                return Status::OK();
+            }
+            // changelog manifests only contain added files
+            for (const auto& entry : manifest_entries) {
+                PAIMON_ASSIGN_OR_RAISE(
+                    std::string bucket_path,
+                    path_factory_->BucketPath(entry.Partition(), entry.Bucket()));
+                changelog_files_to_delete.insert(
+                    {PathUtil::JoinPath(bucket_path, entry.FileName()), entry});
+                for (const auto& extra_file : entry.File()->extra_files) {
+                    if (extra_file) {
+                        changelog_files_to_delete.insert(
+                            {PathUtil::JoinPath(bucket_path, extra_file.value()), entry});
+                    }
+                }
+            }
         }
+        DeleteDataFiles(changelog_files_to_delete);
     }
     return Status::OK();
 }
 
+void ExpireSnapshots::DeleteDataFiles(
+    const std::map<std::string, ManifestEntry>& data_files_to_delete) {
+    std::vector<std::future<void>> futures;
+    ScopeGuard guard([&futures]() { Wait(futures); });
+    for (const auto& [data_file_to_delete, entry] : data_files_to_delete) {
+        auto delete_file_path = data_file_to_delete;
+        futures.push_back(Via(executor_.get(), [this, delete_file_path]() {
+            auto status = fs_->Delete(delete_file_path);
+            // delete quietly will ignore any status error
+            (void)status;
+        }));
+        deletion_buckets_[entry.Partition()].insert(entry.Bucket());
+    }
+}
+
 Status ExpireSnapshots::GetDataFilesToDelete(
     const std::vector<ManifestEntry>& data_file_entries,
     std::map<std::string, ManifestEntry>* data_files_to_delete) const {
     for (const auto& entry : data_file_entries) {
         PAIMON_ASSIGN_OR_RAISE(std::string bucket_path,
                                path_factory_->BucketPath(entry.Partition(), entry.Bucket()));
-        std::string data_file_path = PathUtil::JoinPath(bucket_path, entry.FileName());
+        std::vector<std::string> file_paths = {PathUtil::JoinPath(bucket_path, entry.FileName())};
+        for (const auto& extra_file : entry.File()->extra_files) {
+            if (extra_file) {
+                file_paths.push_back(PathUtil::JoinPath(bucket_path, extra_file.value()));
+            }
+        }
         if (entry.Kind() == FileKind::Add()) {
-            data_files_to_delete->erase(data_file_path);
+            for (const auto& file_path : file_paths) {
+                data_files_to_delete->erase(file_path);
+            }
         } else if (entry.Kind() == FileKind::Delete()) {
-            // TODO(jinli.zjw): do not support extra files
-            data_files_to_delete->insert({data_file_path, entry});
+            for (const auto& file_path : file_paths) {
+                data_files_to_delete->insert({file_path, entry});
+            }
         } else {
             return Status::Invalid(
                 fmt::format("Unknown value kind {}", entry.Kind().ToByteValue()));
@@ -328,6 +421,22 @@ Status ExpireSnapshots::GetManifestSkippingSet(const std::vector<Snapshot>& reta
         if (snapshot.Statistics()) {
             skipping_manifest_set->insert(snapshot.Statistics().value());
         }
+        std::optional<std::string> partition_stats_file = snapshot.PartitionStatsFileName();
+        if (partition_stats_file) {
+            skipping_manifest_set->insert(partition_stats_file.value());
+        }
+        std::optional<std::string> column_sketches_file = snapshot.ColumnSketchesFileName();
+        if (column_sketches_file) {
+            skipping_manifest_set->insert(column_sketches_file.value());
+            PAIMON_ASSIGN_OR_RAISE(
+                TableColumnSketches sketches,
+                ColumnSketchesFile::ReadTableSketches(
+                    fs_, FileStorePathFactory::StatisticsPath(path_factory_->RootPath()),
+                    column_sketches_file.value(), GetDefaultPool()));
+            for (const auto& bucket : sketches.buckets) {
+                skipping_manifest_set->insert(bucket.file_name);
+            }
+        }
     }
     return Status::OK();
 }
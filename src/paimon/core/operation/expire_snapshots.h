@@ -57,8 +57,12 @@ class ExpireSnapshots {
     Result<int32_t> ExpireUntil(int64_t earliest_snapshot_id, int64_t end_exclusive_id);
 
     Status CleanUnusedDataFiles(const std::string& manifest_list_name);
+    Status CleanChangelogFiles(const std::string& changelog_manifest_list_name);
+    void DeleteDataFiles(const std::map<std::string, ManifestEntry>& data_files_to_delete);
     Status CleanUnusedManifests(const std::string& manifest_list_name,
                                 const std::set<std::string>& skipping_sets);
+    void CleanUnusedStatsFiles(const Snapshot& snapshot,
+                               const std::set<std::string>& skipping_sets);
     Status CleanEmptyDirectories();
     Status GetDataFilesToDelete(const std::vector<ManifestEntry>& data_file_entries,
                                 std::map<std::string, ManifestEntry>* data_files_to_delete) const;
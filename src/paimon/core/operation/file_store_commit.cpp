@@ -20,6 +20,7 @@
 #include <utility>
 
 #include "paimon/commit_context.h"
+#include "paimon/commit_message_spool.h"
 #include "paimon/common/types/data_field.h"
 #include "paimon/common/utils/binary_row_partition_computer.h"
 #include "paimon/core/core_options.h"
@@ -27,10 +28,12 @@
 #include "paimon/core/manifest/index_manifest_file.h"
 #include "paimon/core/manifest/manifest_file.h"
 #include "paimon/core/manifest/manifest_list.h"
+#include "paimon/core/manifest/partition_stats_file.h"
 #include "paimon/core/operation/expire_snapshots.h"
 #include "paimon/core/operation/file_store_commit_impl.h"
 #include "paimon/core/schema/schema_manager.h"
 #include "paimon/core/schema/table_schema.h"
+#include "paimon/core/stats/column_sketches_file.h"
 #include "paimon/core/utils/field_mapping.h"
 #include "paimon/core/utils/file_store_path_factory.h"
 #include "paimon/core/utils/snapshot_manager.h"
@@ -117,6 +120,19 @@ Result<std::unique_ptr<FileStoreCommit>> FileStoreCommit::Create(
         IndexManifestFile::Create(options.GetFileSystem(), options.GetManifestFormat(),
                                   options.GetManifestCompression(), path_factory,
                                   ctx->GetMemoryPool(), options));
+    std::shared_ptr<PartitionStatsFile> partition_stats_file;
+    if (options.PartitionStatsFileEnabled()) {
+        PAIMON_ASSIGN_OR_RAISE(
+            partition_stats_file,
+            PartitionStatsFile::Create(options.GetFileSystem(), options.GetManifestFormat(),
+                                       options.GetManifestCompression(), path_factory,
+                                       ctx->GetMemoryPool()));
+    }
+    std::shared_ptr<ColumnSketchesFile> column_sketches_file;
+    if (options.ColumnSketchesEnabled()) {
+        column_sketches_file = std::make_shared<ColumnSketchesFile>(
+            options.GetFileSystem(), path_factory, ctx->GetMemoryPool());
+    }
 
     auto expire_snapshots = std::make_shared<ExpireSnapshots>(
         snapshot_manager, path_factory, manifest_list, manifest_file, options.GetFileSystem(),
@@ -126,7 +142,24 @@ Result<std::unique_ptr<FileStoreCommit>> FileStoreCommit::Create(
         ctx->GetMemoryPool(), ctx->GetExecutor(), arrow_schema, root_path, ctx->GetCommitUser(),
         options, path_factory, std::move(partition_computer), snapshot_manager,
         ctx->IgnoreEmptyCommit(), ctx->UseRESTCatalogCommit(), table_schema.value(), manifest_file,
-        manifest_list, index_manifest_file, expire_snapshots, schema_manager);
+        manifest_list, index_manifest_file, partition_stats_file, column_sketches_file,
+        expire_snapshots, schema_manager);
+}
+
+Status FileStoreCommit::Commit(CommitMessageSpoolReader* spool_reader, int64_t commit_identifier,
+                               std::optional<int64_t> watermark) {
+    if (spool_reader == nullptr) {
+        return Status::Invalid("commit message spool reader is null pointer");
+    }
+    std::vector<std::shared_ptr<CommitMessage>> commit_messages;
+    while (true) {
+        PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<CommitMessage> message, spool_reader->Next());
+        if (message == nullptr) {
+            break;
+        }
+        commit_messages.push_back(std::move(message));
+    }
+    return Commit(commit_messages, commit_identifier, watermark);
 }
 
 }  // namespace paimon
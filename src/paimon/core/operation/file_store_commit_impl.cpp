@@ -19,21 +19,26 @@
 #include <algorithm>
 #include <cstddef>
 #include <future>
+#include <iterator>
 #include <list>
 #include <set>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 
 #include "fmt/format.h"
 #include "fmt/ranges.h"
 #include "paimon/commit_message.h"
+#include "paimon/commit_message_spool.h"
 #include "paimon/common/data/binary_row.h"
 #include "paimon/common/data/blob_utils.h"
 #include "paimon/common/executor/future.h"
 #include "paimon/common/metrics/metrics_impl.h"
 #include "paimon/common/utils/binary_row_partition_computer.h"
 #include "paimon/common/utils/date_time_utils.h"
+#include "paimon/common/utils/path_util.h"
 #include "paimon/common/utils/scope_guard.h"
+#include "paimon/common/utils/string_utils.h"
 #include "paimon/core/catalog/catalog_snapshot_commit.h"
 #include "paimon/core/catalog/renaming_snapshot_commit.h"
 #include "paimon/core/catalog/snapshot_commit.h"
@@ -43,6 +48,7 @@
 #include "paimon/core/io/data_file_meta.h"
 #include "paimon/core/io/data_file_path_factory.h"
 #include "paimon/core/io/data_increment.h"
+#include "paimon/core/io/rolling_file_writer.h"
 #include "paimon/core/manifest/file_entry.h"
 #include "paimon/core/manifest/file_kind.h"
 #include "paimon/core/manifest/file_source.h"
@@ -53,6 +59,7 @@
 #include "paimon/core/manifest/manifest_file_meta.h"
 #include "paimon/core/manifest/manifest_list.h"
 #include "paimon/core/manifest/partition_entry.h"
+#include "paimon/core/manifest/partition_stats_file.h"
 #include "paimon/core/operation/append_only_file_store_scan.h"
 #include "paimon/core/operation/expire_snapshots.h"
 #include "paimon/core/operation/file_store_scan.h"
@@ -61,6 +68,8 @@
 #include "paimon/core/partition/partition_statistics.h"
 #include "paimon/core/schema/schema_manager.h"
 #include "paimon/core/schema/table_schema.h"
+#include "paimon/core/stats/column_sketches.h"
+#include "paimon/core/stats/column_sketches_file.h"
 #include "paimon/core/table/sink/commit_message_impl.h"
 #include "paimon/core/utils/file_store_path_factory.h"
 #include "paimon/core/utils/snapshot_manager.h"
@@ -84,6 +93,8 @@ FileStoreCommitImpl::FileStoreCommitImpl(
     const std::shared_ptr<ManifestFile>& manifest_file,
     const std::shared_ptr<ManifestList>& manifest_list,
     const std::shared_ptr<IndexManifestFile>& index_manifest_file,
+    const std::shared_ptr<PartitionStatsFile>& partition_stats_file,
+    const std::shared_ptr<ColumnSketchesFile>& column_sketches_file,
     const std::shared_ptr<ExpireSnapshots>& expire_snapshots,
     const std::shared_ptr<SchemaManager>& schema_manager)
     : memory_pool_(pool),
@@ -102,6 +113,8 @@ FileStoreCommitImpl::FileStoreCommitImpl(
       manifest_file_(manifest_file),
       manifest_list_(manifest_list),
       index_manifest_file_(index_manifest_file),
+      partition_stats_file_(partition_stats_file),
+      column_sketches_file_(column_sketches_file),
       expire_snapshots_(expire_snapshots),
       schema_manager_(schema_manager),
       metrics_(std::make_shared<MetricsImpl>()),
@@ -126,7 +139,8 @@ Status FileStoreCommitImpl::DropPartition(
     }
     std::string log_msg = fmt::format("Ready to drop partitions {}", partitions);
     PAIMON_LOG_DEBUG(logger_, "%s", log_msg.c_str());
-    return TryOverwrite(partitions, {}, commit_identifier, std::nullopt);
+    return TryOverwrite(partitions, /*changes=*/{}, /*changelog_files=*/{}, commit_identifier,
+                        std::nullopt);
 }
 
 Result<int32_t> FileStoreCommitImpl::FilterAndCommit(
@@ -262,13 +276,15 @@ Status FileStoreCommitImpl::Overwrite(
     std::shared_ptr<ManifestCommittable> committable =
         CreateManifestCommittable(identifier, commit_messages, watermark);
     std::vector<ManifestEntry> append_table_files;
+    std::vector<ManifestEntry> append_changelog_files;
     std::vector<IndexManifestEntry> append_table_index_files;
     PAIMON_RETURN_NOT_OK(CollectChanges(committable->FileCommittables(), &append_table_files,
-                                        &append_table_index_files));
+                                        &append_changelog_files, &append_table_index_files));
     if (!append_table_index_files.empty()) {
         return Status::NotImplemented("Overwrite not support index for now");
     }
-    return TryOverwrite(partitions, append_table_files, identifier, watermark);
+    return TryOverwrite(partitions, append_table_files, append_changelog_files, identifier,
+                        watermark);
 }
 
 Result<int32_t> FileStoreCommitImpl::FilterAndOverwrite(
@@ -283,13 +299,16 @@ Result<int32_t> FileStoreCommitImpl::FilterAndOverwrite(
                            FilterCommitted(committables));
     if (!actual_committables.empty()) {
         std::vector<ManifestEntry> append_table_files;
+        std::vector<ManifestEntry> append_changelog_files;
         std::vector<IndexManifestEntry> append_table_index_files;
         PAIMON_RETURN_NOT_OK(CollectChanges(actual_committables[0]->FileCommittables(),
-                                            &append_table_files, &append_table_index_files));
+                                            &append_table_files, &append_changelog_files,
+                                            &append_table_index_files));
         if (!append_table_index_files.empty()) {
             return Status::NotImplemented("FilterAndOverwrite not support index for now");
         }
-        PAIMON_RETURN_NOT_OK(TryOverwrite(partitions, append_table_files, identifier, watermark));
+        PAIMON_RETURN_NOT_OK(TryOverwrite(partitions, append_table_files, append_changelog_files,
+                                          identifier, watermark));
     }
     return actual_committables.size();
 }
@@ -314,8 +333,8 @@ Result<std::vector<ManifestEntry>> FileStoreCommitImpl::GetAllFiles(
 
 Status FileStoreCommitImpl::TryOverwrite(
     const std::vector<std::map<std::string, std::string>>& partitions,
-    const std::vector<ManifestEntry>& changes, int64_t commit_identifier,
-    std::optional<int64_t> watermark) {
+    const std::vector<ManifestEntry>& changes, const std::vector<ManifestEntry>& changelog_files,
+    int64_t commit_identifier, std::optional<int64_t> watermark) {
     int32_t retry_count = 0;
     while (true) {
         PAIMON_ASSIGN_OR_RAISE(std::optional<Snapshot> latest_snapshot,
@@ -332,7 +351,8 @@ Status FileStoreCommitImpl::TryOverwrite(
         }
         changes_with_overwrite.insert(changes_with_overwrite.end(), changes.begin(), changes.end());
         PAIMON_ASSIGN_OR_RAISE(bool commit_success,
-                               TryCommitOnce(changes_with_overwrite, /*index_entries=*/{},
+                               TryCommitOnce(changes_with_overwrite, changelog_files,
+                                             /*index_entries=*/{},
                                              commit_identifier, watermark,
                                              /*log_offsets=*/{}, /*properties=*/{},
                                              Snapshot::CommitKind::Overwrite(), latest_snapshot,
@@ -354,17 +374,32 @@ Status FileStoreCommitImpl::TryOverwrite(
 Status FileStoreCommitImpl::Commit(const std::shared_ptr<ManifestCommittable>& committable,
                                    bool check_append_files) {
     std::vector<ManifestEntry> append_table_files;
+    std::vector<ManifestEntry> append_changelog_files;
     std::vector<IndexManifestEntry> append_table_index_files;
     PAIMON_RETURN_NOT_OK(CollectChanges(committable->FileCommittables(), &append_table_files,
-                                        &append_table_index_files));
+                                        &append_changelog_files, &append_table_index_files));
+    return CommitChanges(append_table_files, append_changelog_files, append_table_index_files,
+                         committable->Identifier(), committable->Watermark(),
+                         committable->LogOffsets(), committable->Properties(),
+                         check_append_files);
+}
 
+Status FileStoreCommitImpl::CommitChanges(
+    const std::vector<ManifestEntry>& append_table_files,
+    const std::vector<ManifestEntry>& append_changelog_files,
+    const std::vector<IndexManifestEntry>& append_table_index_files, int64_t identifier,
+    std::optional<int64_t> watermark, const std::map<int32_t, int64_t>& log_offsets,
+    const std::map<std::string, std::string>& properties, bool check_append_files) {
     int32_t attempt = 0;
-    if (!ignore_empty_commit_ || !append_table_files.empty() || !append_table_index_files.empty()) {
-        PAIMON_ASSIGN_OR_RAISE(int32_t cnt,
-                               TryCommit(append_table_files, append_table_index_files,
-                                         committable->Identifier(), committable->Watermark(),
-                                         committable->LogOffsets(), committable->Properties(),
-                                         Snapshot::CommitKind::Append(), check_append_files));
+    bool need_conflict_check =
+        check_append_files || HasDeletionVectorsIndex(append_table_index_files);
+    if (!ignore_empty_commit_ || !append_table_files.empty() || !append_changelog_files.empty() ||
+        !append_table_index_files.empty()) {
+        PAIMON_ASSIGN_OR_RAISE(
+            int32_t cnt,
+            TryCommit(append_table_files, append_changelog_files, append_table_index_files,
+                      identifier, watermark, log_offsets, properties,
+                      Snapshot::CommitKind::Append(), need_conflict_check));
         attempt += cnt;
     }
     metrics_->SetCounter(CommitMetrics::LAST_COMMIT_ATTEMPTS, attempt);
@@ -379,13 +414,104 @@ Status FileStoreCommitImpl::Commit(
     return Commit(committable, /*check_append_files=*/false);
 }
 
+Status FileStoreCommitImpl::Commit(CommitMessageSpoolReader* spool_reader, int64_t identifier,
+                                   std::optional<int64_t> watermark) {
+    if (spool_reader == nullptr) {
+        return Status::Invalid("commit message spool reader is null pointer");
+    }
+    if (!options_.RowTrackingEnabled()) {
+        return CommitWrittenChanges(spool_reader, identifier, watermark);
+    }
+    // row ids are assigned to the entries once the snapshot is known, so they can not be written
+    // into manifest files ahead, only the manifest entries of the spooled messages are kept
+    std::vector<ManifestEntry> append_table_files;
+    std::vector<ManifestEntry> append_changelog_files;
+    std::vector<IndexManifestEntry> append_table_index_files;
+    while (true) {
+        PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<CommitMessage> message, spool_reader->Next());
+        if (message == nullptr) {
+            break;
+        }
+        PAIMON_RETURN_NOT_OK(CollectChanges(message, &append_table_files, &append_changelog_files,
+                                            &append_table_index_files));
+    }
+    return CommitChanges(append_table_files, append_changelog_files, append_table_index_files,
+                         identifier, watermark, /*log_offsets=*/{}, /*properties=*/{},
+                         /*check_append_files=*/false);
+}
+
+Status FileStoreCommitImpl::CommitWrittenChanges(CommitMessageSpoolReader* spool_reader,
+                                                 int64_t identifier,
+                                                 std::optional<int64_t> watermark) {
+    // the entries of each decoded message are written into rolling manifest writers and
+    // released, only the index entries are kept in memory
+    WrittenChanges written_changes;
+    std::vector<IndexManifestEntry> append_table_index_files;
+    std::unique_ptr<RollingFileWriter<const ManifestEntry&, ManifestFileMeta>> table_writer =
+        manifest_file_->CreateRollingWriter();
+    std::unique_ptr<RollingFileWriter<const ManifestEntry&, ManifestFileMeta>> changelog_writer =
+        manifest_file_->CreateRollingWriter();
+    ScopeGuard guard([&]() {
+        if (!written_changes.maybe_committed) {
+            table_writer->Abort();
+            changelog_writer->Abort();
+        }
+    });
+    while (true) {
+        PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<CommitMessage> message, spool_reader->Next());
+        if (message == nullptr) {
+            break;
+        }
+        std::vector<ManifestEntry> table_files;
+        std::vector<ManifestEntry> changelog_files;
+        PAIMON_RETURN_NOT_OK(
+            CollectChanges(message, &table_files, &changelog_files, &append_table_index_files));
+        for (const auto& entry : table_files) {
+            PAIMON_RETURN_NOT_OK(table_writer->Write(entry));
+        }
+        for (const auto& entry : changelog_files) {
+            PAIMON_RETURN_NOT_OK(changelog_writer->Write(entry));
+        }
+        PAIMON_RETURN_NOT_OK(
+            PartitionEntry::Merge(table_files, &written_changes.partition_entries));
+        written_changes.record_count_add += ManifestEntry::RecordCountAdd(table_files);
+        written_changes.record_count_delete += ManifestEntry::RecordCountDelete(table_files);
+        written_changes.changelog_record_count += ManifestEntry::RecordCountAdd(changelog_files);
+        if (column_sketches_file_) {
+            PAIMON_RETURN_NOT_OK(
+                CollectSketchedFiles(table_files, &written_changes.sketched_file_changes));
+        }
+    }
+    PAIMON_RETURN_NOT_OK(table_writer->Close());
+    PAIMON_RETURN_NOT_OK(changelog_writer->Close());
+    PAIMON_ASSIGN_OR_RAISE(written_changes.table_manifests, table_writer->GetResult());
+    PAIMON_ASSIGN_OR_RAISE(written_changes.changelog_manifests, changelog_writer->GetResult());
+
+    bool need_conflict_check = HasDeletionVectorsIndex(append_table_index_files);
+    int32_t attempt = 0;
+    if (!ignore_empty_commit_ || !written_changes.table_manifests.empty() ||
+        !written_changes.changelog_manifests.empty() || !append_table_index_files.empty()) {
+        PAIMON_ASSIGN_OR_RAISE(
+            attempt, TryCommit(/*delta_files=*/{}, /*changelog_files=*/{},
+                               append_table_index_files, identifier, watermark,
+                               /*log_offsets=*/{}, /*properties=*/{},
+                               Snapshot::CommitKind::Append(), need_conflict_check,
+                               &written_changes));
+    }
+    guard.Release();
+    metrics_->SetCounter(CommitMetrics::LAST_COMMIT_ATTEMPTS, attempt);
+    return Status::OK();
+}
+
 Result<int32_t> FileStoreCommitImpl::TryCommit(const std::vector<ManifestEntry>& delta_files,
+                                               const std::vector<ManifestEntry>& changelog_files,
                                                const std::vector<IndexManifestEntry>& index_entries,
                                                int64_t identifier, std::optional<int64_t> watermark,
                                                std::map<int32_t, int64_t> log_offsets,
                                                const std::map<std::string, std::string>& properties,
                                                Snapshot::CommitKind commit_kind,
-                                               bool check_append_files) {
+                                               bool check_append_files,
+                                               WrittenChanges* written_changes) {
     int32_t retry_count = 0;
     int64_t start_millis = DateTimeUtils::GetCurrentUTCTimeUs() / 1000;
     while (true) {
@@ -393,8 +519,9 @@ Result<int32_t> FileStoreCommitImpl::TryCommit(const std::vector<ManifestEntry>&
                                snapshot_manager_->LatestSnapshot());
         PAIMON_ASSIGN_OR_RAISE(
             bool commit_success,
-            TryCommitOnce(delta_files, index_entries, identifier, watermark, log_offsets,
-                          properties, commit_kind, latest_snapshot, check_append_files));
+            TryCommitOnce(delta_files, changelog_files, index_entries, identifier, watermark,
+                          log_offsets, properties, commit_kind, latest_snapshot,
+                          check_append_files, written_changes));
         if (commit_success) {
             break;
         }
@@ -458,9 +585,38 @@ Result<std::vector<ManifestEntry>> FileStoreCommitImpl::ReadAllEntriesFromChange
     return plan->Files();
 }
 
-Status FileStoreCommitImpl::NoConflictsOrFail(const std::string& base_commit_user,
-                                              const std::vector<ManifestEntry>& base_entries,
-                                              const std::vector<ManifestEntry>& changes) const {
+Result<std::vector<IndexManifestEntry>> FileStoreCommitImpl::ReadAllIndexEntriesFromChangedBuckets(
+    const Snapshot& latest_snapshot, const std::vector<IndexManifestEntry>& index_files) const {
+    std::vector<IndexManifestEntry> index_entries;
+    const std::optional<std::string>& index_manifest = latest_snapshot.IndexManifest();
+    if (index_files.empty() || index_manifest == std::nullopt) {
+        return index_entries;
+    }
+    std::unordered_set<std::pair<BinaryRow, int32_t>> changed_buckets;
+    for (const IndexManifestEntry& entry : index_files) {
+        changed_buckets.emplace(entry.partition, entry.bucket);
+    }
+    auto filter = [&](const IndexManifestEntry& entry) -> Result<bool> {
+        return changed_buckets.find(std::make_pair(entry.partition, entry.bucket)) !=
+               changed_buckets.end();
+    };
+    PAIMON_RETURN_NOT_OK(
+        index_manifest_file_->Read(index_manifest.value(), filter, &index_entries));
+    return index_entries;
+}
+
+bool FileStoreCommitImpl::HasDeletionVectorsIndex(
+    const std::vector<IndexManifestEntry>& index_files) {
+    return std::any_of(index_files.begin(), index_files.end(), [](const auto& entry) {
+        return entry.index_file->IndexType() == DeletionVectorsIndexFile::DELETION_VECTORS_INDEX;
+    });
+}
+
+Status FileStoreCommitImpl::NoConflictsOrFail(
+    const std::string& base_commit_user, const std::vector<ManifestEntry>& base_entries,
+    const std::vector<ManifestEntry>& changes,
+    const std::vector<IndexManifestEntry>& base_index_entries,
+    const std::vector<IndexManifestEntry>& index_changes) const {
     ScopeGuard guard([&]() {
         PAIMON_LOG_WARN(logger_, "File deletion conflicts detected! Give up committing. %s",
                         base_commit_user.c_str());
@@ -469,11 +625,41 @@ Status FileStoreCommitImpl::NoConflictsOrFail(const std::string& base_commit_use
     all_entries.insert(all_entries.end(), changes.begin(), changes.end());
     std::vector<ManifestEntry> merged_entries;
     PAIMON_RETURN_NOT_OK(FileEntry::MergeEntries(all_entries, &merged_entries));
+    std::unordered_set<std::string> data_file_names;
     for (const auto& entry : merged_entries) {
         if (entry.Kind() == FileKind::Delete()) {
             return Status::Invalid(fmt::format(
                 "Trying to delete file {} which is not previously added.", entry.FileName()));
         }
+        data_file_names.insert(entry.FileName());
+    }
+    // index files in index manifests are always added ones
+    std::unordered_set<std::string> base_index_file_names;
+    for (const auto& entry : base_index_entries) {
+        base_index_file_names.insert(entry.index_file->FileName());
+    }
+    for (const auto& entry : index_changes) {
+        const auto& index_file = entry.index_file;
+        if (entry.kind == FileKind::Delete()) {
+            // e.g. a concurrent commit has already replaced the deletion vectors of the bucket
+            if (base_index_file_names.find(index_file->FileName()) ==
+                base_index_file_names.end()) {
+                return Status::Invalid(
+                    fmt::format("Trying to delete index file {} which is not previously added.",
+                                index_file->FileName()));
+            }
+        } else if (index_file->IndexType() == DeletionVectorsIndexFile::DELETION_VECTORS_INDEX &&
+                   index_file->DvRanges()) {
+            // e.g. a concurrent compaction has already rewritten the deleted rows
+            for (const auto& [data_file_name, _] : index_file->DvRanges().value()) {
+                if (data_file_names.find(data_file_name) == data_file_names.end()) {
+                    return Status::Invalid(fmt::format(
+                        "Deletion vectors of index file {} refer to data file {} which does not "
+                        "exist.",
+                        index_file->FileName(), data_file_name));
+                }
+            }
+        }
     }
     // TODO(yonghao.fyh): check for all LSM level >= 1, key ranges of files do not intersect
     guard.Release();
@@ -482,10 +668,12 @@ Status FileStoreCommitImpl::NoConflictsOrFail(const std::string& base_commit_use
 
 Result<bool> FileStoreCommitImpl::TryCommitOnce(
     const std::vector<ManifestEntry>& delta_entries,
+    const std::vector<ManifestEntry>& changelog_files,
     const std::vector<IndexManifestEntry>& index_entries, int64_t identifier,
     std::optional<int64_t> watermark, std::map<int32_t, int64_t> log_offsets,
     const std::map<std::string, std::string>& properties, Snapshot::CommitKind commit_kind,
-    const std::optional<Snapshot>& latest_snapshot, bool need_conflict_check) {
+    const std::optional<Snapshot>& latest_snapshot, bool need_conflict_check,
+    WrittenChanges* written_changes) {
     std::vector<ManifestEntry> delta_files = delta_entries;
     int64_t start_millis = DateTimeUtils::GetCurrentUTCTimeUs() / 1000;
     int64_t new_snapshot_id = Snapshot::FIRST_SNAPSHOT_ID;
@@ -504,24 +692,41 @@ Result<bool> FileStoreCommitImpl::TryCommitOnce(
     }
 
     if (need_conflict_check && latest_snapshot) {
+        std::vector<ManifestEntry> written_files;
+        if (written_changes) {
+            // written files are only read back for the check, e.g. of deletion vectors
+            for (const auto& manifest : written_changes->table_manifests) {
+                PAIMON_RETURN_NOT_OK(
+                    manifest_file_->Read(manifest.FileName(), /*filter=*/nullptr, &written_files));
+            }
+        }
+        const std::vector<ManifestEntry>& changes = written_changes ? written_files : delta_files;
         std::set<std::map<std::string, std::string>> changed_partitions;
-        PAIMON_ASSIGN_OR_RAISE(changed_partitions, ChangedPartitions(delta_files, index_entries));
+        PAIMON_ASSIGN_OR_RAISE(changed_partitions, ChangedPartitions(changes, index_entries));
         PAIMON_ASSIGN_OR_RAISE(
             std::vector<ManifestEntry> base_data_files,
             ReadAllEntriesFromChangedPartitions(latest_snapshot.value(), changed_partitions));
-        PAIMON_RETURN_NOT_OK(
-            NoConflictsOrFail(latest_snapshot.value().CommitUser(), base_data_files, delta_files));
+        PAIMON_ASSIGN_OR_RAISE(
+            std::vector<IndexManifestEntry> base_index_files,
+            ReadAllIndexEntriesFromChangedBuckets(latest_snapshot.value(), index_entries));
+        PAIMON_RETURN_NOT_OK(NoConflictsOrFail(latest_snapshot.value().CommitUser(),
+                                               base_data_files, changes, base_index_files,
+                                               index_entries));
     }
 
     std::vector<ManifestFileMeta> merge_before_manifests;
     std::vector<ManifestFileMeta> merge_after_manifests;
     std::pair<std::string, int64_t> base_manifest_list;
     std::pair<std::string, int64_t> delta_manifest_list;
+    std::optional<std::pair<std::string, int64_t>> changelog_manifest_list;
+    std::vector<ManifestFileMeta> changelog_manifests;
     std::vector<PartitionEntry> delta_statistics;
     std::string new_snapshot_path;
 
     std::optional<std::string> old_index_manifest;
     std::optional<std::string> index_manifest_name;
+    std::optional<std::string> new_partition_stats_file;
+    std::vector<std::string> new_column_sketches_files;
     ScopeGuard guard([&]() {
         int64_t commit_time = ((DateTimeUtils::GetCurrentUTCTimeUs() / 1000) - start_millis) / 1000;
         PAIMON_LOG_WARN(logger_,
@@ -534,6 +739,22 @@ Result<bool> FileStoreCommitImpl::TryCommitOnce(
         CleanUpTmpManifests(base_manifest_list.first, delta_manifest_list.first,
                             merge_before_manifests, merge_after_manifests, old_index_manifest,
                             index_manifest_name);
+        for (const auto& changelog_manifest : changelog_manifests) {
+            manifest_file_->DeleteQuietly(changelog_manifest.FileName());
+        }
+        if (changelog_manifest_list) {
+            manifest_list_->DeleteQuietly(changelog_manifest_list.value().first);
+        }
+        if (new_partition_stats_file) {
+            partition_stats_file_->DeleteQuietly(new_partition_stats_file.value());
+            PAIMON_LOG_DEBUG(logger_, "delete new partition stats file %s",
+                             new_partition_stats_file.value().c_str());
+        }
+        for (const auto& new_column_sketches_file : new_column_sketches_files) {
+            column_sketches_file_->DeleteQuietly(new_column_sketches_file);
+            PAIMON_LOG_DEBUG(logger_, "delete new column sketches file %s",
+                             new_column_sketches_file.c_str());
+        }
     });
     int64_t next_row_id_start = first_row_id_start;
     int64_t previous_total_record_count = 0;
@@ -590,28 +811,76 @@ Result<bool> FileStoreCommitImpl::TryCommitOnce(
 
     // the added records subtract the deleted records from
     int64_t delta_record_count =
-        ManifestEntry::RecordCountAdd(delta_files) - ManifestEntry::RecordCountDelete(delta_files);
+        written_changes
+            ? written_changes->record_count_add - written_changes->record_count_delete
+            : ManifestEntry::RecordCountAdd(delta_files) -
+                  ManifestEntry::RecordCountDelete(delta_files);
     int64_t total_record_count = previous_total_record_count + delta_record_count;
 
     // write new delta files into manifest files
     std::unordered_map<BinaryRow, PartitionEntry> partition_entry_map;
-    PAIMON_RETURN_NOT_OK(PartitionEntry::Merge(delta_files, &partition_entry_map));
-    delta_statistics.reserve(partition_entry_map.size());
-    for (const auto& [_, partition_entry] : partition_entry_map) {
+    if (!written_changes) {
+        PAIMON_RETURN_NOT_OK(PartitionEntry::Merge(delta_files, &partition_entry_map));
+    }
+    const std::unordered_map<BinaryRow, PartitionEntry>& delta_partition_entries =
+        written_changes ? written_changes->partition_entries : partition_entry_map;
+    delta_statistics.reserve(delta_partition_entries.size());
+    for (const auto& [_, partition_entry] : delta_partition_entries) {
         delta_statistics.push_back(partition_entry);
     }
-    PAIMON_ASSIGN_OR_RAISE(std::vector<ManifestFileMeta> new_changes_manifests,
-                           manifest_file_->Write(delta_files));
-    merge_after_manifests.insert(merge_after_manifests.end(), new_changes_manifests.begin(),
-                                 new_changes_manifests.end());
+    std::vector<ManifestFileMeta> new_changes_manifests;
+    if (written_changes) {
+        // the written manifests are cleaned up by the caller if the commit fails at last
+        new_changes_manifests = written_changes->table_manifests;
+    } else {
+        PAIMON_ASSIGN_OR_RAISE(new_changes_manifests, manifest_file_->Write(delta_files));
+        merge_after_manifests.insert(merge_after_manifests.end(), new_changes_manifests.begin(),
+                                     new_changes_manifests.end());
+    }
     PAIMON_ASSIGN_OR_RAISE(delta_manifest_list, manifest_list_->Write(new_changes_manifests));
 
+    // write changelog into manifest files
+    int64_t changelog_record_count = 0;
+    if (written_changes) {
+        if (!written_changes->changelog_manifests.empty()) {
+            PAIMON_ASSIGN_OR_RAISE(changelog_manifest_list,
+                                   manifest_list_->Write(written_changes->changelog_manifests));
+            changelog_record_count = written_changes->changelog_record_count;
+        }
+    } else if (!changelog_files.empty()) {
+        PAIMON_ASSIGN_OR_RAISE(changelog_manifests, manifest_file_->Write(changelog_files));
+        PAIMON_ASSIGN_OR_RAISE(changelog_manifest_list, manifest_list_->Write(changelog_manifests));
+        changelog_record_count = ManifestEntry::RecordCountAdd(changelog_files);
+    }
+
     PAIMON_ASSIGN_OR_RAISE(index_manifest_name, index_manifest_file_->WriteIndexFiles(
                                                     old_index_manifest, index_entries));
 
-    std::optional<std::pair<std::string, int64_t>> changelog_manifest_list;
+    std::map<std::string, std::string> snapshot_properties = properties;
+    if (partition_stats_file_) {
+        PAIMON_ASSIGN_OR_RAISE(
+            auto partition_stats,
+            WritePartitionStats(latest_snapshot, merged_metas, delta_statistics));
+        if (partition_stats.second) {
+            new_partition_stats_file = partition_stats.first;
+        }
+        snapshot_properties[Snapshot::PROPERTY_PARTITION_STATS_FILE] = partition_stats.first;
+    }
+    if (column_sketches_file_) {
+        SketchedFileChanges sketched_file_changes;
+        if (!written_changes) {
+            PAIMON_RETURN_NOT_OK(CollectSketchedFiles(delta_files, &sketched_file_changes));
+        }
+        PAIMON_ASSIGN_OR_RAISE(
+            auto column_sketches,
+            WriteColumnSketches(latest_snapshot, merged_metas,
+                                written_changes ? written_changes->sketched_file_changes
+                                                : sketched_file_changes));
+        new_column_sketches_files = std::move(column_sketches.second);
+        snapshot_properties[Snapshot::PROPERTY_COLUMN_SKETCHES_FILE] = column_sketches.first;
+    }
+
     std::optional<std::string> statistics;
-    int64_t changelog_record_count = 0;
     int64_t schema_id = 0;
     PAIMON_ASSIGN_OR_RAISE(std::optional<std::shared_ptr<TableSchema>> table_schema,
                            schema_manager_->Latest());
@@ -629,8 +898,9 @@ Result<bool> FileStoreCommitImpl::TryCommitOnce(
         index_manifest_name, commit_user_, identifier, commit_kind,
         DateTimeUtils::GetCurrentUTCTimeUs() / 1000, log_offsets, total_record_count,
         delta_record_count, changelog_record_count, watermark, statistics,
-        properties.empty() ? std::nullopt
-                           : std::optional<std::map<std::string, std::string>>(properties),
+        snapshot_properties.empty()
+            ? std::nullopt
+            : std::optional<std::map<std::string, std::string>>(snapshot_properties),
         next_row_id_start);
 
     Result<bool> commit_result = CommitSnapshotImpl(new_snapshot, delta_statistics);
@@ -647,6 +917,9 @@ Result<bool> FileStoreCommitImpl::TryCommitOnce(
         // as it may delete meta files from a snapshot that was just written by ourselves,
         // leading to an incomplete or corrupted snapshot.
         guard.Release();
+        if (written_changes) {
+            written_changes->maybe_committed = true;
+        }
         return Status::Invalid("You need call FilterAndCommit to retry commit for exception. ",
                                commit_result.status().ToString());
     }
@@ -734,6 +1007,283 @@ Result<bool> FileStoreCommitImpl::CommitSnapshotImpl(
     return commit_result;
 }
 
+Result<std::pair<std::string, bool>> FileStoreCommitImpl::WritePartitionStats(
+    const std::optional<Snapshot>& latest_snapshot,
+    const std::vector<ManifestFileMeta>& base_manifests,
+    const std::vector<PartitionEntry>& delta_statistics) {
+    std::vector<PartitionEntry> base_statistics;
+    if (latest_snapshot) {
+        std::optional<std::string> previous_stats_file =
+            latest_snapshot.value().PartitionStatsFileName();
+        if (previous_stats_file) {
+            if (delta_statistics.empty()) {
+                // nothing changed, share the stats file with the previous snapshot
+                return std::make_pair(previous_stats_file.value(), false);
+            }
+            PAIMON_ASSIGN_OR_RAISE(base_statistics,
+                                   partition_stats_file_->ReadAll(previous_stats_file.value()));
+        } else {
+            // bootstrap from manifests, only happens on the first commit after enabling
+            std::unordered_map<BinaryRow, PartitionEntry> partition_entry_map;
+            for (const auto& manifest : base_manifests) {
+                std::vector<ManifestEntry> entries;
+                PAIMON_RETURN_NOT_OK(manifest_file_->Read(manifest.FileName(),
+                                                          /*filter=*/nullptr, &entries));
+                PAIMON_RETURN_NOT_OK(PartitionEntry::Merge(entries, &partition_entry_map));
+            }
+            base_statistics.reserve(partition_entry_map.size());
+            for (const auto& [_, partition_entry] : partition_entry_map) {
+                base_statistics.push_back(partition_entry);
+            }
+        }
+    }
+    PAIMON_ASSIGN_OR_RAISE(
+        std::string stats_file,
+        partition_stats_file_->Write(PartitionStatsFile::Apply(base_statistics, delta_statistics)));
+    return std::make_pair(stats_file, true);
+}
+
+Status FileStoreCommitImpl::CollectSketchedFiles(const std::vector<ManifestEntry>& entries,
+                                                 SketchedFileChanges* changes) const {
+    for (const auto& entry : entries) {
+        if (BlobUtils::IsBlobFile(entry.FileName())) {
+            continue;
+        }
+        BucketFileChanges& bucket_changes = (*changes)[{entry.Partition(), entry.Bucket()}];
+        if (entry.Kind() == FileKind::Delete()) {
+            bucket_changes.deleted_files.push_back(entry.FileName());
+            continue;
+        }
+        std::optional<std::string> sketch_path;
+        for (const auto& extra_file : entry.File()->extra_files) {
+            if (extra_file && StringUtils::EndsWith(extra_file.value(),
+                                                    DataFilePathFactory::SKETCH_PATH_SUFFIX)) {
+                // sketch files are aligned with their data files, see
+                // `DataFilePathFactory::ToAlignedPath`
+                std::optional<std::string> external_dir = entry.File()->ExternalPathDir();
+                if (external_dir) {
+                    sketch_path = PathUtil::JoinPath(external_dir.value(), extra_file.value());
+                } else {
+                    PAIMON_ASSIGN_OR_RAISE(
+                        std::string bucket_path,
+                        path_factory_->BucketPath(entry.Partition(), entry.Bucket()));
+                    sketch_path = PathUtil::JoinPath(bucket_path, extra_file.value());
+                }
+                break;
+            }
+        }
+        bucket_changes.added_files.emplace_back(entry.FileName(), std::move(sketch_path));
+    }
+    return Status::OK();
+}
+
+Result<ColumnSketches> FileStoreCommitImpl::MergeFileSketches(
+    const std::vector<std::string>& sketch_paths) const {
+    std::vector<std::future<Result<ColumnSketches>>> futures;
+    futures.reserve(sketch_paths.size());
+    for (const auto& sketch_path : sketch_paths) {
+        futures.push_back(Via(executor_.get(), [this, sketch_path]() -> Result<ColumnSketches> {
+            return ColumnSketchesFile::ReadFileSketches(fs_, sketch_path, memory_pool_);
+        }));
+    }
+    ColumnSketches merged;
+    for (auto& file_sketches : CollectAll(futures)) {
+        if (!file_sketches.ok()) {
+            return file_sketches.status();
+        }
+        PAIMON_RETURN_NOT_OK(merged.Merge(file_sketches.value()));
+    }
+    return merged;
+}
+
+Status FileStoreCommitImpl::ApplySketchedFileChanges(const BucketFileChanges& changes,
+                                                     BucketColumnSketches* sketches,
+                                                     ColumnSketches* added_sketches,
+                                                     bool* sketched_file_deleted) const {
+    std::unordered_set<std::string> deleted_files(changes.deleted_files.begin(),
+                                                  changes.deleted_files.end());
+    std::vector<std::string> added_unsketched_files;
+    std::vector<std::pair<std::string, std::string>> added_sketched_files;
+    for (const auto& [file_name, sketch_path] : changes.added_files) {
+        if (deleted_files.erase(file_name) > 0) {
+            // a file deleted and added again (e.g. upgraded to another level) keeps its sketches
+            continue;
+        }
+        if (sketch_path) {
+            added_sketched_files.emplace_back(file_name, sketch_path.value());
+        } else {
+            added_unsketched_files.push_back(file_name);
+        }
+    }
+
+    if (!deleted_files.empty()) {
+        auto& sketched_files = sketches->sketched_files;
+        size_t sketched_file_count = sketched_files.size();
+        sketched_files.erase(std::remove_if(sketched_files.begin(), sketched_files.end(),
+                                            [&](const auto& sketched_file) {
+                                                return deleted_files.count(sketched_file.first) > 0;
+                                            }),
+                             sketched_files.end());
+        auto& unsketched_files = sketches->unsketched_files;
+        unsketched_files.erase(std::remove_if(unsketched_files.begin(), unsketched_files.end(),
+                                              [&](const std::string& unsketched_file) {
+                                                  return deleted_files.count(unsketched_file) > 0;
+                                              }),
+                               unsketched_files.end());
+        if (sketched_files.size() != sketched_file_count) {
+            *sketched_file_deleted = true;
+            std::vector<std::string> sketch_paths;
+            sketch_paths.reserve(sketched_files.size());
+            for (const auto& [_, sketch_path] : sketched_files) {
+                sketch_paths.push_back(sketch_path);
+            }
+            PAIMON_ASSIGN_OR_RAISE(sketches->merged, MergeFileSketches(sketch_paths));
+        }
+    }
+
+    if (!added_sketched_files.empty()) {
+        std::vector<std::string> sketch_paths;
+        sketch_paths.reserve(added_sketched_files.size());
+        for (const auto& [_, sketch_path] : added_sketched_files) {
+            sketch_paths.push_back(sketch_path);
+        }
+        PAIMON_ASSIGN_OR_RAISE(ColumnSketches merged, MergeFileSketches(sketch_paths));
+        PAIMON_RETURN_NOT_OK(sketches->merged.Merge(merged));
+        PAIMON_RETURN_NOT_OK(added_sketches->Merge(merged));
+        sketches->sketched_files.insert(sketches->sketched_files.end(),
+                                        std::make_move_iterator(added_sketched_files.begin()),
+                                        std::make_move_iterator(added_sketched_files.end()));
+    }
+    sketches->unsketched_files.insert(sketches->unsketched_files.end(),
+                                      std::make_move_iterator(added_unsketched_files.begin()),
+                                      std::make_move_iterator(added_unsketched_files.end()));
+    return Status::OK();
+}
+
+Result<std::pair<std::string, std::vector<std::string>>> FileStoreCommitImpl::WriteColumnSketches(
+    const std::optional<Snapshot>& latest_snapshot,
+    const std::vector<ManifestFileMeta>& base_manifests,
+    const SketchedFileChanges& changes) const {
+    TableColumnSketches table_sketches;
+    // new sketches of the changed buckets
+    std::unordered_map<std::pair<BinaryRow, int32_t>, BucketColumnSketches> changed_buckets;
+    // whether the merged sketches of the table are rebuilt from the sketches of all buckets
+    bool rebuild_merged = false;
+    ColumnSketches added_sketches;
+    if (latest_snapshot) {
+        std::optional<std::string> previous_sketches_file =
+            latest_snapshot.value().ColumnSketchesFileName();
+        if (previous_sketches_file) {
+            if (changes.empty()) {
+                // nothing changed, share the sketches file with the previous snapshot
+                return std::make_pair(previous_sketches_file.value(), std::vector<std::string>());
+            }
+            PAIMON_ASSIGN_OR_RAISE(table_sketches, column_sketches_file_->ReadTableSketches(
+                                                       previous_sketches_file.value()));
+        } else {
+            // the sketches are rebuilt from the live files once, e.g. on the first commit after
+            // enabling, files committed before are unsketched
+            std::vector<ManifestEntry> entries;
+            for (const auto& manifest : base_manifests) {
+                PAIMON_RETURN_NOT_OK(
+                    manifest_file_->Read(manifest.FileName(), /*filter=*/nullptr, &entries));
+            }
+            std::vector<ManifestEntry> live_entries;
+            PAIMON_RETURN_NOT_OK(FileEntry::MergeEntries(entries, &live_entries));
+            SketchedFileChanges live_files;
+            PAIMON_RETURN_NOT_OK(CollectSketchedFiles(live_entries, &live_files));
+            for (const auto& [bucket, bucket_changes] : live_files) {
+                bool sketched_file_deleted = false;
+                PAIMON_RETURN_NOT_OK(ApplySketchedFileChanges(bucket_changes,
+                                                              &changed_buckets[bucket],
+                                                              &added_sketches,
+                                                              &sketched_file_deleted));
+            }
+            rebuild_merged = true;
+        }
+    }
+
+    std::unordered_map<std::pair<BinaryRow, int32_t>, size_t> bucket_indexes;
+    for (size_t i = 0; i < table_sketches.buckets.size(); ++i) {
+        const TableColumnSketches::Bucket& bucket = table_sketches.buckets[i];
+        bucket_indexes.emplace(std::make_pair(bucket.partition, bucket.bucket), i);
+    }
+    for (const auto& [bucket, bucket_changes] : changes) {
+        auto [iter, inserted] = changed_buckets.try_emplace(bucket);
+        auto index = bucket_indexes.find(bucket);
+        if (inserted && index != bucket_indexes.end()) {
+            PAIMON_ASSIGN_OR_RAISE(iter->second,
+                                   column_sketches_file_->ReadBucketSketches(
+                                       table_sketches.buckets[index->second].file_name));
+        }
+        bool sketched_file_deleted = false;
+        PAIMON_RETURN_NOT_OK(ApplySketchedFileChanges(bucket_changes, &iter->second,
+                                                      &added_sketches, &sketched_file_deleted));
+        rebuild_merged = rebuild_merged || sketched_file_deleted;
+    }
+
+    std::vector<std::string> new_files;
+    ScopeGuard guard([&]() {
+        for (const auto& new_file : new_files) {
+            column_sketches_file_->DeleteQuietly(new_file);
+        }
+    });
+    // write the sketches of the changed buckets, buckets without live files are dropped
+    std::unordered_map<std::pair<BinaryRow, int32_t>, TableColumnSketches::Bucket> new_buckets;
+    for (const auto& [bucket, bucket_sketches] : changed_buckets) {
+        if (bucket_sketches.sketched_files.empty() && bucket_sketches.unsketched_files.empty()) {
+            continue;
+        }
+        PAIMON_ASSIGN_OR_RAISE(std::string bucket_sketches_file,
+                               column_sketches_file_->WriteBucketSketches(bucket_sketches));
+        new_files.push_back(bucket_sketches_file);
+        new_buckets.emplace(bucket, TableColumnSketches::Bucket{
+                                        bucket.first, bucket.second, bucket_sketches_file,
+                                        !bucket_sketches.unsketched_files.empty()});
+    }
+    // keep the order of the buckets stable, new buckets are appended at the end
+    std::vector<TableColumnSketches::Bucket> buckets;
+    buckets.reserve(table_sketches.buckets.size() + new_buckets.size());
+    for (auto& bucket : table_sketches.buckets) {
+        std::pair<BinaryRow, int32_t> key(bucket.partition, bucket.bucket);
+        if (changed_buckets.count(key) == 0) {
+            buckets.push_back(std::move(bucket));
+            continue;
+        }
+        auto new_bucket = new_buckets.find(key);
+        if (new_bucket != new_buckets.end()) {
+            buckets.push_back(std::move(new_bucket->second));
+            new_buckets.erase(new_bucket);
+        }
+    }
+    for (auto& [_, new_bucket] : new_buckets) {
+        buckets.push_back(std::move(new_bucket));
+    }
+    table_sketches.buckets = std::move(buckets);
+
+    if (rebuild_merged) {
+        ColumnSketches merged;
+        for (const auto& bucket : table_sketches.buckets) {
+            auto changed_bucket = changed_buckets.find({bucket.partition, bucket.bucket});
+            if (changed_bucket != changed_buckets.end()) {
+                PAIMON_RETURN_NOT_OK(merged.Merge(changed_bucket->second.merged));
+            } else {
+                PAIMON_ASSIGN_OR_RAISE(BucketColumnSketches bucket_sketches,
+                                       column_sketches_file_->ReadBucketSketches(bucket.file_name));
+                PAIMON_RETURN_NOT_OK(merged.Merge(bucket_sketches.merged));
+            }
+        }
+        table_sketches.merged = std::move(merged);
+    } else {
+        PAIMON_RETURN_NOT_OK(table_sketches.merged.Merge(added_sketches));
+    }
+    PAIMON_ASSIGN_OR_RAISE(std::string sketches_file,
+                           column_sketches_file_->WriteTableSketches(table_sketches));
+    new_files.push_back(sketches_file);
+    guard.Release();
+    return std::make_pair(sketches_file, std::move(new_files));
+}
+
 void FileStoreCommitImpl::CleanUpTmpManifests(
     const std::string& base_manifest_list_name, const std::string& delta_manifest_list_name,
     const std::vector<ManifestFileMeta>& merge_before_manifests,
@@ -782,33 +1332,44 @@ std::shared_ptr<ManifestCommittable> FileStoreCommitImpl::CreateManifestCommitta
 Status FileStoreCommitImpl::CollectChanges(
     const std::vector<std::shared_ptr<CommitMessage>>& commit_messages,
     std::vector<ManifestEntry>* append_table_files,
+    std::vector<ManifestEntry>* append_changelog_files,
     std::vector<IndexManifestEntry>* append_table_index_files) {
     for (const auto& message : commit_messages) {
-        auto commit_message = std::dynamic_pointer_cast<CommitMessageImpl>(message);
-        if (commit_message) {
-            DataIncrement new_files_increment = commit_message->GetNewFilesIncrement();
-            for (const std::shared_ptr<DataFileMeta>& new_file : new_files_increment.NewFiles()) {
-                append_table_files->push_back(MakeEntry(FileKind::Add(), commit_message, new_file));
-            }
-            for (const std::shared_ptr<DataFileMeta>& deleted_file :
-                 new_files_increment.DeletedFiles()) {
-                append_table_files->push_back(
-                    MakeEntry(FileKind::Delete(), commit_message, deleted_file));
-            }
-            for (const std::shared_ptr<IndexFileMeta>& deleted_index_file :
-                 new_files_increment.DeletedIndexFiles()) {
-                append_table_index_files->emplace_back(
-                    FileKind::Delete(), commit_message->Partition(), commit_message->Bucket(),
-                    deleted_index_file);
-            }
-            for (const std::shared_ptr<IndexFileMeta>& new_index_file :
-                 new_files_increment.NewIndexFiles()) {
-                append_table_index_files->emplace_back(FileKind::Add(), commit_message->Partition(),
-                                                       commit_message->Bucket(), new_index_file);
-            }
-        } else {
-            return Status::Invalid("fail to cast commit message to commit message impl");
-        }
+        PAIMON_RETURN_NOT_OK(CollectChanges(message, append_table_files, append_changelog_files,
+                                            append_table_index_files));
+    }
+    return Status::OK();
+}
+
+Status FileStoreCommitImpl::CollectChanges(
+    const std::shared_ptr<CommitMessage>& message, std::vector<ManifestEntry>* append_table_files,
+    std::vector<ManifestEntry>* append_changelog_files,
+    std::vector<IndexManifestEntry>* append_table_index_files) {
+    auto commit_message = std::dynamic_pointer_cast<CommitMessageImpl>(message);
+    if (!commit_message) {
+        return Status::Invalid("fail to cast commit message to commit message impl");
+    }
+    const DataIncrement& new_files_increment = commit_message->GetNewFilesIncrement();
+    for (const std::shared_ptr<DataFileMeta>& new_file : new_files_increment.NewFiles()) {
+        append_table_files->push_back(MakeEntry(FileKind::Add(), commit_message, new_file));
+    }
+    for (const std::shared_ptr<DataFileMeta>& deleted_file : new_files_increment.DeletedFiles()) {
+        append_table_files->push_back(MakeEntry(FileKind::Delete(), commit_message, deleted_file));
+    }
+    for (const std::shared_ptr<DataFileMeta>& changelog_file :
+         new_files_increment.ChangelogFiles()) {
+        append_changelog_files->push_back(
+            MakeEntry(FileKind::Add(), commit_message, changelog_file));
+    }
+    for (const std::shared_ptr<IndexFileMeta>& deleted_index_file :
+         new_files_increment.DeletedIndexFiles()) {
+        append_table_index_files->emplace_back(FileKind::Delete(), commit_message->Partition(),
+                                               commit_message->Bucket(), deleted_index_file);
+    }
+    for (const std::shared_ptr<IndexFileMeta>& new_index_file :
+         new_files_increment.NewIndexFiles()) {
+        append_table_index_files->emplace_back(FileKind::Add(), commit_message->Partition(),
+                                               commit_message->Bucket(), new_index_file);
     }
     return Status::OK();
 }
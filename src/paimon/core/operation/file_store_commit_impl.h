@@ -22,11 +22,14 @@
 #include <optional>
 #include <set>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "paimon/common/options/memory_size.h"
 #include "paimon/core/catalog/snapshot_commit.h"
 #include "paimon/core/core_options.h"
+#include "paimon/core/manifest/manifest_file_meta.h"
 #include "paimon/core/manifest/partition_entry.h"
 #include "paimon/core/snapshot.h"
 #include "paimon/file_store_commit.h"
@@ -43,6 +46,8 @@ class Schema;
 
 namespace paimon {
 
+struct BucketColumnSketches;
+class ColumnSketches;
 class CommitContext;
 class CommitMessageImpl;
 struct DataFileMeta;
@@ -56,11 +61,14 @@ class IndexManifestFile;
 struct IndexManifestEntry;
 class ManifestList;
 class ManifestFileMeta;
+class PartitionStatsFile;
+class ColumnSketchesFile;
 class SnapshotManager;
 class SchemaManager;
 class TableSchema;
 class BinaryRowPartitionComputer;
 class CommitMessage;
+class CommitMessageSpoolReader;
 class Executor;
 class FileSystem;
 class Logger;
@@ -84,6 +92,8 @@ class FileStoreCommitImpl : public FileStoreCommit {
                         const std::shared_ptr<ManifestFile>& manifest_file,
                         const std::shared_ptr<ManifestList>& manifest_list,
                         const std::shared_ptr<IndexManifestFile>& index_manifest_file,
+                        const std::shared_ptr<PartitionStatsFile>& partition_stats_file,
+                        const std::shared_ptr<ColumnSketchesFile>& column_sketches_file,
                         const std::shared_ptr<ExpireSnapshots>& expire_snapshots,
                         const std::shared_ptr<SchemaManager>& schema_manager);
     ~FileStoreCommitImpl() override;
@@ -92,6 +102,9 @@ class FileStoreCommitImpl : public FileStoreCommit {
                   int64_t commit_identifier,
                   std::optional<int64_t> watermark = std::nullopt) override;
 
+    Status Commit(CommitMessageSpoolReader* spool_reader, int64_t commit_identifier,
+                  std::optional<int64_t> watermark = std::nullopt) override;
+
     Result<int32_t> FilterAndCommit(
         const std::map<int64_t, std::vector<std::shared_ptr<CommitMessage>>>&
             commit_identifier_and_messages,
@@ -121,12 +134,51 @@ class FileStoreCommitImpl : public FileStoreCommit {
     Status Init(std::unique_ptr<CommitContext> ctx);
 
  private:
+    /// Deleted and added table files of a bucket, collected for the column sketches.
+    struct BucketFileChanges {
+        std::vector<std::string> deleted_files;
+        // names of the added files with the paths of their sketch files, std::nullopt if the
+        // file is not sketched
+        std::vector<std::pair<std::string, std::optional<std::string>>> added_files;
+    };
+    using SketchedFileChanges =
+        std::unordered_map<std::pair<BinaryRow, int32_t>, BucketFileChanges>;
+
+    /// Table and changelog files of a commit which are written into manifest files while they
+    /// are collected, together with what the snapshot needs to know about them.
+    struct WrittenChanges {
+        std::vector<ManifestFileMeta> table_manifests;
+        std::vector<ManifestFileMeta> changelog_manifests;
+        std::unordered_map<BinaryRow, PartitionEntry> partition_entries;
+        int64_t record_count_add = 0;
+        int64_t record_count_delete = 0;
+        int64_t changelog_record_count = 0;
+        // table files for the column sketches, only collected if column sketches are enabled
+        SketchedFileChanges sketched_file_changes;
+        // set if the snapshot may have been committed though the commit failed, the manifests
+        // must be kept then
+        bool maybe_committed = false;
+    };
+
     Status Commit(const std::shared_ptr<ManifestCommittable>& manifest_committable,
                   bool check_append_files);
 
+    /// Commit the changes of `spool_reader`, writing them into manifest files while it is read.
+    Status CommitWrittenChanges(CommitMessageSpoolReader* spool_reader, int64_t identifier,
+                                std::optional<int64_t> watermark);
+
+    Status CommitChanges(const std::vector<ManifestEntry>& append_table_files,
+                         const std::vector<ManifestEntry>& append_changelog_files,
+                         const std::vector<IndexManifestEntry>& append_table_index_files,
+                         int64_t identifier, std::optional<int64_t> watermark,
+                         const std::map<int32_t, int64_t>& log_offsets,
+                         const std::map<std::string, std::string>& properties,
+                         bool check_append_files);
+
     Status TryOverwrite(const std::vector<std::map<std::string, std::string>>& partition,
-                        const std::vector<ManifestEntry>& changes, int64_t commit_identifier,
-                        std::optional<int64_t> watermark);
+                        const std::vector<ManifestEntry>& changes,
+                        const std::vector<ManifestEntry>& changelog_files,
+                        int64_t commit_identifier, std::optional<int64_t> watermark);
 
     Result<std::vector<ManifestEntry>> GetAllFiles(
         const Snapshot& snapshot,
@@ -145,26 +197,83 @@ class FileStoreCommitImpl : public FileStoreCommit {
 
     Status CollectChanges(const std::vector<std::shared_ptr<CommitMessage>>& commit_messages,
                           std::vector<ManifestEntry>* append_table_files,
+                          std::vector<ManifestEntry>* append_changelog_files,
+                          std::vector<IndexManifestEntry>* append_table_index_files);
+
+    Status CollectChanges(const std::shared_ptr<CommitMessage>& message,
+                          std::vector<ManifestEntry>* append_table_files,
+                          std::vector<ManifestEntry>* append_changelog_files,
                           std::vector<IndexManifestEntry>* append_table_index_files);
 
     Result<int32_t> TryCommit(const std::vector<ManifestEntry>& delta_files,
+                              const std::vector<ManifestEntry>& changelog_files,
                               const std::vector<IndexManifestEntry>& index_entries,
                               int64_t identifier, std::optional<int64_t> watermark,
                               std::map<int32_t, int64_t> log_offsets,
                               const std::map<std::string, std::string>& properties,
-                              Snapshot::CommitKind commit_kind, bool check_append_files);
+                              Snapshot::CommitKind commit_kind, bool check_append_files,
+                              WrittenChanges* written_changes = nullptr);
+
+    /// @param written_changes Changes already written into manifest files, which replace
+    /// `delta_files` and `changelog_files` if not nullptr.
     Result<bool> TryCommitOnce(const std::vector<ManifestEntry>& delta_files,
+                               const std::vector<ManifestEntry>& changelog_files,
                                const std::vector<IndexManifestEntry>& index_entries,
                                int64_t commit_identifier, std::optional<int64_t> watermark,
                                std::map<int32_t, int64_t> log_offsets,
                                const std::map<std::string, std::string>& properties,
                                Snapshot::CommitKind commit_kind,
                                const std::optional<Snapshot>& latest_snapshot,
-                               bool need_conflict_check);
+                               bool need_conflict_check,
+                               WrittenChanges* written_changes = nullptr);
 
     Result<bool> CommitSnapshotImpl(const Snapshot& new_snapshot,
                                     const std::vector<PartitionEntry>& delta_statistics);
 
+    /// Write the column sketches file of the new snapshot by applying the deleted and added
+    /// table files of a commit to the column sketches of `latest_snapshot`. Only the sketches of
+    /// the changed buckets are rewritten. If `latest_snapshot` has no column sketches file (e.g.
+    /// it was committed before the feature was enabled), the sketches are rebuilt from the live
+    /// files in `base_manifests` once.
+    ///
+    /// @return The sketches file name of the new snapshot and the files newly written by this
+    /// call.
+    Result<std::pair<std::string, std::vector<std::string>>> WriteColumnSketches(
+        const std::optional<Snapshot>& latest_snapshot,
+        const std::vector<ManifestFileMeta>& base_manifests,
+        const SketchedFileChanges& changes) const;
+
+    /// Apply `changes` to the sketches of a bucket. Sketches can not be subtracted, so the
+    /// sketches of the bucket are rebuilt from the sketch files of its live files if sketched
+    /// files are deleted.
+    ///
+    /// @param added_sketches Merged with the sketches of the added files.
+    /// @param sketched_file_deleted Set to true if sketched files are deleted.
+    Status ApplySketchedFileChanges(const BucketFileChanges& changes,
+                                    BucketColumnSketches* sketches, ColumnSketches* added_sketches,
+                                    bool* sketched_file_deleted) const;
+
+    /// @return The merged sketches of the sketch files at `sketch_paths`, which are read in
+    /// parallel.
+    Result<ColumnSketches> MergeFileSketches(const std::vector<std::string>& sketch_paths) const;
+
+    /// Collect the table files of `entries` by bucket, blob files are skipped since their rows
+    /// are sketched with the data files they belong to.
+    Status CollectSketchedFiles(const std::vector<ManifestEntry>& entries,
+                                SketchedFileChanges* changes) const;
+
+    /// Write the partition stats file of the new snapshot by applying `delta_statistics` to the
+    /// partition stats of `latest_snapshot`. If `latest_snapshot` has no partition stats file
+    /// (e.g. it was committed before the feature was enabled), the stats are rebuilt from
+    /// `base_manifests` once.
+    ///
+    /// @return The stats file name of the new snapshot and whether it is newly written by this
+    /// call.
+    Result<std::pair<std::string, bool>> WritePartitionStats(
+        const std::optional<Snapshot>& latest_snapshot,
+        const std::vector<ManifestFileMeta>& base_manifests,
+        const std::vector<PartitionEntry>& delta_statistics);
+
     void CleanUpTmpManifests(const std::string& previous_changes_list_name,
                              const std::string& new_changes_list_name,
                              const std::vector<ManifestFileMeta>& old_metas,
@@ -176,9 +285,18 @@ class FileStoreCommitImpl : public FileStoreCommit {
         const Snapshot& latest_snapshot,
         const std::set<std::map<std::string, std::string>>& partitions) const;
 
+    Result<std::vector<IndexManifestEntry>> ReadAllIndexEntriesFromChangedBuckets(
+        const Snapshot& latest_snapshot, const std::vector<IndexManifestEntry>& index_files) const;
+
+    /// Deletion vectors must always be checked against the latest snapshot, as they are only valid
+    /// for the index files they replace and the data files they refer to.
+    static bool HasDeletionVectorsIndex(const std::vector<IndexManifestEntry>& index_files);
+
     Status NoConflictsOrFail(const std::string& base_commit_user,
                              const std::vector<ManifestEntry>& base_entries,
-                             const std::vector<ManifestEntry>& changes) const;
+                             const std::vector<ManifestEntry>& changes,
+                             const std::vector<IndexManifestEntry>& base_index_entries = {},
+                             const std::vector<IndexManifestEntry>& index_changes = {}) const;
 
     Status CheckFilesExistence(
         const std::vector<std::shared_ptr<ManifestCommittable>>& committables) const;
@@ -212,6 +330,10 @@ class FileStoreCommitImpl : public FileStoreCommit {
     std::shared_ptr<ManifestFile> manifest_file_;
     std::shared_ptr<ManifestList> manifest_list_;
     std::shared_ptr<IndexManifestFile> index_manifest_file_;
+    // nullptr if partition stats file is disabled
+    std::shared_ptr<PartitionStatsFile> partition_stats_file_;
+    // nullptr if column sketches are disabled
+    std::shared_ptr<ColumnSketchesFile> column_sketches_file_;
 
     std::shared_ptr<ExpireSnapshots> expire_snapshots_;
     std::shared_ptr<SchemaManager> schema_manager_;
@@ -22,6 +22,7 @@
 #include <filesystem>
 #include <iostream>
 #include <set>
+#include <unordered_map>
 #include <utility>
 
 #include "arrow/c/abi.h"
@@ -34,6 +35,7 @@
 #include "paimon/catalog/identifier.h"
 #include "paimon/commit_context.h"
 #include "paimon/commit_message.h"
+#include "paimon/commit_message_spool.h"
 #include "paimon/common/data/binary_row.h"
 #include "paimon/common/data/binary_row_writer.h"
 #include "paimon/common/factories/io_hook.h"
@@ -41,16 +43,23 @@
 #include "paimon/common/utils/path_util.h"
 #include "paimon/common/utils/scope_guard.h"
 #include "paimon/core/catalog/commit_table_request.h"
+#include "paimon/core/index/deletion_vector_meta.h"
+#include "paimon/core/index/index_file_meta.h"
 #include "paimon/core/io/data_file_meta.h"
 #include "paimon/core/manifest/file_kind.h"
 #include "paimon/core/manifest/index_manifest_entry.h"
 #include "paimon/core/manifest/manifest_committable.h"
 #include "paimon/core/manifest/manifest_entry.h"
 #include "paimon/core/manifest/manifest_file_meta.h"
+#include "paimon/core/manifest/manifest_file.h"
 #include "paimon/core/manifest/manifest_list.h"
+#include "paimon/core/manifest/partition_entry.h"
+#include "paimon/core/manifest/partition_stats_file.h"
 #include "paimon/core/operation/metrics/commit_metrics.h"
 #include "paimon/core/partition/partition_statistics.h"
 #include "paimon/core/stats/simple_stats.h"
+#include "paimon/core/table/source/abstract_table_scan.h"
+#include "paimon/core/table/source/snapshot/snapshot_reader.h"
 #include "paimon/core/table/sink/commit_message_impl.h"
 #include "paimon/core/utils/file_utils.h"
 #include "paimon/core/utils/snapshot_manager.h"
@@ -62,7 +71,9 @@
 #include "paimon/fs/local/local_file_system_factory.h"
 #include "paimon/memory/memory_pool.h"
 #include "paimon/metrics.h"
+#include "paimon/scan_context.h"
 #include "paimon/string_builder.h"
+#include "paimon/table/source/table_scan.h"
 #include "paimon/testing/utils/binary_row_generator.h"
 #include "paimon/testing/utils/io_exception_helper.h"
 #include "paimon/testing/utils/testharness.h"
@@ -305,6 +316,47 @@ TEST_F(FileStoreCommitImplTest, TestCommit) {
     ASSERT_TRUE(exist);
 }
 
+TEST_F(FileStoreCommitImplTest, TestCommitFromSpool) {
+    CommitContextBuilder context_builder(table_path_, "commit_user_1");
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<CommitContext> commit_context,
+                         context_builder.AddOption(Options::MANIFEST_FORMAT, "orc")
+                             .AddOption(Options::MANIFEST_TARGET_FILE_SIZE, "8mb")
+                             .AddOption(Options::FILE_SYSTEM, "local")
+                             .Finish());
+
+    ASSERT_OK_AND_ASSIGN(auto commit, FileStoreCommit::Create(std::move(commit_context)));
+
+    std::vector<std::shared_ptr<CommitMessage>> msgs =
+        GetCommitMessages(paimon::test::GetDataDir() +
+                              "/orc/append_09.db/append_09/commit_messages/commit_messages-01",
+                          /*version=*/3);
+    ASSERT_GT(msgs.size(), 0);
+    auto pool = GetDefaultPool();
+    std::string spool_path = PathUtil::JoinPath(test_root_, "commit-spool");
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<CommitMessageSpoolWriter> spool_writer,
+                         CommitMessageSpoolWriter::Create(file_system_, spool_path, pool));
+    for (const auto& msg : msgs) {
+        ASSERT_OK(spool_writer->Append(msg));
+    }
+    ASSERT_OK(spool_writer->Close());
+
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<CommitMessageSpoolReader> spool_reader,
+                         CommitMessageSpoolReader::Create(file_system_, spool_path, pool));
+    ASSERT_OK(commit->Commit(spool_reader.get()));
+    ASSERT_OK(spool_reader->Close());
+    ASSERT_OK_AND_ASSIGN(uint64_t counter, commit->GetCommitMetrics()->GetCounter(
+                                               CommitMetrics::LAST_COMMIT_ATTEMPTS));
+    ASSERT_EQ(1u, counter);
+    ASSERT_OK_AND_ASSIGN(
+        bool exist, file_system_->Exists(PathUtil::JoinPath(table_path_, "snapshot/snapshot-1")));
+    ASSERT_TRUE(exist);
+    auto commit_impl = dynamic_cast<FileStoreCommitImpl*>(commit.get());
+    ASSERT_OK_AND_ASSIGN(auto snapshot, commit_impl->snapshot_manager_->LatestSnapshot());
+    ASSERT_TRUE(snapshot);
+    ASSERT_EQ(5, snapshot.value().TotalRecordCount().value());
+    ASSERT_EQ(5, snapshot.value().DeltaRecordCount().value());
+}
+
 TEST_F(FileStoreCommitImplTest, TestRESTCatalogCommit) {
     TimezoneGuard guard("Asia/Shanghai");
     CommitContextBuilder context_builder(table_path_, "commit_user_1");
@@ -1032,6 +1084,59 @@ TEST_F(FileStoreCommitImplTest, TestCheckConflict) {
     }
 }
 
+TEST_F(FileStoreCommitImplTest, TestCheckIndexConflict) {
+    CommitContextBuilder context_builder(table_path_, "commit_user_1");
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<CommitContext> commit_context,
+                         context_builder.AddOption(Options::MANIFEST_FORMAT, "orc")
+                             .AddOption(Options::FILE_SYSTEM, "local")
+                             .Finish());
+    ASSERT_OK_AND_ASSIGN(auto commit, FileStoreCommit::Create(std::move(commit_context)));
+    auto commit_impl = dynamic_cast<FileStoreCommitImpl*>(commit.get());
+    ASSERT_TRUE(commit_impl);
+
+    auto create_dv_entry = [](const std::string& index_file_name,
+                              const std::string& data_file_name, const FileKind& kind) {
+        LinkedHashMap<std::string, DeletionVectorMeta> dv_ranges;
+        dv_ranges.insert_or_assign(data_file_name,
+                                   DeletionVectorMeta(data_file_name, /*offset=*/1,
+                                                      /*length=*/22, /*cardinality=*/1));
+        auto index_file = std::make_shared<IndexFileMeta>(
+            "DELETION_VECTORS", index_file_name, /*file_size=*/31, /*row_count=*/1, dv_ranges,
+            /*external_path=*/std::nullopt);
+        return IndexManifestEntry(kind, BinaryRow::EmptyRow(), /*bucket=*/0, index_file);
+    };
+    std::vector<ManifestEntry> base_entries = {CreateManifestEntry("file1", FileKind::Add())};
+    std::vector<IndexManifestEntry> base_index_entries = {
+        create_dv_entry("index1", "file1", FileKind::Add())};
+    {
+        // replace the deletion vectors of a live data file
+        std::vector<IndexManifestEntry> index_changes = {
+            create_dv_entry("index1", "file1", FileKind::Delete()),
+            create_dv_entry("index2", "file1", FileKind::Add())};
+        ASSERT_OK(commit_impl->NoConflictsOrFail("commit_user_1", base_entries, /*changes=*/{},
+                                                 base_index_entries, index_changes));
+    }
+    {
+        // the deletion vectors have been replaced by another commit
+        std::vector<IndexManifestEntry> index_changes = {
+            create_dv_entry("index2", "file1", FileKind::Delete()),
+            create_dv_entry("index3", "file1", FileKind::Add())};
+        ASSERT_NOK_WITH_MSG(
+            commit_impl->NoConflictsOrFail("commit_user_1", base_entries, /*changes=*/{},
+                                           base_index_entries, index_changes),
+            "Trying to delete index file index2 which is not previously added.");
+    }
+    {
+        // the data file has been removed by another commit
+        std::vector<IndexManifestEntry> index_changes = {
+            create_dv_entry("index2", "file2", FileKind::Add())};
+        ASSERT_NOK_WITH_MSG(
+            commit_impl->NoConflictsOrFail("commit_user_1", base_entries, /*changes=*/{},
+                                           base_index_entries, index_changes),
+            "Deletion vectors of index file index2 refer to data file file2 which does not exist.");
+    }
+}
+
 TEST_F(FileStoreCommitImplTest, TestTryOverwrite) {
     CommitContextBuilder context_builder(table_path_, "commit_user_1");
     ASSERT_OK_AND_ASSIGN(std::unique_ptr<CommitContext> commit_context,
@@ -1058,7 +1163,7 @@ TEST_F(FileStoreCommitImplTest, TestTryOverwrite) {
     std::vector<ManifestEntry> changes;
     changes.push_back(CreateManifestEntry("new_file_1", FileKind::Add()));
     std::vector<std::map<std::string, std::string>> partitions = {{{"f1", "10"}}, {{"f1", "20"}}};
-    ASSERT_OK(commit_impl->TryOverwrite(partitions, changes,
+    ASSERT_OK(commit_impl->TryOverwrite(partitions, changes, /*changelog_files=*/{},
                                         /*commit_identifier=*/1, std::nullopt));
 }
 
@@ -1077,22 +1182,28 @@ TEST_F(FileStoreCommitImplTest, TestTryOverwriteFromNothing) {
     std::vector<ManifestEntry> changes;
     changes.push_back(CreateManifestEntry("new_file_1", FileKind::Add()));
     std::vector<std::map<std::string, std::string>> partitions = {{{"f1", "10"}}, {{"f1", "20"}}};
-    ASSERT_OK(commit_impl->TryOverwrite(partitions, changes,
+    ASSERT_OK(commit_impl->TryOverwrite(partitions, changes, /*changelog_files=*/{},
                                         /*commit_identifier=*/0, std::nullopt));
     ASSERT_OK_AND_ASSIGN(auto snapshot1, commit_impl->snapshot_manager_->LatestSnapshot());
     ASSERT_OK_AND_ASSIGN(auto entries1, commit_impl->GetAllFiles(snapshot1.value(), {}));
     ASSERT_EQ(1u, entries1.size());
     ASSERT_EQ("new_file_1", entries1[0].FileName());
     ASSERT_EQ(FileKind::Add(), entries1[0].Kind());
+    ASSERT_FALSE(snapshot1.value().ChangelogManifestList());
     std::vector<ManifestEntry> changes2;
     changes2.push_back(CreateManifestEntry("new_file_2", FileKind::Add()));
-    ASSERT_OK(commit_impl->TryOverwrite(partitions, changes2,
+    // changelog files of an overwrite are committed as well
+    std::vector<ManifestEntry> changelog_files2;
+    changelog_files2.push_back(CreateManifestEntry("changelog_file_2", FileKind::Add()));
+    ASSERT_OK(commit_impl->TryOverwrite(partitions, changes2, changelog_files2,
                                         /*commit_identifier=*/1, std::nullopt));
     ASSERT_OK_AND_ASSIGN(auto snapshot2, commit_impl->snapshot_manager_->LatestSnapshot());
     ASSERT_OK_AND_ASSIGN(auto entries2, commit_impl->GetAllFiles(snapshot2.value(), {}));
     ASSERT_EQ(1u, entries2.size());
     ASSERT_EQ("new_file_2", entries2[0].FileName());
     ASSERT_EQ(FileKind::Add(), entries2[0].Kind());
+    ASSERT_TRUE(snapshot2.value().ChangelogManifestList());
+    ASSERT_EQ(8, snapshot2.value().ChangelogRecordCount().value());
 }
 
 TEST_F(FileStoreCommitImplTest, TestTryOverwriteThenCommit) {
@@ -1110,7 +1221,7 @@ TEST_F(FileStoreCommitImplTest, TestTryOverwriteThenCommit) {
     std::vector<ManifestEntry> changes;
     changes.push_back(CreateManifestEntry("new_file_1", FileKind::Add()));
     std::vector<std::map<std::string, std::string>> partitions = {{{"f1", "10"}}, {{"f1", "20"}}};
-    ASSERT_OK(commit_impl->TryOverwrite(partitions, changes,
+    ASSERT_OK(commit_impl->TryOverwrite(partitions, changes, /*changelog_files=*/{},
                                         /*commit_identifier=*/0, std::nullopt));
     std::vector<std::shared_ptr<CommitMessage>> msgs =
         GetCommitMessages(paimon::test::GetDataDir() +
@@ -1136,7 +1247,7 @@ TEST_F(FileStoreCommitImplTest, TestTryOverwriteThenCommit) {
 
     std::vector<ManifestEntry> changes2;
     changes2.push_back(CreateManifestEntry("new_file_2", FileKind::Add()));
-    ASSERT_OK(commit_impl->TryOverwrite(partitions, changes2,
+    ASSERT_OK(commit_impl->TryOverwrite(partitions, changes2, /*changelog_files=*/{},
                                         /*commit_identifier=*/2, std::nullopt));
     ASSERT_OK_AND_ASSIGN(auto snapshot2, commit_impl->snapshot_manager_->LatestSnapshot());
     ASSERT_OK_AND_ASSIGN(auto entries2, commit_impl->GetAllFiles(snapshot2.value(), {}));
@@ -1193,6 +1304,106 @@ TEST_F(FileStoreCommitImplTest, TestDropPartitionAndExpireSnapshot) {
     ASSERT_EQ(2, manifests[0].NumDeletedFiles());
 }
 
+TEST_F(FileStoreCommitImplTest, TestPartitionStatsFileWithDropPartitionAndExpire) {
+    CommitContextBuilder context_builder(table_path_, "commit_user_1");
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<CommitContext> commit_context,
+                         context_builder.AddOption(Options::MANIFEST_FORMAT, "orc")
+                             .AddOption(Options::MANIFEST_TARGET_FILE_SIZE, "8mb")
+                             .AddOption(Options::FILE_SYSTEM, "local")
+                             .AddOption(Options::PARTITION_STATS_FILE_ENABLED, "true")
+                             .AddOption(Options::SNAPSHOT_NUM_RETAINED_MIN, "1")
+                             .AddOption(Options::SNAPSHOT_NUM_RETAINED_MAX, "1")
+                             .AddOption(Options::SNAPSHOT_EXPIRE_LIMIT, "30")
+                             .AddOption(Options::SNAPSHOT_TIME_RETAINED, "1ms")
+                             .IgnoreEmptyCommit(true)
+                             .Finish());
+    ASSERT_OK_AND_ASSIGN(auto commit, FileStoreCommit::Create(std::move(commit_context)));
+    auto commit_impl = dynamic_cast<FileStoreCommitImpl*>(commit.get());
+    ASSERT_TRUE(commit_impl);
+    ASSERT_TRUE(commit_impl->partition_stats_file_);
+
+    auto SortByPartition = [](std::vector<PartitionEntry>* entries) {
+        std::sort(entries->begin(), entries->end(),
+                  [](const PartitionEntry& lhs, const PartitionEntry& rhs) {
+                      return lhs.Partition().GetInt(0) < rhs.Partition().GetInt(0);
+                  });
+    };
+    auto ReadFromManifests = [&](const Snapshot& snapshot) {
+        std::vector<ManifestFileMeta> manifests;
+        EXPECT_OK(commit_impl->manifest_list_->ReadDataManifests(snapshot, &manifests));
+        std::unordered_map<BinaryRow, PartitionEntry> partitions;
+        for (const auto& manifest : manifests) {
+            std::vector<ManifestEntry> entries;
+            EXPECT_OK(commit_impl->manifest_file_->Read(manifest.FileName(), /*filter=*/nullptr,
+                                                        &entries));
+            EXPECT_OK(PartitionEntry::Merge(entries, &partitions));
+        }
+        std::vector<PartitionEntry> result;
+        for (const auto& [_, entry] : partitions) {
+            if (entry.FileCount() > 0) {
+                result.push_back(entry);
+            }
+        }
+        SortByPartition(&result);
+        return result;
+    };
+    auto ReadFromStatsFile = [&](const Snapshot& snapshot) {
+        std::optional<std::string> stats_file = snapshot.PartitionStatsFileName();
+        EXPECT_TRUE(stats_file);
+        EXPECT_OK_AND_ASSIGN(std::vector<PartitionEntry> result,
+                             commit_impl->partition_stats_file_->ReadAll(stats_file.value()));
+        SortByPartition(&result);
+        return result;
+    };
+
+    std::vector<std::shared_ptr<CommitMessage>> msgs =
+        GetCommitMessages(paimon::test::GetDataDir() +
+                              "/orc/append_09.db/append_09/commit_messages/"
+                              "commit_messages-01",
+                          /*version=*/3);
+    ASSERT_OK(commit->Commit(msgs, /*commit_identifier=*/0));
+    ASSERT_OK_AND_ASSIGN(Snapshot snapshot1, commit_impl->snapshot_manager_->LoadSnapshot(1));
+    std::vector<PartitionEntry> stats1 = ReadFromStatsFile(snapshot1);
+    ASSERT_FALSE(stats1.empty());
+    ASSERT_EQ(stats1, ReadFromManifests(snapshot1));
+
+    ASSERT_OK(commit->DropPartition({{{"f1", "10"}}}, /*commit_identifier=*/1));
+    ASSERT_OK_AND_ASSIGN(Snapshot snapshot2, commit_impl->snapshot_manager_->LoadSnapshot(2));
+    std::vector<PartitionEntry> stats2 = ReadFromStatsFile(snapshot2);
+    ASSERT_EQ(stats2, ReadFromManifests(snapshot2));
+    for (const auto& entry : stats2) {
+        ASSERT_NE(entry.Partition().GetInt(0), 10);
+    }
+    ASSERT_NE(snapshot1.PartitionStatsFileName(), snapshot2.PartitionStatsFileName());
+
+    // the stats file of the expired snapshot is removed together with its manifests
+    ASSERT_OK_AND_ASSIGN(int32_t expire_snapshot_cnt, commit->Expire());
+    ASSERT_EQ(expire_snapshot_cnt, 1);
+    std::string manifest_dir = PathUtil::JoinPath(table_path_, "manifest");
+    std::string stats_file1 = snapshot1.PartitionStatsFileName().value();
+    std::string stats_file2 = snapshot2.PartitionStatsFileName().value();
+    ASSERT_OK_AND_ASSIGN(bool exist,
+                         file_system_->Exists(PathUtil::JoinPath(manifest_dir, stats_file1)));
+    ASSERT_FALSE(exist);
+    ASSERT_OK_AND_ASSIGN(exist,
+                         file_system_->Exists(PathUtil::JoinPath(manifest_dir, stats_file2)));
+    ASSERT_TRUE(exist);
+
+    // partition entries are read from the manifests if the stats file is lost
+    ASSERT_OK(file_system_->Delete(PathUtil::JoinPath(manifest_dir, stats_file2)));
+    ScanContextBuilder scan_context_builder(table_path_);
+    scan_context_builder.AddOption(Options::MANIFEST_FORMAT, "orc")
+        .AddOption(Options::FILE_SYSTEM, "local");
+    ASSERT_OK_AND_ASSIGN(auto scan_context, scan_context_builder.Finish());
+    ASSERT_OK_AND_ASSIGN(auto table_scan, TableScan::Create(std::move(scan_context)));
+    auto typed_table_scan = dynamic_cast<AbstractTableScan*>(table_scan.get());
+    ASSERT_TRUE(typed_table_scan);
+    ASSERT_OK_AND_ASSIGN(std::vector<PartitionEntry> partition_entries,
+                         typed_table_scan->snapshot_reader_->scan_->ReadPartitionEntries());
+    SortByPartition(&partition_entries);
+    ASSERT_EQ(partition_entries, stats2);
+}
+
 TEST_F(FileStoreCommitImplTest, TestDropMultiPartitionAndExpireSnapshot) {
     CommitContextBuilder context_builder(table_path_, "commit_user_1");
     ASSERT_OK_AND_ASSIGN(std::unique_ptr<CommitContext> commit_context,
@@ -1279,9 +1490,12 @@ TEST_F(FileStoreCommitImplTest, TestCollectChanges) {
     auto commit_impl = std::dynamic_pointer_cast<FileStoreCommitImpl>(
         std::shared_ptr<FileStoreCommit>(std::move(commit)));
     std::vector<ManifestEntry> append_table_files;
+    std::vector<ManifestEntry> append_changelog_files;
     std::vector<IndexManifestEntry> append_table_index_files;
-    ASSERT_OK(commit_impl->CollectChanges(msgs, &append_table_files, &append_table_index_files));
+    ASSERT_OK(commit_impl->CollectChanges(msgs, &append_table_files, &append_changelog_files,
+                                          &append_table_index_files));
     ASSERT_EQ(append_table_files.size(), 3u);
+    ASSERT_EQ(append_changelog_files.size(), 0u);
     ASSERT_EQ(append_table_index_files.size(), 0u);
     ASSERT_EQ(append_table_files[0].Kind(), FileKind::Add());
     ASSERT_EQ(append_table_files[0].Bucket(), 0);
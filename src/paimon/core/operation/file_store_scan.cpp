@@ -16,6 +16,7 @@
 
 #include "paimon/core/operation/file_store_scan.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <future>
 #include <list>
@@ -35,6 +36,7 @@
 #include "paimon/core/manifest/manifest_file.h"
 #include "paimon/core/manifest/manifest_file_meta.h"
 #include "paimon/core/manifest/manifest_list.h"
+#include "paimon/core/manifest/partition_stats_file.h"
 #include "paimon/core/partition/partition_info.h"
 #include "paimon/core/stats/simple_stats.h"
 #include "paimon/core/utils/field_mapping.h"
@@ -71,6 +73,22 @@ FileStoreScan::RawPlan::GroupFiles FileStoreScan::RawPlan::GroupByPartFiles(
 }
 
 Result<std::vector<PartitionEntry>> FileStoreScan::ReadPartitionEntries() const {
+    if (CanUsePartitionStatsFile()) {
+        PAIMON_ASSIGN_OR_RAISE(std::optional<Snapshot> snapshot, ResolveSnapshot());
+        if (snapshot == std::nullopt) {
+            return std::vector<PartitionEntry>();
+        }
+        std::optional<std::string> stats_file = snapshot.value().PartitionStatsFileName();
+        if (stats_file) {
+            Result<std::vector<PartitionEntry>> stats_entries =
+                ReadPartitionEntriesFromStatsFile(stats_file.value());
+            if (stats_entries.ok()) {
+                return stats_entries;
+            }
+            // the stats file is only a shortcut, fall back to the manifests if it is missing
+            // or unreadable
+        }
+    }
     std::optional<Snapshot> snapshot;
     std::vector<ManifestFileMeta> manifest_file_metas;
     PAIMON_RETURN_NOT_OK(ReadManifests(&snapshot, &manifest_file_metas));
@@ -89,6 +107,37 @@ Result<std::vector<PartitionEntry>> FileStoreScan::ReadPartitionEntries() const
     return partition_entries;
 }
 
+bool FileStoreScan::CanUsePartitionStatsFile() const {
+    return partition_stats_file_ && scan_mode_ == ScanMode::ALL && !predicates_ &&
+           bucket_filter_ == std::nullopt && level_filter_ == nullptr && !only_read_real_buckets_ &&
+           row_ranges_ == std::nullopt;
+}
+
+Result<std::vector<PartitionEntry>> FileStoreScan::ReadPartitionEntriesFromStatsFile(
+    const std::string& file_name) const {
+    PAIMON_ASSIGN_OR_RAISE(std::vector<PartitionEntry> stats_entries,
+                           partition_stats_file_->ReadAll(file_name));
+    if (!partition_filter_ && excluded_partitions_.empty()) {
+        return stats_entries;
+    }
+    std::vector<PartitionEntry> partition_entries;
+    partition_entries.reserve(stats_entries.size());
+    for (auto& entry : stats_entries) {
+        if (excluded_partitions_.count(entry.Partition()) > 0) {
+            continue;
+        }
+        if (partition_filter_) {
+            PAIMON_ASSIGN_OR_RAISE(bool res,
+                                   partition_filter_->Test(partition_schema_, entry.Partition()));
+            if (!res) {
+                continue;
+            }
+        }
+        partition_entries.push_back(std::move(entry));
+    }
+    return partition_entries;
+}
+
 Result<std::shared_ptr<FileStoreScan::RawPlan>> FileStoreScan::CreatePlan() const {
     std::optional<Snapshot> snapshot;
     std::vector<ManifestFileMeta> manifest_file_metas;
@@ -125,15 +174,48 @@ Result<std::shared_ptr<FileStoreScan::RawPlan>> FileStoreScan::CreatePlan() cons
                                                     std::move(manifest_entries));
 }
 
+Result<std::vector<ManifestEntry>> FileStoreScan::ReadBucketFiles(
+    const Snapshot& snapshot, const BucketSet& buckets) const {
+    if (buckets.empty()) {
+        return std::vector<ManifestEntry>();
+    }
+    int32_t min_bucket = buckets.begin()->second;
+    int32_t max_bucket = min_bucket;
+    for (const auto& [_, bucket] : buckets) {
+        min_bucket = std::min(min_bucket, bucket);
+        max_bucket = std::max(max_bucket, bucket);
+    }
+    std::vector<ManifestFileMeta> unfiltered_manifest_metas;
+    PAIMON_RETURN_NOT_OK(manifest_list_->ReadDataManifests(snapshot, &unfiltered_manifest_metas));
+    std::vector<ManifestFileMeta> manifest_metas;
+    for (const auto& meta : unfiltered_manifest_metas) {
+        if (meta.MinBucket() && meta.MaxBucket() &&
+            (max_bucket < meta.MinBucket().value() || min_bucket > meta.MaxBucket().value())) {
+            continue;
+        }
+        PAIMON_ASSIGN_OR_RAISE(bool filter_meta_result, FilterManifestFileMeta(meta));
+        if (filter_meta_result) {
+            manifest_metas.push_back(meta);
+        }
+    }
+    manifest_metas = PostFilterManifests(std::move(manifest_metas));
+    std::vector<ManifestEntry> manifest_entries;
+    PAIMON_RETURN_NOT_OK(ReadAndMergeFileEntries(manifest_metas, &manifest_entries, &buckets));
+    return PostFilterManifestEntries(std::move(manifest_entries));
+}
+
+Result<std::optional<Snapshot>> FileStoreScan::ResolveSnapshot() const {
+    if (specified_snapshot_ != std::nullopt) {
+        return specified_snapshot_;
+    }
+    return snapshot_manager_->LatestSnapshot();
+}
+
 Status FileStoreScan::ReadManifests(std::optional<Snapshot>* snapshot_ptr,
                                     std::vector<ManifestFileMeta>* manifests_ptr) const {
     auto& snapshot = *snapshot_ptr;
     auto& manifests = *manifests_ptr;
-    if (specified_snapshot_ != std::nullopt) {
-        snapshot = specified_snapshot_;
-    } else {
-        PAIMON_ASSIGN_OR_RAISE(snapshot, snapshot_manager_->LatestSnapshot());
-    }
+    PAIMON_ASSIGN_OR_RAISE(snapshot, ResolveSnapshot());
     if (snapshot == std::nullopt) {
         manifests = std::vector<ManifestFileMeta>();
         return Status::OK();
@@ -156,6 +238,8 @@ Status FileStoreScan::ReadManifestsWithSnapshot(const Snapshot& snapshot,
             return manifest_list_->ReadDataManifests(snapshot, manifests);
         case ScanMode::DELTA:
             return manifest_list_->ReadDeltaManifests(snapshot, manifests);
+        case ScanMode::CHANGELOG:
+            return manifest_list_->ReadChangelogManifests(snapshot, manifests);
         default:
             return Status::NotImplemented("Unknown scan mode ",
                                           std::to_string(static_cast<int32_t>(scan_mode_)));
@@ -163,12 +247,13 @@ Status FileStoreScan::ReadManifestsWithSnapshot(const Snapshot& snapshot,
 }
 
 Status FileStoreScan::ReadFileEntries(const std::vector<ManifestFileMeta>& manifest_metas,
-                                      std::vector<ManifestEntry>* manifest_entries) const {
+                                      std::vector<ManifestEntry>* manifest_entries,
+                                      const BucketSet* buckets) const {
     std::vector<std::future<Result<std::vector<ManifestEntry>>>> futures;
     for (const auto& meta : manifest_metas) {
-        auto read_meta_task = [this, &meta]() -> Result<std::vector<ManifestEntry>> {
+        auto read_meta_task = [this, &meta, buckets]() -> Result<std::vector<ManifestEntry>> {
             std::vector<ManifestEntry> tmp_entries;
-            PAIMON_RETURN_NOT_OK(ReadManifestFileMeta(meta, &tmp_entries));
+            PAIMON_RETURN_NOT_OK(ReadManifestFileMeta(meta, &tmp_entries, buckets));
             return tmp_entries;
         };
         futures.push_back(Via(executor_.get(), read_meta_task));
@@ -197,9 +282,10 @@ Status FileStoreScan::ReadManifestEntries(const std::vector<ManifestFileMeta>& m
 }
 
 Status FileStoreScan::ReadAndMergeFileEntries(const std::vector<ManifestFileMeta>& manifest_metas,
-                                              std::vector<ManifestEntry>* merged_entries) const {
+                                              std::vector<ManifestEntry>* merged_entries,
+                                              const BucketSet* buckets) const {
     std::vector<ManifestEntry> unmerged_entries;
-    PAIMON_RETURN_NOT_OK(ReadFileEntries(manifest_metas, &unmerged_entries));
+    PAIMON_RETURN_NOT_OK(ReadFileEntries(manifest_metas, &unmerged_entries, buckets));
     std::unordered_set<FileEntry::Identifier> deleted_entries;
     for (const auto& entry : unmerged_entries) {
         if (entry.Kind() == FileKind::Delete()) {
@@ -246,8 +332,15 @@ Result<bool> FileStoreScan::FilterManifestFileMeta(const ManifestFileMeta& manif
 }
 
 Status FileStoreScan::ReadManifestFileMeta(const ManifestFileMeta& manifest,
-                                           std::vector<ManifestEntry>* entries) const {
+                                           std::vector<ManifestEntry>* entries,
+                                           const BucketSet* buckets) const {
     auto filter = [&](const ManifestEntry& entry) -> Result<bool> {
+        if (buckets && buckets->count(std::make_pair(entry.Partition(), entry.Bucket())) == 0) {
+            return false;
+        }
+        if (excluded_partitions_.count(entry.Partition()) > 0) {
+            return false;
+        }
         if (partition_filter_) {
             PAIMON_ASSIGN_OR_RAISE(bool res,
                                    partition_filter_->Test(partition_schema_, entry.Partition()));
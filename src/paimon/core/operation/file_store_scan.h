@@ -24,6 +24,7 @@
 #include <mutex>
 #include <optional>
 #include <string>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -60,6 +61,7 @@ class FileKind;
 class ManifestFile;
 class ManifestFileMeta;
 class ManifestList;
+class PartitionStatsFile;
 class MemoryPool;
 class ScanFilter;
 class SchemaManager;
@@ -110,11 +112,26 @@ class FileStoreScan {
         return this;
     }
 
+    /// Answer `ReadPartitionEntries()` from the partition stats file of the snapshot when it has
+    /// one, instead of reading all manifests.
+    FileStoreScan* WithPartitionStatsFile(
+        const std::shared_ptr<PartitionStatsFile>& partition_stats_file) {
+        partition_stats_file_ = partition_stats_file;
+        return this;
+    }
+
     FileStoreScan* WithRowRanges(const std::vector<Range>& row_ranges) {
         row_ranges_ = row_ranges;
         return this;
     }
 
+    /// Skip the files of `partitions` while reading manifests, e.g. partitions which are read
+    /// from another branch.
+    FileStoreScan* WithExcludedPartitions(const std::unordered_set<BinaryRow>& partitions) {
+        excluded_partitions_ = partitions;
+        return this;
+    }
+
     virtual FileStoreScan* EnableValueFilter() {
         return this;
     }
@@ -127,6 +144,14 @@ class FileStoreScan {
         return core_options_;
     }
 
+    const std::shared_ptr<Executor>& GetExecutor() const {
+        return executor_;
+    }
+
+    const std::shared_ptr<TableSchema>& GetTableSchema() const {
+        return table_schema_;
+    }
+
     std::shared_ptr<PredicateFilter> GetNonPartitionPredicate() const {
         return predicates_;
     }
@@ -182,6 +207,14 @@ class FileStoreScan {
 
     Result<std::vector<PartitionEntry>> ReadPartitionEntries() const;
 
+    using BucketSet = std::unordered_set<std::pair<BinaryRow, int32_t>>;
+
+    /// Read the `FileKind::ADD` files of only the given (partition, bucket)s in all data of
+    /// `snapshot`, regardless of the scan mode and the snapshot of this scan. Other filters of
+    /// this scan still apply.
+    Result<std::vector<ManifestEntry>> ReadBucketFiles(const Snapshot& snapshot,
+                                                       const BucketSet& buckets) const;
+
  protected:
     /// @note Keep this thread-safe.
     virtual Result<bool> FilterByStats(const ManifestEntry& entry) const = 0;
@@ -209,6 +242,15 @@ class FileStoreScan {
                              const std::shared_ptr<ScanFilter>& scan_filters);
 
  private:
+    Result<std::optional<Snapshot>> ResolveSnapshot() const;
+
+    /// Whether partition entries are exactly the partition stats of the whole snapshot, i.e. no
+    /// filter other than the partition filter is applied to files.
+    bool CanUsePartitionStatsFile() const;
+
+    Result<std::vector<PartitionEntry>> ReadPartitionEntriesFromStatsFile(
+        const std::string& file_name) const;
+
     Status ReadManifests(std::optional<Snapshot>* snapshot_ptr,
                          std::vector<ManifestFileMeta>* manifests_ptr) const;
 
@@ -219,18 +261,23 @@ class FileStoreScan {
                                std::vector<ManifestEntry>* manifest_entries) const;
 
     Status ReadAndMergeFileEntries(const std::vector<ManifestFileMeta>& manifest_metas,
-                                   std::vector<ManifestEntry>* merged_entries) const;
+                                   std::vector<ManifestEntry>* merged_entries,
+                                   const BucketSet* buckets = nullptr) const;
 
     Status ReadAndNoMergeFileEntries(const std::vector<ManifestFileMeta>& manifest_metas,
                                      std::vector<ManifestEntry>* manifest_entries) const;
 
     Status ReadFileEntries(const std::vector<ManifestFileMeta>& manifest_metas,
-                           std::vector<ManifestEntry>* manifest_entries) const;
+                           std::vector<ManifestEntry>* manifest_entries,
+                           const BucketSet* buckets = nullptr) const;
 
     Result<bool> FilterManifestFileMeta(const ManifestFileMeta& manifest) const;
 
+    /// Read the entries of `manifest` which pass the filters, and which are in `buckets` if it is
+    /// not null.
     Status ReadManifestFileMeta(const ManifestFileMeta& manifest,
-                                std::vector<ManifestEntry>* entries) const;
+                                std::vector<ManifestEntry>* entries,
+                                const BucketSet* buckets = nullptr) const;
 
  protected:
     std::shared_ptr<MemoryPool> pool_;
@@ -249,8 +296,10 @@ class FileStoreScan {
     std::shared_ptr<SnapshotManager> snapshot_manager_;
     std::shared_ptr<ManifestList> manifest_list_;
     std::shared_ptr<ManifestFile> manifest_file_;
+    std::shared_ptr<PartitionStatsFile> partition_stats_file_;
     std::shared_ptr<arrow::Schema> partition_schema_;
     std::shared_ptr<PredicateFilter> partition_filter_;
+    std::unordered_set<BinaryRow> excluded_partitions_;
     std::shared_ptr<Executor> executor_;
     std::optional<int32_t> bucket_filter_;
     std::function<bool(int32_t)> level_filter_;
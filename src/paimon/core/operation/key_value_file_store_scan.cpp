@@ -20,18 +20,24 @@
 #include <map>
 #include <optional>
 #include <set>
+#include <unordered_set>
 #include <utility>
 
 #include "paimon/common/data/binary_array.h"
 #include "paimon/common/data/binary_row.h"
 #include "paimon/common/predicate/predicate_filter.h"
 #include "paimon/common/predicate/predicate_utils.h"
+#include "paimon/common/types/data_field.h"
 #include "paimon/common/utils/object_utils.h"
 #include "paimon/core/core_options.h"
 #include "paimon/core/io/data_file_meta.h"
+#include "paimon/core/mergetree/compact/interval_partition.h"
+#include "paimon/core/mergetree/sorted_run.h"
 #include "paimon/core/options/merge_engine.h"
 #include "paimon/core/schema/table_schema.h"
 #include "paimon/core/stats/simple_stats.h"
+#include "paimon/core/stats/simple_stats_evolution.h"
+#include "paimon/core/utils/fields_comparator.h"
 #include "paimon/predicate/predicate.h"
 
 namespace arrow {
@@ -63,13 +69,33 @@ Result<std::unique_ptr<KeyValueFileStoreScan>> KeyValueFileStoreScan::Create(
         scan->SplitAndSetFilter(table_schema->PartitionKeys(), arrow_schema, scan_filters));
     PAIMON_ASSIGN_OR_RAISE(std::vector<std::string> trimmed_pk, table_schema->TrimmedPrimaryKeys());
     PAIMON_RETURN_NOT_OK(scan->SplitAndSetKeyValueFilter(trimmed_pk));
+    // comparator only used in interval partition of whole bucket filter
+    PAIMON_ASSIGN_OR_RAISE(std::vector<DataField> trimmed_pk_fields,
+                           table_schema->GetFields(trimmed_pk));
+    PAIMON_ASSIGN_OR_RAISE(scan->key_comparator_,
+                           FieldsComparator::Create(trimmed_pk_fields, /*is_ascending_order=*/true,
+                                                    /*use_view=*/false));
     return scan;
 }
 
+KeyValueFileStoreScan::KeyValueFileStoreScan(
+    const std::shared_ptr<SnapshotManager>& snapshot_manager,
+    const std::shared_ptr<SchemaManager>& schema_manager,
+    const std::shared_ptr<ManifestList>& manifest_list,
+    const std::shared_ptr<ManifestFile>& manifest_file,
+    const std::shared_ptr<TableSchema>& table_schema, const std::shared_ptr<arrow::Schema>& schema,
+    const CoreOptions& core_options, const std::shared_ptr<Executor>& executor,
+    const std::shared_ptr<MemoryPool>& pool)
+    : FileStoreScan(snapshot_manager, schema_manager, manifest_list, manifest_file, table_schema,
+                    schema, core_options, executor, pool) {
+    value_stats_evolution_ = std::make_shared<SimpleStatsEvolution>(
+        table_schema->Fields(), table_schema->Fields(), /*need_mapping=*/false, pool);
+}
+
 Result<bool> KeyValueFileStoreScan::FilterByStats(const ManifestEntry& entry) const {
     PAIMON_ASSIGN_OR_RAISE(bool value_filter_enabled, IsValueFilterEnabled());
     if (value_filter_enabled) {
-        PAIMON_ASSIGN_OR_RAISE(bool filtered, FilterByValueFilter(entry));
+        PAIMON_ASSIGN_OR_RAISE(bool filtered, FilterByValueFilter(*entry.File()));
         if (!filtered) {
             return false;
         }
@@ -86,7 +112,7 @@ Result<bool> KeyValueFileStoreScan::FilterByStats(const ManifestEntry& entry) co
 Result<std::vector<ManifestEntry>> KeyValueFileStoreScan::FilterWholeBucketByStats(
     std::vector<ManifestEntry>&& entries) const {
     return NoOverlapping(entries) ? FilterWholeBucketPerFile(std::move(entries))
-                                  : FilterWholeBucketAllFiles(std::move(entries));
+                                  : FilterWholeBucketPerSection(std::move(entries));
 }
 
 Status KeyValueFileStoreScan::SplitAndSetKeyValueFilter(
@@ -126,22 +152,26 @@ Result<bool> KeyValueFileStoreScan::IsValueFilterEnabled() const {
         case ScanMode::ALL:
             return value_filter_force_enabled_;
         case ScanMode::DELTA:
+        case ScanMode::CHANGELOG:
             return false;
         default:
-            return Status::NotImplemented("only support ALL and DELTA scan mode");
+            return Status::NotImplemented("only support ALL, DELTA and CHANGELOG scan mode");
     }
 }
 
-Result<bool> KeyValueFileStoreScan::FilterByValueFilter(const ManifestEntry& entry) const {
-    if (entry.File()->value_stats_cols != std::nullopt) {
-        return Status::NotImplemented("do not support value stats cols in DataFileMeta");
-    }
-    if (entry.File()->embedded_index != nullptr) {
-        return Status::NotImplemented("do not support embedded index in DataFileMeta");
+Result<bool> KeyValueFileStoreScan::FilterByValueFilter(const DataFileMeta& file) const {
+    // embedded file index is not tested, files are filtered by value stats only
+    if (file.value_stats_cols == std::nullopt) {
+        const auto& stats = file.value_stats;
+        return value_filter_->Test(schema_, file.row_count, stats.MinValues(), stats.MaxValues(),
+                                   stats.NullCounts());
     }
-    const auto& stats = entry.File()->value_stats;
-    return value_filter_->Test(schema_, entry.File()->row_count, stats.MinValues(),
-                               stats.MaxValues(), stats.NullCounts());
+    // dense value stats, fields not stored are tested as unknown stats
+    PAIMON_ASSIGN_OR_RAISE(SimpleStatsEvolution::EvolutionStats stats,
+                           value_stats_evolution_->Evolution(file.value_stats, file.row_count,
+                                                             file.value_stats_cols));
+    return value_filter_->Test(schema_, file.row_count, *stats.min_values, *stats.max_values,
+                               *stats.null_counts);
 }
 
 bool KeyValueFileStoreScan::NoOverlapping(const std::vector<ManifestEntry>& entries) {
@@ -165,7 +195,7 @@ Result<std::vector<ManifestEntry>> KeyValueFileStoreScan::FilterWholeBucketPerFi
     std::vector<ManifestEntry> filtered_entries;
     filtered_entries.reserve(entries.size());
     for (auto& entry : entries) {
-        PAIMON_ASSIGN_OR_RAISE(bool filtered, FilterByValueFilter(entry));
+        PAIMON_ASSIGN_OR_RAISE(bool filtered, FilterByValueFilter(*entry.File()));
         if (filtered) {
             filtered_entries.emplace_back(std::move(entry));
         }
@@ -173,22 +203,56 @@ Result<std::vector<ManifestEntry>> KeyValueFileStoreScan::FilterWholeBucketPerFi
     return filtered_entries;
 }
 
-Result<std::vector<ManifestEntry>> KeyValueFileStoreScan::FilterWholeBucketAllFiles(
+Result<std::vector<ManifestEntry>> KeyValueFileStoreScan::FilterWholeBucketPerSection(
     std::vector<ManifestEntry>&& entries) const {
     if (!core_options_.DeletionVectorsEnabled() &&
         (core_options_.GetMergeEngine() == MergeEngine::AGGREGATE ||
          core_options_.GetMergeEngine() == MergeEngine::PARTIAL_UPDATE)) {
-        return entries;
+        return std::move(entries);
+    }
+    std::vector<std::shared_ptr<DataFileMeta>> files;
+    files.reserve(entries.size());
+    for (const auto& entry : entries) {
+        files.push_back(entry.File());
     }
-    // entries come from the same bucket, if any of it doesn't meet the request, we could
-    // filter the bucket.
+    // files of different sections never overlap in keys, so a section can be filtered as a
+    // whole: if none of its files meets the request, no merged record of it does either.
+    std::unordered_set<const DataFileMeta*> selected_files;
+    for (const auto& section : IntervalPartition(files, key_comparator_).Partition()) {
+        bool section_selected = false;
+        for (const auto& run : section) {
+            for (const auto& file : run.Files()) {
+                PAIMON_ASSIGN_OR_RAISE(bool filtered, FilterByValueFilter(*file));
+                if (filtered) {
+                    section_selected = true;
+                    break;
+                }
+            }
+            if (section_selected) {
+                break;
+            }
+        }
+        if (!section_selected) {
+            continue;
+        }
+        for (const auto& run : section) {
+            for (const auto& file : run.Files()) {
+                selected_files.insert(file.get());
+            }
+        }
+    }
+    if (selected_files.size() == entries.size()) {
+        return std::move(entries);
+    }
+    // keep the original order of entries
+    std::vector<ManifestEntry> filtered_entries;
+    filtered_entries.reserve(selected_files.size());
     for (auto& entry : entries) {
-        PAIMON_ASSIGN_OR_RAISE(bool filtered, FilterByValueFilter(entry));
-        if (filtered) {
-            return std::move(entries);
+        if (selected_files.find(entry.File().get()) != selected_files.end()) {
+            filtered_entries.emplace_back(std::move(entry));
         }
     }
-    return std::vector<ManifestEntry>();
+    return filtered_entries;
 }
 
 }  // namespace paimon
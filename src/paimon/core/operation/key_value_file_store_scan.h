@@ -33,13 +33,16 @@ class Schema;
 
 namespace paimon {
 class CoreOptions;
+struct DataFileMeta;
 class Executor;
+class FieldsComparator;
 class ManifestFile;
 class ManifestList;
 class MemoryPool;
 class PredicateFilter;
 class ScanFilter;
 class SchemaManager;
+class SimpleStatsEvolution;
 class SnapshotManager;
 class TableSchema;
 
@@ -87,14 +90,17 @@ class KeyValueFileStoreScan : public FileStoreScan {
 
     Result<bool> IsValueFilterEnabled() const;
 
-    Result<bool> FilterByValueFilter(const ManifestEntry& entry) const;
+    Result<bool> FilterByValueFilter(const DataFileMeta& file) const;
 
     static bool NoOverlapping(const std::vector<ManifestEntry>& entries);
 
     Result<std::vector<ManifestEntry>> FilterWholeBucketPerFile(
         std::vector<ManifestEntry>&& entries) const;
 
-    Result<std::vector<ManifestEntry>> FilterWholeBucketAllFiles(
+    /// Partitions the files of a bucket into key-range sections by `IntervalPartition`, and
+    /// drops a section only when every file in it fails the value filter. Sections never
+    /// overlap in keys, so each of them can be merged, and thus filtered, independently.
+    Result<std::vector<ManifestEntry>> FilterWholeBucketPerSection(
         std::vector<ManifestEntry>&& entries) const;
 
     KeyValueFileStoreScan(const std::shared_ptr<SnapshotManager>& snapshot_manager,
@@ -105,13 +111,14 @@ class KeyValueFileStoreScan : public FileStoreScan {
                           const std::shared_ptr<arrow::Schema>& schema,
                           const CoreOptions& core_options,
                           const std::shared_ptr<Executor>& executor,
-                          const std::shared_ptr<MemoryPool>& pool)
-        : FileStoreScan(snapshot_manager, schema_manager, manifest_list, manifest_file,
-                        table_schema, schema, core_options, executor, pool) {}
+                          const std::shared_ptr<MemoryPool>& pool);
 
  private:
     bool value_filter_force_enabled_ = false;
     std::shared_ptr<PredicateFilter> key_filter_;
     std::shared_ptr<PredicateFilter> value_filter_;
+    std::shared_ptr<FieldsComparator> key_comparator_;
+    // projects dense value stats to all value fields
+    std::shared_ptr<SimpleStatsEvolution> value_stats_evolution_;
 };
 }  // namespace paimon
@@ -46,6 +46,7 @@
 #include "paimon/predicate/literal.h"
 #include "paimon/predicate/predicate_builder.h"
 #include "paimon/scan_context.h"
+#include "paimon/testing/utils/binary_row_generator.h"
 #include "paimon/testing/utils/testharness.h"
 
 namespace arrow {
@@ -294,4 +295,66 @@ TEST_F(KeyValueFileStoreScanTest, TestNoOverlapping) {
     ASSERT_FALSE(KeyValueFileStoreScan::NoOverlapping(generate_manifest_entries({0, 1, 1})));
     ASSERT_FALSE(KeyValueFileStoreScan::NoOverlapping(generate_manifest_entries({2, 1, 1})));
 }
+
+TEST_F(KeyValueFileStoreScanTest, TestFilterWholeBucketPerSection) {
+    std::string table_path =
+        paimon::test::GetDataDir() + "orc/pk_table_with_mor.db/pk_table_with_mor";
+    auto greater_than = PredicateBuilder::GreaterThan(/*field_index=*/6, /*field_name=*/"v0",
+                                                      FieldType::DOUBLE, Literal(30.0));
+    std::vector<std::map<std::string, std::string>> partition_filters;
+    auto scan_filter = std::make_shared<ScanFilter>(/*predicate=*/greater_than,
+                                                    /*partition_filters=*/partition_filters,
+                                                    /*bucket_filter=*/std::nullopt);
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<KeyValueFileStoreScan> scan,
+                         CreateFileStoreScan(table_path, scan_filter,
+                                             /*table_schema_id=*/0, /*snapshot_id=*/1));
+
+    auto create_entry = [&](const std::string& file_name, int32_t min_key, int32_t max_key,
+                            double min_v0, double max_v0, int32_t level) {
+        auto value_stats = BinaryRowGenerator::GenerateStats(
+            {min_key, 0, 1, 0, std::string("a"), std::string("a"), min_v0, false},
+            {max_key, 0, 1, 0, std::string("a"), std::string("a"), max_v0, true},
+            {0, 0, 0, 0, 0, 0, 0, 0}, pool_.get());
+        return ManifestEntry(
+            /*kind=*/FileKind::Add(), /*partition=*/BinaryRow::EmptyRow(), /*bucket=*/0,
+            /*total_buckets=*/1,
+            std::make_shared<DataFileMeta>(
+                file_name, /*file_size=*/1024, /*row_count=*/10,
+                /*min_key=*/BinaryRowGenerator::GenerateRow({min_key, 0}, pool_.get()),
+                /*max_key=*/BinaryRowGenerator::GenerateRow({max_key, 0}, pool_.get()),
+                /*key_stats=*/SimpleStats::EmptyStats(), value_stats,
+                /*min_sequence_number=*/0, /*max_sequence_number=*/10, /*schema_id=*/0, level,
+                /*extra_files=*/std::vector<std::optional<std::string>>(),
+                /*creation_time=*/Timestamp(0, 0),
+                /*delete_row_count */ std::nullopt,
+                /*embedded_index=*/nullptr,
+                /*file_source=*/FileSource::Append(), /*external_path=*/std::nullopt,
+                /*value_stats_cols=*/std::nullopt,
+                /*first_row_id=*/std::nullopt, /*write_cols=*/std::nullopt));
+    };
+    auto file_names = [](const std::vector<ManifestEntry>& entries) {
+        std::vector<std::string> names;
+        for (const auto& entry : entries) {
+            names.push_back(entry.File()->file_name);
+        }
+        return names;
+    };
+
+    // section [1, 8]: no file meets v0 > 30.0, the whole section is dropped
+    // section [10, 20]: file-c meets the filter, file-d is kept as it overlaps with file-c
+    std::vector<ManifestEntry> entries = {
+        create_entry("file-a", 1, 5, 10.0, 20.0, /*level=*/0),
+        create_entry("file-c", 10, 20, 40.0, 50.0, /*level=*/1),
+        create_entry("file-b", 3, 8, 15.0, 25.0, /*level=*/0),
+        create_entry("file-d", 15, 18, 0.0, 1.0, /*level=*/0)};
+    ASSERT_OK_AND_ASSIGN(std::vector<ManifestEntry> filtered,
+                         scan->FilterWholeBucketByStats(std::move(entries)));
+    ASSERT_EQ(std::vector<std::string>({"file-c", "file-d"}), file_names(filtered));
+
+    // no section meets the filter
+    entries = {create_entry("file-a", 1, 5, 10.0, 20.0, /*level=*/0),
+               create_entry("file-b", 3, 8, 15.0, 25.0, /*level=*/1)};
+    ASSERT_OK_AND_ASSIGN(filtered, scan->FilterWholeBucketByStats(std::move(entries)));
+    ASSERT_TRUE(filtered.empty());
+}
 }  // namespace paimon::test
@@ -54,17 +54,16 @@ KeyValueFileStoreWrite::KeyValueFileStoreWrite(
     const std::shared_ptr<arrow::Schema>& partition_schema,
     const std::shared_ptr<FieldsComparator>& key_comparator,
     const std::shared_ptr<FieldsComparator>& user_defined_seq_comparator,
-    const std::shared_ptr<MergeFunctionWrapper<KeyValue>>& merge_function_wrapper,
-    const CoreOptions& options, bool ignore_previous_files, bool is_streaming_mode,
-    bool ignore_num_bucket_check, const std::shared_ptr<Executor>& executor,
-    const std::shared_ptr<MemoryPool>& pool)
+    const MergeFunctionWrapperFactory& merge_function_wrapper_factory, const CoreOptions& options,
+    bool ignore_previous_files, bool is_streaming_mode, bool ignore_num_bucket_check,
+    const std::shared_ptr<Executor>& executor, const std::shared_ptr<MemoryPool>& pool)
     : AbstractFileStoreWrite(file_store_path_factory, snapshot_manager, schema_manager, commit_user,
                              root_path, table_schema, schema, /*write_schema=*/schema,
                              partition_schema, options, ignore_previous_files, is_streaming_mode,
                              ignore_num_bucket_check, executor, pool),
       key_comparator_(key_comparator),
       user_defined_seq_comparator_(user_defined_seq_comparator),
-      merge_function_wrapper_(merge_function_wrapper),
+      merge_function_wrapper_factory_(merge_function_wrapper_factory),
       logger_(Logger::GetLogger("KeyValueFileStoreWrite")) {}
 
 Result<std::unique_ptr<FileStoreScan>> KeyValueFileStoreWrite::CreateFileStoreScan(
@@ -104,9 +103,11 @@ Result<std::pair<int32_t, std::shared_ptr<BatchWriter>>> KeyValueFileStoreWrite:
                            file_store_path_factory_->CreateDataFilePathFactory(partition, bucket));
     PAIMON_ASSIGN_OR_RAISE(std::vector<std::string> trimmed_primary_keys,
                            table_schema_->TrimmedPrimaryKeys());
+    PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<MergeFunctionWrapper<KeyValue>> merge_function_wrapper,
+                           merge_function_wrapper_factory_());
     auto writer = std::make_shared<MergeTreeWriter>(
         max_sequence_number, trimmed_primary_keys, data_file_path_factory, key_comparator_,
-        user_defined_seq_comparator_, merge_function_wrapper_, table_schema_->Id(), schema_,
+        user_defined_seq_comparator_, merge_function_wrapper, table_schema_->Id(), schema_,
         options_, pool_);
     return std::pair<int32_t, std::shared_ptr<BatchWriter>>(total_buckets, writer);
 }
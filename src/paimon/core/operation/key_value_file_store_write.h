@@ -17,6 +17,7 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
 #include <utility>
@@ -50,6 +51,11 @@ class MergeFunctionWrapper;
 
 class KeyValueFileStoreWrite : public AbstractFileStoreWrite {
  public:
+    // merge functions keep the state of the key being merged, so each writer creates its own to be
+    // flushed concurrently with other writers
+    using MergeFunctionWrapperFactory =
+        std::function<Result<std::shared_ptr<MergeFunctionWrapper<KeyValue>>>()>;
+
     KeyValueFileStoreWrite(
         const std::shared_ptr<FileStorePathFactory>& file_store_path_factory,
         const std::shared_ptr<SnapshotManager>& snapshot_manager,
@@ -59,7 +65,7 @@ class KeyValueFileStoreWrite : public AbstractFileStoreWrite {
         const std::shared_ptr<arrow::Schema>& partition_schema,
         const std::shared_ptr<FieldsComparator>& key_comparator,
         const std::shared_ptr<FieldsComparator>& user_defined_seq_comparator,
-        const std::shared_ptr<MergeFunctionWrapper<KeyValue>>& merge_function_wrapper,
+        const MergeFunctionWrapperFactory& merge_function_wrapper_factory,
         const CoreOptions& options, bool ignore_previous_files, bool is_streaming_mode,
         bool ignore_num_bucket_check, const std::shared_ptr<Executor>& executor,
         const std::shared_ptr<MemoryPool>& pool);
@@ -74,7 +80,7 @@ class KeyValueFileStoreWrite : public AbstractFileStoreWrite {
  private:
     std::shared_ptr<FieldsComparator> key_comparator_;
     std::shared_ptr<FieldsComparator> user_defined_seq_comparator_;
-    std::shared_ptr<MergeFunctionWrapper<KeyValue>> merge_function_wrapper_;
+    MergeFunctionWrapperFactory merge_function_wrapper_factory_;
     std::unique_ptr<Logger> logger_;
 };
 
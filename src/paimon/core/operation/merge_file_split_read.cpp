@@ -46,8 +46,6 @@
 #include "paimon/core/mergetree/compact/merge_function.h"
 #include "paimon/core/mergetree/compact/partial_update_merge_function.h"
 #include "paimon/core/mergetree/compact/reducer_merge_function_wrapper.h"
-#include "paimon/core/mergetree/compact/sort_merge_reader_with_loser_tree.h"
-#include "paimon/core/mergetree/compact/sort_merge_reader_with_min_heap.h"
 #include "paimon/core/mergetree/drop_delete_reader.h"
 #include "paimon/core/mergetree/sorted_run.h"
 #include "paimon/core/operation/internal_read_context.h"
@@ -431,17 +429,9 @@ Result<std::unique_ptr<KeyValueRecordReader>> MergeFileSplitRead::CreateReaderFo
 
 Result<std::unique_ptr<SortMergeReader>> MergeFileSplitRead::CreateSortMergeReader(
     std::vector<std::unique_ptr<KeyValueRecordReader>>&& record_readers) const {
-    auto sort_engine = options_.GetSortEngine();
-    if (sort_engine == SortEngine::MIN_HEAP) {
-        return std::make_unique<SortMergeReaderWithMinHeap>(
-            std::move(record_readers), key_comparator_, user_defined_seq_comparator_,
-            merge_function_wrapper_);
-    } else if (sort_engine == SortEngine::LOSER_TREE) {
-        return std::make_unique<SortMergeReaderWithLoserTree>(
-            std::move(record_readers), key_comparator_, user_defined_seq_comparator_,
-            merge_function_wrapper_);
-    }
-    return Status::Invalid("only support loser-tree or min-heap sort engine");
+    return SortMergeReader::Create(options_.GetSortEngine(), std::move(record_readers),
+                                   key_comparator_, user_defined_seq_comparator_,
+                                   merge_function_wrapper_);
 }
 
 Result<bool> MergeFileSplitRead::Match(const std::shared_ptr<Split>& split,
@@ -65,7 +65,7 @@ OrphanFilesCleanerImpl::OrphanFilesCleanerImpl(
 
 bool OrphanFilesCleanerImpl::SupportToClean(const std::string& file_name) {
     static std::vector<std::pair<std::string, std::string>> supported_pattern = {
-        {"manifest-", ""}, {"manifest-list-", ""}, {".", ".tmp"}};
+        {"manifest-", ""}, {"manifest-list-", ""}, {"partition-stats-", ""}, {".", ".tmp"}};
     for (const auto& pattern : supported_pattern) {
         if (StringUtils::StartsWith(file_name, pattern.first) &&
             StringUtils::EndsWith(file_name, pattern.second)) {
@@ -229,6 +229,10 @@ Result<std::set<std::string>> OrphanFilesCleanerImpl::GetUsedFiles() const {
         used_files.insert(SnapshotManager::SNAPSHOT_PREFIX + std::to_string(snapshot.Id()));
         used_files.insert(snapshot.BaseManifestList());
         used_files.insert(snapshot.DeltaManifestList());
+        std::optional<std::string> partition_stats_file = snapshot.PartitionStatsFileName();
+        if (partition_stats_file) {
+            used_files.insert(partition_stats_file.value());
+        }
         std::vector<ManifestFileMeta> manifests;
         PAIMON_RETURN_NOT_OK(manifest_list_->ReadIfFileExist(snapshot.BaseManifestList(),
                                                              /*filter=*/nullptr, &manifests));
@@ -45,6 +45,8 @@ TEST(OrphanFilesCleanerTest, TestSupportToClean) {
         OrphanFilesCleanerImpl::SupportToClean("manifest-3ea5ee21-d399-4f1c-a749-2fc63dbf0852-0"));
     ASSERT_TRUE(OrphanFilesCleanerImpl::SupportToClean(
         "manifest-list-469f3a0f-f6f1-4027-91bf-d1e897e8ea23-1"));
+    ASSERT_TRUE(OrphanFilesCleanerImpl::SupportToClean(
+        "partition-stats-469f3a0f-f6f1-4027-91bf-d1e897e8ea23-0"));
     ASSERT_TRUE(OrphanFilesCleanerImpl::SupportToClean(
         ".snapshot-2.13c988c3-784d-493d-8884-016ddddb1fc2.tmp"));
     ASSERT_FALSE(OrphanFilesCleanerImpl::SupportToClean("tmp"));
@@ -16,6 +16,8 @@
 
 #include "paimon/core/operation/raw_file_split_read.h"
 
+#include <algorithm>
+#include <cstddef>
 #include <optional>
 #include <utility>
 #include <vector>
@@ -25,9 +27,11 @@
 #include "paimon/common/file_index/bitmap/apply_bitmap_index_batch_reader.h"
 #include "paimon/common/reader/complete_row_kind_batch_reader.h"
 #include "paimon/common/reader/concat_batch_reader.h"
+#include "paimon/common/types/row_kind.h"
 #include "paimon/common/utils/arrow/status_utils.h"
 #include "paimon/core/core_options.h"
 #include "paimon/core/deletionvectors/bitmap_deletion_vector.h"
+#include "paimon/core/deletionvectors/deleted_rows_batch_reader.h"
 #include "paimon/core/deletionvectors/deletion_vector.h"
 #include "paimon/core/io/data_file_meta.h"
 #include "paimon/core/io/file_index_evaluator.h"
@@ -35,6 +39,7 @@
 #include "paimon/core/schema/schema_manager.h"
 #include "paimon/core/schema/table_schema.h"
 #include "paimon/core/table/source/data_split_impl.h"
+#include "paimon/core/table/source/deletion_file.h"
 #include "paimon/core/utils/file_store_path_factory.h"
 #include "paimon/file_index/bitmap_index_result.h"
 #include "paimon/file_index/file_index_result.h"
@@ -66,6 +71,9 @@ Result<std::unique_ptr<BatchReader>> RawFileSplitRead::CreateReader(
     if (!data_split) {
         return Status::Invalid("cannot cast split to data_split in RawFileSplitRead");
     }
+    if (HasDeletionVectorChanges(*data_split)) {
+        return CreateDeletedRowsReader(data_split);
+    }
     auto deletion_file_map = CreateDeletionFileMap(*data_split);
     const auto& predicate = context_->GetPredicate();
     PAIMON_ASSIGN_OR_RAISE(
@@ -82,6 +90,77 @@ Result<std::unique_ptr<BatchReader>> RawFileSplitRead::CreateReader(
     return std::make_unique<CompleteRowKindBatchReader>(std::move(batch_reader), pool_);
 }
 
+bool RawFileSplitRead::HasDeletionVectorChanges(const DataSplitImpl& data_split) {
+    if (data_split.BeforeFiles().empty()) {
+        return false;
+    }
+    auto has_deletion_file = [](const std::vector<std::optional<DeletionFile>>& deletion_files) {
+        return std::any_of(deletion_files.begin(), deletion_files.end(),
+                           [](const auto& deletion_file) { return deletion_file != std::nullopt; });
+    };
+    return has_deletion_file(data_split.DeletionFiles()) ||
+           has_deletion_file(data_split.BeforeDeletionFiles());
+}
+
+Result<std::unique_ptr<BatchReader>> RawFileSplitRead::CreateDeletedRowsReader(
+    const std::shared_ptr<DataSplitImpl>& data_split) const {
+    const auto& data_files = data_split->DataFiles();
+    const auto& deletion_files = data_split->DeletionFiles();
+    const auto& before_deletion_files = data_split->BeforeDeletionFiles();
+    if (data_split->BeforeFiles().size() != data_files.size() ||
+        deletion_files.size() != data_files.size() ||
+        before_deletion_files.size() != data_files.size()) {
+        return Status::Invalid(
+            "split with before files must carry the before and current deletion files of each "
+            "data file");
+    }
+    PAIMON_ASSIGN_OR_RAISE(
+        std::shared_ptr<DataFilePathFactory> data_file_path_factory,
+        path_factory_->CreateDataFilePathFactory(data_split->Partition(), data_split->Bucket()));
+    std::vector<std::unique_ptr<BatchReader>> deleted_rows_readers;
+    for (size_t i = 0; i < data_files.size(); ++i) {
+        PAIMON_ASSIGN_OR_RAISE(RoaringBitmap32 deleted_rows, ReadDeletedRows(deletion_files[i]));
+        PAIMON_ASSIGN_OR_RAISE(RoaringBitmap32 before_deleted_rows,
+                               ReadDeletedRows(before_deletion_files[i]));
+        deleted_rows -= before_deleted_rows;
+        if (deleted_rows.IsEmpty()) {
+            continue;
+        }
+        // positions are counted over the whole file, so nothing is pushed down into the reader
+        PAIMON_ASSIGN_OR_RAISE(
+            std::vector<std::unique_ptr<BatchReader>> raw_file_readers,
+            CreateRawFileReaders(data_split->Partition(), {data_files[i]}, raw_read_schema_,
+                                 /*predicate=*/nullptr, /*deletion_file_map=*/{},
+                                 /*row_ranges=*/{}, data_file_path_factory));
+        if (!raw_file_readers.empty()) {
+            deleted_rows_readers.push_back(std::make_unique<DeletedRowsBatchReader>(
+                std::move(raw_file_readers[0]), std::move(deleted_rows)));
+        }
+    }
+    auto concat_batch_reader =
+        std::make_unique<ConcatBatchReader>(std::move(deleted_rows_readers), pool_);
+    PAIMON_ASSIGN_OR_RAISE(
+        std::unique_ptr<BatchReader> batch_reader,
+        ApplyPredicateFilterIfNeeded(std::move(concat_batch_reader), context_->GetPredicate()));
+    return std::make_unique<CompleteRowKindBatchReader>(std::move(batch_reader), pool_,
+                                                        RowKind::Delete());
+}
+
+Result<RoaringBitmap32> RawFileSplitRead::ReadDeletedRows(
+    const std::optional<DeletionFile>& deletion_file) const {
+    if (deletion_file == std::nullopt) {
+        return RoaringBitmap32();
+    }
+    PAIMON_ASSIGN_OR_RAISE(PAIMON_UNIQUE_PTR<DeletionVector> deletion_vector,
+                           DeletionVector::Read(options_.GetFileSystem().get(),
+                                                deletion_file.value(), pool_.get()));
+    auto* bitmap_dv = dynamic_cast<BitmapDeletionVector*>(deletion_vector.get());
+    if (bitmap_dv == nullptr) {
+        return Status::NotImplemented("Only support BitmapDeletionVector");
+    }
+    return *bitmap_dv->GetBitmap();
+}
+
 Result<bool> RawFileSplitRead::Match(const std::shared_ptr<Split>& split,
                                      bool force_keep_delete) const {
     auto split_impl = dynamic_cast<DataSplitImpl*>(split.get());
@@ -28,6 +28,7 @@
 #include "paimon/read_context.h"
 #include "paimon/reader/batch_reader.h"
 #include "paimon/result.h"
+#include "paimon/utils/roaring_bitmap32.h"
 
 namespace arrow {
 class Schema;
@@ -36,6 +37,7 @@ class Schema;
 namespace paimon {
 class DataFilePathFactory;
 class DataSplit;
+class DataSplitImpl;
 class Executor;
 class FileBatchReader;
 class FileStorePathFactory;
@@ -73,6 +75,18 @@ class RawFileSplitRead : public AbstractSplitRead {
         const std::unordered_map<std::string, DeletionFile>& deletion_file_map,
         const std::optional<std::vector<Range>>& ranges,
         const std::shared_ptr<DataFilePathFactory>& data_file_path_factory) const override;
+
+ private:
+    /// Whether `data_split` carries deletion vector changes, i.e. has before files and a current
+    /// or previous deletion file.
+    static bool HasDeletionVectorChanges(const DataSplitImpl& data_split);
+
+    /// Read the rows deleted by the deletion vector changes of a split, whose before files are its
+    /// data files with their previous deletion files. All rows are returned as `RowKind::Delete()`.
+    Result<std::unique_ptr<BatchReader>> CreateDeletedRowsReader(
+        const std::shared_ptr<DataSplitImpl>& data_split) const;
+
+    Result<RoaringBitmap32> ReadDeletedRows(const std::optional<DeletionFile>& deletion_file) const;
 };
 
 }  // namespace paimon
@@ -16,7 +16,9 @@
 
 #include "paimon/core/operation/raw_file_split_read.h"
 
+#include <memory>
 #include <optional>
+#include <string>
 #include <utility>
 #include <variant>
 #include <vector>
@@ -412,6 +414,78 @@ TEST_F(RawFileSplitReadTest, TestEmptyPlan) {
     ASSERT_EQ(result_array, nullptr);
 }
 
+TEST_F(RawFileSplitReadTest, TestBeforeFilesWithoutDeletionVectorChanges) {
+    std::string path = paimon::test::GetDataDir() +
+                       "/orc/multi_partition_append_table.db/"
+                       "multi_partition_append_table";
+    ReadContextBuilder context_builder(path);
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<ReadContext> read_context, context_builder.Finish());
+    SchemaManager schema_manager(std::make_shared<LocalFileSystem>(), read_context->GetPath());
+    ASSERT_OK_AND_ASSIGN(auto table_schema, schema_manager.ReadSchema(0));
+
+    ASSERT_OK_AND_ASSIGN(auto internal_context,
+                         InternalReadContext::Create(std::move(read_context), table_schema,
+                                                     table_schema->Options()));
+    const auto& core_options = internal_context->GetCoreOptions();
+    auto arrow_schema = DataField::ConvertDataFieldsToArrowSchema(table_schema->Fields());
+    ASSERT_OK_AND_ASSIGN(std::vector<std::string> external_paths,
+                         core_options.CreateExternalPaths());
+    ASSERT_OK_AND_ASSIGN(
+        std::shared_ptr<FileStorePathFactory> path_factory,
+        FileStorePathFactory::Create(
+            internal_context->GetPath(), arrow_schema, table_schema->PartitionKeys(),
+            core_options.GetPartitionDefaultName(), core_options.GetWriteFileFormat()->Identifier(),
+            core_options.DataFilePrefix(), core_options.LegacyPartitionNameEnabled(),
+            external_paths, core_options.IndexFileInDataFileDir(), pool_));
+    auto split_read =
+        std::make_unique<RawFileSplitRead>(path_factory, std::move(internal_context), pool_,
+                                           CreateDefaultExecutor(/*thread_count=*/2));
+
+    auto meta = std::make_shared<DataFileMeta>(
+        "data-01b6a930-6564-409b-b8f4-ed1307790d72-0.orc", /*file_size=*/575, /*row_count=*/3,
+        /*min_key=*/BinaryRow::EmptyRow(), /*max_key=*/BinaryRow::EmptyRow(),
+        /*key_stats=*/SimpleStats::EmptyStats(),
+        BinaryRowGenerator::GenerateStats({"Bob", 10, 0, 12.1}, {"Tony", 10, 0, 14.1},
+                                          {0, 0, 0, 0}, pool_.get()),
+        /*min_sequence_number=*/0, /*max_sequence_number=*/2, /*schema_id=*/0,
+        /*level=*/0, /*extra_files=*/std::vector<std::optional<std::string>>(),
+        /*creation_time=*/Timestamp(1728497439433ll, 0),
+        /*delete_row_count=*/0, /*embedded_index=*/nullptr, FileSource::Append(),
+        /*value_stats_cols=*/std::nullopt, /*external_path=*/std::nullopt,
+        /*first_row_id=*/std::nullopt,
+        /*write_cols=*/std::nullopt);
+    // before files without any deletion file do not carry deletion vector changes, so the data
+    // files are read as usual
+    DataSplitImpl::Builder builder(BinaryRowGenerator::GenerateRow({10, 0}, pool_.get()),
+                                   /*bucket=*/0, /*bucket_path=*/
+                                   paimon::test::GetDataDir() +
+                                       "/orc/multi_partition_append_table.db/"
+                                       "multi_partition_append_table/f1=10/f2=0/bucket-0",
+                                   {meta});
+    ASSERT_OK_AND_ASSIGN(auto data_split, builder.WithSnapshot(1)
+                                              .WithBeforeFiles({meta})
+                                              .IsStreaming(true)
+                                              .RawConvertible(true)
+                                              .Build());
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<BatchReader> reader, split_read->CreateReader(data_split));
+    ASSERT_OK_AND_ASSIGN(auto result_array, ReadResultCollector::CollectResult(reader.get()));
+
+    arrow::FieldVector fields_with_row_kind = {arrow::field("_VALUE_KIND", arrow::int8())};
+    for (const auto& field : arrow_schema->fields()) {
+        fields_with_row_kind.push_back(field);
+    }
+    std::shared_ptr<arrow::ChunkedArray> expected_array;
+    auto array_status =
+        arrow::ipc::internal::json::ChunkedArrayFromJSON(arrow::struct_(fields_with_row_kind), {R"([
+      [0, "Bob", 10, 0, 12.1],
+      [0, "Emily", 10, 0, 13.1],
+      [0, "Tony", 10, 0, 14.1]
+    ])"},
+                                                         &expected_array);
+    ASSERT_TRUE(array_status.ok());
+    ASSERT_TRUE(result_array->Equals(expected_array)) << result_array->ToString();
+}
+
 TEST_F(RawFileSplitReadTest, TestMatch) {
     std::string path = paimon::test::GetDataDir() +
                        "/orc/pk_table_with_total_buckets.db/pk_table_with_total_buckets";
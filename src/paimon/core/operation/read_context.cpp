@@ -22,6 +22,7 @@
 #include "paimon/core/utils/branch_manager.h"
 #include "paimon/executor.h"
 #include "paimon/memory/memory_pool.h"
+#include "paimon/schema/schema.h"
 #include "paimon/status.h"
 
 namespace paimon {
@@ -34,6 +35,7 @@ ReadContext::ReadContext(const std::string& path, const std::string& branch,
                          uint32_t prefetch_max_parallel_num, bool enable_multi_thread_row_to_batch,
                          uint32_t row_to_batch_thread_number,
                          const std::optional<std::string>& table_schema,
+                         const std::shared_ptr<Schema>& loaded_table_schema,
                          const std::shared_ptr<MemoryPool>& memory_pool,
                          const std::shared_ptr<Executor>& executor,
                          const std::map<std::string, std::string>& fs_scheme_to_identifier_map,
@@ -49,6 +51,7 @@ ReadContext::ReadContext(const std::string& path, const std::string& branch,
       enable_multi_thread_row_to_batch_(enable_multi_thread_row_to_batch),
       row_to_batch_thread_number_(row_to_batch_thread_number),
       table_schema_(table_schema),
+      loaded_table_schema_(loaded_table_schema),
       memory_pool_(memory_pool),
       executor_(executor),
       fs_scheme_to_identifier_map_(fs_scheme_to_identifier_map),
@@ -72,6 +75,7 @@ class ReadContextBuilder::Impl {
         enable_multi_thread_row_to_batch_ = false;
         row_to_batch_thread_number_ = 1;
         table_schema_ = std::nullopt;
+        loaded_table_schema_.reset();
         memory_pool_ = GetDefaultPool();
         executor_.reset();
     }
@@ -90,6 +94,7 @@ class ReadContextBuilder::Impl {
     bool enable_multi_thread_row_to_batch_ = false;
     uint32_t row_to_batch_thread_number_ = 1;
     std::optional<std::string> table_schema_;
+    std::shared_ptr<Schema> loaded_table_schema_;
     std::shared_ptr<MemoryPool> memory_pool_ = GetDefaultPool();
     std::shared_ptr<Executor> executor_;
 };
@@ -169,6 +174,12 @@ ReadContextBuilder& ReadContextBuilder::SetTableSchema(const std::string& table_
     return *this;
 }
 
+ReadContextBuilder& ReadContextBuilder::SetTableSchema(
+    const std::shared_ptr<Schema>& table_schema) {
+    impl_->loaded_table_schema_ = table_schema;
+    return *this;
+}
+
 ReadContextBuilder& ReadContextBuilder::WithBranch(const std::string& branch) {
     impl_->branch_ = branch;
     return *this;
@@ -206,8 +217,9 @@ Result<std::unique_ptr<ReadContext>> ReadContextBuilder::Finish() {
         impl_->path_, impl_->branch_, impl_->read_field_names_, impl_->predicate_,
         impl_->enable_predicate_filter_, impl_->enable_prefetch_, impl_->prefetch_batch_count_,
         impl_->prefetch_max_parallel_num_, impl_->enable_multi_thread_row_to_batch_,
-        impl_->row_to_batch_thread_number_, impl_->table_schema_, impl_->memory_pool_,
-        impl_->executor_, impl_->fs_scheme_to_identifier_map_, impl_->options_);
+        impl_->row_to_batch_thread_number_, impl_->table_schema_, impl_->loaded_table_schema_,
+        impl_->memory_pool_, impl_->executor_, impl_->fs_scheme_to_identifier_map_,
+        impl_->options_);
     impl_->Reset();
     return ctx;
 }
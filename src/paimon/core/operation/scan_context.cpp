@@ -21,6 +21,7 @@
 #include "paimon/common/utils/path_util.h"
 #include "paimon/executor.h"
 #include "paimon/memory/memory_pool.h"
+#include "paimon/schema/schema.h"
 #include "paimon/status.h"
 
 namespace paimon {
@@ -30,6 +31,7 @@ ScanContext::ScanContext(const std::string& path, bool is_streaming_mode,
                          std::optional<int32_t> limit,
                          const std::shared_ptr<ScanFilter>& scan_filter,
                          const std::shared_ptr<GlobalIndexResult>& global_index_result,
+                         const std::shared_ptr<Schema>& table_schema,
                          const std::shared_ptr<MemoryPool>& memory_pool,
                          const std::shared_ptr<Executor>& executor,
                          const std::map<std::string, std::string>& options)
@@ -38,6 +40,7 @@ ScanContext::ScanContext(const std::string& path, bool is_streaming_mode,
       limit_(limit),
       scan_filters_(scan_filter),
       global_index_result_(global_index_result),
+      table_schema_(table_schema),
       memory_pool_(memory_pool),
       executor_(executor),
       options_(options) {}
@@ -55,6 +58,7 @@ class ScanContextBuilder::Impl {
         partition_filters_.clear();
         predicates_.reset();
         global_index_result_.reset();
+        table_schema_.reset();
         memory_pool_ = GetDefaultPool();
         executor_ = CreateDefaultExecutor();
         options_.clear();
@@ -68,6 +72,7 @@ class ScanContextBuilder::Impl {
     std::vector<std::map<std::string, std::string>> partition_filters_;
     std::shared_ptr<Predicate> predicates_;
     std::shared_ptr<GlobalIndexResult> global_index_result_;
+    std::shared_ptr<Schema> table_schema_;
     std::shared_ptr<MemoryPool> memory_pool_ = GetDefaultPool();
     std::shared_ptr<Executor> executor_ = CreateDefaultExecutor();
     std::map<std::string, std::string> options_;
@@ -110,6 +115,12 @@ ScanContextBuilder& ScanContextBuilder::SetGlobalIndexResult(
     return *this;
 }
 
+ScanContextBuilder& ScanContextBuilder::SetTableSchema(
+    const std::shared_ptr<Schema>& table_schema) {
+    impl_->table_schema_ = table_schema;
+    return *this;
+}
+
 ScanContextBuilder& ScanContextBuilder::SetOptions(
     const std::map<std::string, std::string>& options) {
     impl_->options_ = options;
@@ -142,7 +153,8 @@ Result<std::unique_ptr<ScanContext>> ScanContextBuilder::Finish() {
         impl_->path_, impl_->is_streaming_mode_, impl_->limit_,
         std::make_shared<ScanFilter>(impl_->predicates_, impl_->partition_filters_,
                                      impl_->bucket_filter_),
-        impl_->global_index_result_, impl_->memory_pool_, impl_->executor_, impl_->options_);
+        impl_->global_index_result_, impl_->table_schema_, impl_->memory_pool_, impl_->executor_,
+        impl_->options_);
     impl_->Reset();
     return ctx;
 }
@@ -0,0 +1,169 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/table_delete.h"
+
+#include <map>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "fmt/format.h"
+#include "paimon/common/predicate/predicate_filter.h"
+#include "paimon/common/predicate/predicate_validator.h"
+#include "paimon/common/types/data_field.h"
+#include "paimon/core/core_options.h"
+#include "paimon/core/index/index_file_handler.h"
+#include "paimon/core/manifest/index_manifest_file.h"
+#include "paimon/core/manifest/manifest_file.h"
+#include "paimon/core/manifest/manifest_list.h"
+#include "paimon/core/operation/append_only_file_store_scan.h"
+#include "paimon/core/operation/table_delete_impl.h"
+#include "paimon/core/schema/schema_manager.h"
+#include "paimon/core/schema/table_schema.h"
+#include "paimon/core/utils/field_mapping.h"
+#include "paimon/core/utils/file_store_path_factory.h"
+#include "paimon/core/utils/index_file_path_factories.h"
+#include "paimon/core/utils/snapshot_manager.h"
+#include "paimon/defs.h"
+#include "paimon/format/file_format.h"
+#include "paimon/read_context.h"
+#include "paimon/scan_context.h"
+#include "paimon/status.h"
+#include "paimon/table/source/table_read.h"
+#include "paimon/table/source/table_scan.h"
+
+namespace paimon {
+
+Result<std::unique_ptr<TableDelete>> TableDelete::Create(std::unique_ptr<ScanContext> context) {
+    if (context == nullptr) {
+        return Status::Invalid("scan context is null pointer");
+    }
+    if (context->GetMemoryPool() == nullptr) {
+        return Status::Invalid("memory pool is null pointer");
+    }
+    if (context->GetExecutor() == nullptr) {
+        return Status::Invalid("executor is null pointer");
+    }
+    if (context->IsStreamingMode()) {
+        return Status::Invalid("table delete does not support streaming mode");
+    }
+    std::shared_ptr<Predicate> predicate;
+    if (context->GetScanFilters()) {
+        predicate = context->GetScanFilters()->GetPredicate();
+    }
+    if (predicate == nullptr) {
+        return Status::Invalid("table delete requires a predicate");
+    }
+    auto predicate_filter = std::dynamic_pointer_cast<PredicateFilter>(predicate);
+    if (predicate_filter == nullptr) {
+        return Status::Invalid(
+            fmt::format("predicate {} does not support Test", predicate->ToString()));
+    }
+
+    // load schema
+    PAIMON_ASSIGN_OR_RAISE(CoreOptions tmp_options, CoreOptions::FromMap(context->GetOptions()));
+    SchemaManager schema_manager(tmp_options.GetFileSystem(), context->GetPath());
+    PAIMON_ASSIGN_OR_RAISE(std::optional<std::shared_ptr<TableSchema>> latest_table_schema,
+                           schema_manager.Latest());
+    if (latest_table_schema == std::nullopt) {
+        return Status::Invalid("not found latest schema");
+    }
+    const auto& table_schema = latest_table_schema.value();
+    auto options = table_schema->Options();
+    for (const auto& [key, value] : context->GetOptions()) {
+        options[key] = value;
+    }
+    PAIMON_ASSIGN_OR_RAISE(CoreOptions core_options, CoreOptions::FromMap(options));
+    if (!table_schema->PrimaryKeys().empty()) {
+        return Status::NotImplemented("table delete only supports append table");
+    }
+    if (!core_options.DeletionVectorsEnabled()) {
+        return Status::Invalid(
+            fmt::format("table delete requires {} = true", Options::DELETION_VECTORS_ENABLED));
+    }
+    if (core_options.DataEvolutionEnabled()) {
+        return Status::NotImplemented("table delete does not support data evolution table");
+    }
+    auto arrow_schema = DataField::ConvertDataFieldsToArrowSchema(table_schema->Fields());
+    PAIMON_RETURN_NOT_OK(PredicateValidator::ValidatePredicateWithSchema(
+        *arrow_schema, predicate, /*validate_field_idx=*/true));
+
+    auto pool = context->GetMemoryPool();
+    PAIMON_ASSIGN_OR_RAISE(std::vector<std::string> external_paths,
+                           core_options.CreateExternalPaths());
+    PAIMON_ASSIGN_OR_RAISE(
+        std::shared_ptr<FileStorePathFactory> path_factory,
+        FileStorePathFactory::Create(
+            context->GetPath(), arrow_schema, table_schema->PartitionKeys(),
+            core_options.GetPartitionDefaultName(), core_options.GetWriteFileFormat()->Identifier(),
+            core_options.DataFilePrefix(), core_options.LegacyPartitionNameEnabled(),
+            external_paths, core_options.IndexFileInDataFileDir(), pool));
+    PAIMON_ASSIGN_OR_RAISE(
+        std::unique_ptr<IndexManifestFile> index_manifest_file,
+        IndexManifestFile::Create(core_options.GetFileSystem(), core_options.GetManifestFormat(),
+                                  core_options.GetManifestCompression(), path_factory, pool,
+                                  core_options));
+    auto index_file_handler = std::make_unique<IndexFileHandler>(
+        std::move(index_manifest_file), std::make_shared<IndexFilePathFactories>(path_factory));
+    auto snapshot_manager =
+        std::make_shared<SnapshotManager>(core_options.GetFileSystem(), context->GetPath());
+
+    // the live data files of a bucket are read without the predicate of the delete
+    PAIMON_ASSIGN_OR_RAISE(
+        std::shared_ptr<ManifestList> manifest_list,
+        ManifestList::Create(core_options.GetFileSystem(), core_options.GetManifestFormat(),
+                             core_options.GetManifestCompression(), path_factory, pool));
+    PAIMON_ASSIGN_OR_RAISE(
+        std::shared_ptr<arrow::Schema> partition_schema,
+        FieldMapping::GetPartitionSchema(arrow_schema, table_schema->PartitionKeys()));
+    PAIMON_ASSIGN_OR_RAISE(
+        std::shared_ptr<ManifestFile> manifest_file,
+        ManifestFile::Create(core_options.GetFileSystem(), core_options.GetManifestFormat(),
+                             core_options.GetManifestCompression(), path_factory,
+                             core_options.GetManifestTargetFileSize(), pool, core_options,
+                             partition_schema));
+    auto scan_filter =
+        std::make_shared<ScanFilter>(/*predicate=*/nullptr, /*partition_filters=*/
+                                     std::vector<std::map<std::string, std::string>>(),
+                                     /*bucket_filter=*/std::nullopt);
+    PAIMON_ASSIGN_OR_RAISE(
+        std::unique_ptr<FileStoreScan> file_store_scan,
+        AppendOnlyFileStoreScan::Create(
+            snapshot_manager,
+            std::make_shared<SchemaManager>(core_options.GetFileSystem(), context->GetPath()),
+            manifest_list, manifest_file, table_schema, arrow_schema, scan_filter, core_options,
+            context->GetExecutor(), pool));
+
+    // matched rows are located by reading whole files, so the read has no predicate
+    ReadContextBuilder read_context_builder(context->GetPath());
+    read_context_builder.SetOptions(context->GetOptions())
+        .WithMemoryPool(pool)
+        .WithExecutor(context->GetExecutor());
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<ReadContext> read_context,
+                           read_context_builder.Finish());
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<TableRead> table_read,
+                           TableRead::Create(std::move(read_context)));
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<TableScan> table_scan,
+                           TableScan::Create(std::move(context)));
+    return std::make_unique<TableDeleteImpl>(
+        table_schema, arrow_schema, core_options, predicate_filter, path_factory,
+        snapshot_manager, std::move(index_file_handler), std::move(table_scan),
+        std::move(file_store_scan), std::move(table_read), pool);
+}
+
+}  // namespace paimon
@@ -0,0 +1,262 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/operation/table_delete_impl.h"
+
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+#include "arrow/api.h"
+#include "arrow/c/bridge.h"
+#include "fmt/format.h"
+#include "paimon/common/data/binary_row.h"
+#include "paimon/common/predicate/predicate_filter.h"
+#include "paimon/common/table/special_fields.h"
+#include "paimon/common/utils/arrow/status_utils.h"
+#include "paimon/core/deletionvectors/bitmap_deletion_vector.h"
+#include "paimon/core/deletionvectors/deletion_vector.h"
+#include "paimon/core/deletionvectors/deletion_vectors_index_file.h"
+#include "paimon/core/index/index_file_handler.h"
+#include "paimon/core/index/index_file_meta.h"
+#include "paimon/core/io/compact_increment.h"
+#include "paimon/core/io/data_file_meta.h"
+#include "paimon/core/io/data_increment.h"
+#include "paimon/core/io/file_index_evaluator.h"
+#include "paimon/core/manifest/manifest_entry.h"
+#include "paimon/core/operation/file_store_scan.h"
+#include "paimon/core/schema/table_schema.h"
+#include "paimon/core/snapshot.h"
+#include "paimon/core/table/sink/commit_message_impl.h"
+#include "paimon/core/table/source/data_split_impl.h"
+#include "paimon/core/utils/file_store_path_factory.h"
+#include "paimon/core/utils/snapshot_manager.h"
+#include "paimon/file_index/file_index_result.h"
+#include "paimon/reader/batch_reader.h"
+#include "paimon/status.h"
+#include "paimon/table/source/plan.h"
+#include "paimon/table/source/table_read.h"
+#include "paimon/table/source/table_scan.h"
+
+namespace paimon {
+
+TableDeleteImpl::TableDeleteImpl(const std::shared_ptr<TableSchema>& table_schema,
+                                 const std::shared_ptr<arrow::Schema>& arrow_schema,
+                                 const CoreOptions& core_options,
+                                 const std::shared_ptr<PredicateFilter>& predicate_filter,
+                                 const std::shared_ptr<FileStorePathFactory>& path_factory,
+                                 const std::shared_ptr<SnapshotManager>& snapshot_manager,
+                                 std::unique_ptr<IndexFileHandler>&& index_file_handler,
+                                 std::unique_ptr<TableScan>&& table_scan,
+                                 std::unique_ptr<FileStoreScan>&& file_store_scan,
+                                 std::unique_ptr<TableRead>&& table_read,
+                                 const std::shared_ptr<MemoryPool>& pool)
+    : table_schema_(table_schema),
+      arrow_schema_(arrow_schema),
+      core_options_(core_options),
+      predicate_filter_(predicate_filter),
+      path_factory_(path_factory),
+      snapshot_manager_(snapshot_manager),
+      index_file_handler_(std::move(index_file_handler)),
+      table_scan_(std::move(table_scan)),
+      file_store_scan_(std::move(file_store_scan)),
+      table_read_(std::move(table_read)),
+      pool_(pool) {}
+
+TableDeleteImpl::~TableDeleteImpl() = default;
+
+Result<std::vector<std::shared_ptr<CommitMessage>>> TableDeleteImpl::Delete() {
+    std::vector<std::shared_ptr<CommitMessage>> commit_messages;
+    PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<Plan> plan, table_scan_->CreatePlan());
+    if (plan->SnapshotId() == std::nullopt) {
+        return commit_messages;
+    }
+
+    // collect the matched row positions of each data file, grouped by partition and bucket
+    struct BucketDeletion {
+        std::optional<int32_t> total_buckets;
+        std::map<std::string, RoaringBitmap32> positions;
+    };
+    using PartitionBucket = std::pair<BinaryRow, int32_t>;
+    std::vector<PartitionBucket> touched_buckets;
+    std::unordered_map<PartitionBucket, BucketDeletion> bucket_deletions;
+    std::unordered_set<BinaryRow> partitions;
+    for (const auto& split : plan->Splits()) {
+        auto data_split = std::dynamic_pointer_cast<DataSplitImpl>(split);
+        if (!data_split) {
+            return Status::Invalid("cannot cast split to data_split in TableDelete");
+        }
+        PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<DataFilePathFactory> data_file_path_factory,
+                               path_factory_->CreateDataFilePathFactory(data_split->Partition(),
+                                                                        data_split->Bucket()));
+        for (const auto& file : data_split->DataFiles()) {
+            PAIMON_ASSIGN_OR_RAISE(RoaringBitmap32 positions,
+                                   MatchedPositions(*data_split, file, data_file_path_factory));
+            if (positions.IsEmpty()) {
+                continue;
+            }
+            PartitionBucket key(data_split->Partition(), data_split->Bucket());
+            auto iter = bucket_deletions.find(key);
+            if (iter == bucket_deletions.end()) {
+                touched_buckets.push_back(key);
+                partitions.insert(data_split->Partition());
+                iter = bucket_deletions.emplace(key, BucketDeletion()).first;
+                iter->second.total_buckets = data_split->TotalBuckets();
+            }
+            iter->second.positions[file->file_name] |= positions;
+        }
+    }
+    if (touched_buckets.empty()) {
+        return commit_messages;
+    }
+
+    // merge with the deletion vectors of the snapshot, each touched bucket gets a new index file
+    // which replaces all its previous ones
+    PAIMON_ASSIGN_OR_RAISE(Snapshot snapshot,
+                           snapshot_manager_->LoadSnapshot(plan->SnapshotId().value()));
+    PAIMON_ASSIGN_OR_RAISE(
+        IndexFileHandler::IndexFileMetaGroups dv_index_files,
+        index_file_handler_->Scan(snapshot, DeletionVectorsIndexFile::DELETION_VECTORS_INDEX,
+                                  partitions));
+    // deletion vectors of data files which are no longer live, e.g. rewritten by a compaction, are
+    // not carried forward, the commit rejects deletion vectors of missing data files
+    PAIMON_ASSIGN_OR_RAISE(
+        std::vector<ManifestEntry> live_entries,
+        file_store_scan_->ReadBucketFiles(
+            snapshot, FileStoreScan::BucketSet(touched_buckets.begin(), touched_buckets.end())));
+    std::unordered_map<PartitionBucket, std::unordered_set<std::string>> live_file_names;
+    for (const auto& entry : live_entries) {
+        live_file_names[PartitionBucket(entry.Partition(), entry.Bucket())].insert(
+            entry.FileName());
+    }
+    for (const auto& key : touched_buckets) {
+        const auto& [partition, bucket] = key;
+        PAIMON_ASSIGN_OR_RAISE(
+            std::unique_ptr<DeletionVectorsIndexFile> dv_index,
+            index_file_handler_->DvIndex(core_options_.GetFileSystem(), partition, bucket, pool_));
+        std::map<std::string, PAIMON_UNIQUE_PTR<DeletionVector>> deletion_vectors;
+        std::vector<std::shared_ptr<IndexFileMeta>> old_index_files;
+        auto index_iter = dv_index_files.find(key);
+        if (index_iter != dv_index_files.end()) {
+            old_index_files = index_iter->second;
+        }
+        const auto& bucket_live_file_names = live_file_names[key];
+        for (const auto& index_file : old_index_files) {
+            PAIMON_ASSIGN_OR_RAISE(auto old_deletion_vectors,
+                                   dv_index->ReadAllDeletionVectors(index_file));
+            for (auto& [data_file_name, deletion_vector] : old_deletion_vectors) {
+                if (bucket_live_file_names.find(data_file_name) == bucket_live_file_names.end()) {
+                    continue;
+                }
+                deletion_vectors[data_file_name] = std::move(deletion_vector);
+            }
+        }
+        const BucketDeletion& bucket_deletion = bucket_deletions[key];
+        int64_t deleted_rows = 0;
+        for (const auto& [data_file_name, positions] : bucket_deletion.positions) {
+            auto& deletion_vector = deletion_vectors[data_file_name];
+            if (deletion_vector == nullptr) {
+                deletion_vector = pool_->AllocateUnique<BitmapDeletionVector>(RoaringBitmap32());
+            }
+            for (auto iter = positions.Begin(); iter != positions.End(); ++iter) {
+                PAIMON_ASSIGN_OR_RAISE(bool deleted, deletion_vector->CheckedDelete(*iter));
+                deleted_rows += deleted ? 1 : 0;
+            }
+        }
+        if (deleted_rows == 0) {
+            // all matched rows have been deleted before
+            continue;
+        }
+        PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<IndexFileMeta> new_index_file,
+                               dv_index->WriteSingleFile(deletion_vectors));
+        DataIncrement data_increment(
+            /*new_files=*/{}, /*deleted_files=*/{}, /*changelog_files=*/{},
+            /*new_index_files=*/{new_index_file}, std::move(old_index_files));
+        CompactIncrement compact_increment(/*compact_before=*/{}, /*compact_after=*/{},
+                                           /*changelog_files=*/{});
+        commit_messages.push_back(std::make_shared<CommitMessageImpl>(
+            partition, bucket, bucket_deletion.total_buckets, data_increment, compact_increment));
+    }
+    return commit_messages;
+}
+
+Result<RoaringBitmap32> TableDeleteImpl::MatchedPositions(
+    const DataSplitImpl& split, const std::shared_ptr<DataFileMeta>& file,
+    const std::shared_ptr<DataFilePathFactory>& data_file_path_factory) const {
+    // file indexes are built with the write schema, only use them when it is the current one
+    if (core_options_.FileIndexReadEnabled() && file->schema_id == table_schema_->Id()) {
+        PAIMON_ASSIGN_OR_RAISE(
+            std::shared_ptr<FileIndexResult> file_index_result,
+            FileIndexEvaluator::Evaluate(arrow_schema_, predicate_filter_, data_file_path_factory,
+                                         file, core_options_.GetFileSystem(), pool_));
+        PAIMON_ASSIGN_OR_RAISE(bool is_remain, file_index_result->IsRemain());
+        if (!is_remain) {
+            return RoaringBitmap32();
+        }
+    }
+    // read the whole file without predicate pushdown or deletion vectors, so that the i-th read
+    // row is the i-th row of the file
+    DataSplitImpl::Builder builder(split.Partition(), split.Bucket(), split.BucketPath(),
+                                   std::vector<std::shared_ptr<DataFileMeta>>({file}));
+    PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<DataSplitImpl> file_split,
+                           builder.WithSnapshot(split.SnapshotId())
+                               .WithTotalBuckets(split.TotalBuckets())
+                               .RawConvertible(true)
+                               .Build());
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<BatchReader> reader,
+                           table_read_->CreateReader(file_split));
+    RoaringBitmap32 positions;
+    int64_t row_offset = 0;
+    while (true) {
+        PAIMON_ASSIGN_OR_RAISE(BatchReader::ReadBatch batch, reader->NextBatch());
+        if (BatchReader::IsEofBatch(batch)) {
+            break;
+        }
+        auto& [c_array, c_schema] = batch;
+        PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(std::shared_ptr<arrow::Array> array,
+                                          arrow::ImportArray(c_array.get(), c_schema.get()));
+        auto struct_array = std::dynamic_pointer_cast<arrow::StructArray>(array);
+        if (!struct_array) {
+            return Status::Invalid("read batch is not a struct array in TableDelete");
+        }
+        // remove the row kind column, the predicate uses the field indexes of the table schema
+        arrow::ArrayVector children = struct_array->fields();
+        arrow::FieldVector fields = struct_array->struct_type()->fields();
+        if (!fields.empty() && fields[0]->name() == SpecialFields::ValueKind().Name()) {
+            children.erase(children.begin());
+            fields.erase(fields.begin());
+            PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(array, arrow::StructArray::Make(children, fields));
+        }
+        PAIMON_ASSIGN_OR_RAISE(std::vector<char> matched, predicate_filter_->Test(*array));
+        for (size_t i = 0; i < matched.size(); i++) {
+            if (!matched[i]) {
+                continue;
+            }
+            int64_t position = row_offset + static_cast<int64_t>(i);
+            if (position > RoaringBitmap32::MAX_VALUE) {
+                reader->Close();
+                return Status::Invalid(fmt::format(
+                    "data file {} has too many rows for deletion vectors", file->file_name));
+            }
+            positions.Add(static_cast<int32_t>(position));
+        }
+        row_offset += array->length();
+    }
+    reader->Close();
+    return positions;
+}
+
+}  // namespace paimon
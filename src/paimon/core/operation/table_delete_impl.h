@@ -0,0 +1,86 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "paimon/core/core_options.h"
+#include "paimon/result.h"
+#include "paimon/table_delete.h"
+#include "paimon/utils/roaring_bitmap32.h"
+
+namespace arrow {
+class Schema;
+}  // namespace arrow
+
+namespace paimon {
+class CommitMessage;
+class DataFilePathFactory;
+class DataSplitImpl;
+class FileStorePathFactory;
+class FileStoreScan;
+class IndexFileHandler;
+class MemoryPool;
+class PredicateFilter;
+class SnapshotManager;
+class TableRead;
+class TableScan;
+class TableSchema;
+struct DataFileMeta;
+
+class TableDeleteImpl : public TableDelete {
+ public:
+    TableDeleteImpl(const std::shared_ptr<TableSchema>& table_schema,
+                    const std::shared_ptr<arrow::Schema>& arrow_schema,
+                    const CoreOptions& core_options,
+                    const std::shared_ptr<PredicateFilter>& predicate_filter,
+                    const std::shared_ptr<FileStorePathFactory>& path_factory,
+                    const std::shared_ptr<SnapshotManager>& snapshot_manager,
+                    std::unique_ptr<IndexFileHandler>&& index_file_handler,
+                    std::unique_ptr<TableScan>&& table_scan,
+                    std::unique_ptr<FileStoreScan>&& file_store_scan,
+                    std::unique_ptr<TableRead>&& table_read,
+                    const std::shared_ptr<MemoryPool>& pool);
+
+    ~TableDeleteImpl() override;
+
+    Result<std::vector<std::shared_ptr<CommitMessage>>> Delete() override;
+
+ private:
+    /// @return Positions of the rows in `file` matched by the predicate, empty if none.
+    Result<RoaringBitmap32> MatchedPositions(
+        const DataSplitImpl& split, const std::shared_ptr<DataFileMeta>& file,
+        const std::shared_ptr<DataFilePathFactory>& data_file_path_factory) const;
+
+ private:
+    std::shared_ptr<TableSchema> table_schema_;
+    std::shared_ptr<arrow::Schema> arrow_schema_;
+    CoreOptions core_options_;
+    std::shared_ptr<PredicateFilter> predicate_filter_;
+    std::shared_ptr<FileStorePathFactory> path_factory_;
+    std::shared_ptr<SnapshotManager> snapshot_manager_;
+    std::unique_ptr<IndexFileHandler> index_file_handler_;
+    std::unique_ptr<TableScan> table_scan_;
+    // scan without filters, reads all live data files of the touched buckets
+    std::unique_ptr<FileStoreScan> file_store_scan_;
+    std::unique_ptr<TableRead> table_read_;
+    std::shared_ptr<MemoryPool> pool_;
+};
+}  // namespace paimon
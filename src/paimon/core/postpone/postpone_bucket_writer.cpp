@@ -36,13 +36,14 @@
 #include "paimon/common/types/row_kind.h"
 #include "paimon/common/utils/arrow/mem_utils.h"
 #include "paimon/common/utils/arrow/status_utils.h"
-#include "paimon/common/utils/scope_guard.h"
 #include "paimon/core/io/compact_increment.h"
 #include "paimon/core/io/data_file_path_factory.h"
 #include "paimon/core/io/data_increment.h"
+#include "paimon/core/io/format_writer_context.h"
 #include "paimon/core/io/key_value_data_file_writer.h"
 #include "paimon/core/io/single_file_writer.h"
 #include "paimon/core/manifest/file_source.h"
+#include "paimon/core/stats/column_sketch_collector.h"
 #include "paimon/core/utils/commit_increment.h"
 #include "paimon/format/file_format.h"
 #include "paimon/format/writer_builder.h"
@@ -114,7 +115,7 @@ Status PostponeBucketWriter::Write(std::unique_ptr<RecordBatch>&& moved_batch) {
 
     // write KeyValueBatch to RollingFileWriter
     if (!writer_) {
-        writer_ = CreateRollingRowWriter();
+        PAIMON_ASSIGN_OR_RAISE(writer_, CreateRollingRowWriter());
     }
     PAIMON_RETURN_NOT_OK(writer_->Write(std::move(key_value_batch)));
     return Status::OK();
@@ -236,28 +237,32 @@ PostponeBucketWriter::PrepareMinMaxKey(
                                       value_struct_array->length() - 1));
 }
 
-std::unique_ptr<RollingFileWriter<KeyValueBatch, std::shared_ptr<DataFileMeta>>>
-PostponeBucketWriter::CreateRollingRowWriter() const {
-    auto create_file_writer = [&]()
-        -> Result<std::unique_ptr<SingleFileWriter<KeyValueBatch, std::shared_ptr<DataFileMeta>>>> {
-        ::ArrowSchema arrow_schema;
-        ScopeGuard guard([&arrow_schema]() { ArrowSchemaRelease(&arrow_schema); });
-        PAIMON_RETURN_NOT_OK_FROM_ARROW(arrow::ExportSchema(*write_schema_, &arrow_schema));
-        auto format = options_.GetWriteFileFormat();
+Result<std::unique_ptr<RollingFileWriter<KeyValueBatch, std::shared_ptr<DataFileMeta>>>>
+PostponeBucketWriter::CreateRollingRowWriter() {
+    if (format_context_ == nullptr) {
         PAIMON_ASSIGN_OR_RAISE(
-            std::shared_ptr<WriterBuilder> writer_builder,
-            format->CreateWriterBuilder(&arrow_schema, options_.GetWriteBatchSize()));
-        writer_builder->WithMemoryPool(pool_);
+            format_context_,
+            FormatWriterContext::Create(options_.GetWriteFileFormat(), write_schema_,
+                                        options_.GetWriteBatchSize(), pool_,
+                                        /*with_stats_extractor=*/false));
+    }
+    auto create_file_writer = [this, format_context = format_context_]()
+        -> Result<std::unique_ptr<SingleFileWriter<KeyValueBatch, std::shared_ptr<DataFileMeta>>>> {
         auto converter = [](KeyValueBatch key_value_batch, ArrowArray* array) -> Status {
             ArrowArrayMove(key_value_batch.batch.get(), array);
             return Status::OK();
         };
+        std::unique_ptr<ColumnSketchCollector> sketch_collector;
+        if (options_.ColumnSketchesEnabled()) {
+            PAIMON_ASSIGN_OR_RAISE(sketch_collector, ColumnSketchCollector::Create(write_schema_));
+        }
         auto writer = std::make_unique<KeyValueDataFileWriter>(
             options_.GetFileCompression(), converter, schema_id_, FileSource::Append(),
             trimmed_primary_keys_, /*stats_extractor=*/nullptr, write_schema_,
-            path_factory_->IsExternalPath(), pool_);
-        PAIMON_RETURN_NOT_OK(
-            writer->Init(options_.GetFileSystem(), path_factory_->NewPath(), writer_builder));
+            path_factory_->IsExternalPath(), /*value_stats_converter=*/nullptr,
+            std::move(sketch_collector), /*index_writer=*/nullptr, pool_);
+        PAIMON_RETURN_NOT_OK(writer->Init(options_.GetFileSystem(), path_factory_->NewPath(),
+                                          format_context->GetWriterBuilder()));
         return writer;
     };
     return std::make_unique<RollingFileWriter<KeyValueBatch, std::shared_ptr<DataFileMeta>>>(
@@ -44,6 +44,7 @@ struct ArrowArray;
 
 namespace paimon {
 class DataFilePathFactory;
+class FormatWriterContext;
 class MemoryPool;
 class Metrics;
 
@@ -97,8 +98,8 @@ class PostponeBucketWriter : public BatchWriter {
     Status Flush();
     Result<CommitIncrement> DrainIncrement();
 
-    std::unique_ptr<RollingFileWriter<KeyValueBatch, std::shared_ptr<DataFileMeta>>>
-    CreateRollingRowWriter() const;
+    Result<std::unique_ptr<RollingFileWriter<KeyValueBatch, std::shared_ptr<DataFileMeta>>>>
+    CreateRollingRowWriter();
 
  private:
     std::shared_ptr<MemoryPool> pool_;
@@ -110,6 +111,8 @@ class PostponeBucketWriter : public BatchWriter {
     // write_schema = value_schema + special fields
     std::shared_ptr<arrow::DataType> value_type_;
     std::shared_ptr<arrow::Schema> write_schema_;
+    // created on first write and shared by all rolling writers
+    std::shared_ptr<FormatWriterContext> format_context_;
     std::shared_ptr<Metrics> metrics_;
     std::vector<std::shared_ptr<DataFileMeta>> new_files_;
     std::unique_ptr<RollingFileWriter<KeyValueBatch, std::shared_ptr<DataFileMeta>>> writer_;
@@ -22,7 +22,9 @@
 #include <vector>
 
 #include "paimon/core/schema/table_schema.h"
+#include "paimon/result.h"
 #include "paimon/schema/schema.h"
+#include "paimon/status.h"
 
 namespace paimon {
 
@@ -31,6 +33,15 @@ class SchemaImpl : public Schema {
     explicit SchemaImpl(const std::shared_ptr<TableSchema>& table_schema)
         : table_schema_(table_schema) {}
 
+    /// Returns the table schema wrapped by a schema loaded by a catalog.
+    static Result<std::shared_ptr<TableSchema>> GetTableSchema(const Schema& schema) {
+        const auto* schema_impl = dynamic_cast<const SchemaImpl*>(&schema);
+        if (schema_impl == nullptr) {
+            return Status::Invalid("table schema is not loaded by a catalog");
+        }
+        return schema_impl->table_schema_;
+    }
+
     std::vector<std::string> FieldNames() const override {
         return table_schema_->FieldNames();
     }
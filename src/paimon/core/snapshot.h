@@ -86,6 +86,14 @@ class Snapshot : public Jsonizable<Snapshot> {
     static constexpr char FIELD_PROPERTIES[] = "properties";
     static constexpr char FIELD_NEXT_ROW_ID[] = "nextRowId";
 
+    /// Property key of the partition stats file maintained for this snapshot, see
+    /// `PartitionStatsFile`. Kept in `properties` so that the snapshot json stays readable by
+    /// other implementations.
+    static constexpr char PROPERTY_PARTITION_STATS_FILE[] = "partition-stats.file";
+    /// Property key of the column sketches file of the table at this snapshot, see
+    /// `ColumnSketchesFile`.
+    static constexpr char PROPERTY_COLUMN_SKETCHES_FILE[] = "column-sketches.file";
+
     JSONIZABLE_FRIEND_AND_DEFAULT_CTOR(Snapshot);
 
     Snapshot(int64_t id, int64_t schema_id, const std::string& base_manifest_list,
@@ -220,6 +228,18 @@ class Snapshot : public Jsonizable<Snapshot> {
         return properties_;
     }
 
+    /// @return The name of the partition stats file of this snapshot, or `std::nullopt` if the
+    /// snapshot was committed without maintaining one.
+    std::optional<std::string> PartitionStatsFileName() const {
+        return GetProperty(PROPERTY_PARTITION_STATS_FILE);
+    }
+
+    /// @return The name of the column sketches file of this snapshot, or `std::nullopt` if the
+    /// sketches of the table are unknown at this snapshot.
+    std::optional<std::string> ColumnSketchesFileName() const {
+        return GetProperty(PROPERTY_COLUMN_SKETCHES_FILE);
+    }
+
     const std::optional<int64_t>& NextRowId() const {
         return next_row_id_;
     }
@@ -232,6 +252,17 @@ class Snapshot : public Jsonizable<Snapshot> {
     static Result<Snapshot> FromPath(const std::shared_ptr<FileSystem>& fs,
                                      const std::string& path);
 
+ private:
+    std::optional<std::string> GetProperty(const std::string& key) const {
+        if (properties_) {
+            auto iter = properties_.value().find(key);
+            if (iter != properties_.value().end()) {
+                return iter->second;
+            }
+        }
+        return std::nullopt;
+    }
+
  private:
     // version of snapshot
     // null for paimon <= 0.2
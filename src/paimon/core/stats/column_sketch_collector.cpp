@@ -0,0 +1,234 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/stats/column_sketch_collector.h"
+
+#include <cstring>
+#include <string_view>
+#include <utility>
+
+#include "arrow/api.h"
+#include "arrow/util/bit_run_reader.h"
+#include "arrow/util/checked_cast.h"
+#include "paimon/common/table/special_fields.h"
+#include "paimon/common/types/data_field.h"
+#include "xxhash.h"  // NOLINT(build/include_subdir)
+
+namespace paimon {
+namespace {
+
+/// Calls `visitor(position, length)` for each run of non-null values.
+template <typename Visitor>
+void VisitValidRuns(const arrow::Array& array, Visitor&& visitor) {
+    if (array.null_count() == 0) {
+        visitor(0, array.length());
+    } else if (array.null_count() < array.length()) {
+        arrow::internal::VisitSetBitRunsVoid(array.null_bitmap_data(), array.offset(),
+                                             array.length(), std::forward<Visitor>(visitor));
+    }
+}
+
+uint64_t HashInt64(int64_t value) {
+    return XXH64(&value, sizeof(value), /*seed=*/0);
+}
+
+/// Integers of all widths, dates and timestamps are hashed as int64, so that a value keeps its
+/// hash when the type of the field is widened.
+template <typename ArrowType>
+void UpdateIntegers(const arrow::Array& array, ColumnSketch* sketch) {
+    const auto* values =
+        arrow::internal::checked_cast<const arrow::NumericArray<ArrowType>&>(array).raw_values();
+    VisitValidRuns(array, [&](int64_t position, int64_t length) {
+        for (int64_t i = position; i < position + length; ++i) {
+            auto value = static_cast<int64_t>(values[i]);
+            sketch->Update(HashInt64(value), static_cast<double>(value));
+        }
+    });
+}
+
+template <typename ArrowType>
+void UpdateFloatingPoints(const arrow::Array& array, ColumnSketch* sketch) {
+    const auto* values =
+        arrow::internal::checked_cast<const arrow::NumericArray<ArrowType>&>(array).raw_values();
+    VisitValidRuns(array, [&](int64_t position, int64_t length) {
+        for (int64_t i = position; i < position + length; ++i) {
+            auto value = static_cast<double>(values[i]);
+            if (value == 0.0) {
+                // -0.0 and 0.0 are the same value
+                value = 0.0;
+            }
+            int64_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            sketch->Update(HashInt64(bits), value);
+        }
+    });
+}
+
+void UpdateBooleans(const arrow::Array& array, ColumnSketch* sketch) {
+    const auto& booleans = arrow::internal::checked_cast<const arrow::BooleanArray&>(array);
+    VisitValidRuns(array, [&](int64_t position, int64_t length) {
+        for (int64_t i = position; i < position + length; ++i) {
+            sketch->Update(HashInt64(booleans.Value(i) ? 1 : 0));
+        }
+    });
+}
+
+void UpdateDecimals(const arrow::Array& array, ColumnSketch* sketch) {
+    const auto& decimals = arrow::internal::checked_cast<const arrow::Decimal128Array&>(array);
+    int32_t scale =
+        arrow::internal::checked_cast<const arrow::Decimal128Type&>(*array.type()).scale();
+    VisitValidRuns(array, [&](int64_t position, int64_t length) {
+        for (int64_t i = position; i < position + length; ++i) {
+            arrow::Decimal128 value(decimals.GetValue(i));
+            sketch->Update(XXH64(decimals.GetValue(i), decimals.byte_width(), /*seed=*/0),
+                           value.ToDouble(scale));
+        }
+    });
+}
+
+template <typename ArrayType>
+void UpdateBinaries(const arrow::Array& array, ColumnSketch* sketch) {
+    const auto& binaries = arrow::internal::checked_cast<const ArrayType&>(array);
+    VisitValidRuns(array, [&](int64_t position, int64_t length) {
+        for (int64_t i = position; i < position + length; ++i) {
+            std::string_view value = binaries.GetView(i);
+            sketch->Update(XXH64(value.data(), value.size(), /*seed=*/0));
+        }
+    });
+}
+
+/// @return Whether the field is sketched, and whether with quantiles.
+std::pair<bool, bool> SketchKind(const arrow::DataType& type) {
+    switch (type.id()) {
+        case arrow::Type::BOOL:
+        case arrow::Type::STRING:
+        case arrow::Type::BINARY:
+        case arrow::Type::LARGE_STRING:
+        case arrow::Type::LARGE_BINARY:
+            return {true, false};
+        case arrow::Type::INT8:
+        case arrow::Type::INT16:
+        case arrow::Type::INT32:
+        case arrow::Type::INT64:
+        case arrow::Type::FLOAT:
+        case arrow::Type::DOUBLE:
+        case arrow::Type::DATE32:
+        case arrow::Type::TIMESTAMP:
+        case arrow::Type::DECIMAL128:
+            return {true, true};
+        default:
+            return {false, false};
+    }
+}
+
+void UpdateSketch(const arrow::Array& array, ColumnSketch* sketch) {
+    switch (array.type_id()) {
+        case arrow::Type::BOOL:
+            UpdateBooleans(array, sketch);
+            break;
+        case arrow::Type::INT8:
+            UpdateIntegers<arrow::Int8Type>(array, sketch);
+            break;
+        case arrow::Type::INT16:
+            UpdateIntegers<arrow::Int16Type>(array, sketch);
+            break;
+        case arrow::Type::INT32:
+            UpdateIntegers<arrow::Int32Type>(array, sketch);
+            break;
+        case arrow::Type::INT64:
+            UpdateIntegers<arrow::Int64Type>(array, sketch);
+            break;
+        case arrow::Type::DATE32:
+            UpdateIntegers<arrow::Date32Type>(array, sketch);
+            break;
+        case arrow::Type::TIMESTAMP:
+            UpdateIntegers<arrow::TimestampType>(array, sketch);
+            break;
+        case arrow::Type::FLOAT:
+            UpdateFloatingPoints<arrow::FloatType>(array, sketch);
+            break;
+        case arrow::Type::DOUBLE:
+            UpdateFloatingPoints<arrow::DoubleType>(array, sketch);
+            break;
+        case arrow::Type::DECIMAL128:
+            UpdateDecimals(array, sketch);
+            break;
+        case arrow::Type::STRING:
+            UpdateBinaries<arrow::StringArray>(array, sketch);
+            break;
+        case arrow::Type::BINARY:
+            UpdateBinaries<arrow::BinaryArray>(array, sketch);
+            break;
+        case arrow::Type::LARGE_STRING:
+            UpdateBinaries<arrow::LargeStringArray>(array, sketch);
+            break;
+        case arrow::Type::LARGE_BINARY:
+            UpdateBinaries<arrow::LargeBinaryArray>(array, sketch);
+            break;
+        default:
+            // not sketched, see SketchKind
+            break;
+    }
+    sketch->UpdateNulls(array.null_count());
+}
+
+}  // namespace
+
+ColumnSketchCollector::ColumnSketchCollector(const std::shared_ptr<arrow::DataType>& batch_type,
+                                             std::vector<int32_t>&& field_indexes,
+                                             std::vector<ColumnSketch>&& columns)
+    : batch_type_(batch_type),
+      field_indexes_(std::move(field_indexes)),
+      columns_(std::move(columns)) {}
+
+Result<std::unique_ptr<ColumnSketchCollector>> ColumnSketchCollector::Create(
+    const std::shared_ptr<arrow::Schema>& schema) {
+    std::vector<int32_t> field_indexes;
+    std::vector<ColumnSketch> columns;
+    for (int32_t i = 0; i < schema->num_fields(); ++i) {
+        const std::shared_ptr<arrow::Field>& field = schema->field(i);
+        auto [sketched, with_quantiles] = SketchKind(*field->type());
+        if (!sketched || SpecialFields::IsSpecialFieldName(field->name())) {
+            continue;
+        }
+        PAIMON_ASSIGN_OR_RAISE(DataField data_field,
+                               DataField::ConvertArrowFieldToDataField(field));
+        field_indexes.push_back(i);
+        columns.emplace_back(data_field.Id(), data_field.Name(), with_quantiles);
+    }
+    return std::unique_ptr<ColumnSketchCollector>(new ColumnSketchCollector(
+        arrow::struct_(schema->fields()), std::move(field_indexes), std::move(columns)));
+}
+
+Status ColumnSketchCollector::Collect(const arrow::Array& batch) {
+    if (!batch.type()->Equals(*batch_type_, /*check_metadata=*/false)) {
+        return Status::Invalid("batch type ", batch.type()->ToString(),
+                               " mismatches schema of column sketch collector ",
+                               batch_type_->ToString());
+    }
+    const auto& struct_array = arrow::internal::checked_cast<const arrow::StructArray&>(batch);
+    for (size_t i = 0; i < field_indexes_.size(); ++i) {
+        UpdateSketch(*struct_array.field(field_indexes_[i]), &columns_[i]);
+    }
+    return Status::OK();
+}
+
+ColumnSketches ColumnSketchCollector::GetResult() const {
+    std::vector<ColumnSketch> columns = columns_;
+    return ColumnSketches(std::move(columns));
+}
+
+}  // namespace paimon
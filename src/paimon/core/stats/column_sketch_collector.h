@@ -0,0 +1,68 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "paimon/core/stats/column_sketches.h"
+#include "paimon/result.h"
+#include "paimon/status.h"
+
+namespace arrow {
+class Array;
+class DataType;
+class Schema;
+}  // namespace arrow
+
+namespace paimon {
+
+/// Collects `ColumnSketches` of the fields of written arrow batches.
+///
+/// Distinct counts are sketched for fields of primitive, decimal, string and binary types, and
+/// quantiles additionally for numeric, decimal, date and timestamp fields. Fields of other types
+/// (e.g. arrays, maps and structs) and special fields (e.g. the sequence number and value kind of
+/// primary key tables) are not sketched.
+class ColumnSketchCollector {
+ public:
+    /// @param schema Schema of the batches to collect, whose fields must carry field ids.
+    static Result<std::unique_ptr<ColumnSketchCollector>> Create(
+        const std::shared_ptr<arrow::Schema>& schema);
+
+    /// Updates sketches with a struct array whose fields match the schema.
+    Status Collect(const arrow::Array& batch);
+
+    ColumnSketches GetResult() const;
+
+    /// @return The struct type of the collected batches.
+    const std::shared_ptr<arrow::DataType>& BatchType() const {
+        return batch_type_;
+    }
+
+ private:
+    ColumnSketchCollector(const std::shared_ptr<arrow::DataType>& batch_type,
+                          std::vector<int32_t>&& field_indexes,
+                          std::vector<ColumnSketch>&& columns);
+
+    std::shared_ptr<arrow::DataType> batch_type_;
+    // index in the batch of each sketched field
+    std::vector<int32_t> field_indexes_;
+    std::vector<ColumnSketch> columns_;
+};
+
+}  // namespace paimon
@@ -0,0 +1,120 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/stats/column_sketch_collector.h"
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "arrow/api.h"
+#include "arrow/ipc/json_simple.h"
+#include "gtest/gtest.h"
+#include "paimon/common/table/special_fields.h"
+#include "paimon/common/types/data_field.h"
+#include "paimon/testing/utils/testharness.h"
+
+namespace paimon::test {
+
+TEST(ColumnSketchCollectorTest, TestCollect) {
+    std::vector<DataField> fields = {
+        DataField(0, arrow::field("f0", arrow::int32())),
+        DataField(1, arrow::field("f1", arrow::utf8())),
+        DataField(2, arrow::field("f2", arrow::float64())),
+        DataField(5, arrow::field("f3", arrow::boolean())),
+        DataField(6, arrow::field("f4", arrow::list(arrow::int32()))),
+    };
+    std::shared_ptr<arrow::Schema> schema = DataField::ConvertDataFieldsToArrowSchema(fields);
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<ColumnSketchCollector> collector,
+                         ColumnSketchCollector::Create(schema));
+    ASSERT_TRUE(collector->BatchType()->Equals(arrow::struct_(schema->fields())));
+
+    auto batch1 = arrow::ipc::internal::json::ArrayFromJSON(collector->BatchType(), R"([
+        [1, "a", 1.5, true, [1]],
+        [2, "b", -0.0, false, null],
+        [null, "a", 0.0, null, [2, 3]]
+    ])")
+                      .ValueOrDie();
+    auto batch2 = arrow::ipc::internal::json::ArrayFromJSON(collector->BatchType(), R"([
+        [3, null, NaN, true, []],
+        [2, "c", null, true, null]
+    ])")
+                      .ValueOrDie();
+    ASSERT_OK(collector->Collect(*batch1));
+    ASSERT_OK(collector->Collect(*batch2));
+
+    ColumnSketches sketches = collector->GetResult();
+    ASSERT_EQ(4, sketches.Columns().size());
+    ASSERT_FALSE(sketches.GetColumn(/*field_id=*/6));
+
+    const ColumnSketch* f0 = sketches.GetColumn(/*field_id=*/0);
+    ASSERT_TRUE(f0);
+    ASSERT_EQ("f0", f0->FieldName());
+    ASSERT_EQ(5, f0->RowCount());
+    ASSERT_EQ(1, f0->NullCount());
+    ASSERT_EQ(3, f0->DistinctCount());
+    ASSERT_TRUE(f0->Quantiles());
+    ASSERT_EQ(std::optional<double>(1), f0->Quantiles()->Quantile(0.0));
+    ASSERT_EQ(std::optional<double>(3), f0->Quantiles()->Quantile(1.0));
+
+    const ColumnSketch* f1 = sketches.GetColumn(/*field_id=*/1);
+    ASSERT_TRUE(f1);
+    ASSERT_EQ(5, f1->RowCount());
+    ASSERT_EQ(1, f1->NullCount());
+    ASSERT_EQ(3, f1->DistinctCount());
+    ASSERT_FALSE(f1->Quantiles());
+
+    // -0.0 and 0.0 are the same value, and NaN is counted as a distinct value without quantile
+    const ColumnSketch* f2 = sketches.GetColumn(/*field_id=*/2);
+    ASSERT_TRUE(f2);
+    ASSERT_EQ(1, f2->NullCount());
+    ASSERT_EQ(3, f2->DistinctCount());
+    ASSERT_EQ(3, f2->Quantiles()->Count());
+    ASSERT_EQ(std::optional<double>(1.5), f2->Quantiles()->Quantile(1.0));
+
+    const ColumnSketch* f3 = sketches.GetColumn(/*field_id=*/5);
+    ASSERT_TRUE(f3);
+    ASSERT_EQ("f3", f3->FieldName());
+    ASSERT_EQ(1, f3->NullCount());
+    ASSERT_EQ(2, f3->DistinctCount());
+}
+
+TEST(ColumnSketchCollectorTest, TestSkipSpecialFields) {
+    std::vector<DataField> fields = {
+        SpecialFields::SequenceNumber(),
+        SpecialFields::ValueKind(),
+        DataField(0, arrow::field("f0", arrow::int32())),
+    };
+    std::shared_ptr<arrow::Schema> schema = DataField::ConvertDataFieldsToArrowSchema(fields);
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<ColumnSketchCollector> collector,
+                         ColumnSketchCollector::Create(schema));
+    auto batch = arrow::ipc::internal::json::ArrayFromJSON(collector->BatchType(), R"([
+        [0, 0, 1],
+        [1, 0, 2]
+    ])")
+                     .ValueOrDie();
+    ASSERT_OK(collector->Collect(*batch));
+
+    ColumnSketches sketches = collector->GetResult();
+    ASSERT_EQ(1, sketches.Columns().size());
+    const ColumnSketch* f0 = sketches.GetColumn(/*field_id=*/0);
+    ASSERT_TRUE(f0);
+    ASSERT_EQ(2, f0->RowCount());
+    ASSERT_EQ(2, f0->DistinctCount());
+}
+
+}  // namespace paimon::test
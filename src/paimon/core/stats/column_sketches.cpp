@@ -0,0 +1,210 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/stats/column_sketches.h"
+
+#include <cstring>
+#include <utility>
+
+#include "fmt/format.h"
+#include "paimon/common/io/memory_segment_output_stream.h"
+#include "paimon/common/memory/memory_segment_utils.h"
+#include "paimon/io/byte_array_input_stream.h"
+#include "paimon/io/data_input_stream.h"
+#include "paimon/memory/memory_pool.h"
+
+namespace paimon {
+namespace {
+// doubles are kept by their bits, as the data streams have no floating point support
+int64_t DoubleToBits(double value) {
+    int64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+double BitsToDouble(int64_t bits) {
+    double value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+void WriteColumnSketch(const ColumnSketch& column, MemorySegmentOutputStream* out) {
+    out->WriteValue<int32_t>(column.FieldId());
+    out->WriteString(column.FieldName());
+    out->WriteValue<int64_t>(column.RowCount());
+    out->WriteValue<int64_t>(column.NullCount());
+    const HyperLogLog& distinct_sketch = column.DistinctSketch();
+    out->WriteValue<int32_t>(distinct_sketch.Precision());
+    const std::vector<uint8_t>& registers = distinct_sketch.Registers();
+    out->Write(reinterpret_cast<const char*>(registers.data()), registers.size());
+    const std::optional<QuantileSketch>& quantile_sketch = column.Quantiles();
+    out->WriteValue<bool>(quantile_sketch.has_value());
+    if (!quantile_sketch) {
+        return;
+    }
+    out->WriteValue<int32_t>(quantile_sketch->K());
+    out->WriteValue<int64_t>(quantile_sketch->Count());
+    out->WriteValue<int64_t>(DoubleToBits(quantile_sketch->MinValue()));
+    out->WriteValue<int64_t>(DoubleToBits(quantile_sketch->MaxValue()));
+    const std::vector<std::vector<double>>& levels = quantile_sketch->Levels();
+    out->WriteValue<int32_t>(levels.size());
+    for (const auto& level : levels) {
+        out->WriteValue<int32_t>(level.size());
+        for (double value : level) {
+            out->WriteValue<int64_t>(DoubleToBits(value));
+        }
+    }
+}
+
+Result<QuantileSketch> ReadQuantileSketch(const DataInputStream& in) {
+    PAIMON_ASSIGN_OR_RAISE(int32_t k, in.ReadValue<int32_t>());
+    PAIMON_ASSIGN_OR_RAISE(int64_t count, in.ReadValue<int64_t>());
+    PAIMON_ASSIGN_OR_RAISE(int64_t min_bits, in.ReadValue<int64_t>());
+    PAIMON_ASSIGN_OR_RAISE(int64_t max_bits, in.ReadValue<int64_t>());
+    PAIMON_ASSIGN_OR_RAISE(int32_t num_levels, in.ReadValue<int32_t>());
+    std::vector<std::vector<double>> levels(num_levels);
+    for (auto& level : levels) {
+        PAIMON_ASSIGN_OR_RAISE(int32_t level_size, in.ReadValue<int32_t>());
+        level.reserve(level_size);
+        for (int32_t i = 0; i < level_size; ++i) {
+            PAIMON_ASSIGN_OR_RAISE(int64_t bits, in.ReadValue<int64_t>());
+            level.push_back(BitsToDouble(bits));
+        }
+    }
+    return QuantileSketch::FromLevels(k, count, BitsToDouble(min_bits), BitsToDouble(max_bits),
+                                      std::move(levels));
+}
+
+Result<ColumnSketch> ReadColumnSketch(const DataInputStream& in, MemoryPool* pool) {
+    PAIMON_ASSIGN_OR_RAISE(int32_t field_id, in.ReadValue<int32_t>());
+    PAIMON_ASSIGN_OR_RAISE(std::string field_name, in.ReadString());
+    PAIMON_ASSIGN_OR_RAISE(int64_t row_count, in.ReadValue<int64_t>());
+    PAIMON_ASSIGN_OR_RAISE(int64_t null_count, in.ReadValue<int64_t>());
+    PAIMON_ASSIGN_OR_RAISE(int32_t precision, in.ReadValue<int32_t>());
+    if (precision < HyperLogLog::MIN_PRECISION || precision > HyperLogLog::MAX_PRECISION) {
+        return Status::Invalid(fmt::format("invalid precision {} of distinct sketch of field {}",
+                                           precision, field_id));
+    }
+    auto register_bytes = Bytes::AllocateBytes(static_cast<int32_t>(1) << precision, pool);
+    PAIMON_RETURN_NOT_OK(in.ReadBytes(register_bytes.get()));
+    std::vector<uint8_t> registers(register_bytes->size());
+    std::memcpy(registers.data(), register_bytes->data(), register_bytes->size());
+    PAIMON_ASSIGN_OR_RAISE(HyperLogLog distinct_sketch,
+                           HyperLogLog::FromRegisters(precision, std::move(registers)));
+    std::optional<QuantileSketch> quantile_sketch;
+    PAIMON_ASSIGN_OR_RAISE(bool with_quantiles, in.ReadValue<bool>());
+    if (with_quantiles) {
+        PAIMON_ASSIGN_OR_RAISE(quantile_sketch, ReadQuantileSketch(in));
+    }
+    return ColumnSketch(field_id, field_name, row_count, null_count, std::move(distinct_sketch),
+                        std::move(quantile_sketch));
+}
+}  // namespace
+
+ColumnSketch::ColumnSketch(int32_t field_id, const std::string& field_name, bool with_quantiles)
+    : field_id_(field_id), field_name_(field_name) {
+    if (with_quantiles) {
+        quantile_sketch_.emplace();
+    }
+}
+
+ColumnSketch::ColumnSketch(int32_t field_id, const std::string& field_name, int64_t row_count,
+                           int64_t null_count, HyperLogLog&& distinct_sketch,
+                           std::optional<QuantileSketch>&& quantile_sketch)
+    : field_id_(field_id),
+      field_name_(field_name),
+      row_count_(row_count),
+      null_count_(null_count),
+      distinct_sketch_(std::move(distinct_sketch)),
+      quantile_sketch_(std::move(quantile_sketch)) {}
+
+Status ColumnSketch::Merge(const ColumnSketch& other) {
+    if (field_id_ != other.field_id_) {
+        return Status::Invalid(fmt::format("cannot merge column sketch of field {} into field {}",
+                                           other.field_id_, field_id_));
+    }
+    PAIMON_RETURN_NOT_OK(distinct_sketch_.Merge(other.distinct_sketch_));
+    if (quantile_sketch_ && other.quantile_sketch_) {
+        PAIMON_RETURN_NOT_OK(quantile_sketch_->Merge(other.quantile_sketch_.value()));
+    } else {
+        // the type of the field was changed, quantiles of different types are not comparable
+        quantile_sketch_.reset();
+    }
+    field_name_ = other.field_name_;
+    row_count_ += other.row_count_;
+    null_count_ += other.null_count_;
+    return Status::OK();
+}
+
+ColumnSketches::ColumnSketches(std::vector<ColumnSketch>&& columns)
+    : columns_(std::move(columns)) {}
+
+const ColumnSketch* ColumnSketches::GetColumn(int32_t field_id) const {
+    for (const auto& column : columns_) {
+        if (column.FieldId() == field_id) {
+            return &column;
+        }
+    }
+    return nullptr;
+}
+
+Status ColumnSketches::Merge(const ColumnSketches& other) {
+    for (const auto& other_column : other.columns_) {
+        bool merged = false;
+        for (auto& column : columns_) {
+            if (column.FieldId() == other_column.FieldId()) {
+                PAIMON_RETURN_NOT_OK(column.Merge(other_column));
+                merged = true;
+                break;
+            }
+        }
+        if (!merged) {
+            columns_.push_back(other_column);
+        }
+    }
+    return Status::OK();
+}
+
+Result<PAIMON_UNIQUE_PTR<Bytes>> ColumnSketches::Serialize(
+    const std::shared_ptr<MemoryPool>& pool) const {
+    MemorySegmentOutputStream out(MemorySegmentOutputStream::DEFAULT_SEGMENT_SIZE, pool);
+    out.WriteValue<int32_t>(VERSION);
+    out.WriteValue<int32_t>(columns_.size());
+    for (const auto& column : columns_) {
+        WriteColumnSketch(column, &out);
+    }
+    return MemorySegmentUtils::CopyToBytes(out.Segments(), 0, out.CurrentSize(), pool.get());
+}
+
+Result<ColumnSketches> ColumnSketches::Deserialize(const char* buffer, size_t length,
+                                                   const std::shared_ptr<MemoryPool>& pool) {
+    auto input_stream = std::make_shared<ByteArrayInputStream>(buffer, length);
+    DataInputStream in(input_stream);
+    PAIMON_ASSIGN_OR_RAISE(int32_t version, in.ReadValue<int32_t>());
+    if (version != VERSION) {
+        return Status::Invalid(fmt::format("invalid version {} for ColumnSketches", version));
+    }
+    PAIMON_ASSIGN_OR_RAISE(int32_t num_columns, in.ReadValue<int32_t>());
+    std::vector<ColumnSketch> columns;
+    columns.reserve(num_columns);
+    for (int32_t i = 0; i < num_columns; ++i) {
+        PAIMON_ASSIGN_OR_RAISE(ColumnSketch column, ReadColumnSketch(in, pool.get()));
+        columns.push_back(std::move(column));
+    }
+    return ColumnSketches(std::move(columns));
+}
+
+}  // namespace paimon
@@ -0,0 +1,137 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "paimon/common/utils/hyper_log_log.h"
+#include "paimon/common/utils/quantile_sketch.h"
+#include "paimon/memory/bytes.h"
+#include "paimon/result.h"
+#include "paimon/status.h"
+
+namespace paimon {
+class MemoryPool;
+
+/// Approximate distribution of the values of one column: the number of distinct values is
+/// estimated by a `HyperLogLog` sketch and, for columns of numeric, date or timestamp type, the
+/// quantiles by a `QuantileSketch`. Null values are only counted.
+class ColumnSketch {
+ public:
+    ColumnSketch(int32_t field_id, const std::string& field_name, bool with_quantiles);
+
+    ColumnSketch(int32_t field_id, const std::string& field_name, int64_t row_count,
+                 int64_t null_count, HyperLogLog&& distinct_sketch,
+                 std::optional<QuantileSketch>&& quantile_sketch);
+
+    void UpdateNulls(int64_t count) {
+        row_count_ += count;
+        null_count_ += count;
+    }
+
+    void Update(uint64_t hash) {
+        ++row_count_;
+        distinct_sketch_.AddHash(hash);
+    }
+
+    /// Update with a value of a column with quantiles, `value` is the value as double and `hash`
+    /// the hash of the original value.
+    void Update(uint64_t hash, double value) {
+        Update(hash);
+        if (quantile_sketch_) {
+            quantile_sketch_->Update(value);
+        }
+    }
+
+    /// Merge `other` of the same field into this sketch. The field name of `other` is taken, so
+    /// that `other` is expected to be the newer one when the field was renamed.
+    Status Merge(const ColumnSketch& other);
+
+    int32_t FieldId() const {
+        return field_id_;
+    }
+
+    const std::string& FieldName() const {
+        return field_name_;
+    }
+
+    int64_t RowCount() const {
+        return row_count_;
+    }
+
+    int64_t NullCount() const {
+        return null_count_;
+    }
+
+    int64_t DistinctCount() const {
+        return distinct_sketch_.Estimate();
+    }
+
+    const HyperLogLog& DistinctSketch() const {
+        return distinct_sketch_;
+    }
+
+    const std::optional<QuantileSketch>& Quantiles() const {
+        return quantile_sketch_;
+    }
+
+ private:
+    int32_t field_id_;
+    std::string field_name_;
+    int64_t row_count_ = 0;
+    int64_t null_count_ = 0;
+    HyperLogLog distinct_sketch_;
+    std::optional<QuantileSketch> quantile_sketch_;
+};
+
+/// Sketches of the columns of a data file or a whole table, identified by field id.
+///
+/// Writers keep one `ColumnSketches` per data file in a sketch file next to it, and commits merge
+/// the sketches of the live data files into the sketches of the table, see `ColumnSketchesFile`.
+class ColumnSketches {
+ public:
+    static constexpr int32_t VERSION = 1;
+
+    ColumnSketches() = default;
+    explicit ColumnSketches(std::vector<ColumnSketch>&& columns);
+
+    const std::vector<ColumnSketch>& Columns() const {
+        return columns_;
+    }
+
+    /// @return The sketch of `field_id`, or nullptr if the field is not sketched.
+    const ColumnSketch* GetColumn(int32_t field_id) const;
+
+    /// Merge `other` into these sketches, fields only sketched by `other` are appended. `other`
+    /// is expected to be the newer one, see `ColumnSketch::Merge`.
+    Status Merge(const ColumnSketches& other);
+
+    Result<PAIMON_UNIQUE_PTR<Bytes>> Serialize(const std::shared_ptr<MemoryPool>& pool) const;
+
+    static Result<ColumnSketches> Deserialize(const char* buffer, size_t length,
+                                              const std::shared_ptr<MemoryPool>& pool);
+
+ private:
+    std::vector<ColumnSketch> columns_;
+};
+
+}  // namespace paimon
@@ -0,0 +1,197 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/stats/column_sketches_file.h"
+
+#include <utility>
+
+#include "fmt/format.h"
+#include "paimon/common/io/memory_segment_output_stream.h"
+#include "paimon/common/memory/memory_segment_utils.h"
+#include "paimon/common/utils/path_util.h"
+#include "paimon/common/utils/serialization_utils.h"
+#include "paimon/core/utils/file_store_path_factory.h"
+#include "paimon/fs/file_system.h"
+#include "paimon/io/byte_array_input_stream.h"
+#include "paimon/io/data_input_stream.h"
+#include "paimon/memory/bytes.h"
+#include "paimon/memory/memory_pool.h"
+
+namespace paimon {
+namespace {
+constexpr int32_t BUCKET_SKETCHES_VERSION = 1;
+constexpr int32_t TABLE_SKETCHES_VERSION = 1;
+
+Status WriteSketches(const ColumnSketches& sketches, const std::shared_ptr<MemoryPool>& pool,
+                     MemorySegmentOutputStream* out) {
+    PAIMON_ASSIGN_OR_RAISE(PAIMON_UNIQUE_PTR<Bytes> bytes, sketches.Serialize(pool));
+    out->WriteValue<int32_t>(bytes->size());
+    out->Write(bytes->data(), bytes->size());
+    return Status::OK();
+}
+
+Result<ColumnSketches> ReadSketches(const DataInputStream& in,
+                                    const std::shared_ptr<MemoryPool>& pool) {
+    PAIMON_ASSIGN_OR_RAISE(int32_t length, in.ReadValue<int32_t>());
+    auto bytes = Bytes::AllocateBytes(length, pool.get());
+    PAIMON_RETURN_NOT_OK(in.ReadBytes(bytes.get()));
+    return ColumnSketches::Deserialize(bytes->data(), bytes->size(), pool);
+}
+
+Status WriteContent(const std::shared_ptr<FileSystem>& fs, const std::string& path,
+                    const MemorySegmentOutputStream& out, const std::shared_ptr<MemoryPool>& pool) {
+    PAIMON_UNIQUE_PTR<Bytes> bytes =
+        MemorySegmentUtils::CopyToBytes(out.Segments(), 0, out.CurrentSize(), pool.get());
+    return fs->WriteFile(path, std::string(bytes->data(), bytes->size()), /*overwrite=*/false);
+}
+
+Status CheckVersion(const DataInputStream& in, int32_t expected_version, const std::string& path) {
+    PAIMON_ASSIGN_OR_RAISE(int32_t version, in.ReadValue<int32_t>());
+    if (version != expected_version) {
+        return Status::Invalid(
+            fmt::format("invalid version {} of column sketches file {}", version, path));
+    }
+    return Status::OK();
+}
+}  // namespace
+
+bool TableColumnSketches::IsComplete() const {
+    for (const auto& bucket : buckets) {
+        if (bucket.has_unsketched_files) {
+            return false;
+        }
+    }
+    return true;
+}
+
+ColumnSketchesFile::ColumnSketchesFile(const std::shared_ptr<FileSystem>& fs,
+                                       const std::shared_ptr<FileStorePathFactory>& path_factory,
+                                       const std::shared_ptr<MemoryPool>& pool)
+    : fs_(fs), path_factory_(path_factory), pool_(pool) {}
+
+Status ColumnSketchesFile::WriteFileSketches(const std::shared_ptr<FileSystem>& fs,
+                                             const std::string& path,
+                                             const ColumnSketches& sketches,
+                                             const std::shared_ptr<MemoryPool>& pool) {
+    PAIMON_ASSIGN_OR_RAISE(PAIMON_UNIQUE_PTR<Bytes> bytes, sketches.Serialize(pool));
+    return fs->WriteFile(path, std::string(bytes->data(), bytes->size()), /*overwrite=*/false);
+}
+
+Result<ColumnSketches> ColumnSketchesFile::ReadFileSketches(
+    const std::shared_ptr<FileSystem>& fs, const std::string& path,
+    const std::shared_ptr<MemoryPool>& pool) {
+    std::string content;
+    PAIMON_RETURN_NOT_OK(fs->ReadFile(path, &content));
+    return ColumnSketches::Deserialize(content.data(), content.size(), pool);
+}
+
+Result<TableColumnSketches> ColumnSketchesFile::ReadTableSketches(
+    const std::shared_ptr<FileSystem>& fs, const std::string& stats_dir,
+    const std::string& file_name, const std::shared_ptr<MemoryPool>& pool) {
+    std::string path = PathUtil::JoinPath(stats_dir, file_name);
+    std::string content;
+    PAIMON_RETURN_NOT_OK(fs->ReadFile(path, &content));
+    DataInputStream in(std::make_shared<ByteArrayInputStream>(content.data(), content.size()));
+    PAIMON_RETURN_NOT_OK(CheckVersion(in, TABLE_SKETCHES_VERSION, path));
+    TableColumnSketches sketches;
+    PAIMON_ASSIGN_OR_RAISE(sketches.merged, ReadSketches(in, pool));
+    PAIMON_ASSIGN_OR_RAISE(int32_t num_buckets, in.ReadValue<int32_t>());
+    sketches.buckets.reserve(num_buckets);
+    for (int32_t i = 0; i < num_buckets; ++i) {
+        TableColumnSketches::Bucket bucket;
+        PAIMON_ASSIGN_OR_RAISE(bucket.partition,
+                               SerializationUtils::DeserializeBinaryRow(&in, pool.get()));
+        PAIMON_ASSIGN_OR_RAISE(bucket.bucket, in.ReadValue<int32_t>());
+        PAIMON_ASSIGN_OR_RAISE(bucket.file_name, in.ReadString());
+        PAIMON_ASSIGN_OR_RAISE(bucket.has_unsketched_files, in.ReadValue<bool>());
+        sketches.buckets.push_back(std::move(bucket));
+    }
+    return sketches;
+}
+
+Result<std::string> ColumnSketchesFile::WriteBucketSketches(
+    const BucketColumnSketches& sketches) const {
+    MemorySegmentOutputStream out(MemorySegmentOutputStream::DEFAULT_SEGMENT_SIZE, pool_);
+    out.WriteValue<int32_t>(BUCKET_SKETCHES_VERSION);
+    PAIMON_RETURN_NOT_OK(WriteSketches(sketches.merged, pool_, &out));
+    out.WriteValue<int32_t>(sketches.sketched_files.size());
+    for (const auto& [data_file, sketch_path] : sketches.sketched_files) {
+        out.WriteString(data_file);
+        out.WriteString(sketch_path);
+    }
+    out.WriteValue<int32_t>(sketches.unsketched_files.size());
+    for (const auto& data_file : sketches.unsketched_files) {
+        out.WriteString(data_file);
+    }
+    std::string path = path_factory_->NewBucketSketchesFile();
+    PAIMON_RETURN_NOT_OK(WriteContent(fs_, path, out, pool_));
+    return PathUtil::GetName(path);
+}
+
+Result<BucketColumnSketches> ColumnSketchesFile::ReadBucketSketches(
+    const std::string& file_name) const {
+    std::string path = path_factory_->ToStatsFilePath(file_name);
+    std::string content;
+    PAIMON_RETURN_NOT_OK(fs_->ReadFile(path, &content));
+    DataInputStream in(std::make_shared<ByteArrayInputStream>(content.data(), content.size()));
+    PAIMON_RETURN_NOT_OK(CheckVersion(in, BUCKET_SKETCHES_VERSION, path));
+    BucketColumnSketches sketches;
+    PAIMON_ASSIGN_OR_RAISE(sketches.merged, ReadSketches(in, pool_));
+    PAIMON_ASSIGN_OR_RAISE(int32_t num_sketched_files, in.ReadValue<int32_t>());
+    sketches.sketched_files.reserve(num_sketched_files);
+    for (int32_t i = 0; i < num_sketched_files; ++i) {
+        PAIMON_ASSIGN_OR_RAISE(std::string data_file, in.ReadString());
+        PAIMON_ASSIGN_OR_RAISE(std::string sketch_path, in.ReadString());
+        sketches.sketched_files.emplace_back(std::move(data_file), std::move(sketch_path));
+    }
+    PAIMON_ASSIGN_OR_RAISE(int32_t num_unsketched_files, in.ReadValue<int32_t>());
+    sketches.unsketched_files.reserve(num_unsketched_files);
+    for (int32_t i = 0; i < num_unsketched_files; ++i) {
+        PAIMON_ASSIGN_OR_RAISE(std::string data_file, in.ReadString());
+        sketches.unsketched_files.push_back(std::move(data_file));
+    }
+    return sketches;
+}
+
+Result<std::string> ColumnSketchesFile::WriteTableSketches(
+    const TableColumnSketches& sketches) const {
+    MemorySegmentOutputStream out(MemorySegmentOutputStream::DEFAULT_SEGMENT_SIZE, pool_);
+    out.WriteValue<int32_t>(TABLE_SKETCHES_VERSION);
+    PAIMON_RETURN_NOT_OK(WriteSketches(sketches.merged, pool_, &out));
+    out.WriteValue<int32_t>(sketches.buckets.size());
+    for (const auto& bucket : sketches.buckets) {
+        PAIMON_RETURN_NOT_OK(SerializationUtils::SerializeBinaryRow(bucket.partition, &out));
+        out.WriteValue<int32_t>(bucket.bucket);
+        out.WriteString(bucket.file_name);
+        out.WriteValue<bool>(bucket.has_unsketched_files);
+    }
+    std::string path = path_factory_->NewColumnSketchesFile();
+    PAIMON_RETURN_NOT_OK(WriteContent(fs_, path, out, pool_));
+    return PathUtil::GetName(path);
+}
+
+Result<TableColumnSketches> ColumnSketchesFile::ReadTableSketches(
+    const std::string& file_name) const {
+    return ReadTableSketches(fs_, FileStorePathFactory::StatisticsPath(path_factory_->RootPath()),
+                             file_name, pool_);
+}
+
+void ColumnSketchesFile::DeleteQuietly(const std::string& file_name) const {
+    auto status = fs_->Delete(path_factory_->ToStatsFilePath(file_name));
+    (void)status;
+}
+
+}  // namespace paimon
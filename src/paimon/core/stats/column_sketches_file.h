@@ -0,0 +1,119 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "paimon/common/data/binary_row.h"
+#include "paimon/core/stats/column_sketches.h"
+#include "paimon/result.h"
+#include "paimon/status.h"
+
+namespace paimon {
+class FileStorePathFactory;
+class FileSystem;
+class MemoryPool;
+
+/// Column sketches of the live data files of a bucket.
+struct BucketColumnSketches {
+    /// Merged sketches of `sketched_files`.
+    ColumnSketches merged;
+    /// Names of the live sketched data files with the paths of their sketch files, see
+    /// `DataFilePathFactory::SKETCH_PATH_SUFFIX`.
+    std::vector<std::pair<std::string, std::string>> sketched_files;
+    /// Names of the live data files without sketches, e.g. files committed before sketches were
+    /// enabled.
+    std::vector<std::string> unsketched_files;
+};
+
+/// Column sketches of the table at a snapshot.
+struct TableColumnSketches {
+    struct Bucket {
+        BinaryRow partition;
+        int32_t bucket;
+        /// Name of the file of the `BucketColumnSketches` in the statistics directory.
+        std::string file_name;
+        /// Whether some live data files of the bucket are not sketched.
+        bool has_unsketched_files;
+    };
+
+    /// Merged sketches of all buckets.
+    ColumnSketches merged;
+    /// Buckets with live data files.
+    std::vector<Bucket> buckets;
+
+    /// @return Whether all live data files are sketched, the sketches of the table are unknown
+    /// otherwise.
+    bool IsComplete() const;
+};
+
+/// Reads and writes the files of column sketches.
+///
+/// Sketches of a data file are kept in a sketch file next to it, which is listed in the extra
+/// files of the data file, so that they survive the serialization of commit messages. The
+/// statistics directory keeps the merged sketches of each bucket, which are rewritten only when
+/// the files of the bucket change, and the table sketches file referenced by the snapshot (see
+/// `Snapshot::PROPERTY_COLUMN_SKETCHES_FILE`) lists the bucket sketches files and keeps the
+/// merged sketches of all buckets.
+class ColumnSketchesFile {
+ public:
+    ColumnSketchesFile(const std::shared_ptr<FileSystem>& fs,
+                       const std::shared_ptr<FileStorePathFactory>& path_factory,
+                       const std::shared_ptr<MemoryPool>& pool);
+
+    /// Write sketches of a data file to `path`.
+    static Status WriteFileSketches(const std::shared_ptr<FileSystem>& fs, const std::string& path,
+                                    const ColumnSketches& sketches,
+                                    const std::shared_ptr<MemoryPool>& pool);
+
+    /// Read sketches of a data file from `path`.
+    static Result<ColumnSketches> ReadFileSketches(const std::shared_ptr<FileSystem>& fs,
+                                                   const std::string& path,
+                                                   const std::shared_ptr<MemoryPool>& pool);
+
+    static Result<TableColumnSketches> ReadTableSketches(const std::shared_ptr<FileSystem>& fs,
+                                                         const std::string& stats_dir,
+                                                         const std::string& file_name,
+                                                         const std::shared_ptr<MemoryPool>& pool);
+
+    /// Write sketches of a bucket into a new file of the statistics directory.
+    /// @return The name of the written file.
+    Result<std::string> WriteBucketSketches(const BucketColumnSketches& sketches) const;
+
+    /// Read sketches of a bucket from `file_name` in the statistics directory.
+    Result<BucketColumnSketches> ReadBucketSketches(const std::string& file_name) const;
+
+    /// Write sketches of the table into a new file of the statistics directory.
+    /// @return The name of the written file.
+    Result<std::string> WriteTableSketches(const TableColumnSketches& sketches) const;
+
+    /// Read sketches of the table from `file_name` in the statistics directory.
+    Result<TableColumnSketches> ReadTableSketches(const std::string& file_name) const;
+
+    void DeleteQuietly(const std::string& file_name) const;
+
+ private:
+    std::shared_ptr<FileSystem> fs_;
+    std::shared_ptr<FileStorePathFactory> path_factory_;
+    std::shared_ptr<MemoryPool> pool_;
+};
+
+}  // namespace paimon
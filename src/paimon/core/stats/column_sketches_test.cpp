@@ -0,0 +1,110 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/stats/column_sketches.h"
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "paimon/memory/memory_pool.h"
+#include "paimon/testing/utils/testharness.h"
+#include "xxhash.h"  // NOLINT(build/include_subdir)
+
+namespace paimon::test {
+
+namespace {
+uint64_t Hash(int64_t value) {
+    return XXH64(&value, sizeof(value), /*seed=*/0);
+}
+
+ColumnSketch MakeSketch(int32_t field_id, const std::string& field_name, bool with_quantiles,
+                        int64_t begin, int64_t end, int64_t null_count) {
+    ColumnSketch sketch(field_id, field_name, with_quantiles);
+    for (int64_t value = begin; value < end; ++value) {
+        sketch.Update(Hash(value), static_cast<double>(value));
+    }
+    sketch.UpdateNulls(null_count);
+    return sketch;
+}
+}  // namespace
+
+TEST(ColumnSketchesTest, TestSerializeAndDeserialize) {
+    auto pool = GetDefaultPool();
+    std::vector<ColumnSketch> columns;
+    columns.push_back(MakeSketch(/*field_id=*/0, "f0", /*with_quantiles=*/true, 0, 10000, 5));
+    columns.push_back(MakeSketch(/*field_id=*/3, "f3", /*with_quantiles=*/false, 0, 100, 0));
+    ColumnSketches sketches(std::move(columns));
+
+    ASSERT_OK_AND_ASSIGN(PAIMON_UNIQUE_PTR<Bytes> bytes, sketches.Serialize(pool));
+    ASSERT_OK_AND_ASSIGN(ColumnSketches result,
+                         ColumnSketches::Deserialize(bytes->data(), bytes->size(), pool));
+    ASSERT_EQ(2, result.Columns().size());
+    for (const auto& expected : sketches.Columns()) {
+        const ColumnSketch* column = result.GetColumn(expected.FieldId());
+        ASSERT_TRUE(column);
+        ASSERT_EQ(expected.FieldName(), column->FieldName());
+        ASSERT_EQ(expected.RowCount(), column->RowCount());
+        ASSERT_EQ(expected.NullCount(), column->NullCount());
+        ASSERT_EQ(expected.DistinctSketch().Registers(), column->DistinctSketch().Registers());
+        ASSERT_EQ(expected.Quantiles().has_value(), column->Quantiles().has_value());
+        if (expected.Quantiles()) {
+            ASSERT_EQ(expected.Quantiles()->Levels(), column->Quantiles()->Levels());
+            ASSERT_EQ(expected.Quantiles()->Quantile(0.5), column->Quantiles()->Quantile(0.5));
+        }
+    }
+    ASSERT_FALSE(result.GetColumn(/*field_id=*/1));
+
+    // truncated bytes
+    ASSERT_NOK(ColumnSketches::Deserialize(bytes->data(), bytes->size() / 2, pool));
+}
+
+TEST(ColumnSketchesTest, TestMerge) {
+    std::vector<ColumnSketch> columns1;
+    columns1.push_back(MakeSketch(/*field_id=*/0, "f0", /*with_quantiles=*/true, 0, 1000, 1));
+    ColumnSketches sketches(std::move(columns1));
+
+    std::vector<ColumnSketch> columns2;
+    columns2.push_back(
+        MakeSketch(/*field_id=*/0, "f0_new", /*with_quantiles=*/true, 500, 2000, 2));
+    columns2.push_back(MakeSketch(/*field_id=*/1, "f1", /*with_quantiles=*/false, 0, 10, 0));
+    ASSERT_OK(sketches.Merge(ColumnSketches(std::move(columns2))));
+
+    ASSERT_EQ(2, sketches.Columns().size());
+    const ColumnSketch* f0 = sketches.GetColumn(/*field_id=*/0);
+    ASSERT_TRUE(f0);
+    ASSERT_EQ("f0_new", f0->FieldName());
+    ASSERT_EQ(2503, f0->RowCount());
+    ASSERT_EQ(3, f0->NullCount());
+    ASSERT_NEAR(2000, f0->DistinctCount(), 2000 * 0.05);
+    ASSERT_EQ(std::optional<double>(0), f0->Quantiles()->Quantile(0.0));
+    ASSERT_EQ(std::optional<double>(1999), f0->Quantiles()->Quantile(1.0));
+    const ColumnSketch* f1 = sketches.GetColumn(/*field_id=*/1);
+    ASSERT_TRUE(f1);
+    ASSERT_EQ(10, f1->DistinctCount());
+    ASSERT_FALSE(f1->Quantiles());
+
+    // quantiles are dropped if only one side has them
+    ColumnSketch sketch = MakeSketch(/*field_id=*/1, "f1", /*with_quantiles=*/true, 0, 10, 0);
+    ASSERT_OK(sketch.Merge(*f1));
+    ASSERT_FALSE(sketch.Quantiles());
+    ASSERT_NOK(sketch.Merge(*f0));
+}
+
+}  // namespace paimon::test
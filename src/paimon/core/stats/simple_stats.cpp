@@ -20,12 +20,15 @@
 #include <vector>
 
 #include "arrow/api.h"
+#include "arrow/util/checked_cast.h"
 #include "paimon/common/data/binary_row_writer.h"
 #include "paimon/common/data/binary_section.h"
 #include "paimon/common/data/internal_array.h"
 #include "paimon/common/data/internal_row.h"
+#include "paimon/common/utils/arrow/status_utils.h"
 #include "paimon/common/utils/murmurhash_utils.h"
 #include "paimon/common/utils/serialization_utils.h"
+#include "paimon/core/utils/meta_builder_utils.h"
 #include "paimon/macros.h"
 #include "paimon/memory/memory_pool.h"
 #include "paimon/status.h"
@@ -53,6 +56,26 @@ BinaryRow SimpleStats::ToRow() const {
     return row;
 }
 
+Status SimpleStats::AppendTo(arrow::StructBuilder* builder, MemoryPool* pool) const {
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(builder->Append());
+    PAIMON_RETURN_NOT_OK(MetaBuilderUtils::AppendBinaryRow(
+        min_values_, pool, MetaBuilderUtils::FieldBuilder<arrow::BinaryBuilder>(builder, 0)));
+    PAIMON_RETURN_NOT_OK(MetaBuilderUtils::AppendBinaryRow(
+        max_values_, pool, MetaBuilderUtils::FieldBuilder<arrow::BinaryBuilder>(builder, 1)));
+    auto* null_counts_builder = MetaBuilderUtils::FieldBuilder<arrow::ListBuilder>(builder, 2);
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(null_counts_builder->Append());
+    auto* value_builder =
+        arrow::internal::checked_cast<arrow::Int64Builder*>(null_counts_builder->value_builder());
+    for (int32_t i = 0; i < null_counts_.Size(); i++) {
+        if (null_counts_.IsNullAt(i)) {
+            PAIMON_RETURN_NOT_OK_FROM_ARROW(value_builder->AppendNull());
+        } else {
+            PAIMON_RETURN_NOT_OK_FROM_ARROW(value_builder->Append(null_counts_.GetLong(i)));
+        }
+    }
+    return Status::OK();
+}
+
 Result<SimpleStats> SimpleStats::FromRow(const InternalRow* row, MemoryPool* pool) {
     if (PAIMON_UNLIKELY(row == nullptr)) {
         return Status::Invalid("internal row is null pointer");
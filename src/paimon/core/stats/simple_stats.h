@@ -29,6 +29,7 @@
 
 namespace arrow {
 class ArrayBuilder;
+class StructBuilder;
 }  // namespace arrow
 
 namespace paimon {
@@ -68,6 +69,9 @@ class SimpleStats {
 
     BinaryRow ToRow() const;
 
+    /// Append the stats to a struct builder of `DataType()`, the same as converting `ToRow()`.
+    Status AppendTo(arrow::StructBuilder* builder, MemoryPool* pool) const;
+
     static Result<SimpleStats> FromRow(const InternalRow* row, MemoryPool* pool);
 
     std::string ToString() const {
@@ -0,0 +1,271 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/stats/stats_mode.h"
+
+#include <cstddef>
+#include <cstring>
+#include <optional>
+#include <vector>
+
+#include "fmt/format.h"
+#include "paimon/common/utils/string_utils.h"
+#include "paimon/defs.h"
+#include "paimon/format/column_stats.h"
+#include "paimon/status.h"
+
+namespace paimon {
+
+namespace {
+constexpr char TRUNCATE_PREFIX[] = "truncate(";
+constexpr uint32_t MAX_CODE_POINT = 0x10FFFF;
+constexpr uint32_t MIN_SURROGATE = 0xD800;
+constexpr uint32_t MAX_SURROGATE = 0xDFFF;
+
+// Byte length of the UTF-8 sequence starting with `lead`, 0 if `lead` cannot start a sequence.
+size_t SequenceLength(unsigned char lead) {
+    if (lead < 0x80) {
+        return 1;
+    }
+    if ((lead & 0xE0) == 0xC0) {
+        return 2;
+    }
+    if ((lead & 0xF0) == 0xE0) {
+        return 3;
+    }
+    if ((lead & 0xF8) == 0xF0) {
+        return 4;
+    }
+    return 0;
+}
+
+// Byte offsets of the first `max_count` characters of `str`, nullopt if `str` is not valid UTF-8
+// in that range.
+std::optional<std::vector<size_t>> CharOffsets(const std::string& str, int32_t max_count) {
+    std::vector<size_t> offsets;
+    size_t pos = 0;
+    while (pos < str.size() && static_cast<int32_t>(offsets.size()) < max_count) {
+        size_t length = SequenceLength(static_cast<unsigned char>(str[pos]));
+        if (length == 0 || pos + length > str.size()) {
+            return std::nullopt;
+        }
+        offsets.push_back(pos);
+        pos += length;
+    }
+    return offsets;
+}
+
+uint32_t DecodeCodePoint(const std::string& str, size_t pos) {
+    auto lead = static_cast<unsigned char>(str[pos]);
+    size_t length = SequenceLength(lead);
+    if (length == 1) {
+        return lead;
+    }
+    uint32_t code_point = lead & (0xFF >> (length + 1));
+    for (size_t i = 1; i < length; ++i) {
+        code_point = (code_point << 6) | (static_cast<unsigned char>(str[pos + i]) & 0x3F);
+    }
+    return code_point;
+}
+
+void EncodeCodePoint(uint32_t code_point, std::string* str) {
+    if (code_point < 0x80) {
+        str->push_back(static_cast<char>(code_point));
+    } else if (code_point < 0x800) {
+        str->push_back(static_cast<char>(0xC0 | (code_point >> 6)));
+        str->push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+    } else if (code_point < 0x10000) {
+        str->push_back(static_cast<char>(0xE0 | (code_point >> 12)));
+        str->push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+        str->push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+    } else {
+        str->push_back(static_cast<char>(0xF0 | (code_point >> 18)));
+        str->push_back(static_cast<char>(0x80 | ((code_point >> 12) & 0x3F)));
+        str->push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+        str->push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+    }
+}
+
+// Rounds up the prefix of `str` made of the characters at `offsets`, the result is not less than
+// any string starting with the prefix. Returns nullopt if the prefix cannot be rounded up.
+std::optional<std::string> RoundUpPrefix(const std::string& str,
+                                         const std::vector<size_t>& offsets) {
+    for (size_t i = offsets.size(); i > 0; --i) {
+        uint32_t next = DecodeCodePoint(str, offsets[i - 1]) + 1;
+        if (next >= MIN_SURROGATE && next <= MAX_SURROGATE) {
+            next = MAX_SURROGATE + 1;
+        }
+        if (next <= MAX_CODE_POINT) {
+            std::string result = str.substr(0, offsets[i - 1]);
+            EncodeCodePoint(next, &result);
+            return result;
+        }
+    }
+    return std::nullopt;
+}
+
+Result<std::shared_ptr<ColumnStats>> TruncateStringStats(const StringColumnStats& stats,
+                                                         int32_t length) {
+    const auto& min = stats.Min();
+    const auto& max = stats.Max();
+    std::optional<std::string> truncated_min = min;
+    std::optional<std::string> truncated_max = max;
+    if (min) {
+        // one more character to tell whether the string is longer than `length`
+        std::optional<std::vector<size_t>> offsets = CharOffsets(min.value(), length + 1);
+        if (offsets && static_cast<int32_t>(offsets->size()) > length) {
+            truncated_min = min->substr(0, offsets.value()[length]);
+        }
+    }
+    if (max) {
+        std::optional<std::vector<size_t>> offsets = CharOffsets(max.value(), length + 1);
+        if (offsets && static_cast<int32_t>(offsets->size()) > length) {
+            offsets->pop_back();
+            truncated_max = RoundUpPrefix(max.value(), offsets.value());
+            if (!truncated_max) {
+                truncated_min = std::nullopt;
+            }
+        }
+    }
+    return std::shared_ptr<ColumnStats>(
+        ColumnStats::CreateStringColumnStats(truncated_min, truncated_max, stats.NullCount()));
+}
+
+template <typename T>
+Result<const T*> CastStats(const ColumnStats& stats) {
+    const auto* typed_stats = dynamic_cast<const T*>(&stats);
+    if (typed_stats == nullptr) {
+        return Status::Invalid(fmt::format("cast column stats {} failed", stats.ToString()));
+    }
+    return typed_stats;
+}
+
+Result<std::shared_ptr<ColumnStats>> StatsWithoutMinMax(const ColumnStats& stats,
+                                                        std::optional<int64_t> null_count) {
+    FieldType type = stats.GetFieldType();
+    switch (type) {
+        case FieldType::BOOLEAN:
+            return std::shared_ptr<ColumnStats>(
+                ColumnStats::CreateBooleanColumnStats(std::nullopt, std::nullopt, null_count));
+        case FieldType::TINYINT:
+            return std::shared_ptr<ColumnStats>(
+                ColumnStats::CreateTinyIntColumnStats(std::nullopt, std::nullopt, null_count));
+        case FieldType::SMALLINT:
+            return std::shared_ptr<ColumnStats>(
+                ColumnStats::CreateSmallIntColumnStats(std::nullopt, std::nullopt, null_count));
+        case FieldType::INT:
+            return std::shared_ptr<ColumnStats>(
+                ColumnStats::CreateIntColumnStats(std::nullopt, std::nullopt, null_count));
+        case FieldType::BIGINT:
+            return std::shared_ptr<ColumnStats>(
+                ColumnStats::CreateBigIntColumnStats(std::nullopt, std::nullopt, null_count));
+        case FieldType::FLOAT:
+            return std::shared_ptr<ColumnStats>(
+                ColumnStats::CreateFloatColumnStats(std::nullopt, std::nullopt, null_count));
+        case FieldType::DOUBLE:
+            return std::shared_ptr<ColumnStats>(
+                ColumnStats::CreateDoubleColumnStats(std::nullopt, std::nullopt, null_count));
+        case FieldType::STRING:
+            return std::shared_ptr<ColumnStats>(
+                ColumnStats::CreateStringColumnStats(std::nullopt, std::nullopt, null_count));
+        case FieldType::DATE:
+            return std::shared_ptr<ColumnStats>(
+                ColumnStats::CreateDateColumnStats(std::nullopt, std::nullopt, null_count));
+        case FieldType::TIMESTAMP: {
+            PAIMON_ASSIGN_OR_RAISE(const TimestampColumnStats* typed_stats,
+                                   CastStats<TimestampColumnStats>(stats));
+            return std::shared_ptr<ColumnStats>(ColumnStats::CreateTimestampColumnStats(
+                std::nullopt, std::nullopt, null_count, typed_stats->GetPrecision()));
+        }
+        case FieldType::DECIMAL: {
+            PAIMON_ASSIGN_OR_RAISE(const DecimalColumnStats* typed_stats,
+                                   CastStats<DecimalColumnStats>(stats));
+            return std::shared_ptr<ColumnStats>(ColumnStats::CreateDecimalColumnStats(
+                std::nullopt, std::nullopt, null_count, typed_stats->GetPrecision(),
+                typed_stats->GetScale()));
+        }
+        case FieldType::ARRAY:
+        case FieldType::MAP:
+        case FieldType::STRUCT:
+            return std::shared_ptr<ColumnStats>(
+                ColumnStats::CreateNestedColumnStats(type, null_count));
+        default:
+            return Status::Invalid(fmt::format("invalid type {} for stats mode",
+                                               static_cast<int32_t>(type)));
+    }
+}
+}  // namespace
+
+Result<StatsMode> StatsMode::FromString(const std::string& str) {
+    std::string mode = StringUtils::ToLowerCase(str);
+    StringUtils::Trim(&mode);
+    if (mode == "none") {
+        return StatsMode(Kind::NONE, /*truncate_length=*/0);
+    }
+    if (mode == "counts") {
+        return StatsMode(Kind::COUNTS, /*truncate_length=*/0);
+    }
+    if (mode == "full") {
+        return Full();
+    }
+    if (StringUtils::StartsWith(mode, TRUNCATE_PREFIX) && StringUtils::EndsWith(mode, ")")) {
+        size_t prefix_length = std::strlen(TRUNCATE_PREFIX);
+        std::optional<int32_t> length = StringUtils::StringToValue<int32_t>(
+            mode.substr(prefix_length, mode.size() - prefix_length - 1));
+        if (length && length.value() > 0) {
+            return StatsMode(Kind::TRUNCATE, length.value());
+        }
+    }
+    return Status::Invalid(fmt::format(
+        "invalid stats mode '{}', only support none, counts, truncate(N) with N > 0 and full",
+        str));
+}
+
+Result<std::shared_ptr<ColumnStats>> StatsMode::Apply(
+    const std::shared_ptr<ColumnStats>& stats) const {
+    switch (kind_) {
+        case Kind::NONE:
+            return StatsWithoutMinMax(*stats, /*null_count=*/std::nullopt);
+        case Kind::COUNTS:
+            return StatsWithoutMinMax(*stats, stats->NullCount());
+        case Kind::TRUNCATE:
+            if (stats->GetFieldType() == FieldType::STRING) {
+                PAIMON_ASSIGN_OR_RAISE(const StringColumnStats* typed_stats,
+                                       CastStats<StringColumnStats>(*stats));
+                return TruncateStringStats(*typed_stats, truncate_length_);
+            }
+            return stats;
+        case Kind::FULL:
+            return stats;
+    }
+    return Status::Invalid(fmt::format("invalid stats mode {}", static_cast<int32_t>(kind_)));
+}
+
+std::string StatsMode::ToString() const {
+    switch (kind_) {
+        case Kind::NONE:
+            return "none";
+        case Kind::COUNTS:
+            return "counts";
+        case Kind::TRUNCATE:
+            return fmt::format("truncate({})", truncate_length_);
+        case Kind::FULL:
+            return "full";
+    }
+    return "unknown";
+}
+
+}  // namespace paimon
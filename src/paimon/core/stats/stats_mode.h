@@ -0,0 +1,82 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "paimon/result.h"
+
+namespace paimon {
+class ColumnStats;
+
+/// Mode of the metadata stats of a column, configured by "metadata.stats-mode" and
+/// "fields.$field_name.stats-mode".
+class StatsMode {
+ public:
+    enum class Kind {
+        // neither min/max nor null count is stored
+        NONE = 1,
+        // only null count is stored
+        COUNTS = 2,
+        // min/max of strings are truncated, other types are stored in full
+        TRUNCATE = 3,
+        // min/max and null count are stored in full
+        FULL = 4
+    };
+
+    /// Parse mode from "none", "counts", "truncate(N)" or "full", case insensitive.
+    static Result<StatsMode> FromString(const std::string& str);
+
+    static StatsMode Full() {
+        return StatsMode(Kind::FULL, /*truncate_length=*/0);
+    }
+
+    Kind GetKind() const {
+        return kind_;
+    }
+
+    int32_t TruncateLength() const {
+        return truncate_length_;
+    }
+
+    /// Returns the stats of a column reduced to this mode, `stats` is returned directly if
+    /// nothing is reduced.
+    ///
+    /// Truncated min of strings is the prefix of `TruncateLength()` characters, truncated max is
+    /// the prefix with its last character rounded up. If max cannot be rounded up, e.g., all
+    /// characters of the prefix are the max code point, both min and max are dropped.
+    Result<std::shared_ptr<ColumnStats>> Apply(const std::shared_ptr<ColumnStats>& stats) const;
+
+    std::string ToString() const;
+
+    bool operator==(const StatsMode& other) const {
+        return kind_ == other.kind_ && truncate_length_ == other.truncate_length_;
+    }
+
+ private:
+    StatsMode(Kind kind, int32_t truncate_length)
+        : kind_(kind), truncate_length_(truncate_length) {}
+
+ private:
+    Kind kind_;
+    // only valid in TRUNCATE mode
+    int32_t truncate_length_;
+};
+
+}  // namespace paimon
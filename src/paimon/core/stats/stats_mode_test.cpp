@@ -0,0 +1,141 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/stats/stats_mode.h"
+
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "paimon/format/column_stats.h"
+#include "paimon/testing/utils/testharness.h"
+
+namespace paimon::test {
+
+namespace {
+std::shared_ptr<StringColumnStats> TruncateStrings(int32_t length,
+                                                   const std::optional<std::string>& min,
+                                                   const std::optional<std::string>& max) {
+    auto mode = StatsMode::FromString("truncate(" + std::to_string(length) + ")").value();
+    std::shared_ptr<ColumnStats> stats =
+        ColumnStats::CreateStringColumnStats(min, max, /*null_count=*/1);
+    auto result = std::dynamic_pointer_cast<StringColumnStats>(mode.Apply(stats).value());
+    EXPECT_TRUE(result);
+    EXPECT_EQ(1, result->NullCount());
+    return result;
+}
+}  // namespace
+
+TEST(StatsModeTest, TestFromString) {
+    ASSERT_OK_AND_ASSIGN(StatsMode none, StatsMode::FromString("none"));
+    ASSERT_EQ(StatsMode::Kind::NONE, none.GetKind());
+    ASSERT_OK_AND_ASSIGN(StatsMode counts, StatsMode::FromString("Counts"));
+    ASSERT_EQ(StatsMode::Kind::COUNTS, counts.GetKind());
+    ASSERT_OK_AND_ASSIGN(StatsMode full, StatsMode::FromString(" full "));
+    ASSERT_EQ(StatsMode::Full(), full);
+    ASSERT_OK_AND_ASSIGN(StatsMode truncate, StatsMode::FromString("TRUNCATE(16)"));
+    ASSERT_EQ(StatsMode::Kind::TRUNCATE, truncate.GetKind());
+    ASSERT_EQ(16, truncate.TruncateLength());
+    ASSERT_EQ("truncate(16)", truncate.ToString());
+
+    ASSERT_NOK_WITH_MSG(StatsMode::FromString("truncate(0)"), "invalid stats mode 'truncate(0)'");
+    ASSERT_NOK_WITH_MSG(StatsMode::FromString("truncate(a)"), "invalid stats mode");
+    ASSERT_NOK_WITH_MSG(StatsMode::FromString("truncate"), "invalid stats mode");
+    ASSERT_NOK_WITH_MSG(StatsMode::FromString("min-max"), "invalid stats mode");
+}
+
+TEST(StatsModeTest, TestNoneAndCounts) {
+    std::shared_ptr<ColumnStats> int_stats =
+        ColumnStats::CreateIntColumnStats(/*min=*/1, /*max=*/10, /*null_count=*/2);
+    ASSERT_OK_AND_ASSIGN(StatsMode none, StatsMode::FromString("none"));
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<ColumnStats> result, none.Apply(int_stats));
+    auto typed_result = std::dynamic_pointer_cast<IntColumnStats>(result);
+    ASSERT_TRUE(typed_result);
+    ASSERT_EQ(std::nullopt, typed_result->Min());
+    ASSERT_EQ(std::nullopt, typed_result->Max());
+    ASSERT_EQ(std::nullopt, typed_result->NullCount());
+
+    ASSERT_OK_AND_ASSIGN(StatsMode counts, StatsMode::FromString("counts"));
+    ASSERT_OK_AND_ASSIGN(result, counts.Apply(int_stats));
+    typed_result = std::dynamic_pointer_cast<IntColumnStats>(result);
+    ASSERT_TRUE(typed_result);
+    ASSERT_EQ(std::nullopt, typed_result->Min());
+    ASSERT_EQ(std::nullopt, typed_result->Max());
+    ASSERT_EQ(2, typed_result->NullCount());
+
+    std::shared_ptr<ColumnStats> decimal_stats = ColumnStats::CreateDecimalColumnStats(
+        Decimal(/*precision=*/10, /*scale=*/2, /*value=*/100),
+        Decimal(/*precision=*/10, /*scale=*/2, /*value=*/200), /*null_count=*/0,
+        /*precision=*/10, /*scale=*/2);
+    ASSERT_OK_AND_ASSIGN(result, counts.Apply(decimal_stats));
+    auto decimal_result = std::dynamic_pointer_cast<DecimalColumnStats>(result);
+    ASSERT_TRUE(decimal_result);
+    ASSERT_EQ(std::nullopt, decimal_result->Min());
+    ASSERT_EQ(10, decimal_result->GetPrecision());
+    ASSERT_EQ(2, decimal_result->GetScale());
+    ASSERT_EQ(0, decimal_result->NullCount());
+
+    std::shared_ptr<ColumnStats> nested_stats =
+        ColumnStats::CreateNestedColumnStats(FieldType::ARRAY, /*null_count=*/3);
+    ASSERT_OK_AND_ASSIGN(result, none.Apply(nested_stats));
+    ASSERT_EQ(FieldType::ARRAY, result->GetFieldType());
+    ASSERT_EQ(std::nullopt, result->NullCount());
+}
+
+TEST(StatsModeTest, TestFullAndTruncateNonString) {
+    std::shared_ptr<ColumnStats> int_stats =
+        ColumnStats::CreateIntColumnStats(/*min=*/1, /*max=*/10, /*null_count=*/2);
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<ColumnStats> result, StatsMode::Full().Apply(int_stats));
+    ASSERT_EQ(int_stats, result);
+    ASSERT_OK_AND_ASSIGN(StatsMode truncate, StatsMode::FromString("truncate(1)"));
+    ASSERT_OK_AND_ASSIGN(result, truncate.Apply(int_stats));
+    ASSERT_EQ(int_stats, result);
+}
+
+TEST(StatsModeTest, TestTruncateString) {
+    // short strings are kept
+    auto result = TruncateStrings(/*length=*/4, "abc", "abcd");
+    ASSERT_EQ("abc", result->Min());
+    ASSERT_EQ("abcd", result->Max());
+    // long strings are truncated, max is rounded up
+    result = TruncateStrings(/*length=*/3, "abcdef", "abzzz");
+    ASSERT_EQ("abc", result->Min());
+    ASSERT_EQ("ab{", result->Max());
+    // null min/max
+    result = TruncateStrings(/*length=*/3, std::nullopt, std::nullopt);
+    ASSERT_EQ(std::nullopt, result->Min());
+    ASSERT_EQ(std::nullopt, result->Max());
+    // truncated by characters rather than bytes
+    result = TruncateStrings(/*length=*/2, "\xE4\xBD\xA0\xE5\xA5\xBD\xE5\x90\x97",
+                             "\xE4\xBD\xA0\xE5\xA5\xBD\xE5\x90\x97");
+    ASSERT_EQ("\xE4\xBD\xA0\xE5\xA5\xBD", result->Min());
+    ASSERT_EQ("\xE4\xBD\xA0\xE5\xA5\xBE", result->Max());
+    // round up skips surrogates, U+D7FF to U+E000
+    result = TruncateStrings(/*length=*/1, "a", "\xED\x9F\xBF\x61");
+    ASSERT_EQ("a", result->Min());
+    ASSERT_EQ("\xEE\x80\x80", result->Max());
+    // round up carries to the previous character if the last one is the max code point
+    result = TruncateStrings(/*length=*/2, "a", "a\xF4\x8F\xBF\xBF\x61");
+    ASSERT_EQ("a", result->Min());
+    ASSERT_EQ("b", result->Max());
+    // max cannot be rounded up, both min and max are dropped
+    result = TruncateStrings(/*length=*/1, "a", "\xF4\x8F\xBF\xBF\x61");
+    ASSERT_EQ(std::nullopt, result->Min());
+    ASSERT_EQ(std::nullopt, result->Max());
+}
+
+}  // namespace paimon::test
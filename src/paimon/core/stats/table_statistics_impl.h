@@ -0,0 +1,98 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "paimon/core/stats/column_sketches.h"
+#include "paimon/stats/table_statistics.h"
+
+namespace paimon {
+
+class ColumnStatisticsImpl : public ColumnStatistics {
+ public:
+    ColumnStatisticsImpl(const std::string& field_name, const ColumnSketch& sketch)
+        : field_name_(field_name), sketch_(sketch) {}
+
+    int32_t FieldId() const override {
+        return sketch_.FieldId();
+    }
+    const std::string& FieldName() const override {
+        return field_name_;
+    }
+    int64_t RowCount() const override {
+        return sketch_.RowCount();
+    }
+    int64_t NullCount() const override {
+        return sketch_.NullCount();
+    }
+    int64_t DistinctCount() const override {
+        return sketch_.DistinctCount();
+    }
+    bool HasQuantiles() const override {
+        return sketch_.Quantiles().has_value();
+    }
+    std::optional<double> Quantile(double rank) const override {
+        if (!sketch_.Quantiles()) {
+            return std::nullopt;
+        }
+        return sketch_.Quantiles()->Quantile(rank);
+    }
+    std::vector<double> EquiDepthBoundaries(int32_t num_buckets) const override {
+        if (!sketch_.Quantiles()) {
+            return {};
+        }
+        return sketch_.Quantiles()->EquiDepthBoundaries(num_buckets);
+    }
+
+ private:
+    std::string field_name_;
+    ColumnSketch sketch_;
+};
+
+class TableStatisticsImpl : public TableStatistics {
+ public:
+    TableStatisticsImpl(int64_t snapshot_id,
+                        std::vector<std::shared_ptr<ColumnStatistics>>&& columns)
+        : snapshot_id_(snapshot_id), columns_(std::move(columns)) {}
+
+    int64_t SnapshotId() const override {
+        return snapshot_id_;
+    }
+    const std::vector<std::shared_ptr<ColumnStatistics>>& Columns() const override {
+        return columns_;
+    }
+    std::shared_ptr<ColumnStatistics> GetColumn(const std::string& field_name) const override {
+        for (const auto& column : columns_) {
+            if (column->FieldName() == field_name) {
+                return column;
+            }
+        }
+        return nullptr;
+    }
+
+ private:
+    int64_t snapshot_id_;
+    std::vector<std::shared_ptr<ColumnStatistics>> columns_;
+};
+
+}  // namespace paimon
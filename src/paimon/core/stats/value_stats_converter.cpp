@@ -0,0 +1,90 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/stats/value_stats_converter.h"
+
+#include <utility>
+
+#include "fmt/format.h"
+#include "paimon/core/core_options.h"
+#include "paimon/core/stats/simple_stats.h"
+#include "paimon/core/stats/simple_stats_converter.h"
+#include "paimon/format/column_stats.h"
+
+namespace paimon {
+
+ValueStatsConverter::ValueStatsConverter(std::vector<StatsMode>&& modes,
+                                         std::optional<std::vector<std::string>>&& dense_fields)
+    : modes_(std::move(modes)), dense_fields_(std::move(dense_fields)), all_full_(true) {
+    for (const auto& mode : modes_) {
+        if (mode.GetKind() != StatsMode::Kind::FULL) {
+            all_full_ = false;
+            break;
+        }
+    }
+}
+
+Result<std::unique_ptr<ValueStatsConverter>> ValueStatsConverter::Create(
+    const CoreOptions& options, const std::vector<std::string>& field_names) {
+    std::vector<StatsMode> modes;
+    modes.reserve(field_names.size());
+    std::vector<std::string> stored_fields;
+    for (const auto& field_name : field_names) {
+        PAIMON_ASSIGN_OR_RAISE(StatsMode mode,
+                               StatsMode::FromString(options.GetFieldStatsMode(field_name)));
+        if (mode.GetKind() != StatsMode::Kind::NONE) {
+            stored_fields.push_back(field_name);
+        }
+        modes.push_back(mode);
+    }
+    std::optional<std::vector<std::string>> dense_fields;
+    if (options.MetadataStatsDenseStore() && stored_fields.size() != field_names.size()) {
+        dense_fields = std::move(stored_fields);
+    }
+    return std::unique_ptr<ValueStatsConverter>(
+        new ValueStatsConverter(std::move(modes), std::move(dense_fields)));
+}
+
+Status ValueStatsConverter::Convert(
+    const std::vector<std::shared_ptr<ColumnStats>>& field_stats, MemoryPool* pool,
+    SimpleStats* value_stats, std::optional<std::vector<std::string>>* value_stats_cols) const {
+    if (field_stats.size() != modes_.size()) {
+        return Status::Invalid(fmt::format("field stats count {} mismatch with stats modes {}",
+                                           field_stats.size(), modes_.size()));
+    }
+    *value_stats_cols = dense_fields_;
+    if (all_full_) {
+        PAIMON_ASSIGN_OR_RAISE(*value_stats, SimpleStatsConverter::ToBinary(field_stats, pool));
+        return Status::OK();
+    }
+    std::vector<std::shared_ptr<ColumnStats>> stored_stats;
+    stored_stats.reserve(field_stats.size());
+    for (size_t i = 0; i < field_stats.size(); ++i) {
+        if (dense_fields_ && modes_[i].GetKind() == StatsMode::Kind::NONE) {
+            continue;
+        }
+        PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<ColumnStats> stats, modes_[i].Apply(field_stats[i]));
+        stored_stats.push_back(std::move(stats));
+    }
+    if (stored_stats.empty()) {
+        *value_stats = SimpleStats::EmptyStats();
+        return Status::OK();
+    }
+    PAIMON_ASSIGN_OR_RAISE(*value_stats, SimpleStatsConverter::ToBinary(stored_stats, pool));
+    return Status::OK();
+}
+
+}  // namespace paimon
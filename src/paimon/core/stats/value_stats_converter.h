@@ -0,0 +1,62 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "paimon/core/stats/stats_mode.h"
+#include "paimon/result.h"
+#include "paimon/status.h"
+
+namespace paimon {
+class ColumnStats;
+class CoreOptions;
+class MemoryPool;
+class SimpleStats;
+
+/// Converts stats of the value fields of a data file to the value stats of `DataFileMeta`,
+/// reducing the stats of each field to its `StatsMode`.
+///
+/// With "metadata.stats-dense-store", fields in "none" mode are not stored at all, and the stored
+/// fields are listed in `DataFileMeta::value_stats_cols`.
+class ValueStatsConverter {
+ public:
+    static Result<std::unique_ptr<ValueStatsConverter>> Create(
+        const CoreOptions& options, const std::vector<std::string>& field_names);
+
+    /// @param field_stats Stats of all value fields, in the order of `field_names`.
+    /// @param value_stats Output value stats.
+    /// @param value_stats_cols Output names of the stored fields, nullopt if all fields are stored.
+    Status Convert(const std::vector<std::shared_ptr<ColumnStats>>& field_stats, MemoryPool* pool,
+                   SimpleStats* value_stats,
+                   std::optional<std::vector<std::string>>* value_stats_cols) const;
+
+ private:
+    ValueStatsConverter(std::vector<StatsMode>&& modes,
+                        std::optional<std::vector<std::string>>&& dense_fields);
+
+ private:
+    std::vector<StatsMode> modes_;
+    // names of the stored fields in dense store, nullopt if all fields are stored
+    std::optional<std::vector<std::string>> dense_fields_;
+    bool all_full_;
+};
+
+}  // namespace paimon
@@ -0,0 +1,126 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/stats/value_stats_converter.h"
+
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "paimon/core/core_options.h"
+#include "paimon/core/stats/simple_stats.h"
+#include "paimon/core/stats/simple_stats_converter.h"
+#include "paimon/defs.h"
+#include "paimon/format/column_stats.h"
+#include "paimon/memory/memory_pool.h"
+#include "paimon/testing/utils/testharness.h"
+
+namespace paimon::test {
+
+class ValueStatsConverterTest : public testing::Test {
+ public:
+    void SetUp() override {
+        pool_ = GetDefaultPool();
+        field_stats_ = {
+            ColumnStats::CreateIntColumnStats(/*min=*/1, /*max=*/10, /*null_count=*/0),
+            ColumnStats::CreateStringColumnStats("apple", "banana", /*null_count=*/1),
+            ColumnStats::CreateBigIntColumnStats(/*min=*/-5, /*max=*/5, /*null_count=*/2),
+        };
+    }
+
+    void Convert(const std::map<std::string, std::string>& raw_options, SimpleStats* value_stats,
+                 std::optional<std::vector<std::string>>* value_stats_cols) const {
+        ASSERT_OK_AND_ASSIGN(CoreOptions options, CoreOptions::FromMap(raw_options));
+        ASSERT_OK_AND_ASSIGN(std::unique_ptr<ValueStatsConverter> converter,
+                             ValueStatsConverter::Create(options, field_names_));
+        ASSERT_OK(converter->Convert(field_stats_, pool_.get(), value_stats, value_stats_cols));
+    }
+
+ protected:
+    std::shared_ptr<MemoryPool> pool_;
+    std::vector<std::string> field_names_ = {"f0", "f1", "f2"};
+    std::vector<std::shared_ptr<ColumnStats>> field_stats_;
+};
+
+TEST_F(ValueStatsConverterTest, TestFull) {
+    SimpleStats value_stats = SimpleStats::EmptyStats();
+    std::optional<std::vector<std::string>> value_stats_cols;
+    Convert({}, &value_stats, &value_stats_cols);
+    ASSERT_EQ(std::nullopt, value_stats_cols);
+    ASSERT_OK_AND_ASSIGN(SimpleStats expected,
+                         SimpleStatsConverter::ToBinary(field_stats_, pool_.get()));
+    ASSERT_EQ(expected, value_stats);
+}
+
+TEST_F(ValueStatsConverterTest, TestDenseStore) {
+    SimpleStats value_stats = SimpleStats::EmptyStats();
+    std::optional<std::vector<std::string>> value_stats_cols;
+    Convert({{Options::METADATA_STATS_MODE, "truncate(2)"}, {"fields.f0.stats-mode", "none"}},
+            &value_stats, &value_stats_cols);
+    ASSERT_EQ(std::vector<std::string>({"f1", "f2"}), value_stats_cols);
+    ASSERT_EQ(2, value_stats.MinValues().GetFieldCount());
+    ASSERT_EQ("ap", value_stats.MinValues().GetString(0).ToString());
+    ASSERT_EQ("bb", value_stats.MaxValues().GetString(0).ToString());
+    ASSERT_EQ(-5, value_stats.MinValues().GetLong(1));
+    ASSERT_EQ(5, value_stats.MaxValues().GetLong(1));
+    ASSERT_EQ(1, value_stats.NullCounts().GetLong(0));
+    ASSERT_EQ(2, value_stats.NullCounts().GetLong(1));
+
+    // all fields in none mode
+    Convert({{Options::METADATA_STATS_MODE, "none"}}, &value_stats, &value_stats_cols);
+    ASSERT_EQ(std::vector<std::string>(), value_stats_cols);
+    ASSERT_EQ(SimpleStats::EmptyStats(), value_stats);
+}
+
+TEST_F(ValueStatsConverterTest, TestSparseStore) {
+    SimpleStats value_stats = SimpleStats::EmptyStats();
+    std::optional<std::vector<std::string>> value_stats_cols;
+    Convert({{Options::METADATA_STATS_DENSE_STORE, "false"},
+             {"fields.f0.stats-mode", "none"},
+             {"fields.f2.stats-mode", "counts"}},
+            &value_stats, &value_stats_cols);
+    ASSERT_EQ(std::nullopt, value_stats_cols);
+    ASSERT_EQ(3, value_stats.MinValues().GetFieldCount());
+    ASSERT_TRUE(value_stats.MinValues().IsNullAt(0));
+    ASSERT_TRUE(value_stats.MaxValues().IsNullAt(0));
+    ASSERT_TRUE(value_stats.NullCounts().IsNullAt(0));
+    ASSERT_EQ("apple", value_stats.MinValues().GetString(1).ToString());
+    ASSERT_EQ("banana", value_stats.MaxValues().GetString(1).ToString());
+    ASSERT_TRUE(value_stats.MinValues().IsNullAt(2));
+    ASSERT_TRUE(value_stats.MaxValues().IsNullAt(2));
+    ASSERT_EQ(2, value_stats.NullCounts().GetLong(2));
+}
+
+TEST_F(ValueStatsConverterTest, TestInvalid) {
+    ASSERT_OK_AND_ASSIGN(CoreOptions options,
+                         CoreOptions::FromMap({{"fields.f1.stats-mode", "truncate(-1)"}}));
+    ASSERT_NOK_WITH_MSG(ValueStatsConverter::Create(options, field_names_),
+                        "invalid stats mode 'truncate(-1)'");
+
+    ASSERT_OK_AND_ASSIGN(options, CoreOptions::FromMap({}));
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<ValueStatsConverter> converter,
+                         ValueStatsConverter::Create(options, {"f0"}));
+    SimpleStats value_stats = SimpleStats::EmptyStats();
+    std::optional<std::vector<std::string>> value_stats_cols;
+    ASSERT_NOK_WITH_MSG(
+        converter->Convert(field_stats_, pool_.get(), &value_stats, &value_stats_cols),
+        "field stats count 3 mismatch with stats modes 1");
+}
+
+}  // namespace paimon::test
@@ -0,0 +1,169 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/commit_message_spool.h"
+
+#include <utility>
+
+#include "fmt/format.h"
+#include "paimon/common/io/data_output_stream.h"
+#include "paimon/common/io/memory_segment_output_stream.h"
+#include "paimon/common/memory/memory_segment_utils.h"
+#include "paimon/core/table/sink/commit_message_serializer.h"
+#include "paimon/fs/file_system.h"
+#include "paimon/io/buffered_input_stream.h"
+#include "paimon/io/data_input_stream.h"
+#include "paimon/memory/bytes.h"
+#include "paimon/memory/memory_pool.h"
+
+namespace paimon {
+
+namespace {
+// "PCMS", paimon commit message spool
+constexpr int32_t SPOOL_MAGIC = 0x50434D53;
+constexpr int32_t SPOOL_HEADER_SIZE = sizeof(int32_t);
+// read ahead of the spool file, a commit message with stats of several files fits in it
+constexpr int32_t SPOOL_READ_BUFFER_SIZE = 1024 * 1024;
+}  // namespace
+
+CommitMessageSpoolWriter::CommitMessageSpoolWriter(const std::shared_ptr<OutputStream>& out,
+                                                   const std::shared_ptr<MemoryPool>& pool)
+    : pool_(pool),
+      out_(out),
+      data_out_(std::make_unique<DataOutputStream>(out)),
+      serializer_(std::make_unique<CommitMessageSerializer>(pool)) {}
+
+CommitMessageSpoolWriter::~CommitMessageSpoolWriter() {
+    if (!closed_) {
+        [[maybe_unused]] auto status = out_->Close();
+    }
+}
+
+Result<std::unique_ptr<CommitMessageSpoolWriter>> CommitMessageSpoolWriter::Create(
+    const std::shared_ptr<FileSystem>& fs, const std::string& path,
+    const std::shared_ptr<MemoryPool>& pool) {
+    if (fs == nullptr) {
+        return Status::Invalid("file system of commit message spool is null pointer");
+    }
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<OutputStream> out,
+                           fs->Create(path, /*overwrite=*/true));
+    auto writer = std::unique_ptr<CommitMessageSpoolWriter>(
+        new CommitMessageSpoolWriter(std::shared_ptr<OutputStream>(std::move(out)), pool));
+    PAIMON_RETURN_NOT_OK(writer->data_out_->WriteValue<int32_t>(SPOOL_MAGIC));
+    return writer;
+}
+
+Status CommitMessageSpoolWriter::Append(const std::shared_ptr<CommitMessage>& commit_message) {
+    MemorySegmentOutputStream out(MemorySegmentOutputStream::DEFAULT_SEGMENT_SIZE, pool_);
+    PAIMON_RETURN_NOT_OK(serializer_->Serialize(commit_message, &out));
+    PAIMON_UNIQUE_PTR<Bytes> bytes =
+        MemorySegmentUtils::CopyToBytes(out.Segments(), 0, out.CurrentSize(), pool_.get());
+    return AppendSerialized(CommitMessageSerializer::CURRENT_VERSION, bytes->data(),
+                            bytes->size());
+}
+
+Status CommitMessageSpoolWriter::AppendSerialized(int32_t version, const char* buffer,
+                                                  int32_t length) {
+    if (closed_) {
+        return Status::Invalid("commit message spool is already closed");
+    }
+    if (buffer == nullptr) {
+        return Status::Invalid("buffer is null pointer");
+    }
+    if (length <= 0) {
+        return Status::Invalid("length is equal or less than zero");
+    }
+    PAIMON_RETURN_NOT_OK(data_out_->WriteValue<int32_t>(version));
+    PAIMON_RETURN_NOT_OK(data_out_->WriteValue<int32_t>(length));
+    PAIMON_ASSIGN_OR_RAISE(int32_t write_length, out_->Write(buffer, length));
+    if (write_length != length) {
+        return Status::Invalid(fmt::format(
+            "write commit message to spool failed, expect {} bytes, actual {} bytes", length,
+            write_length));
+    }
+    num_messages_++;
+    return Status::OK();
+}
+
+Status CommitMessageSpoolWriter::Close() {
+    if (closed_) {
+        return Status::OK();
+    }
+    closed_ = true;
+    PAIMON_RETURN_NOT_OK(out_->Flush());
+    return out_->Close();
+}
+
+CommitMessageSpoolReader::CommitMessageSpoolReader(const std::shared_ptr<InputStream>& in,
+                                                   uint64_t length,
+                                                   const std::shared_ptr<MemoryPool>& pool)
+    : pool_(pool),
+      in_(in),
+      data_in_(std::make_unique<DataInputStream>(in)),
+      serializer_(std::make_unique<CommitMessageSerializer>(pool)),
+      length_(length) {}
+
+CommitMessageSpoolReader::~CommitMessageSpoolReader() = default;
+
+Result<std::unique_ptr<CommitMessageSpoolReader>> CommitMessageSpoolReader::Create(
+    const std::shared_ptr<FileSystem>& fs, const std::string& path,
+    const std::shared_ptr<MemoryPool>& pool) {
+    if (fs == nullptr) {
+        return Status::Invalid("file system of commit message spool is null pointer");
+    }
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<InputStream> file_in, fs->Open(path));
+    auto in = std::make_shared<BufferedInputStream>(std::move(file_in), SPOOL_READ_BUFFER_SIZE,
+                                                    pool.get());
+    PAIMON_ASSIGN_OR_RAISE(uint64_t length, in->Length());
+    auto reader = std::unique_ptr<CommitMessageSpoolReader>(
+        new CommitMessageSpoolReader(in, length, pool));
+    PAIMON_ASSIGN_OR_RAISE(int32_t magic, reader->data_in_->ReadValue<int32_t>());
+    if (magic != SPOOL_MAGIC) {
+        return Status::Invalid(fmt::format("{} is not a commit message spool file", path));
+    }
+    return reader;
+}
+
+Result<std::shared_ptr<CommitMessage>> CommitMessageSpoolReader::Next() {
+    PAIMON_ASSIGN_OR_RAISE(int64_t start_pos, data_in_->GetPos());
+    if (static_cast<uint64_t>(start_pos) >= length_) {
+        return std::shared_ptr<CommitMessage>();
+    }
+    PAIMON_ASSIGN_OR_RAISE(int32_t version, data_in_->ReadValue<int32_t>());
+    PAIMON_ASSIGN_OR_RAISE(int32_t length, data_in_->ReadValue<int32_t>());
+    PAIMON_ASSIGN_OR_RAISE(int64_t message_pos, data_in_->GetPos());
+    // decode from the stream directly, the bytes of the message are never held at once
+    PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<CommitMessage> commit_message,
+                           serializer_->Deserialize(version, data_in_.get()));
+    PAIMON_ASSIGN_OR_RAISE(int64_t end_pos, data_in_->GetPos());
+    if (end_pos - message_pos != length) {
+        return Status::Invalid(fmt::format(
+            "corrupted commit message spool at offset {}, expect message of {} bytes, actual {} "
+            "bytes",
+            start_pos, length, end_pos - message_pos));
+    }
+    return commit_message;
+}
+
+Status CommitMessageSpoolReader::Rewind() {
+    return data_in_->Seek(SPOOL_HEADER_SIZE);
+}
+
+Status CommitMessageSpoolReader::Close() {
+    return in_->Close();
+}
+
+}  // namespace paimon
@@ -0,0 +1,110 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/commit_message_spool.h"
+
+#include <utility>
+
+#include "gtest/gtest.h"
+#include "paimon/core/table/sink/commit_message_impl.h"
+#include "paimon/fs/file_system.h"
+#include "paimon/fs/local/local_file_system.h"
+#include "paimon/memory/memory_pool.h"
+#include "paimon/status.h"
+#include "paimon/testing/utils/testharness.h"
+
+namespace paimon::test {
+
+class CommitMessageSpoolTest : public testing::Test {
+ public:
+    void SetUp() override {
+        pool_ = GetDefaultPool();
+        fs_ = std::make_shared<LocalFileSystem>();
+        dir_ = UniqueTestDirectory::Create();
+        ASSERT_TRUE(dir_);
+    }
+
+    // a single commit message serialized in version 10
+    std::string ReadVersion10Message() const {
+        std::string data_path = paimon::test::GetDataDir() +
+                                "orc/pk_dv_index_with_commit_message_version10.db/"
+                                "pk_dv_index_with_commit_message_version10/"
+                                "commit_messages/commit_messages-01";
+        std::string content;
+        EXPECT_OK(fs_->ReadFile(data_path, &content));
+        // skip the number of messages in the list
+        return content.substr(sizeof(int32_t));
+    }
+
+ protected:
+    std::shared_ptr<MemoryPool> pool_;
+    std::shared_ptr<FileSystem> fs_;
+    std::unique_ptr<UniqueTestDirectory> dir_;
+};
+
+TEST_F(CommitMessageSpoolTest, TestAppendAndRead) {
+    std::string serialized = ReadVersion10Message();
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<CommitMessage> message,
+                         CommitMessage::Deserialize(/*version=*/10, serialized.data(),
+                                                    serialized.size(), pool_));
+    const auto& expected = *std::dynamic_pointer_cast<CommitMessageImpl>(message);
+
+    std::string spool_path = dir_->Str() + "/commit-spool";
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<CommitMessageSpoolWriter> writer,
+                         CommitMessageSpoolWriter::Create(fs_, spool_path, pool_));
+    ASSERT_OK(writer->Append(message));
+    ASSERT_OK(writer->AppendSerialized(/*version=*/10, serialized.data(), serialized.size()));
+    ASSERT_OK(writer->Append(message));
+    ASSERT_NOK_WITH_MSG(writer->AppendSerialized(/*version=*/10, nullptr, 0),
+                        "buffer is null pointer");
+    ASSERT_EQ(3, writer->NumMessages());
+    ASSERT_OK(writer->Close());
+    ASSERT_NOK_WITH_MSG(writer->Append(message), "commit message spool is already closed");
+
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<CommitMessageSpoolReader> reader,
+                         CommitMessageSpoolReader::Create(fs_, spool_path, pool_));
+    for (int32_t round = 0; round < 2; ++round) {
+        for (int32_t i = 0; i < 3; ++i) {
+            ASSERT_OK_AND_ASSIGN(std::shared_ptr<CommitMessage> result, reader->Next());
+            ASSERT_TRUE(result);
+            ASSERT_EQ(expected, *std::dynamic_pointer_cast<CommitMessageImpl>(result));
+        }
+        ASSERT_OK_AND_ASSIGN(std::shared_ptr<CommitMessage> result, reader->Next());
+        ASSERT_FALSE(result);
+        ASSERT_OK(reader->Rewind());
+    }
+    ASSERT_OK(reader->Close());
+}
+
+TEST_F(CommitMessageSpoolTest, TestEmptySpool) {
+    std::string spool_path = dir_->Str() + "/commit-spool";
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<CommitMessageSpoolWriter> writer,
+                         CommitMessageSpoolWriter::Create(fs_, spool_path, pool_));
+    ASSERT_OK(writer->Close());
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<CommitMessageSpoolReader> reader,
+                         CommitMessageSpoolReader::Create(fs_, spool_path, pool_));
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<CommitMessage> result, reader->Next());
+    ASSERT_FALSE(result);
+}
+
+TEST_F(CommitMessageSpoolTest, TestInvalidSpool) {
+    std::string spool_path = dir_->Str() + "/not-a-spool";
+    ASSERT_OK(fs_->WriteFile(spool_path, "invalid spool", /*overwrite=*/true));
+    ASSERT_NOK_WITH_MSG(CommitMessageSpoolReader::Create(fs_, spool_path, pool_),
+                        "is not a commit message spool file");
+}
+
+}  // namespace paimon::test
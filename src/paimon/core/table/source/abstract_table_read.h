@@ -0,0 +1,79 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/type.h"
+#include "paimon/common/table/special_fields.h"
+#include "paimon/core/operation/internal_read_context.h"
+#include "paimon/reader/batch_reader.h"
+#include "paimon/result.h"
+#include "paimon/status.h"
+#include "paimon/table/source/split.h"
+#include "paimon/table/source/table_read.h"
+
+namespace paimon {
+class MemoryPool;
+
+/// Base of the built-in `TableRead` implementations, which holds the state shared by them
+/// without changing the layout of the exported `TableRead`.
+class AbstractTableRead : public TableRead {
+ public:
+    /// Schema of the batches returned by the readers: `_VALUE_KIND` followed by the read fields.
+    const std::shared_ptr<arrow::Schema>& OutputSchema() const {
+        return output_schema_;
+    }
+
+    /// Creates readers of `splits` which each return rows in trimmed primary key order, in the
+    /// order of `splits`. Only primary key tables support it.
+    virtual Result<std::vector<std::unique_ptr<BatchReader>>> CreateKeyOrderedReaders(
+        const std::vector<std::shared_ptr<Split>>& splits) {
+        return Status::NotImplemented("key ordered read is only supported for primary key tables");
+    }
+
+    /// Merges `readers` created by `CreateKeyOrderedReaders()` into a single reader in trimmed
+    /// primary key order.
+    virtual Result<std::unique_ptr<BatchReader>> MergeKeyOrderedReaders(
+        std::vector<std::unique_ptr<BatchReader>>&& readers) {
+        return Status::NotImplemented("key ordered read is only supported for primary key tables");
+    }
+
+ protected:
+    AbstractTableRead(const std::shared_ptr<InternalReadContext>& context,
+                      const std::shared_ptr<MemoryPool>& memory_pool)
+        : AbstractTableRead(CreateOutputSchema(*context), memory_pool) {}
+
+    AbstractTableRead(std::shared_ptr<arrow::Schema> output_schema,
+                      const std::shared_ptr<MemoryPool>& memory_pool)
+        : TableRead(memory_pool), output_schema_(std::move(output_schema)) {}
+
+ private:
+    static std::shared_ptr<arrow::Schema> CreateOutputSchema(const InternalReadContext& context) {
+        arrow::FieldVector fields = {SpecialFields::ValueKind().ArrowField()};
+        const auto& read_fields = context.GetReadSchema()->fields();
+        fields.insert(fields.end(), read_fields.begin(), read_fields.end());
+        return arrow::schema(fields);
+    }
+
+ private:
+    std::shared_ptr<arrow::Schema> output_schema_;
+};
+
+}  // namespace paimon
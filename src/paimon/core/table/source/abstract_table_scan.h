@@ -35,6 +35,10 @@ class AbstractTableScan : public TableScan {
                       const std::shared_ptr<SnapshotReader>& snapshot_reader)
         : core_options_(core_options), snapshot_reader_(snapshot_reader) {}
 
+    Result<std::shared_ptr<BucketedPlan>> CreateBucketedPlan() override {
+        return Status::NotImplemented("bucketed plan is only supported by batch scan");
+    }
+
  protected:
     Result<std::shared_ptr<StartingScanner>> CreateStartingScanner(bool is_streaming) const {
         const auto& snapshot_manager = snapshot_reader_->GetSnapshotManager();
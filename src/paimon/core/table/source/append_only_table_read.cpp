@@ -32,7 +32,7 @@ AppendOnlyTableRead::AppendOnlyTableRead(const std::shared_ptr<FileStorePathFact
                                          const std::shared_ptr<InternalReadContext>& context,
                                          const std::shared_ptr<MemoryPool>& memory_pool,
                                          const std::shared_ptr<Executor>& executor)
-    : TableRead(memory_pool) {
+    : AbstractTableRead(context, memory_pool) {
     const auto& core_options = context->GetCoreOptions();
     if (core_options.DataEvolutionEnabled()) {
         // add data evolution first
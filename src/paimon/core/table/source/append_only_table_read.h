@@ -21,10 +21,10 @@
 
 #include "paimon/core/operation/internal_read_context.h"
 #include "paimon/core/operation/split_read.h"
+#include "paimon/core/table/source/abstract_table_read.h"
 #include "paimon/core/utils/file_store_path_factory.h"
 #include "paimon/reader/batch_reader.h"
 #include "paimon/result.h"
-#include "paimon/table/source/table_read.h"
 
 namespace paimon {
 
@@ -34,7 +34,7 @@ class FileStorePathFactory;
 class InternalReadContext;
 class MemoryPool;
 
-class AppendOnlyTableRead : public TableRead {
+class AppendOnlyTableRead : public AbstractTableRead {
  public:
     AppendOnlyTableRead(const std::shared_ptr<FileStorePathFactory>& path_factory,
                         const std::shared_ptr<InternalReadContext>& context,
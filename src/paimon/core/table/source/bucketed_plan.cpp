@@ -0,0 +1,81 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/table/source/bucketed_plan.h"
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "fmt/format.h"
+#include "fmt/ranges.h"
+#include "paimon/status.h"
+
+namespace paimon {
+
+Result<std::vector<BucketedPlan::BucketPair>> BucketedPlan::PairBuckets(
+    const BucketedPlan& left, const BucketedPlan& right) {
+    if (left.NumBuckets() != right.NumBuckets()) {
+        return Status::Invalid(fmt::format(
+            "cannot pair buckets of tables with different numbers of buckets, left {}, right {}",
+            left.NumBuckets(), right.NumBuckets()));
+    }
+    const arrow::FieldVector& left_keys = left.BucketKeys();
+    const arrow::FieldVector& right_keys = right.BucketKeys();
+    bool same_key_types = left_keys.size() == right_keys.size();
+    for (size_t i = 0; same_key_types && i < left_keys.size(); ++i) {
+        same_key_types = left_keys[i]->type()->Equals(right_keys[i]->type());
+    }
+    if (!same_key_types) {
+        auto to_string = [](const arrow::FieldVector& keys) {
+            std::vector<std::string> types;
+            types.reserve(keys.size());
+            for (const auto& key : keys) {
+                types.push_back(key->type()->ToString());
+            }
+            return fmt::format("[{}]", fmt::join(types, ", "));
+        };
+        return Status::Invalid(fmt::format(
+            "cannot pair buckets of tables with different types of bucket keys, left {}, right {}",
+            to_string(left_keys), to_string(right_keys)));
+    }
+
+    std::map<int32_t, BucketPair> pairs;
+    auto get_pair = [&pairs](int32_t bucket) -> BucketPair& {
+        auto iter = pairs.find(bucket);
+        if (iter == pairs.end()) {
+            iter = pairs.emplace(bucket, BucketPair{bucket, {}, {}}).first;
+        }
+        return iter->second;
+    };
+    for (const auto& bucket_splits : left.Buckets()) {
+        auto& splits = get_pair(bucket_splits.bucket).left;
+        splits.insert(splits.end(), bucket_splits.splits.begin(), bucket_splits.splits.end());
+    }
+    for (const auto& bucket_splits : right.Buckets()) {
+        auto& splits = get_pair(bucket_splits.bucket).right;
+        splits.insert(splits.end(), bucket_splits.splits.begin(), bucket_splits.splits.end());
+    }
+    std::vector<BucketPair> result;
+    result.reserve(pairs.size());
+    for (auto& [_, pair] : pairs) {
+        result.push_back(std::move(pair));
+    }
+    return result;
+}
+
+}  // namespace paimon
@@ -0,0 +1,62 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "arrow/api.h"
+#include "paimon/table/source/bucketed_plan.h"
+
+namespace paimon {
+
+/// An implementation of `BucketedPlan`.
+class BucketedPlanImpl : public BucketedPlan {
+ public:
+    BucketedPlanImpl(const std::optional<int64_t>& snapshot_id, int32_t num_buckets,
+                     const arrow::FieldVector& bucket_keys, std::vector<BucketSplits>&& buckets)
+        : snapshot_id_(snapshot_id),
+          num_buckets_(num_buckets),
+          bucket_keys_(bucket_keys),
+          buckets_(std::move(buckets)) {}
+
+    std::optional<int64_t> SnapshotId() const override {
+        return snapshot_id_;
+    }
+
+    int32_t NumBuckets() const override {
+        return num_buckets_;
+    }
+
+    const arrow::FieldVector& BucketKeys() const override {
+        return bucket_keys_;
+    }
+
+    const std::vector<BucketSplits>& Buckets() const override {
+        return buckets_;
+    }
+
+ private:
+    std::optional<int64_t> snapshot_id_;
+    int32_t num_buckets_;
+    arrow::FieldVector bucket_keys_;
+    std::vector<BucketSplits> buckets_;
+};
+}  // namespace paimon
@@ -0,0 +1,104 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/table/source/bucketed_plan.h"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/api.h"
+#include "gtest/gtest.h"
+#include "paimon/common/data/binary_row.h"
+#include "paimon/core/table/source/bucketed_plan_impl.h"
+#include "paimon/core/table/source/data_split_impl.h"
+#include "paimon/testing/utils/testharness.h"
+
+namespace paimon::test {
+
+class BucketedPlanTest : public testing::Test {
+ public:
+    std::shared_ptr<Split> MakeSplit(int32_t bucket) const {
+        DataSplitImpl::Builder builder(BinaryRow::EmptyRow(), bucket,
+                                       "bucket-" + std::to_string(bucket), {});
+        EXPECT_OK_AND_ASSIGN(std::shared_ptr<DataSplitImpl> split,
+                             builder.WithSnapshot(1).Build());
+        return split;
+    }
+
+    std::unique_ptr<BucketedPlan> MakePlan(
+        int32_t num_buckets, const arrow::FieldVector& bucket_keys,
+        const std::vector<std::pair<std::string, int32_t>>& partition_buckets) const {
+        std::vector<BucketedPlan::BucketSplits> buckets;
+        for (const auto& [partition, bucket] : partition_buckets) {
+            buckets.push_back({{{"pt", partition}}, bucket, {MakeSplit(bucket)}});
+        }
+        return std::make_unique<BucketedPlanImpl>(/*snapshot_id=*/1, num_buckets, bucket_keys,
+                                                  std::move(buckets));
+    }
+};
+
+TEST_F(BucketedPlanTest, TestPairBuckets) {
+    auto left = MakePlan(/*num_buckets=*/4,
+                         {arrow::field("id", arrow::int64()), arrow::field("name", arrow::utf8())},
+                         {{"a", 0}, {"a", 2}, {"b", 2}});
+    // names and nullability of bucket keys do not matter
+    auto right = MakePlan(/*num_buckets=*/4,
+                          {arrow::field("user_id", arrow::int64(), /*nullable=*/false),
+                           arrow::field("user_name", arrow::utf8())},
+                          {{"x", 1}, {"x", 2}});
+    ASSERT_OK_AND_ASSIGN(std::vector<BucketedPlan::BucketPair> pairs,
+                         BucketedPlan::PairBuckets(*left, *right));
+    ASSERT_EQ(3, pairs.size());
+    ASSERT_EQ(0, pairs[0].bucket);
+    ASSERT_EQ(1, pairs[0].left.size());
+    ASSERT_TRUE(pairs[0].right.empty());
+    ASSERT_EQ(1, pairs[1].bucket);
+    ASSERT_TRUE(pairs[1].left.empty());
+    ASSERT_EQ(1, pairs[1].right.size());
+    // splits of all partitions of a bucket are paired
+    ASSERT_EQ(2, pairs[2].bucket);
+    ASSERT_EQ(2, pairs[2].left.size());
+    ASSERT_EQ(1, pairs[2].right.size());
+    ASSERT_EQ(left->Buckets()[1].splits[0], pairs[2].left[0]);
+    ASSERT_EQ(left->Buckets()[2].splits[0], pairs[2].left[1]);
+
+    ASSERT_OK_AND_ASSIGN(pairs, BucketedPlan::PairBuckets(
+                                    *left, *MakePlan(/*num_buckets=*/4, left->BucketKeys(), {})));
+    ASSERT_EQ(2, pairs.size());
+}
+
+TEST_F(BucketedPlanTest, TestNotCoPartitioned) {
+    auto left = MakePlan(/*num_buckets=*/4, {arrow::field("id", arrow::int64())}, {{"a", 0}});
+    ASSERT_NOK_WITH_MSG(
+        BucketedPlan::PairBuckets(
+            *left, *MakePlan(/*num_buckets=*/8, {arrow::field("id", arrow::int64())}, {})),
+        "different numbers of buckets");
+    ASSERT_NOK_WITH_MSG(
+        BucketedPlan::PairBuckets(
+            *left, *MakePlan(/*num_buckets=*/4, {arrow::field("id", arrow::int32())}, {})),
+        "different types of bucket keys, left [int64], right [int32]");
+    ASSERT_NOK_WITH_MSG(BucketedPlan::PairBuckets(
+                            *left, *MakePlan(/*num_buckets=*/4,
+                                             {arrow::field("id", arrow::int64()),
+                                              arrow::field("name", arrow::utf8())},
+                                             {})),
+                        "different types of bucket keys");
+}
+
+}  // namespace paimon::test
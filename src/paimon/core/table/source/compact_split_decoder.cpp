@@ -0,0 +1,358 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/table/source/compact_split_decoder.h"
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "fmt/format.h"
+#include "paimon/common/data/binary_row.h"
+#include "paimon/common/utils/serialization_utils.h"
+#include "paimon/core/global_index/indexed_split_impl.h"
+#include "paimon/core/io/data_file_meta.h"
+#include "paimon/core/manifest/file_source.h"
+#include "paimon/core/stats/simple_stats.h"
+#include "paimon/core/table/source/compact_split_encoder.h"
+#include "paimon/core/table/source/data_split_impl.h"
+#include "paimon/core/table/source/deletion_file.h"
+#include "paimon/core/table/source/fallback_data_split.h"
+#include "paimon/data/timestamp.h"
+#include "paimon/io/byte_array_input_stream.h"
+#include "paimon/io/data_input_stream.h"
+#include "paimon/memory/bytes.h"
+#include "paimon/status.h"
+#include "paimon/utils/range.h"
+
+namespace paimon {
+namespace {
+Result<std::string> ReadBinaryString(DataInputStream* in) {
+    PAIMON_ASSIGN_OR_RAISE(int32_t length, in->ReadValue<int32_t>());
+    if (length < 0) {
+        return Status::Invalid(fmt::format("invalid string length {} in compact splits", length));
+    }
+    std::string value(length, '\0');
+    PAIMON_RETURN_NOT_OK(in->Read(value.data(), length));
+    return value;
+}
+}  // namespace
+
+class CompactSplitDecoder::Impl {
+ public:
+    Impl(const char* buffer, size_t length, const std::shared_ptr<MemoryPool>& pool)
+        : data_(buffer, length), pool_(pool) {}
+
+    Status Init();
+
+    size_t NumSplits() const {
+        return split_end_offsets_.size();
+    }
+
+    Result<std::shared_ptr<Split>> GetSplit(size_t index) const;
+
+ private:
+    Result<std::string> GetString(int32_t index) const;
+    Result<std::shared_ptr<DataSplitImpl>> ReadDataSplit(DataInputStream* in) const;
+    Result<std::vector<std::shared_ptr<DataFileMeta>>> ReadFileMetas(DataInputStream* in) const;
+    Result<std::shared_ptr<DataFileMeta>> ReadFileMeta(DataInputStream* in) const;
+    Result<std::vector<std::optional<DeletionFile>>> ReadDeletionFiles(DataInputStream* in) const;
+
+ private:
+    std::string data_;
+    std::shared_ptr<MemoryPool> pool_;
+    std::vector<std::string> strings_;
+    std::vector<BinaryRow> partitions_;
+    int64_t body_offset_ = 0;
+    std::vector<int64_t> split_end_offsets_;
+};
+
+Status CompactSplitDecoder::Impl::Init() {
+    auto input_stream = std::make_shared<ByteArrayInputStream>(data_.data(), data_.size());
+    DataInputStream in(input_stream);
+    PAIMON_ASSIGN_OR_RAISE(int64_t magic, in.ReadValue<int64_t>());
+    if (magic != CompactSplitEncoder::MAGIC) {
+        return Status::Invalid("invalid compact splits, magic number mismatch");
+    }
+    PAIMON_ASSIGN_OR_RAISE(int32_t version, in.ReadValue<int32_t>());
+    if (version != CompactSplitEncoder::VERSION) {
+        return Status::Invalid(fmt::format("Unsupported compact splits version: {}", version));
+    }
+    PAIMON_ASSIGN_OR_RAISE(int32_t string_count, in.ReadValue<int32_t>());
+    strings_.reserve(string_count);
+    for (int32_t i = 0; i < string_count; i++) {
+        PAIMON_ASSIGN_OR_RAISE(std::string str, ReadBinaryString(&in));
+        strings_.push_back(std::move(str));
+    }
+    PAIMON_ASSIGN_OR_RAISE(int32_t partition_count, in.ReadValue<int32_t>());
+    partitions_.reserve(partition_count);
+    for (int32_t i = 0; i < partition_count; i++) {
+        PAIMON_ASSIGN_OR_RAISE(std::string partition, ReadBinaryString(&in));
+        std::shared_ptr<Bytes> bytes = Bytes::AllocateBytes(partition, pool_.get());
+        PAIMON_ASSIGN_OR_RAISE(BinaryRow row, SerializationUtils::DeserializeBinaryRow(bytes));
+        partitions_.push_back(std::move(row));
+    }
+    PAIMON_ASSIGN_OR_RAISE(int32_t split_count, in.ReadValue<int32_t>());
+    split_end_offsets_.reserve(split_count);
+    for (int32_t i = 0; i < split_count; i++) {
+        PAIMON_ASSIGN_OR_RAISE(int64_t end_offset, in.ReadValue<int64_t>());
+        split_end_offsets_.push_back(end_offset);
+    }
+    PAIMON_ASSIGN_OR_RAISE(body_offset_, in.GetPos());
+    int64_t body_length = static_cast<int64_t>(data_.size()) - body_offset_;
+    int64_t previous_end = 0;
+    for (const auto& end_offset : split_end_offsets_) {
+        if (end_offset < previous_end || end_offset > body_length) {
+            return Status::Invalid(
+                fmt::format("invalid compact splits, split end offset {} out of range [{}, {}]",
+                            end_offset, previous_end, body_length));
+        }
+        previous_end = end_offset;
+    }
+    return Status::OK();
+}
+
+Result<std::string> CompactSplitDecoder::Impl::GetString(int32_t index) const {
+    if (index < 0 || static_cast<size_t>(index) >= strings_.size()) {
+        return Status::Invalid(fmt::format("invalid string index {} in compact splits, size {}",
+                                           index, strings_.size()));
+    }
+    return strings_[index];
+}
+
+Result<std::shared_ptr<Split>> CompactSplitDecoder::Impl::GetSplit(size_t index) const {
+    if (index >= split_end_offsets_.size()) {
+        return Status::Invalid(fmt::format("split index {} out of range, split count {}", index,
+                                           split_end_offsets_.size()));
+    }
+    int64_t begin = index == 0 ? 0 : split_end_offsets_[index - 1];
+    int64_t end = split_end_offsets_[index];
+    auto input_stream =
+        std::make_shared<ByteArrayInputStream>(data_.data() + body_offset_ + begin, end - begin);
+    DataInputStream in(input_stream);
+
+    std::shared_ptr<Split> split;
+    PAIMON_ASSIGN_OR_RAISE(int8_t split_type, in.ReadValue<int8_t>());
+    if (split_type == CompactSplitEncoder::DATA_SPLIT) {
+        PAIMON_ASSIGN_OR_RAISE(split, ReadDataSplit(&in));
+    } else if (split_type == CompactSplitEncoder::FALLBACK_DATA_SPLIT) {
+        PAIMON_ASSIGN_OR_RAISE(bool is_fallback, in.ReadValue<bool>());
+        PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<DataSplitImpl> data_split, ReadDataSplit(&in));
+        split = std::make_shared<FallbackDataSplit>(data_split, is_fallback);
+    } else if (split_type == CompactSplitEncoder::INDEXED_SPLIT) {
+        PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<DataSplitImpl> data_split, ReadDataSplit(&in));
+        PAIMON_ASSIGN_OR_RAISE(int32_t range_size, in.ReadValue<int32_t>());
+        std::vector<Range> row_ranges;
+        row_ranges.reserve(range_size);
+        for (int32_t i = 0; i < range_size; ++i) {
+            PAIMON_ASSIGN_OR_RAISE(int64_t range_from, in.ReadValue<int64_t>());
+            PAIMON_ASSIGN_OR_RAISE(int64_t range_to, in.ReadValue<int64_t>());
+            row_ranges.emplace_back(range_from, range_to);
+        }
+        PAIMON_ASSIGN_OR_RAISE(int32_t scores_length, in.ReadValue<int32_t>());
+        std::vector<float> scores(scores_length);
+        for (int32_t i = 0; i < scores_length; ++i) {
+            PAIMON_ASSIGN_OR_RAISE(scores[i], in.ReadValue<float>());
+        }
+        split = std::make_shared<IndexedSplitImpl>(data_split, row_ranges, scores);
+    } else {
+        return Status::Invalid(fmt::format("invalid split type {} in compact splits",
+                                           static_cast<int32_t>(split_type)));
+    }
+    PAIMON_ASSIGN_OR_RAISE(int64_t pos, in.GetPos());
+    if (pos != end - begin) {
+        return Status::Invalid(
+            fmt::format("invalid compact splits, remaining {} bytes after deserializing split {}",
+                        end - begin - pos, index));
+    }
+    return split;
+}
+
+Result<std::shared_ptr<DataSplitImpl>> CompactSplitDecoder::Impl::ReadDataSplit(
+    DataInputStream* in) const {
+    PAIMON_ASSIGN_OR_RAISE(int64_t snapshot_id, in->ReadValue<int64_t>());
+    PAIMON_ASSIGN_OR_RAISE(int32_t partition_index, in->ReadValue<int32_t>());
+    if (partition_index < 0 || static_cast<size_t>(partition_index) >= partitions_.size()) {
+        return Status::Invalid(fmt::format("invalid partition index {} in compact splits, size {}",
+                                           partition_index, partitions_.size()));
+    }
+    PAIMON_ASSIGN_OR_RAISE(int32_t bucket, in->ReadValue<int32_t>());
+    PAIMON_ASSIGN_OR_RAISE(int32_t bucket_path_index, in->ReadValue<int32_t>());
+    PAIMON_ASSIGN_OR_RAISE(std::string bucket_path, GetString(bucket_path_index));
+    std::optional<int32_t> total_buckets;
+    PAIMON_ASSIGN_OR_RAISE(bool total_buckets_exist, in->ReadValue<bool>());
+    if (total_buckets_exist) {
+        PAIMON_ASSIGN_OR_RAISE(total_buckets, in->ReadValue<int32_t>());
+    }
+    PAIMON_ASSIGN_OR_RAISE(std::vector<std::shared_ptr<DataFileMeta>> before_files,
+                           ReadFileMetas(in));
+    PAIMON_ASSIGN_OR_RAISE(std::vector<std::optional<DeletionFile>> before_deletion_files,
+                           ReadDeletionFiles(in));
+    PAIMON_ASSIGN_OR_RAISE(std::vector<std::shared_ptr<DataFileMeta>> data_files,
+                           ReadFileMetas(in));
+    PAIMON_ASSIGN_OR_RAISE(std::vector<std::optional<DeletionFile>> data_deletion_files,
+                           ReadDeletionFiles(in));
+    PAIMON_ASSIGN_OR_RAISE(bool is_streaming, in->ReadValue<bool>());
+    PAIMON_ASSIGN_OR_RAISE(bool raw_convertible, in->ReadValue<bool>());
+
+    DataSplitImpl::Builder builder(partitions_[partition_index], bucket, bucket_path,
+                                   std::move(data_files));
+    builder.WithTotalBuckets(total_buckets)
+        .WithSnapshot(snapshot_id)
+        .WithBeforeFiles(std::move(before_files))
+        .IsStreaming(is_streaming)
+        .RawConvertible(raw_convertible);
+    if (!before_deletion_files.empty()) {
+        builder.WithBeforeDeletionFiles(before_deletion_files);
+    }
+    if (!data_deletion_files.empty()) {
+        builder.WithDataDeletionFiles(data_deletion_files);
+    }
+    return builder.Build();
+}
+
+Result<std::vector<std::shared_ptr<DataFileMeta>>> CompactSplitDecoder::Impl::ReadFileMetas(
+    DataInputStream* in) const {
+    PAIMON_ASSIGN_OR_RAISE(int32_t size, in->ReadValue<int32_t>());
+    std::vector<std::shared_ptr<DataFileMeta>> file_metas;
+    file_metas.reserve(size);
+    for (int32_t i = 0; i < size; i++) {
+        PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<DataFileMeta> file_meta, ReadFileMeta(in));
+        file_metas.push_back(std::move(file_meta));
+    }
+    return file_metas;
+}
+
+Result<std::shared_ptr<DataFileMeta>> CompactSplitDecoder::Impl::ReadFileMeta(
+    DataInputStream* in) const {
+    PAIMON_ASSIGN_OR_RAISE(std::string file_name, ReadBinaryString(in));
+    PAIMON_ASSIGN_OR_RAISE(int64_t file_size, in->ReadValue<int64_t>());
+    PAIMON_ASSIGN_OR_RAISE(int64_t row_count, in->ReadValue<int64_t>());
+    PAIMON_ASSIGN_OR_RAISE(BinaryRow min_key,
+                           SerializationUtils::DeserializeBinaryRow(in, pool_.get()));
+    PAIMON_ASSIGN_OR_RAISE(BinaryRow max_key,
+                           SerializationUtils::DeserializeBinaryRow(in, pool_.get()));
+    PAIMON_ASSIGN_OR_RAISE(int64_t min_sequence_number, in->ReadValue<int64_t>());
+    PAIMON_ASSIGN_OR_RAISE(int64_t max_sequence_number, in->ReadValue<int64_t>());
+    PAIMON_ASSIGN_OR_RAISE(int64_t schema_id, in->ReadValue<int64_t>());
+    PAIMON_ASSIGN_OR_RAISE(int32_t level, in->ReadValue<int32_t>());
+
+    PAIMON_ASSIGN_OR_RAISE(int32_t extra_file_count, in->ReadValue<int32_t>());
+    std::vector<std::optional<std::string>> extra_files;
+    extra_files.reserve(extra_file_count);
+    for (int32_t i = 0; i < extra_file_count; i++) {
+        PAIMON_ASSIGN_OR_RAISE(bool extra_file_exist, in->ReadValue<bool>());
+        std::optional<std::string> extra_file;
+        if (extra_file_exist) {
+            PAIMON_ASSIGN_OR_RAISE(extra_file, ReadBinaryString(in));
+        }
+        extra_files.push_back(std::move(extra_file));
+    }
+    PAIMON_ASSIGN_OR_RAISE(int64_t creation_millis, in->ReadValue<int64_t>());
+    PAIMON_ASSIGN_OR_RAISE(int32_t creation_nanos, in->ReadValue<int32_t>());
+
+    std::optional<int64_t> delete_row_count;
+    PAIMON_ASSIGN_OR_RAISE(bool delete_row_count_exist, in->ReadValue<bool>());
+    if (delete_row_count_exist) {
+        PAIMON_ASSIGN_OR_RAISE(delete_row_count, in->ReadValue<int64_t>());
+    }
+    std::shared_ptr<Bytes> embedded_index;
+    PAIMON_ASSIGN_OR_RAISE(int32_t embedded_index_length, in->ReadValue<int32_t>());
+    if (embedded_index_length >= 0) {
+        embedded_index = Bytes::AllocateBytes(embedded_index_length, pool_.get());
+        PAIMON_RETURN_NOT_OK(in->ReadBytes(embedded_index.get()));
+    }
+    std::optional<FileSource> file_source;
+    PAIMON_ASSIGN_OR_RAISE(int8_t file_source_value, in->ReadValue<int8_t>());
+    if (file_source_value >= 0) {
+        PAIMON_ASSIGN_OR_RAISE(file_source, FileSource::FromByteValue(file_source_value));
+    }
+    std::optional<std::string> external_path;
+    PAIMON_ASSIGN_OR_RAISE(int32_t external_dir_index, in->ReadValue<int32_t>());
+    if (external_dir_index >= 0) {
+        PAIMON_ASSIGN_OR_RAISE(std::string external_dir, GetString(external_dir_index));
+        PAIMON_ASSIGN_OR_RAISE(std::string external_name, ReadBinaryString(in));
+        external_path = external_dir + external_name;
+    }
+    std::optional<int64_t> first_row_id;
+    PAIMON_ASSIGN_OR_RAISE(bool first_row_id_exist, in->ReadValue<bool>());
+    if (first_row_id_exist) {
+        PAIMON_ASSIGN_OR_RAISE(first_row_id, in->ReadValue<int64_t>());
+    }
+    std::optional<std::vector<std::string>> write_cols;
+    PAIMON_ASSIGN_OR_RAISE(int32_t write_col_count, in->ReadValue<int32_t>());
+    if (write_col_count >= 0) {
+        write_cols = std::vector<std::string>();
+        write_cols->reserve(write_col_count);
+        for (int32_t i = 0; i < write_col_count; i++) {
+            PAIMON_ASSIGN_OR_RAISE(int32_t write_col_index, in->ReadValue<int32_t>());
+            PAIMON_ASSIGN_OR_RAISE(std::string write_col, GetString(write_col_index));
+            write_cols->push_back(std::move(write_col));
+        }
+    }
+    // stats are not encoded, see CompactSplitEncoder
+    return std::make_shared<DataFileMeta>(
+        file_name, file_size, row_count, min_key, max_key, SimpleStats::EmptyStats(),
+        SimpleStats::EmptyStats(), min_sequence_number, max_sequence_number, schema_id, level,
+        extra_files, Timestamp(creation_millis, creation_nanos), delete_row_count, embedded_index,
+        file_source, /*value_stats_cols=*/std::nullopt, external_path, first_row_id, write_cols);
+}
+
+Result<std::vector<std::optional<DeletionFile>>> CompactSplitDecoder::Impl::ReadDeletionFiles(
+    DataInputStream* in) const {
+    PAIMON_ASSIGN_OR_RAISE(int32_t size, in->ReadValue<int32_t>());
+    std::vector<std::optional<DeletionFile>> deletion_files;
+    deletion_files.reserve(size);
+    for (int32_t i = 0; i < size; i++) {
+        PAIMON_ASSIGN_OR_RAISE(bool deletion_file_exist, in->ReadValue<bool>());
+        if (!deletion_file_exist) {
+            deletion_files.emplace_back(std::nullopt);
+            continue;
+        }
+        PAIMON_ASSIGN_OR_RAISE(int32_t path_index, in->ReadValue<int32_t>());
+        PAIMON_ASSIGN_OR_RAISE(std::string path, GetString(path_index));
+        PAIMON_ASSIGN_OR_RAISE(int64_t offset, in->ReadValue<int64_t>());
+        PAIMON_ASSIGN_OR_RAISE(int64_t length, in->ReadValue<int64_t>());
+        PAIMON_ASSIGN_OR_RAISE(int64_t cardinality, in->ReadValue<int64_t>());
+        deletion_files.emplace_back(DeletionFile(
+            path, offset, length,
+            cardinality == -1 ? std::nullopt : std::optional<int64_t>(cardinality)));
+    }
+    return deletion_files;
+}
+
+CompactSplitDecoder::CompactSplitDecoder(std::unique_ptr<Impl>&& impl) : impl_(std::move(impl)) {}
+
+CompactSplitDecoder::~CompactSplitDecoder() = default;
+
+Result<std::unique_ptr<CompactSplitDecoder>> CompactSplitDecoder::Create(
+    const char* buffer, size_t length, const std::shared_ptr<MemoryPool>& pool) {
+    auto impl = std::make_unique<Impl>(buffer, length, pool);
+    PAIMON_RETURN_NOT_OK(impl->Init());
+    return std::unique_ptr<CompactSplitDecoder>(new CompactSplitDecoder(std::move(impl)));
+}
+
+size_t CompactSplitDecoder::NumSplits() const {
+    return impl_->NumSplits();
+}
+
+Result<std::shared_ptr<Split>> CompactSplitDecoder::GetSplit(size_t index) const {
+    return impl_->GetSplit(index);
+}
+
+}  // namespace paimon
@@ -0,0 +1,165 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/table/source/compact_split_decoder.h"
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "paimon/common/data/binary_row.h"
+#include "paimon/core/global_index/indexed_split_impl.h"
+#include "paimon/core/io/data_file_meta.h"
+#include "paimon/core/manifest/file_source.h"
+#include "paimon/core/stats/simple_stats.h"
+#include "paimon/core/table/source/data_split_impl.h"
+#include "paimon/core/table/source/deletion_file.h"
+#include "paimon/core/table/source/fallback_data_split.h"
+#include "paimon/data/timestamp.h"
+#include "paimon/memory/bytes.h"
+#include "paimon/memory/memory_pool.h"
+#include "paimon/table/source/split.h"
+#include "paimon/testing/utils/binary_row_generator.h"
+#include "paimon/testing/utils/testharness.h"
+#include "paimon/utils/range.h"
+
+namespace paimon::test {
+class CompactSplitDecoderTest : public ::testing::Test {
+ public:
+    void SetUp() override {
+        pool_ = GetDefaultPool();
+    }
+
+    std::shared_ptr<DataFileMeta> CreateFileMeta(const std::string& file_name,
+                                                 bool with_stats) const {
+        SimpleStats key_stats = SimpleStats::EmptyStats();
+        SimpleStats value_stats = SimpleStats::EmptyStats();
+        std::optional<std::vector<std::string>> value_stats_cols;
+        if (with_stats) {
+            key_stats =
+                BinaryRowGenerator::GenerateStats({"Alex", 0}, {"Tony", 0}, {0, 0}, pool_.get());
+            value_stats = BinaryRowGenerator::GenerateStats({"Alex", 10, 0}, {"Tony", 10, 0},
+                                                            {0, 0, 0}, pool_.get());
+            value_stats_cols = std::vector<std::string>({"f0", "f1", "f2"});
+        }
+        auto embedded_index = std::make_shared<Bytes>("embedded index", pool_.get());
+        return std::make_shared<DataFileMeta>(
+            file_name, /*file_size=*/961, /*row_count=*/5,
+            /*min_key=*/BinaryRowGenerator::GenerateRow({"Alex", 0}, pool_.get()),
+            /*max_key=*/BinaryRowGenerator::GenerateRow({"Tony", 0}, pool_.get()), key_stats,
+            value_stats, /*min_sequence_number=*/0, /*max_sequence_number=*/4, /*schema_id=*/0,
+            /*level=*/5,
+            /*extra_files=*/std::vector<std::optional<std::string>>({"extra", std::nullopt}),
+            /*creation_time=*/Timestamp(1757354415711ll, 12),
+            /*delete_row_count=*/1, embedded_index, FileSource::Append(), value_stats_cols,
+            /*external_path=*/"FILE:/tmp/external/f1=10/bucket-1/" + file_name,
+            /*first_row_id=*/100, /*write_cols=*/std::vector<std::string>({"f0", "f1", "f2"}));
+    }
+
+    std::shared_ptr<DataSplitImpl> CreateDataSplit(int32_t bucket, bool with_stats) const {
+        std::string bucket_path = "data/t/f1=10/bucket-" + std::to_string(bucket);
+        DataSplitImpl::Builder builder(
+            BinaryRowGenerator::GenerateRow({10}, pool_.get()), bucket, bucket_path,
+            {CreateFileMeta("data-" + std::to_string(bucket) + "-0.orc", with_stats),
+             CreateFileMeta("data-" + std::to_string(bucket) + "-1.orc", with_stats)});
+        return builder.WithSnapshot(4)
+            .WithTotalBuckets(2)
+            .IsStreaming(false)
+            .RawConvertible(true)
+            .WithDataDeletionFiles(
+                {DeletionFile("data/t/index/index-0", /*offset=*/1, /*length=*/22,
+                              /*cardinality=*/1),
+                 std::nullopt})
+            .Build()
+            .value();
+    }
+
+ protected:
+    std::shared_ptr<MemoryPool> pool_;
+};
+
+TEST_F(CompactSplitDecoderTest, TestSerializeAndDecode) {
+    std::vector<std::shared_ptr<Split>> splits = {
+        CreateDataSplit(/*bucket=*/0, /*with_stats=*/true),
+        std::make_shared<FallbackDataSplit>(CreateDataSplit(/*bucket=*/1, /*with_stats=*/true),
+                                            /*is_fallback=*/true),
+        std::make_shared<IndexedSplitImpl>(CreateDataSplit(/*bucket=*/0, /*with_stats=*/true),
+                                           std::vector<Range>({Range(0, 2), Range(4, 4)}),
+                                           std::vector<float>({0.5f, 0.25f}))};
+    ASSERT_OK_AND_ASSIGN(std::string bytes, Split::SerializeCompact(splits, pool_));
+    ASSERT_OK_AND_ASSIGN(auto decoder,
+                         CompactSplitDecoder::Create(bytes.data(), bytes.size(), pool_));
+    ASSERT_EQ(3, decoder->NumSplits());
+
+    // splits are decoded in any order, stats are dropped
+    ASSERT_OK_AND_ASSIGN(auto split2, decoder->GetSplit(2));
+    auto indexed_split = std::dynamic_pointer_cast<IndexedSplitImpl>(split2);
+    ASSERT_TRUE(indexed_split);
+    IndexedSplitImpl expected_indexed_split(CreateDataSplit(/*bucket=*/0, /*with_stats=*/false),
+                                            {Range(0, 2), Range(4, 4)}, {0.5f, 0.25f});
+    ASSERT_EQ(expected_indexed_split, *indexed_split);
+
+    ASSERT_OK_AND_ASSIGN(auto split0, decoder->GetSplit(0));
+    auto data_split = std::dynamic_pointer_cast<DataSplitImpl>(split0);
+    ASSERT_TRUE(data_split);
+    ASSERT_EQ(*CreateDataSplit(/*bucket=*/0, /*with_stats=*/false), *data_split)
+        << data_split->ToString();
+
+    ASSERT_OK_AND_ASSIGN(auto split1, decoder->GetSplit(1));
+    auto fallback_split = std::dynamic_pointer_cast<FallbackDataSplit>(split1);
+    ASSERT_TRUE(fallback_split);
+    ASSERT_TRUE(fallback_split->IsFallback());
+    auto inner_split = std::dynamic_pointer_cast<DataSplitImpl>(fallback_split->GetSplit());
+    ASSERT_TRUE(inner_split);
+    ASSERT_EQ(*CreateDataSplit(/*bucket=*/1, /*with_stats=*/false), *inner_split);
+
+    ASSERT_NOK_WITH_MSG(decoder->GetSplit(3), "split index 3 out of range, split count 3");
+}
+
+TEST_F(CompactSplitDecoderTest, TestSmallerThanJavaCompatibleFormat) {
+    std::vector<std::shared_ptr<Split>> splits;
+    size_t java_compatible_size = 0;
+    for (int32_t i = 0; i < 100; i++) {
+        auto split = CreateDataSplit(/*bucket=*/i % 2, /*with_stats=*/true);
+        ASSERT_OK_AND_ASSIGN(std::string bytes, Split::Serialize(split, pool_));
+        java_compatible_size += bytes.size();
+        splits.push_back(split);
+    }
+    ASSERT_OK_AND_ASSIGN(std::string bytes, Split::SerializeCompact(splits, pool_));
+    ASSERT_LT(bytes.size(), java_compatible_size / 2);
+}
+
+TEST_F(CompactSplitDecoderTest, TestEmptyAndInvalidInput) {
+    ASSERT_OK_AND_ASSIGN(std::string bytes, Split::SerializeCompact({}, pool_));
+    ASSERT_OK_AND_ASSIGN(auto decoder,
+                         CompactSplitDecoder::Create(bytes.data(), bytes.size(), pool_));
+    ASSERT_EQ(0, decoder->NumSplits());
+
+    // the java compatible format is rejected
+    ASSERT_OK_AND_ASSIGN(std::string java_bytes,
+                         Split::Serialize(CreateDataSplit(/*bucket=*/0, true), pool_));
+    ASSERT_NOK_WITH_MSG(CompactSplitDecoder::Create(java_bytes.data(), java_bytes.size(), pool_),
+                        "magic number mismatch");
+
+    // truncated input
+    ASSERT_OK_AND_ASSIGN(bytes,
+                         Split::SerializeCompact({CreateDataSplit(/*bucket=*/0, true)}, pool_));
+    ASSERT_NOK(CompactSplitDecoder::Create(bytes.data(), bytes.size() - 1, pool_));
+}
+}  // namespace paimon::test
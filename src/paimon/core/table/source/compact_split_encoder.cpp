@@ -0,0 +1,228 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/table/source/compact_split_encoder.h"
+
+#include <utility>
+
+#include "paimon/common/memory/memory_segment_utils.h"
+#include "paimon/common/utils/path_util.h"
+#include "paimon/common/utils/serialization_utils.h"
+#include "paimon/core/global_index/indexed_split_impl.h"
+#include "paimon/core/table/source/data_split_impl.h"
+#include "paimon/core/table/source/fallback_data_split.h"
+#include "paimon/memory/bytes.h"
+#include "paimon/memory/memory_pool.h"
+#include "paimon/table/source/split.h"
+
+namespace paimon {
+namespace {
+void WriteBinaryString(const std::string& str, MemorySegmentOutputStream* out) {
+    out->WriteValue<int32_t>(str.size());
+    out->Write(str.data(), str.size());
+}
+
+std::string ToString(const MemorySegmentOutputStream& out, MemoryPool* pool) {
+    PAIMON_UNIQUE_PTR<Bytes> bytes =
+        MemorySegmentUtils::CopyToBytes(out.Segments(), 0, out.CurrentSize(), pool);
+    return std::string(bytes->data(), bytes->size());
+}
+}  // namespace
+
+CompactSplitEncoder::CompactSplitEncoder(const std::shared_ptr<MemoryPool>& pool)
+    : pool_(pool), body_(MemorySegmentOutputStream::DEFAULT_SEGMENT_SIZE, pool) {}
+
+int32_t CompactSplitEncoder::StringIndex(const std::string& str) {
+    auto [iter, inserted] = string_ids_.emplace(str, static_cast<int32_t>(strings_.size()));
+    if (inserted) {
+        strings_.push_back(str);
+    }
+    return iter->second;
+}
+
+int32_t CompactSplitEncoder::PartitionIndex(const BinaryRow& partition) {
+    std::shared_ptr<Bytes> bytes = SerializationUtils::SerializeBinaryRow(partition, pool_.get());
+    std::string key(bytes->data(), bytes->size());
+    auto [iter, inserted] =
+        partition_ids_.emplace(std::move(key), static_cast<int32_t>(partitions_.size()));
+    if (inserted) {
+        partitions_.push_back(iter->first);
+    }
+    return iter->second;
+}
+
+Status CompactSplitEncoder::Write(const std::shared_ptr<Split>& split) {
+    if (auto data_split_impl = std::dynamic_pointer_cast<DataSplitImpl>(split)) {
+        body_.WriteValue<int8_t>(DATA_SPLIT);
+        PAIMON_RETURN_NOT_OK(WriteDataSplit(*data_split_impl));
+    } else if (auto fallback_split = std::dynamic_pointer_cast<FallbackDataSplit>(split)) {
+        auto inner_split_impl =
+            std::dynamic_pointer_cast<DataSplitImpl>(fallback_split->GetSplit());
+        if (!inner_split_impl) {
+            return Status::Invalid("inner split in FallbackDataSplit is supposed to be DataSplit");
+        }
+        body_.WriteValue<int8_t>(FALLBACK_DATA_SPLIT);
+        body_.WriteValue<bool>(fallback_split->IsFallback());
+        PAIMON_RETURN_NOT_OK(WriteDataSplit(*inner_split_impl));
+    } else if (auto indexed_split_impl = std::dynamic_pointer_cast<IndexedSplitImpl>(split)) {
+        auto inner_split_impl =
+            std::dynamic_pointer_cast<DataSplitImpl>(indexed_split_impl->GetDataSplit());
+        if (!inner_split_impl) {
+            return Status::Invalid("inner split in IndexedSplit is supposed to be DataSplit");
+        }
+        body_.WriteValue<int8_t>(INDEXED_SPLIT);
+        PAIMON_RETURN_NOT_OK(WriteDataSplit(*inner_split_impl));
+        const auto& row_ranges = indexed_split_impl->RowRanges();
+        body_.WriteValue<int32_t>(row_ranges.size());
+        for (const auto& range : row_ranges) {
+            body_.WriteValue<int64_t>(range.from);
+            body_.WriteValue<int64_t>(range.to);
+        }
+        const auto& scores = indexed_split_impl->Scores();
+        body_.WriteValue<int32_t>(scores.size());
+        for (const auto& score : scores) {
+            body_.WriteValue<float>(score);
+        }
+    } else {
+        return Status::Invalid("invalid split, cannot cast to DataSplit or IndexedSplit");
+    }
+    split_end_offsets_.push_back(body_.CurrentSize());
+    return Status::OK();
+}
+
+Status CompactSplitEncoder::WriteDataSplit(const DataSplitImpl& split) {
+    body_.WriteValue<int64_t>(split.SnapshotId());
+    body_.WriteValue<int32_t>(PartitionIndex(split.Partition()));
+    body_.WriteValue<int32_t>(split.Bucket());
+    body_.WriteValue<int32_t>(StringIndex(split.BucketPath()));
+    const std::optional<int32_t>& total_buckets = split.TotalBuckets();
+    body_.WriteValue<bool>(total_buckets != std::nullopt);
+    if (total_buckets) {
+        body_.WriteValue<int32_t>(total_buckets.value());
+    }
+    PAIMON_RETURN_NOT_OK(WriteFileMetas(split.BeforeFiles()));
+    WriteDeletionFiles(split.BeforeDeletionFiles());
+    PAIMON_RETURN_NOT_OK(WriteFileMetas(split.DataFiles()));
+    WriteDeletionFiles(split.DeletionFiles());
+    body_.WriteValue<bool>(split.IsStreaming());
+    body_.WriteValue<bool>(split.RawConvertible());
+    return Status::OK();
+}
+
+Status CompactSplitEncoder::WriteFileMetas(
+    const std::vector<std::shared_ptr<DataFileMeta>>& file_metas) {
+    body_.WriteValue<int32_t>(file_metas.size());
+    for (const auto& file_meta : file_metas) {
+        PAIMON_RETURN_NOT_OK(WriteFileMeta(*file_meta));
+    }
+    return Status::OK();
+}
+
+Status CompactSplitEncoder::WriteFileMeta(const DataFileMeta& file_meta) {
+    WriteBinaryString(file_meta.file_name, &body_);
+    body_.WriteValue<int64_t>(file_meta.file_size);
+    body_.WriteValue<int64_t>(file_meta.row_count);
+    PAIMON_RETURN_NOT_OK(SerializationUtils::SerializeBinaryRow(file_meta.min_key, &body_));
+    PAIMON_RETURN_NOT_OK(SerializationUtils::SerializeBinaryRow(file_meta.max_key, &body_));
+    body_.WriteValue<int64_t>(file_meta.min_sequence_number);
+    body_.WriteValue<int64_t>(file_meta.max_sequence_number);
+    body_.WriteValue<int64_t>(file_meta.schema_id);
+    body_.WriteValue<int32_t>(file_meta.level);
+
+    body_.WriteValue<int32_t>(file_meta.extra_files.size());
+    for (const auto& extra_file : file_meta.extra_files) {
+        body_.WriteValue<bool>(extra_file != std::nullopt);
+        if (extra_file) {
+            WriteBinaryString(extra_file.value(), &body_);
+        }
+    }
+    body_.WriteValue<int64_t>(file_meta.creation_time.GetMillisecond());
+    body_.WriteValue<int32_t>(file_meta.creation_time.GetNanoOfMillisecond());
+
+    body_.WriteValue<bool>(file_meta.delete_row_count != std::nullopt);
+    if (file_meta.delete_row_count) {
+        body_.WriteValue<int64_t>(file_meta.delete_row_count.value());
+    }
+    if (file_meta.embedded_index) {
+        body_.WriteValue<int32_t>(file_meta.embedded_index->size());
+        body_.Write(file_meta.embedded_index->data(), file_meta.embedded_index->size());
+    } else {
+        body_.WriteValue<int32_t>(-1);
+    }
+    body_.WriteValue<int8_t>(file_meta.file_source ? file_meta.file_source->ToByteValue() : -1);
+
+    // external path is split into a dictionary-encoded dir and the remaining file name
+    if (file_meta.external_path) {
+        const std::string& external_path = file_meta.external_path.value();
+        size_t pos = external_path.rfind('/');
+        size_t name_start = pos == std::string::npos ? 0 : pos + 1;
+        body_.WriteValue<int32_t>(StringIndex(external_path.substr(0, name_start)));
+        WriteBinaryString(external_path.substr(name_start), &body_);
+    } else {
+        body_.WriteValue<int32_t>(-1);
+    }
+
+    body_.WriteValue<bool>(file_meta.first_row_id != std::nullopt);
+    if (file_meta.first_row_id) {
+        body_.WriteValue<int64_t>(file_meta.first_row_id.value());
+    }
+    if (file_meta.write_cols) {
+        body_.WriteValue<int32_t>(file_meta.write_cols->size());
+        for (const auto& write_col : file_meta.write_cols.value()) {
+            body_.WriteValue<int32_t>(StringIndex(write_col));
+        }
+    } else {
+        body_.WriteValue<int32_t>(-1);
+    }
+    return Status::OK();
+}
+
+void CompactSplitEncoder::WriteDeletionFiles(
+    const std::vector<std::optional<DeletionFile>>& deletion_files) {
+    body_.WriteValue<int32_t>(deletion_files.size());
+    for (const auto& deletion_file : deletion_files) {
+        body_.WriteValue<bool>(deletion_file != std::nullopt);
+        if (deletion_file) {
+            body_.WriteValue<int32_t>(StringIndex(deletion_file->path));
+            body_.WriteValue<int64_t>(deletion_file->offset);
+            body_.WriteValue<int64_t>(deletion_file->length);
+            body_.WriteValue<int64_t>(deletion_file->cardinality.value_or(-1));
+        }
+    }
+}
+
+Result<std::string> CompactSplitEncoder::Finish() {
+    MemorySegmentOutputStream header(MemorySegmentOutputStream::DEFAULT_SEGMENT_SIZE, pool_);
+    header.WriteValue<int64_t>(MAGIC);
+    header.WriteValue<int32_t>(VERSION);
+    header.WriteValue<int32_t>(strings_.size());
+    for (const auto& str : strings_) {
+        WriteBinaryString(str, &header);
+    }
+    header.WriteValue<int32_t>(partitions_.size());
+    for (const auto& partition : partitions_) {
+        WriteBinaryString(partition, &header);
+    }
+    header.WriteValue<int32_t>(split_end_offsets_.size());
+    for (const auto& end_offset : split_end_offsets_) {
+        header.WriteValue<int64_t>(end_offset);
+    }
+    std::string result = ToString(header, pool_.get());
+    result.append(ToString(body_, pool_.get()));
+    return result;
+}
+
+}  // namespace paimon
@@ -0,0 +1,80 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "paimon/common/data/binary_row.h"
+#include "paimon/common/io/memory_segment_output_stream.h"
+#include "paimon/core/io/data_file_meta.h"
+#include "paimon/core/table/source/deletion_file.h"
+#include "paimon/result.h"
+#include "paimon/status.h"
+
+namespace paimon {
+class DataSplitImpl;
+class MemoryPool;
+class Split;
+
+/// Encoder of the compact split encoding, see `Split::SerializeCompact()`.
+///
+/// The encoded bytes consist of a header (magic, version), a string dictionary, a partition
+/// dictionary, the end offset of each split and the split bodies. Bucket paths, deletion file
+/// paths, external path dirs and write columns are replaced by their index in the string
+/// dictionary, so a body only references data which is specific to the split. Key and value stats
+/// of data files are not encoded as reading does not need them.
+class CompactSplitEncoder {
+ public:
+    static constexpr int64_t MAGIC = -5274712906185093427L;
+    static constexpr int32_t VERSION = 1;
+
+    static constexpr int8_t DATA_SPLIT = 0;
+    static constexpr int8_t FALLBACK_DATA_SPLIT = 1;
+    static constexpr int8_t INDEXED_SPLIT = 2;
+
+    explicit CompactSplitEncoder(const std::shared_ptr<MemoryPool>& pool);
+
+    Status Write(const std::shared_ptr<Split>& split);
+
+    Result<std::string> Finish();
+
+ private:
+    int32_t StringIndex(const std::string& str);
+    int32_t PartitionIndex(const BinaryRow& partition);
+
+    Status WriteDataSplit(const DataSplitImpl& split);
+    Status WriteFileMetas(const std::vector<std::shared_ptr<DataFileMeta>>& file_metas);
+    Status WriteFileMeta(const DataFileMeta& file_meta);
+    void WriteDeletionFiles(const std::vector<std::optional<DeletionFile>>& deletion_files);
+
+ private:
+    std::shared_ptr<MemoryPool> pool_;
+    std::unordered_map<std::string, int32_t> string_ids_;
+    std::vector<std::string> strings_;
+    // partitions are deduplicated by their serialized bytes
+    std::unordered_map<std::string, int32_t> partition_ids_;
+    std::vector<std::string> partitions_;
+    MemorySegmentOutputStream body_;
+    std::vector<int64_t> split_end_offsets_;
+};
+
+}  // namespace paimon
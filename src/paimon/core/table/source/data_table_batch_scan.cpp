@@ -17,12 +17,20 @@
 #include "paimon/core/table/source/data_table_batch_scan.h"
 
 #include <functional>
+#include <map>
+#include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "fmt/format.h"
+#include "paimon/common/data/binary_row.h"
+#include "paimon/common/types/data_field.h"
 #include "paimon/core/core_options.h"
 #include "paimon/core/options/merge_engine.h"
+#include "paimon/core/schema/table_schema.h"
 #include "paimon/core/table/bucket_mode.h"
+#include "paimon/core/table/source/bucketed_plan_impl.h"
 #include "paimon/core/table/source/data_split_impl.h"
 #include "paimon/core/table/source/plan_impl.h"
 #include "paimon/core/table/source/snapshot/snapshot_reader.h"
@@ -59,6 +67,60 @@ Result<std::shared_ptr<Plan>> DataTableBatchScan::CreatePlan() {
     return Status::Invalid("end of scan");
 }
 
+Result<std::shared_ptr<BucketedPlan>> DataTableBatchScan::CreateBucketedPlan() {
+    int32_t num_buckets = core_options_.GetBucket();
+    if (num_buckets <= 0) {
+        return Status::NotImplemented(fmt::format(
+            "bucketed plan requires a fixed number of buckets, but bucket is {}", num_buckets));
+    }
+    const std::shared_ptr<TableSchema>& table_schema = snapshot_reader_->GetTableSchema();
+    PAIMON_ASSIGN_OR_RAISE(std::vector<DataField> bucket_key_fields,
+                           table_schema->GetFields(table_schema->BucketKeys()));
+    arrow::FieldVector bucket_keys;
+    bucket_keys.reserve(bucket_key_fields.size());
+    for (const auto& field : bucket_key_fields) {
+        bucket_keys.push_back(DataField::ConvertDataFieldToArrowField(field));
+    }
+    PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<Plan> plan, CreatePlan());
+
+    std::vector<BinaryRow> partitions;
+    std::unordered_map<BinaryRow, std::map<int32_t, std::vector<std::shared_ptr<Split>>>>
+        partition_buckets;
+    for (const auto& split : plan->Splits()) {
+        auto data_split = std::dynamic_pointer_cast<DataSplitImpl>(split);
+        if (!data_split) {
+            return Status::Invalid("DataSplit cannot cast to DataSplitImpl");
+        }
+        const std::optional<int32_t>& total_buckets = data_split->TotalBuckets();
+        if (total_buckets && total_buckets.value() != num_buckets) {
+            // files of the partition are still distributed by another number of buckets
+            return Status::Invalid(fmt::format(
+                "bucket {} of split has total buckets {}, which differs from bucket number {} of "
+                "the table",
+                data_split->Bucket(), total_buckets.value(), num_buckets));
+        }
+        if (partition_buckets.count(data_split->Partition()) == 0) {
+            partitions.push_back(data_split->Partition());
+        }
+        partition_buckets[data_split->Partition()][data_split->Bucket()].push_back(split);
+    }
+
+    std::vector<BucketedPlan::BucketSplits> buckets;
+    for (const auto& partition : partitions) {
+        using PartitionVector = std::vector<std::pair<std::string, std::string>>;
+        PAIMON_ASSIGN_OR_RAISE(
+            PartitionVector partition_vector,
+            snapshot_reader_->GetPathFactory()->GeneratePartitionVector(partition));
+        std::map<std::string, std::string> partition_spec(partition_vector.begin(),
+                                                          partition_vector.end());
+        for (auto& [bucket, splits] : partition_buckets[partition]) {
+            buckets.push_back({partition_spec, bucket, std::move(splits)});
+        }
+    }
+    return std::make_shared<BucketedPlanImpl>(plan->SnapshotId(), num_buckets, bucket_keys,
+                                              std::move(buckets));
+}
+
 Result<std::shared_ptr<Plan>> DataTableBatchScan::ApplyPushDownLimit(
     const std::shared_ptr<StartingScanner::ScanResult>& scan_result) const {
     auto current_scan_result =
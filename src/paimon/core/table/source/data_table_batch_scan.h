@@ -37,6 +37,8 @@ class DataTableBatchScan : public AbstractTableScan {
 
     Result<std::shared_ptr<Plan>> CreatePlan() override;
 
+    Result<std::shared_ptr<BucketedPlan>> CreateBucketedPlan() override;
+
     std::shared_ptr<PredicateFilter> GetNonPartitionPredicate() const {
         return snapshot_reader_->GetNonPartitionPredicate();
     }
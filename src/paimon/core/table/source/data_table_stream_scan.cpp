@@ -25,6 +25,7 @@
 #include "paimon/core/table/source/plan_impl.h"
 #include "paimon/core/table/source/snapshot/delta_follow_up_scanner.h"
 #include "paimon/core/table/source/snapshot/follow_up_scanner.h"
+#include "paimon/core/table/source/snapshot/input_changelog_follow_up_scanner.h"
 #include "paimon/core/table/source/snapshot/snapshot_reader.h"
 #include "paimon/core/table/source/snapshot/starting_scanner.h"
 #include "paimon/core/utils/snapshot_manager.h"
@@ -119,7 +120,11 @@ Result<std::optional<Snapshot>> DataTableStreamScan::GetNextSnapshot(
 
 Status DataTableStreamScan::InitScanner() {
     PAIMON_ASSIGN_OR_RAISE(starting_scanner_, CreateStartingScanner(/*is_streaming=*/true));
-    follow_up_scanner_ = std::make_shared<DeltaFollowUpScanner>();
+    if (core_options_.GetChangelogProducer() == ChangelogProducer::INPUT) {
+        follow_up_scanner_ = std::make_shared<InputChangelogFollowUpScanner>();
+    } else {
+        follow_up_scanner_ = std::make_shared<DeltaFollowUpScanner>();
+    }
     return Status::OK();
 }
 
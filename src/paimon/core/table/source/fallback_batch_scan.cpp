@@ -0,0 +1,102 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/table/source/fallback_batch_scan.h"
+
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "paimon/core/manifest/partition_entry.h"
+#include "paimon/core/operation/file_store_scan.h"
+#include "paimon/core/snapshot.h"
+#include "paimon/core/table/source/data_split_impl.h"
+#include "paimon/core/table/source/fallback_data_split.h"
+#include "paimon/core/table/source/plan_impl.h"
+#include "paimon/core/table/source/snapshot/snapshot_reader.h"
+#include "paimon/status.h"
+#include "paimon/table/source/data_split.h"
+
+namespace paimon {
+
+FallbackBatchScan::FallbackBatchScan(
+    std::unique_ptr<TableScan>&& main_scan, std::unique_ptr<FileStoreScan>&& main_partition_scan,
+    std::unique_ptr<TableScan>&& fallback_scan,
+    const std::shared_ptr<SnapshotReader>& fallback_snapshot_reader)
+    : main_scan_(std::move(main_scan)),
+      main_partition_scan_(std::move(main_partition_scan)),
+      fallback_scan_(std::move(fallback_scan)),
+      fallback_snapshot_reader_(fallback_snapshot_reader) {}
+
+FallbackBatchScan::~FallbackBatchScan() = default;
+
+Result<std::shared_ptr<Plan>> FallbackBatchScan::CreatePlan() {
+    PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<Plan> main_plan, main_scan_->CreatePlan());
+    // the partitions are listed from the snapshot of the main plan, so a concurrent commit to the
+    // main branch can neither hide nor duplicate a partition
+    PAIMON_ASSIGN_OR_RAISE(std::unordered_set<BinaryRow> main_partitions,
+                           ListMainPartitions(main_plan->SnapshotId()));
+    fallback_snapshot_reader_->WithExcludedPartitions(main_partitions);
+    PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<Plan> fallback_plan, fallback_scan_->CreatePlan());
+
+    std::vector<std::shared_ptr<Split>> splits;
+    splits.reserve(main_plan->Splits().size() + fallback_plan->Splits().size());
+    for (const auto& split : main_plan->Splits()) {
+        auto data_split = std::dynamic_pointer_cast<DataSplit>(split);
+        if (data_split) {
+            splits.push_back(
+                std::make_shared<FallbackDataSplit>(data_split, /*is_fallback=*/false));
+        } else {
+            // e.g., indexed splits of data evolution table, which are always read from main branch
+            splits.push_back(split);
+        }
+    }
+    for (const auto& split : fallback_plan->Splits()) {
+        auto data_split = std::dynamic_pointer_cast<DataSplitImpl>(split);
+        if (!data_split) {
+            return Status::Invalid("DataSplit cannot cast to DataSplitImpl");
+        }
+        splits.push_back(std::make_shared<FallbackDataSplit>(data_split, /*is_fallback=*/true));
+    }
+    return std::make_shared<PlanImpl>(main_plan->SnapshotId(), splits);
+}
+
+Result<std::shared_ptr<BucketedPlan>> FallbackBatchScan::CreateBucketedPlan() {
+    return Status::NotImplemented("bucketed plan is not supported with scan.fallback-branch");
+}
+
+Result<std::unordered_set<BinaryRow>> FallbackBatchScan::ListMainPartitions(
+    const std::optional<int64_t>& snapshot_id) {
+    std::unordered_set<BinaryRow> partitions;
+    if (snapshot_id == std::nullopt) {
+        // the main branch has no snapshot yet
+        return partitions;
+    }
+    PAIMON_ASSIGN_OR_RAISE(
+        Snapshot snapshot,
+        main_partition_scan_->GetSnapshotManager()->LoadSnapshot(snapshot_id.value()));
+    // partition entries come from the partition stats file or the manifests, the data files are
+    // never listed
+    PAIMON_ASSIGN_OR_RAISE(std::vector<PartitionEntry> partition_entries,
+                           main_partition_scan_->WithSnapshot(snapshot)->ReadPartitionEntries());
+    partitions.reserve(partition_entries.size());
+    for (const auto& entry : partition_entries) {
+        partitions.insert(entry.Partition());
+    }
+    return partitions;
+}
+
+}  // namespace paimon
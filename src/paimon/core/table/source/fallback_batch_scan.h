@@ -0,0 +1,68 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <unordered_set>
+
+#include "paimon/common/data/binary_row.h"
+#include "paimon/result.h"
+#include "paimon/table/source/bucketed_plan.h"
+#include "paimon/table/source/plan.h"
+#include "paimon/table/source/table_scan.h"
+
+namespace paimon {
+class FileStoreScan;
+class SnapshotReader;
+
+/// `TableScan` implementation for batch planning of a table with "scan.fallback-branch".
+///
+/// A partition is read from the main branch if the main branch has files in it, otherwise it is
+/// read from the fallback branch. The partitions of the main branch are listed from the snapshot of
+/// the main plan, and excluded from the fallback branch before it is planned, so that the
+/// manifest entries of these partitions are skipped rather than planned and dropped. Splits of
+/// the plan are `FallbackDataSplit`s flagged with the branch they belong to, which are routed by
+/// `FallbackTableRead`.
+class FallbackBatchScan : public TableScan {
+ public:
+    /// @param main_scan Batch scan of the main branch.
+    /// @param main_partition_scan Scan of the main branch with partition filters only, which lists
+    /// the partitions covered by the main branch.
+    /// @param fallback_scan Batch scan of the fallback branch.
+    /// @param fallback_snapshot_reader Snapshot reader of `fallback_scan`.
+    FallbackBatchScan(std::unique_ptr<TableScan>&& main_scan,
+                      std::unique_ptr<FileStoreScan>&& main_partition_scan,
+                      std::unique_ptr<TableScan>&& fallback_scan,
+                      const std::shared_ptr<SnapshotReader>& fallback_snapshot_reader);
+    ~FallbackBatchScan() override;
+
+    Result<std::shared_ptr<Plan>> CreatePlan() override;
+
+    Result<std::shared_ptr<BucketedPlan>> CreateBucketedPlan() override;
+
+ private:
+    Result<std::unordered_set<BinaryRow>> ListMainPartitions(
+        const std::optional<int64_t>& snapshot_id);
+
+ private:
+    std::unique_ptr<TableScan> main_scan_;
+    std::unique_ptr<FileStoreScan> main_partition_scan_;
+    std::unique_ptr<TableScan> fallback_scan_;
+    std::shared_ptr<SnapshotReader> fallback_snapshot_reader_;
+};
+}  // namespace paimon
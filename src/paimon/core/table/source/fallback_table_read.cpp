@@ -39,4 +39,32 @@ Result<std::unique_ptr<BatchReader>> FallbackTableRead::CreateReader(
     return main_table_->CreateReader(data_split);
 }
 
+Result<std::vector<std::unique_ptr<BatchReader>>> FallbackTableRead::CreateKeyOrderedReaders(
+    const std::vector<std::shared_ptr<Split>>& splits) {
+    std::vector<std::unique_ptr<BatchReader>> readers;
+    for (const auto& split : splits) {
+        // create readers split by split to keep the order of splits across both branches
+        AbstractTableRead* table_read = main_table_.get();
+        std::shared_ptr<Split> branch_split = split;
+        auto fallback_data_split = std::dynamic_pointer_cast<FallbackDataSplit>(split);
+        if (fallback_data_split) {
+            if (fallback_data_split->IsFallback()) {
+                table_read = fallback_table_.get();
+            }
+            branch_split = fallback_data_split->GetSplit();
+        }
+        PAIMON_ASSIGN_OR_RAISE(std::vector<std::unique_ptr<BatchReader>> split_readers,
+                               table_read->CreateKeyOrderedReaders({branch_split}));
+        for (auto& reader : split_readers) {
+            readers.push_back(std::move(reader));
+        }
+    }
+    return readers;
+}
+
+Result<std::unique_ptr<BatchReader>> FallbackTableRead::MergeKeyOrderedReaders(
+    std::vector<std::unique_ptr<BatchReader>>&& readers) {
+    return main_table_->MergeKeyOrderedReaders(std::move(readers));
+}
+
 }  // namespace paimon
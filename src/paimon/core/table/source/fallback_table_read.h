@@ -18,29 +18,36 @@
 
 #include <memory>
 #include <utility>
+#include <vector>
 
+#include "paimon/core/table/source/abstract_table_read.h"
 #include "paimon/reader/batch_reader.h"
 #include "paimon/result.h"
-#include "paimon/table/source/table_read.h"
 
 namespace paimon {
 class DataSplit;
 class MemoryPool;
 
-class FallbackTableRead : public TableRead {
+class FallbackTableRead : public AbstractTableRead {
  public:
-    FallbackTableRead(std::unique_ptr<TableRead> main_table,
-                      std::unique_ptr<TableRead> fallback_table,
+    FallbackTableRead(std::unique_ptr<AbstractTableRead> main_table,
+                      std::unique_ptr<AbstractTableRead> fallback_table,
                       const std::shared_ptr<MemoryPool>& memory_pool)
-        : TableRead(memory_pool),
+        : AbstractTableRead(main_table->OutputSchema(), memory_pool),
           main_table_(std::move(main_table)),
           fallback_table_(std::move(fallback_table)) {}
 
     Result<std::unique_ptr<BatchReader>> CreateReader(const std::shared_ptr<Split>& split) override;
 
+    Result<std::vector<std::unique_ptr<BatchReader>>> CreateKeyOrderedReaders(
+        const std::vector<std::shared_ptr<Split>>& splits) override;
+
+    Result<std::unique_ptr<BatchReader>> MergeKeyOrderedReaders(
+        std::vector<std::unique_ptr<BatchReader>>&& readers) override;
+
  private:
-    std::unique_ptr<TableRead> main_table_;
-    std::unique_ptr<TableRead> fallback_table_;
+    std::unique_ptr<AbstractTableRead> main_table_;
+    std::unique_ptr<AbstractTableRead> fallback_table_;
 };
 
 }  // namespace paimon
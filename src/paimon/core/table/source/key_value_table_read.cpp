@@ -16,10 +16,19 @@
 
 #include "paimon/core/table/source/key_value_table_read.h"
 
+#include <optional>
+#include <string>
 #include <utility>
 
+#include "arrow/type.h"
+#include "fmt/format.h"
+#include "paimon/common/types/data_field.h"
+#include "paimon/core/core_options.h"
+#include "paimon/core/mergetree/key_ordered_merge_batch_reader.h"
 #include "paimon/core/operation/merge_file_split_read.h"
 #include "paimon/core/operation/raw_file_split_read.h"
+#include "paimon/core/schema/table_schema.h"
+#include "paimon/core/table/source/data_split_impl.h"
 #include "paimon/status.h"
 
 namespace paimon {
@@ -30,10 +39,14 @@ class InternalReadContext;
 class MemoryPool;
 
 KeyValueTableRead::KeyValueTableRead(std::vector<std::unique_ptr<SplitRead>>&& split_reads,
+                                     const std::shared_ptr<InternalReadContext>& context,
                                      const std::shared_ptr<MemoryPool>& memory_pool)
-    : TableRead(memory_pool), split_reads_(std::move(split_reads)) {}
+    : AbstractTableRead(context, memory_pool),
+      split_reads_(std::move(split_reads)),
+      context_(context),
+      memory_pool_(memory_pool) {}
 
-Result<std::unique_ptr<TableRead>> KeyValueTableRead::Create(
+Result<std::unique_ptr<AbstractTableRead>> KeyValueTableRead::Create(
     const std::shared_ptr<FileStorePathFactory>& path_factory,
     const std::shared_ptr<InternalReadContext>& context,
     const std::shared_ptr<MemoryPool>& memory_pool, const std::shared_ptr<Executor>& executor) {
@@ -46,7 +59,8 @@ Result<std::unique_ptr<TableRead>> KeyValueTableRead::Create(
         MergeFileSplitRead::Create(path_factory, context, memory_pool, executor));
     split_reads.emplace_back(std::move(merge_file_split_read));
 
-    return std::unique_ptr<TableRead>(new KeyValueTableRead(std::move(split_reads), memory_pool));
+    return std::unique_ptr<AbstractTableRead>(
+        new KeyValueTableRead(std::move(split_reads), context, memory_pool));
 }
 
 Result<std::unique_ptr<BatchReader>> KeyValueTableRead::CreateReader(
@@ -64,4 +78,81 @@ Result<std::unique_ptr<BatchReader>> KeyValueTableRead::CreateReader(
     return Status::Invalid("create reader failed, not read match with data split.");
 }
 
+Result<std::vector<DataField>> KeyValueTableRead::KeyFields() const {
+    const auto& table_schema = context_->GetTableSchema();
+    PAIMON_ASSIGN_OR_RAISE(std::vector<std::string> trimmed_primary_keys,
+                           table_schema->TrimmedPrimaryKeys());
+    const auto& read_schema = context_->GetReadSchema();
+    for (const auto& key : trimmed_primary_keys) {
+        if (read_schema->GetFieldIndex(key) < 0) {
+            return Status::Invalid(fmt::format(
+                "key ordered read requires primary key field {} in read schema", key));
+        }
+    }
+    return table_schema->GetFields(trimmed_primary_keys);
+}
+
+Result<std::vector<std::unique_ptr<BatchReader>>> KeyValueTableRead::CreateKeyOrderedReaders(
+    const std::vector<std::shared_ptr<Split>>& splits) {
+    // validate the read schema before opening any reader
+    PAIMON_RETURN_NOT_OK(KeyFields());
+    std::vector<std::unique_ptr<BatchReader>> readers;
+    for (const auto& split : splits) {
+        auto data_split = std::dynamic_pointer_cast<DataSplitImpl>(split);
+        if (!data_split) {
+            return Status::Invalid("split cannot be casted to DataSplit");
+        }
+        if (data_split->IsStreaming()) {
+            return Status::Invalid("key ordered read does not support streaming splits");
+        }
+        PAIMON_ASSIGN_OR_RAISE(std::vector<std::shared_ptr<Split>> sorted_splits,
+                               SplitIntoSortedSplits(data_split));
+        for (const auto& sorted_split : sorted_splits) {
+            PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<BatchReader> reader, CreateReader(sorted_split));
+            readers.push_back(std::move(reader));
+        }
+    }
+    return readers;
+}
+
+Result<std::unique_ptr<BatchReader>> KeyValueTableRead::MergeKeyOrderedReaders(
+    std::vector<std::unique_ptr<BatchReader>>&& readers) {
+    PAIMON_ASSIGN_OR_RAISE(std::vector<DataField> key_fields, KeyFields());
+    PAIMON_ASSIGN_OR_RAISE(
+        std::unique_ptr<KeyOrderedMergeBatchReader> merge_reader,
+        KeyOrderedMergeBatchReader::Create(std::move(readers), key_fields,
+                                           context_->GetCoreOptions().GetReadBatchSize(),
+                                           memory_pool_));
+    return std::unique_ptr<BatchReader>(std::move(merge_reader));
+}
+
+Result<std::vector<std::shared_ptr<Split>>> KeyValueTableRead::SplitIntoSortedSplits(
+    const std::shared_ptr<DataSplitImpl>& split) const {
+    const auto& data_files = split->DataFiles();
+    // the merge read returns rows in key order, while the raw read concatenates data files,
+    // which may overlap (e.g. files of different levels with deletion vectors), so each data file
+    // of a raw read becomes a split of its own
+    PAIMON_ASSIGN_OR_RAISE(bool raw_read, split_reads_[0]->Match(split, force_keep_delete_));
+    if (!raw_read || data_files.size() <= 1) {
+        return std::vector<std::shared_ptr<Split>>({split});
+    }
+    const auto& deletion_files = split->DeletionFiles();
+    std::vector<std::shared_ptr<Split>> sorted_splits;
+    sorted_splits.reserve(data_files.size());
+    for (size_t i = 0; i < data_files.size(); i++) {
+        DataSplitImpl::Builder builder(split->Partition(), split->Bucket(), split->BucketPath(),
+                                       {data_files[i]});
+        builder.WithSnapshot(split->SnapshotId())
+            .WithTotalBuckets(split->TotalBuckets())
+            .IsStreaming(false)
+            .RawConvertible(true);
+        if (!deletion_files.empty()) {
+            builder.WithDataDeletionFiles({deletion_files[i]});
+        }
+        PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<DataSplitImpl> sorted_split, builder.Build());
+        sorted_splits.push_back(std::move(sorted_split));
+    }
+    return sorted_splits;
+}
+
 }  // namespace paimon
@@ -19,34 +19,52 @@
 #include <memory>
 #include <vector>
 
+#include "paimon/common/types/data_field.h"
 #include "paimon/core/operation/internal_read_context.h"
 #include "paimon/core/operation/split_read.h"
+#include "paimon/core/table/source/abstract_table_read.h"
 #include "paimon/core/utils/file_store_path_factory.h"
 #include "paimon/reader/batch_reader.h"
 #include "paimon/result.h"
-#include "paimon/table/source/table_read.h"
 
 namespace paimon {
 class Split;
+class DataSplitImpl;
 class Executor;
 class FileStorePathFactory;
 class InternalReadContext;
 class MemoryPool;
 
-class KeyValueTableRead : public TableRead {
+class KeyValueTableRead : public AbstractTableRead {
  public:
-    static Result<std::unique_ptr<TableRead>> Create(
+    static Result<std::unique_ptr<AbstractTableRead>> Create(
         const std::shared_ptr<FileStorePathFactory>& path_factory,
         const std::shared_ptr<InternalReadContext>& context,
         const std::shared_ptr<MemoryPool>& memory_pool, const std::shared_ptr<Executor>& executor);
 
     Result<std::unique_ptr<BatchReader>> CreateReader(const std::shared_ptr<Split>& split) override;
 
+    Result<std::vector<std::unique_ptr<BatchReader>>> CreateKeyOrderedReaders(
+        const std::vector<std::shared_ptr<Split>>& splits) override;
+
+    Result<std::unique_ptr<BatchReader>> MergeKeyOrderedReaders(
+        std::vector<std::unique_ptr<BatchReader>>&& readers) override;
+
  private:
     KeyValueTableRead(std::vector<std::unique_ptr<SplitRead>>&& split_reads,
+                      const std::shared_ptr<InternalReadContext>& context,
                       const std::shared_ptr<MemoryPool>& memory_pool);
 
+    /// Fields of the trimmed primary key, which must all be in the read schema.
+    Result<std::vector<DataField>> KeyFields() const;
+
+    /// Splits `split` into splits whose readers each return rows in key order.
+    Result<std::vector<std::shared_ptr<Split>>> SplitIntoSortedSplits(
+        const std::shared_ptr<DataSplitImpl>& split) const;
+
     std::vector<std::unique_ptr<SplitRead>> split_reads_;
+    std::shared_ptr<InternalReadContext> context_;
+    std::shared_ptr<MemoryPool> memory_pool_;
     bool force_keep_delete_ = false;
 };
 
@@ -17,11 +17,19 @@
 #include "paimon/core/table/source/snapshot/snapshot_reader.h"
 
 #include <cassert>
+#include <functional>
+#include <future>
+#include <iterator>
 #include <list>
+#include <set>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
+#include <utility>
 
+#include "fmt/format.h"
 #include "paimon/common/data/binary_row.h"
+#include "paimon/common/executor/future.h"
 #include "paimon/common/utils/linked_hash_map.h"
 #include "paimon/core/core_options.h"
 #include "paimon/core/deletionvectors/deletion_vectors_index_file.h"
@@ -29,123 +37,306 @@
 #include "paimon/core/index/index_file_meta.h"
 #include "paimon/core/io/data_file_meta.h"
 #include "paimon/core/manifest/file_kind.h"
+#include "paimon/core/manifest/index_manifest_entry.h"
 #include "paimon/core/manifest/manifest_entry.h"
+#include "paimon/core/schema/table_schema.h"
 #include "paimon/core/snapshot.h"
 #include "paimon/core/table/source/data_split_impl.h"
 #include "paimon/core/table/source/plan_impl.h"
 #include "paimon/core/utils/file_store_path_factory.h"
+#include "paimon/core/utils/snapshot_manager.h"
 
 namespace paimon {
 Result<std::shared_ptr<Plan>> SnapshotReader::Read() const {
     PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<FileStoreScan::RawPlan> raw_plan, scan_->CreatePlan());
     const std::optional<Snapshot>& snapshot = raw_plan->GetSnapshot();
+    std::vector<ManifestEntry> added_files = raw_plan->Files(FileKind::Add());
+    std::unordered_set<std::string> added_file_names;
+    if (NeedReadDeletionVectorChanges(snapshot)) {
+        for (const auto& entry : added_files) {
+            added_file_names.insert(entry.File()->file_name);
+        }
+    }
     FileStoreScan::RawPlan::GroupFiles files =
-        FileStoreScan::RawPlan::GroupByPartFiles(raw_plan->Files(FileKind::Add()));
+        FileStoreScan::RawPlan::GroupByPartFiles(std::move(added_files));
     PAIMON_ASSIGN_OR_RAISE(
         std::vector<std::shared_ptr<Split>> data_splits,
         GenerateSplits(snapshot, scan_mode_ != ScanMode::ALL, split_generator_, std::move(files)));
+    if (NeedReadDeletionVectorChanges(snapshot)) {
+        PAIMON_ASSIGN_OR_RAISE(
+            std::vector<std::shared_ptr<Split>> deletion_splits,
+            GenerateDeletionVectorChangeSplits(snapshot.value(), added_file_names));
+        data_splits.insert(data_splits.end(), deletion_splits.begin(), deletion_splits.end());
+    }
     return std::make_shared<PlanImpl>(raw_plan->SnapshotId(), data_splits);
 }
 
+bool SnapshotReader::NeedReadDeletionVectorChanges(const std::optional<Snapshot>& snapshot) const {
+    // rows of primary key tables are deleted by deletion vectors only when they are superseded by
+    // newer records, which are already in the changes of the table
+    const CoreOptions& core_options = scan_->GetCoreOptions();
+    return scan_mode_ == ScanMode::DELTA && snapshot != std::nullopt &&
+           core_options.DeletionVectorsEnabled() && !core_options.DataEvolutionEnabled() &&
+           GetTableSchema()->PrimaryKeys().empty();
+}
+
 Result<std::vector<std::shared_ptr<Split>>> SnapshotReader::GenerateSplits(
     const std::optional<Snapshot>& snapshot, bool is_streaming,
     const std::unique_ptr<SplitGenerator>& split_generator,
     FileStoreScan::RawPlan::GroupFiles&& grouped_manifest_entries) const {
-    std::vector<std::shared_ptr<Split>> splits;
     // Read deletion indexes at once to reduce file IO
     std::unordered_map<std::pair<BinaryRow, int32_t>, std::vector<std::shared_ptr<IndexFileMeta>>>
         deletion_index_files_map;
+    // streaming splits also carry the deletion files of the snapshot, so that deleted rows of
+    // their data files are skipped just like in batch reads
     bool deletion_file_enabled = scan_->GetCoreOptions().DeletionVectorsEnabled();
-    if (!is_streaming) {
-        if (deletion_file_enabled && snapshot != std::nullopt) {
-            PAIMON_ASSIGN_OR_RAISE(
-                deletion_index_files_map,
-                index_file_handler_->Scan(
-                    snapshot.value(), std::string(DeletionVectorsIndexFile::DELETION_VECTORS_INDEX),
-                    grouped_manifest_entries.key_set()));
-        }
+    if (deletion_file_enabled && snapshot != std::nullopt) {
+        PAIMON_ASSIGN_OR_RAISE(
+            deletion_index_files_map,
+            index_file_handler_->Scan(
+                snapshot.value(), std::string(DeletionVectorsIndexFile::DELETION_VECTORS_INDEX),
+                grouped_manifest_entries.key_set()));
     }
-    for (auto& [partition, bucket_map] : grouped_manifest_entries) {
-        for (auto& [bucket, manifest_entries] : bucket_map) {
-            // collect data file metas
-            assert(!manifest_entries.empty());
-            auto total_buckets = manifest_entries[0].TotalBuckets();
-            std::vector<std::shared_ptr<DataFileMeta>> files;
-            files.reserve(manifest_entries.size());
-            for (auto& entry : manifest_entries) {
-                files.emplace_back(std::move(entry.File()));
+    static const std::vector<std::shared_ptr<IndexFileMeta>> NO_INDEX_FILES;
+    // each (partition, bucket) is independent, generate their splits in parallel and gather them
+    // in the order of `grouped_manifest_entries` to keep the plan deterministic
+    std::vector<std::function<Result<std::vector<std::shared_ptr<Split>>>()>> tasks;
+    for (const auto& [partition, bucket_map] : grouped_manifest_entries) {
+        for (const auto& [bucket, manifest_entries] : bucket_map) {
+            const std::vector<std::shared_ptr<IndexFileMeta>>* index_file_metas = &NO_INDEX_FILES;
+            auto index_iter = deletion_index_files_map.find(std::make_pair(partition, bucket));
+            if (deletion_file_enabled && index_iter != deletion_index_files_map.end()) {
+                index_file_metas = &index_iter->second;
             }
-            std::vector<SplitGenerator::SplitGroup> split_groups;
-            if (is_streaming) {
-                PAIMON_ASSIGN_OR_RAISE(split_groups,
-                                       split_generator->SplitForStreaming(std::move(files)));
-            } else {
-                PAIMON_ASSIGN_OR_RAISE(split_groups,
-                                       split_generator->SplitForBatch(std::move(files)));
+            tasks.emplace_back([this, &snapshot, is_streaming, &split_generator,
+                                partition = &partition, bucket = bucket,
+                                manifest_entries = &manifest_entries, index_file_metas]() {
+                return GenerateBucketSplits(snapshot, is_streaming, split_generator, *partition,
+                                            bucket, *manifest_entries, *index_file_metas);
+            });
+        }
+    }
+    std::vector<Result<std::vector<std::shared_ptr<Split>>>> bucket_splits;
+    if (tasks.size() <= 1) {
+        for (auto& task : tasks) {
+            bucket_splits.push_back(task());
+        }
+    } else {
+        std::vector<std::future<Result<std::vector<std::shared_ptr<Split>>>>> futures;
+        futures.reserve(tasks.size());
+        for (auto& task : tasks) {
+            futures.push_back(Via(scan_->GetExecutor().get(), std::move(task)));
+        }
+        bucket_splits = CollectAll(futures);
+    }
+    std::vector<std::shared_ptr<Split>> splits;
+    for (auto& result : bucket_splits) {
+        PAIMON_ASSIGN_OR_RAISE(std::vector<std::shared_ptr<Split>> splits_of_bucket,
+                               std::move(result));
+        splits.insert(splits.end(), std::make_move_iterator(splits_of_bucket.begin()),
+                      std::make_move_iterator(splits_of_bucket.end()));
+    }
+    return splits;
+}
+
+Result<std::vector<std::shared_ptr<Split>>> SnapshotReader::GenerateBucketSplits(
+    const std::optional<Snapshot>& snapshot, bool is_streaming,
+    const std::unique_ptr<SplitGenerator>& split_generator, const BinaryRow& partition,
+    int32_t bucket, const std::vector<ManifestEntry>& manifest_entries,
+    const std::vector<std::shared_ptr<IndexFileMeta>>& index_file_metas) const {
+    // collect data file metas
+    assert(!manifest_entries.empty());
+    auto total_buckets = manifest_entries[0].TotalBuckets();
+    std::vector<std::shared_ptr<DataFileMeta>> files;
+    files.reserve(manifest_entries.size());
+    for (const auto& entry : manifest_entries) {
+        files.emplace_back(entry.File());
+    }
+    std::vector<SplitGenerator::SplitGroup> split_groups;
+    if (is_streaming) {
+        PAIMON_ASSIGN_OR_RAISE(split_groups, split_generator->SplitForStreaming(std::move(files)));
+    } else {
+        PAIMON_ASSIGN_OR_RAISE(split_groups, split_generator->SplitForBatch(std::move(files)));
+    }
+    PAIMON_ASSIGN_OR_RAISE(std::string bucket_path, path_factory_->BucketPath(partition, bucket));
+    std::unordered_map<std::string, DeletionFile> deletion_file_index;
+    if (!index_file_metas.empty()) {
+        PAIMON_ASSIGN_OR_RAISE(deletion_file_index,
+                               GetDeletionFileIndex(partition, bucket, index_file_metas));
+    }
+    std::vector<std::shared_ptr<Split>> splits;
+    splits.reserve(split_groups.size());
+    for (auto& split_group : split_groups) {
+        std::vector<std::shared_ptr<DataFileMeta>>& data_files = split_group.files;
+        DataSplitImpl::Builder builder(partition, bucket, bucket_path, std::move(data_files));
+        builder.WithTotalBuckets(total_buckets)
+            .WithSnapshot(snapshot == std::nullopt ? Snapshot::FIRST_SNAPSHOT_ID - 1
+                                                   : snapshot.value().Id())
+            .IsStreaming(is_streaming)
+            .RawConvertible(split_group.raw_convertible);
+        if (!index_file_metas.empty()) {
+            builder.WithDataDeletionFiles(
+                GetDeletionFiles(builder.DataFiles(), deletion_file_index));
+        }
+        PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<DataSplit> data_split, builder.Build());
+        splits.emplace_back(data_split);
+    }
+    return splits;
+}
+
+Result<std::vector<std::shared_ptr<Split>>> SnapshotReader::GenerateDeletionVectorChangeSplits(
+    const Snapshot& snapshot, const std::unordered_set<std::string>& added_file_names) const {
+    PAIMON_ASSIGN_OR_RAISE(IndexFileHandler::IndexFileMetaGroups index_files,
+                           ScanDeletionVectorIndex(snapshot));
+    IndexFileHandler::IndexFileMetaGroups before_index_files;
+    int64_t before_snapshot_id = snapshot.Id() - 1;
+    if (before_snapshot_id >= Snapshot::FIRST_SNAPSHOT_ID) {
+        const std::shared_ptr<SnapshotManager>& snapshot_manager = GetSnapshotManager();
+        PAIMON_ASSIGN_OR_RAISE(bool exists, snapshot_manager->SnapshotExists(before_snapshot_id));
+        if (!exists) {
+            return Status::Invalid(fmt::format(
+                "cannot read deletion vector changes of snapshot {}, previous snapshot {} has "
+                "expired",
+                snapshot.Id(), before_snapshot_id));
+        }
+        PAIMON_ASSIGN_OR_RAISE(Snapshot before_snapshot,
+                               snapshot_manager->LoadSnapshot(before_snapshot_id));
+        PAIMON_ASSIGN_OR_RAISE(before_index_files, ScanDeletionVectorIndex(before_snapshot));
+    }
+    auto file_names = [](const std::vector<std::shared_ptr<IndexFileMeta>>& metas) {
+        std::set<std::string> names;
+        for (const auto& meta : metas) {
+            names.insert(meta->FileName());
+        }
+        return names;
+    };
+    FileStoreScan::BucketSet changed_buckets;
+    for (const auto& [partition_bucket, metas] : index_files) {
+        auto before_iter = before_index_files.find(partition_bucket);
+        if (before_iter == before_index_files.end() ||
+            file_names(before_iter->second) != file_names(metas)) {
+            changed_buckets.insert(partition_bucket);
+        }
+    }
+    if (changed_buckets.empty()) {
+        return std::vector<std::shared_ptr<Split>>();
+    }
+
+    // index files only record data file names, so look up the metas of data files in the
+    // buckets whose deletion vectors changed, without touching the state of the shared scan
+    PAIMON_ASSIGN_OR_RAISE(std::vector<ManifestEntry> changed_bucket_files,
+                           scan_->ReadBucketFiles(snapshot, changed_buckets));
+    FileStoreScan::RawPlan::GroupFiles grouped_files =
+        FileStoreScan::RawPlan::GroupByPartFiles(std::move(changed_bucket_files));
+
+    std::vector<std::shared_ptr<Split>> splits;
+    for (const auto& [partition, bucket_map] : grouped_files) {
+        for (const auto& [bucket, manifest_entries] : bucket_map) {
+            auto partition_bucket = std::make_pair(partition, bucket);
+            PAIMON_ASSIGN_OR_RAISE(
+                auto deletion_file_index,
+                GetDeletionFileIndex(partition, bucket, index_files[partition_bucket]));
+            std::unordered_map<std::string, DeletionFile> before_deletion_file_index;
+            auto before_iter = before_index_files.find(partition_bucket);
+            if (before_iter != before_index_files.end()) {
+                PAIMON_ASSIGN_OR_RAISE(
+                    before_deletion_file_index,
+                    GetDeletionFileIndex(partition, bucket, before_iter->second));
             }
-            for (auto& split_group : split_groups) {
-                std::vector<std::shared_ptr<DataFileMeta>>& data_files = split_group.files;
-                PAIMON_ASSIGN_OR_RAISE(std::string bucket_path,
-                                       path_factory_->BucketPath(partition, bucket));
-                DataSplitImpl::Builder builder(partition, bucket, bucket_path,
-                                               std::move(data_files));
-                builder.WithTotalBuckets(total_buckets)
-                    .WithSnapshot(snapshot == std::nullopt ? Snapshot::FIRST_SNAPSHOT_ID - 1
-                                                           : snapshot.value().Id())
-                    .IsStreaming(is_streaming)
-                    .RawConvertible(split_group.raw_convertible);
-                if (deletion_file_enabled && !deletion_index_files_map.empty()) {
-                    PAIMON_ASSIGN_OR_RAISE(
-                        std::vector<std::optional<DeletionFile>> deletion_files,
-                        GetDeletionFiles(
-                            partition, bucket, builder.DataFiles(),
-                            deletion_index_files_map[std::make_pair(partition, bucket)]));
-                    builder.WithDataDeletionFiles(deletion_files);
+            std::vector<std::shared_ptr<DataFileMeta>> data_files;
+            std::vector<std::optional<DeletionFile>> deletion_files;
+            std::vector<std::optional<DeletionFile>> before_deletion_files;
+            for (const auto& entry : manifest_entries) {
+                const std::shared_ptr<DataFileMeta>& file = entry.File();
+                // rows of files added by the snapshot are read with their deletion files applied
+                if (added_file_names.find(file->file_name) != added_file_names.end()) {
+                    continue;
+                }
+                auto iter = deletion_file_index.find(file->file_name);
+                if (iter == deletion_file_index.end()) {
+                    continue;
+                }
+                std::optional<DeletionFile> before_deletion_file;
+                auto before_file_iter = before_deletion_file_index.find(file->file_name);
+                if (before_file_iter != before_deletion_file_index.end()) {
+                    if (before_file_iter->second == iter->second) {
+                        continue;
+                    }
+                    before_deletion_file = before_file_iter->second;
                 }
-                PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<DataSplit> data_split, builder.Build());
-                splits.emplace_back(data_split);
+                data_files.push_back(file);
+                deletion_files.emplace_back(iter->second);
+                before_deletion_files.push_back(std::move(before_deletion_file));
             }
+            if (data_files.empty()) {
+                continue;
+            }
+            PAIMON_ASSIGN_OR_RAISE(std::string bucket_path,
+                                   path_factory_->BucketPath(partition, bucket));
+            std::vector<std::shared_ptr<DataFileMeta>> before_files = data_files;
+            DataSplitImpl::Builder builder(partition, bucket, bucket_path, std::move(data_files));
+            builder.WithTotalBuckets(manifest_entries[0].TotalBuckets())
+                .WithSnapshot(snapshot.Id())
+                .WithBeforeFiles(std::move(before_files))
+                .WithBeforeDeletionFiles(before_deletion_files)
+                .WithDataDeletionFiles(deletion_files)
+                .IsStreaming(true)
+                .RawConvertible(false);
+            PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<DataSplit> data_split, builder.Build());
+            splits.emplace_back(data_split);
         }
     }
     return splits;
 }
 
-Result<std::vector<std::optional<DeletionFile>>> SnapshotReader::GetDeletionFiles(
+Result<IndexFileHandler::IndexFileMetaGroups> SnapshotReader::ScanDeletionVectorIndex(
+    const Snapshot& snapshot) const {
+    const std::string index_type(DeletionVectorsIndexFile::DELETION_VECTORS_INDEX);
+    PAIMON_ASSIGN_OR_RAISE(
+        std::vector<IndexManifestEntry> index_entries,
+        index_file_handler_->Scan(snapshot, [&index_type](const IndexManifestEntry& entry) {
+            return Result<bool>(entry.index_file->IndexType() == index_type);
+        }));
+    IndexFileHandler::IndexFileMetaGroups index_files;
+    for (const auto& entry : index_entries) {
+        index_files[std::make_pair(entry.partition, entry.bucket)].push_back(entry.index_file);
+    }
+    return index_files;
+}
+
+Result<std::unordered_map<std::string, DeletionFile>> SnapshotReader::GetDeletionFileIndex(
     const BinaryRow& partition, int32_t bucket,
-    const std::vector<std::shared_ptr<DataFileMeta>>& data_files,
     const std::vector<std::shared_ptr<IndexFileMeta>>& index_file_metas) const {
-    std::unordered_map<std::string, std::shared_ptr<IndexFileMeta>> data_file_to_index_file_meta;
+    std::unordered_map<std::string, DeletionFile> deletion_file_index;
     for (const auto& index_file_meta : index_file_metas) {
         const auto& dv_metas = index_file_meta->DvRanges();
-        if (dv_metas != std::nullopt) {
-            for (const auto& dv_meta_iter : dv_metas.value()) {
-                const auto& dv_meta = dv_meta_iter.second;
-                data_file_to_index_file_meta.insert(
-                    std::make_pair(dv_meta.data_file_name, index_file_meta));
-            }
+        if (dv_metas == std::nullopt || dv_metas->empty()) {
+            continue;
+        }
+        PAIMON_ASSIGN_OR_RAISE(std::string index_file_path,
+                               index_file_handler_->FilePath(partition, bucket, index_file_meta));
+        for (const auto& dv_meta_iter : dv_metas.value()) {
+            const auto& dv_meta = dv_meta_iter.second;
+            deletion_file_index.emplace(
+                dv_meta.data_file_name,
+                DeletionFile(index_file_path, dv_meta.offset, dv_meta.length, dv_meta.cardinality));
         }
     }
+    return deletion_file_index;
+}
 
+std::vector<std::optional<DeletionFile>> SnapshotReader::GetDeletionFiles(
+    const std::vector<std::shared_ptr<DataFileMeta>>& data_files,
+    const std::unordered_map<std::string, DeletionFile>& deletion_file_index) {
     std::vector<std::optional<DeletionFile>> deletion_files;
     deletion_files.reserve(data_files.size());
     for (const auto& file : data_files) {
-        auto index_file_meta_iter = data_file_to_index_file_meta.find(file->file_name);
-        if (index_file_meta_iter != data_file_to_index_file_meta.end()) {
-            const auto& optional_dv_metas = index_file_meta_iter->second->DvRanges();
-            assert(optional_dv_metas != std::nullopt);
-            const auto& dv_metas = optional_dv_metas.value();
-            auto dv_meta_iter = dv_metas.find(file->file_name);
-            if (dv_meta_iter != dv_metas.end()) {
-                PAIMON_ASSIGN_OR_RAISE(
-                    std::string index_file_path,
-                    index_file_handler_->FilePath(partition, bucket, index_file_meta_iter->second));
-                deletion_files.emplace_back(
-                    DeletionFile(index_file_path, dv_meta_iter->second.offset,
-                                 dv_meta_iter->second.length, dv_meta_iter->second.cardinality));
-                continue;
-            }
+        auto iter = deletion_file_index.find(file->file_name);
+        if (iter != deletion_file_index.end()) {
+            deletion_files.emplace_back(iter->second);
+        } else {
+            deletion_files.emplace_back(std::nullopt);
         }
-        deletion_files.emplace_back(std::nullopt);
     }
     return deletion_files;
 }
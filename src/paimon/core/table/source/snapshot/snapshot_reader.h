@@ -20,10 +20,14 @@
 #include <functional>
 #include <memory>
 #include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include "paimon/core/index/index_file_handler.h"
+#include "paimon/core/manifest/manifest_entry.h"
 #include "paimon/core/operation/file_store_scan.h"
 #include "paimon/core/table/source/data_split_impl.h"
 #include "paimon/core/table/source/deletion_file.h"
@@ -41,6 +45,7 @@ class FileStorePathFactory;
 class IndexFileMeta;
 class Snapshot;
 class SnapshotManager;
+class TableSchema;
 struct DataFileMeta;
 
 class SnapshotReader {
@@ -85,10 +90,23 @@ class SnapshotReader {
         return this;
     }
 
+    SnapshotReader* WithExcludedPartitions(const std::unordered_set<BinaryRow>& partitions) {
+        scan_->WithExcludedPartitions(partitions);
+        return this;
+    }
+
     const std::shared_ptr<SnapshotManager>& GetSnapshotManager() const {
         return scan_->GetSnapshotManager();
     }
 
+    const std::shared_ptr<TableSchema>& GetTableSchema() const {
+        return scan_->GetTableSchema();
+    }
+
+    const std::shared_ptr<FileStorePathFactory>& GetPathFactory() const {
+        return path_factory_;
+    }
+
     std::shared_ptr<PredicateFilter> GetNonPartitionPredicate() const {
         return scan_->GetNonPartitionPredicate();
     }
@@ -97,7 +115,10 @@ class SnapshotReader {
         return scan_->GetPartitionPredicate();
     }
 
-    /// Get splits from `FileKind::ADD` files.
+    /// Get splits from `FileKind::ADD` files. A delta plan of an append table with deletion
+    /// vectors also gets a split for each bucket whose deletion vectors changed in the snapshot,
+    /// its before files are the data files with changed deletion vectors and its before deletion
+    /// files the previous ones, so that newly deleted rows can be read as deletes.
     Result<std::shared_ptr<Plan>> Read() const;
 
  private:
@@ -106,11 +127,31 @@ class SnapshotReader {
         const std::unique_ptr<SplitGenerator>& split_generator,
         FileStoreScan::RawPlan::GroupFiles&& grouped_data_files) const;
 
-    Result<std::vector<std::optional<DeletionFile>>> GetDeletionFiles(
+    /// Generate splits of a single (partition, bucket), `index_file_metas` are the deletion
+    /// vector index files of the bucket.
+    Result<std::vector<std::shared_ptr<Split>>> GenerateBucketSplits(
+        const std::optional<Snapshot>& snapshot, bool is_streaming,
+        const std::unique_ptr<SplitGenerator>& split_generator, const BinaryRow& partition,
+        int32_t bucket, const std::vector<ManifestEntry>& manifest_entries,
+        const std::vector<std::shared_ptr<IndexFileMeta>>& index_file_metas) const;
+
+    bool NeedReadDeletionVectorChanges(const std::optional<Snapshot>& snapshot) const;
+
+    Result<std::vector<std::shared_ptr<Split>>> GenerateDeletionVectorChangeSplits(
+        const Snapshot& snapshot, const std::unordered_set<std::string>& added_file_names) const;
+
+    Result<IndexFileHandler::IndexFileMetaGroups> ScanDeletionVectorIndex(
+        const Snapshot& snapshot) const;
+
+    /// Map each data file name in the deletion vector index files of a bucket to its deletion file.
+    Result<std::unordered_map<std::string, DeletionFile>> GetDeletionFileIndex(
         const BinaryRow& partition, int32_t bucket,
-        const std::vector<std::shared_ptr<DataFileMeta>>& data_files,
         const std::vector<std::shared_ptr<IndexFileMeta>>& index_file_metas) const;
 
+    static std::vector<std::optional<DeletionFile>> GetDeletionFiles(
+        const std::vector<std::shared_ptr<DataFileMeta>>& data_files,
+        const std::unordered_map<std::string, DeletionFile>& deletion_file_index);
+
  private:
     std::shared_ptr<FileStoreScan> scan_;
     std::shared_ptr<FileStorePathFactory> path_factory_;
@@ -23,6 +23,7 @@
 #include "paimon/common/utils/serialization_utils.h"
 #include "paimon/core/global_index/indexed_split_impl.h"
 #include "paimon/core/io/data_file_meta_serializer.h"
+#include "paimon/core/table/source/compact_split_encoder.h"
 #include "paimon/core/table/source/data_split_impl.h"
 #include "paimon/core/table/source/deletion_file.h"
 #include "paimon/core/table/source/fallback_data_split.h"
@@ -170,6 +171,15 @@ Result<std::string> Split::Serialize(const std::shared_ptr<Split>& split,
     return std::string(bytes->data(), bytes->size());
 }
 
+Result<std::string> Split::SerializeCompact(const std::vector<std::shared_ptr<Split>>& splits,
+                                            const std::shared_ptr<MemoryPool>& pool) {
+    CompactSplitEncoder encoder(pool);
+    for (const auto& split : splits) {
+        PAIMON_RETURN_NOT_OK(encoder.Write(split));
+    }
+    return encoder.Finish();
+}
+
 Result<std::shared_ptr<Split>> Split::Deserialize(const char* buffer, size_t length,
                                                   const std::shared_ptr<MemoryPool>& pool) {
     auto input_stream = std::make_shared<ByteArrayInputStream>(buffer, length);
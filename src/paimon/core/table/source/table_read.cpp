@@ -22,14 +22,20 @@
 #include <string>
 #include <utility>
 
+#include "arrow/c/abi.h"
+#include "arrow/c/bridge.h"
 #include "fmt/format.h"
 #include "paimon/common/reader/concat_batch_reader.h"
+#include "paimon/common/reader/read_ahead_record_batch_reader.h"
 #include "paimon/common/types/data_field.h"
+#include "paimon/common/utils/arrow/status_utils.h"
 #include "paimon/common/utils/string_utils.h"
 #include "paimon/core/core_options.h"
 #include "paimon/core/operation/internal_read_context.h"
+#include "paimon/core/schema/schema_impl.h"
 #include "paimon/core/schema/schema_manager.h"
 #include "paimon/core/schema/table_schema.h"
+#include "paimon/core/table/source/abstract_table_read.h"
 #include "paimon/core/table/source/append_only_table_read.h"
 #include "paimon/core/table/source/fallback_table_read.h"
 #include "paimon/core/table/source/key_value_table_read.h"
@@ -50,8 +56,11 @@ Result<std::unique_ptr<InternalReadContext>> CreateInternalReadContext(
     const std::shared_ptr<ReadContext>& context, const std::string& branch) {
     std::map<std::string, std::string> tmp_options = context->GetOptions();
     std::shared_ptr<TableSchema> table_schema;
+    const auto& loaded_table_schema = context->GetLoadedTableSchema();
     const auto& specific_table_schema = context->GetSpecificTableSchema();
-    if (branch == BranchManager::DEFAULT_MAIN_BRANCH && specific_table_schema) {
+    if (branch == BranchManager::DEFAULT_MAIN_BRANCH && loaded_table_schema) {
+        PAIMON_ASSIGN_OR_RAISE(table_schema, SchemaImpl::GetTableSchema(*loaded_table_schema));
+    } else if (branch == BranchManager::DEFAULT_MAIN_BRANCH && specific_table_schema) {
         PAIMON_ASSIGN_OR_RAISE(table_schema,
                                TableSchema::CreateFromJson(specific_table_schema.value()));
     } else {
@@ -80,7 +89,7 @@ Result<std::unique_ptr<InternalReadContext>> CreateInternalReadContext(
     return InternalReadContext::Create(context, table_schema, options);
 }
 
-Result<std::unique_ptr<TableRead>> CreateTableRead(
+Result<std::unique_ptr<AbstractTableRead>> CreateTableRead(
     const std::shared_ptr<InternalReadContext>& internal_context,
     const std::shared_ptr<MemoryPool>& memory_pool, const std::shared_ptr<Executor>& executor) {
     const auto& core_options = internal_context->GetCoreOptions();
@@ -123,7 +132,7 @@ Result<std::unique_ptr<TableRead>> TableRead::Create(std::unique_ptr<ReadContext
     PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<InternalReadContext> internal_context,
                            CreateInternalReadContext(context, context->GetBranch()));
 
-    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<TableRead> table_read,
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<AbstractTableRead> table_read,
                            CreateTableRead(internal_context, memory_pool, executor));
 
     std::optional<std::string> scan_fallback_branch =
@@ -137,7 +146,7 @@ Result<std::unique_ptr<TableRead>> TableRead::Create(std::unique_ptr<ReadContext
         std::shared_ptr<InternalReadContext> fallback_context,
         CreateInternalReadContext(context, /*branch=*/scan_fallback_branch.value()));
 
-    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<TableRead> fallback_table_read,
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<AbstractTableRead> fallback_table_read,
                            CreateTableRead(fallback_context, memory_pool, executor));
     return std::make_unique<FallbackTableRead>(std::move(table_read),
                                                std::move(fallback_table_read), memory_pool);
@@ -154,4 +163,46 @@ Result<std::unique_ptr<BatchReader>> TableRead::CreateReader(
     return std::make_unique<ConcatBatchReader>(std::move(batch_readers), pool_);
 }
 
+Result<std::unique_ptr<BatchReader>> TableRead::CreateKeyOrderedReader(
+    const std::vector<std::shared_ptr<Split>>& splits) {
+    auto* table_read = dynamic_cast<AbstractTableRead*>(this);
+    if (table_read == nullptr) {
+        return Status::NotImplemented("key ordered read is only supported by built-in table read");
+    }
+    PAIMON_ASSIGN_OR_RAISE(std::vector<std::unique_ptr<BatchReader>> readers,
+                           table_read->CreateKeyOrderedReaders(splits));
+    return table_read->MergeKeyOrderedReaders(std::move(readers));
+}
+
+Result<std::unique_ptr<ArrowArrayStream>> TableRead::CreateArrowArrayStream(
+    const std::vector<std::shared_ptr<Split>>& splits, uint32_t max_read_ahead_batches,
+    uint64_t max_read_ahead_bytes) {
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<BatchReader> reader, CreateReader(splits));
+    return ExportArrowArrayStream(std::move(reader), max_read_ahead_batches, max_read_ahead_bytes);
+}
+
+Result<std::unique_ptr<ArrowArrayStream>> TableRead::CreateArrowArrayStream(
+    const std::shared_ptr<Split>& split, uint32_t max_read_ahead_batches,
+    uint64_t max_read_ahead_bytes) {
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<BatchReader> reader, CreateReader(split));
+    return ExportArrowArrayStream(std::move(reader), max_read_ahead_batches, max_read_ahead_bytes);
+}
+
+Result<std::unique_ptr<ArrowArrayStream>> TableRead::ExportArrowArrayStream(
+    std::unique_ptr<BatchReader>&& reader, uint32_t max_read_ahead_batches,
+    uint64_t max_read_ahead_bytes) const {
+    const auto* table_read = dynamic_cast<const AbstractTableRead*>(this);
+    if (table_read == nullptr) {
+        return Status::NotImplemented("arrow array stream is only supported by built-in table read");
+    }
+    PAIMON_ASSIGN_OR_RAISE(
+        std::shared_ptr<ReadAheadRecordBatchReader> read_ahead_reader,
+        ReadAheadRecordBatchReader::Create(std::move(reader), table_read->OutputSchema(),
+                                           max_read_ahead_batches, max_read_ahead_bytes));
+    auto stream = std::make_unique<ArrowArrayStream>();
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(
+        arrow::ExportRecordBatchReader(std::move(read_ahead_reader), stream.get()));
+    return stream;
+}
+
 }  // namespace paimon
@@ -17,20 +17,32 @@
 #include "paimon/table/source/table_read.h"
 
 #include <map>
+#include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
+#include "arrow/api.h"
 #include "gtest/gtest.h"
 #include "paimon/core/core_options.h"
 #include "paimon/core/operation/abstract_split_read.h"
 #include "paimon/core/operation/split_read.h"
+#include "paimon/core/table/source/abstract_table_read.h"
 #include "paimon/core/table/source/append_only_table_read.h"
+#include "paimon/core/table/source/fallback_data_split.h"
+#include "paimon/core/table/source/fallback_table_read.h"
 #include "paimon/core/table/source/key_value_table_read.h"
 #include "paimon/defs.h"
+#include "paimon/memory/memory_pool.h"
 #include "paimon/predicate/literal.h"
 #include "paimon/predicate/predicate_builder.h"
 #include "paimon/read_context.h"
+#include "paimon/scan_context.h"
 #include "paimon/status.h"
+#include "paimon/table/source/data_split.h"
+#include "paimon/table/source/plan.h"
+#include "paimon/table/source/table_scan.h"
+#include "paimon/testing/utils/read_result_collector.h"
 #include "paimon/testing/utils/testharness.h"
 
 namespace paimon::test {
@@ -153,4 +165,43 @@ TEST(TableReadTest, TestMergeOptions) {
         {"manifest.format", "orc"}, {"file.format", "orc"}};
     ASSERT_EQ(expected_options, core_options.ToMap());
 }
+
+TEST(TableReadTest, TestFallbackKeyOrderedRead) {
+    std::string path = paimon::test::GetDataDir() +
+                       "/orc/pk_table_scan_and_read_mor.db/pk_table_scan_and_read_mor/";
+    ScanContextBuilder scan_context_builder(path);
+    ASSERT_OK_AND_ASSIGN(auto scan_context, scan_context_builder.Finish());
+    ASSERT_OK_AND_ASSIGN(auto table_scan, TableScan::Create(std::move(scan_context)));
+    ASSERT_OK_AND_ASSIGN(auto plan, table_scan->CreatePlan());
+    ASSERT_GT(plan->Splits().size(), 1);
+
+    auto create_table_read = [&]() -> std::unique_ptr<AbstractTableRead> {
+        ReadContextBuilder context_builder(path);
+        context_builder.AddOption(Options::READ_BATCH_SIZE, "2");
+        auto read_context = context_builder.Finish().value();
+        auto table_read = TableRead::Create(std::move(read_context)).value();
+        return std::unique_ptr<AbstractTableRead>(
+            dynamic_cast<AbstractTableRead*>(table_read.release()));
+    };
+    auto read_all = [](TableRead* table_read, const std::vector<std::shared_ptr<Split>>& splits)
+        -> std::shared_ptr<arrow::Array> {
+        auto batch_reader = table_read->CreateKeyOrderedReader(splits).value();
+        auto read_result = ReadResultCollector::CollectResult(batch_reader.get()).value();
+        return arrow::Concatenate(read_result->chunks()).ValueOrDie();
+    };
+    auto expected = read_all(create_table_read().get(), plan->Splits());
+
+    // splits of both branches are merged in key order, as if read from a single branch
+    std::vector<std::shared_ptr<Split>> fallback_splits;
+    for (size_t i = 0; i < plan->Splits().size(); ++i) {
+        auto data_split = std::dynamic_pointer_cast<DataSplit>(plan->Splits()[i]);
+        ASSERT_TRUE(data_split);
+        fallback_splits.push_back(
+            std::make_shared<FallbackDataSplit>(data_split, /*is_fallback=*/i % 2 == 1));
+    }
+    FallbackTableRead fallback_table_read(create_table_read(), create_table_read(),
+                                          GetDefaultPool());
+    auto result = read_all(&fallback_table_read, fallback_splits);
+    ASSERT_TRUE(expected->Equals(result)) << result->ToString();
+}
 }  // namespace paimon::test
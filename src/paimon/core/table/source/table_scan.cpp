@@ -30,10 +30,12 @@
 #include "paimon/core/manifest/index_manifest_file.h"
 #include "paimon/core/manifest/manifest_file.h"
 #include "paimon/core/manifest/manifest_list.h"
+#include "paimon/core/manifest/partition_stats_file.h"
 #include "paimon/core/operation/append_only_file_store_scan.h"
 #include "paimon/core/operation/data_evolution_file_store_scan.h"
 #include "paimon/core/operation/file_store_scan.h"
 #include "paimon/core/operation/key_value_file_store_scan.h"
+#include "paimon/core/schema/schema_impl.h"
 #include "paimon/core/schema/schema_manager.h"
 #include "paimon/core/schema/schema_validation.h"
 #include "paimon/core/schema/table_schema.h"
@@ -44,14 +46,17 @@
 #include "paimon/core/table/source/data_evolution_split_generator.h"
 #include "paimon/core/table/source/data_table_batch_scan.h"
 #include "paimon/core/table/source/data_table_stream_scan.h"
+#include "paimon/core/table/source/fallback_batch_scan.h"
 #include "paimon/core/table/source/merge_tree_split_generator.h"
 #include "paimon/core/table/source/snapshot/snapshot_reader.h"
 #include "paimon/core/table/source/split_generator.h"
+#include "paimon/core/utils/branch_manager.h"
 #include "paimon/core/utils/field_mapping.h"
 #include "paimon/core/utils/fields_comparator.h"
 #include "paimon/core/utils/file_store_path_factory.h"
 #include "paimon/core/utils/index_file_path_factories.h"
 #include "paimon/core/utils/snapshot_manager.h"
+#include "paimon/defs.h"
 #include "paimon/format/file_format.h"
 #include "paimon/result.h"
 #include "paimon/scan_context.h"
@@ -63,6 +68,7 @@ class Schema;
 
 namespace paimon {
 class Executor;
+class FileSystem;
 class MemoryPool;
 
 class TableScanImpl {
@@ -72,12 +78,14 @@ class TableScanImpl {
         const std::shared_ptr<arrow::Schema>& arrow_schema,
         const std::shared_ptr<TableSchema>& table_schema, const CoreOptions& core_options,
         const std::shared_ptr<Executor>& executor, const std::shared_ptr<MemoryPool>& memory_pool,
-        const ScanContext* context) {
+        const std::string& table_path, const std::string& branch,
+        const std::shared_ptr<ScanFilter>& scan_filter) {
         auto fs = core_options.GetFileSystem();
         auto manifest_file_format = core_options.GetManifestFormat();
-        auto snapshot_manager = std::make_shared<SnapshotManager>(fs, context->GetPath());
-        // TODO(liancheng.lsz): support fallback branch in scan
-        auto schema_manager = std::make_shared<SchemaManager>(fs, context->GetPath());
+        // snapshots and schemas are maintained per branch, while data files and manifests of all
+        // branches are under the table root
+        auto snapshot_manager = std::make_shared<SnapshotManager>(fs, table_path, branch);
+        auto schema_manager = std::make_shared<SchemaManager>(fs, table_path, branch);
         PAIMON_ASSIGN_OR_RAISE(
             std::shared_ptr<ManifestList> manifest_list,
             ManifestList::Create(fs, manifest_file_format, core_options.GetManifestCompression(),
@@ -90,19 +98,37 @@ class TableScanImpl {
             ManifestFile::Create(fs, manifest_file_format, core_options.GetManifestCompression(),
                                  path_factory, core_options.GetManifestTargetFileSize(),
                                  memory_pool, core_options, partition_schema));
+        std::unique_ptr<FileStoreScan> scan;
         if (table_schema->PrimaryKeys().empty()) {
             if (core_options.DataEvolutionEnabled()) {
-                return DataEvolutionFileStoreScan::Create(
-                    snapshot_manager, schema_manager, manifest_list, manifest_file, table_schema,
-                    arrow_schema, context->GetScanFilters(), core_options, executor, memory_pool);
+                PAIMON_ASSIGN_OR_RAISE(
+                    scan, DataEvolutionFileStoreScan::Create(
+                              snapshot_manager, schema_manager, manifest_list, manifest_file,
+                              table_schema, arrow_schema, scan_filter,
+                              core_options, executor, memory_pool));
+            } else {
+                PAIMON_ASSIGN_OR_RAISE(
+                    scan, AppendOnlyFileStoreScan::Create(
+                              snapshot_manager, schema_manager, manifest_list, manifest_file,
+                              table_schema, arrow_schema, scan_filter,
+                              core_options, executor, memory_pool));
             }
-            return AppendOnlyFileStoreScan::Create(
-                snapshot_manager, schema_manager, manifest_list, manifest_file, table_schema,
-                arrow_schema, context->GetScanFilters(), core_options, executor, memory_pool);
+        } else {
+            PAIMON_ASSIGN_OR_RAISE(
+                scan, KeyValueFileStoreScan::Create(snapshot_manager, schema_manager,
+                                                    manifest_list, manifest_file, table_schema,
+                                                    arrow_schema, scan_filter, core_options,
+                                                    executor, memory_pool));
         }
-        return KeyValueFileStoreScan::Create(
-            snapshot_manager, schema_manager, manifest_list, manifest_file, table_schema,
-            arrow_schema, context->GetScanFilters(), core_options, executor, memory_pool);
+        // partition stats file is referenced by snapshots, reading it does not depend on whether
+        // the current writer maintains it
+        PAIMON_ASSIGN_OR_RAISE(
+            std::shared_ptr<PartitionStatsFile> partition_stats_file,
+            PartitionStatsFile::Create(fs, manifest_file_format,
+                                       core_options.GetManifestCompression(), path_factory,
+                                       memory_pool));
+        scan->WithPartitionStatsFile(partition_stats_file);
+        return scan;
     }
 
     static Result<std::unique_ptr<SplitGenerator>> CreateSplitGenerator(
@@ -147,6 +173,168 @@ class TableScanImpl {
         return std::make_unique<IndexFileHandler>(
             std::move(index_manifest_file), std::make_shared<IndexFilePathFactories>(path_factory));
     }
+
+    static Result<std::shared_ptr<TableSchema>> LoadTableSchema(
+        const std::shared_ptr<FileSystem>& fs, const std::string& table_path,
+        const std::string& branch, const std::shared_ptr<Schema>& loaded_schema) {
+        std::shared_ptr<TableSchema> table_schema;
+        if (loaded_schema) {
+            PAIMON_ASSIGN_OR_RAISE(table_schema, SchemaImpl::GetTableSchema(*loaded_schema));
+        } else {
+            SchemaManager schema_manager(fs, table_path, branch);
+            PAIMON_ASSIGN_OR_RAISE(std::optional<std::shared_ptr<TableSchema>> latest_table_schema,
+                                   schema_manager.Latest());
+            if (latest_table_schema == std::nullopt) {
+                if (BranchManager::IsMainBranch(branch)) {
+                    return Status::Invalid("not found latest schema");
+                }
+                return Status::Invalid(
+                    fmt::format("not found latest schema in branch {}", branch));
+            }
+            table_schema = latest_table_schema.value();
+        }
+        if (table_schema->Id() != TableSchema::FIRST_SCHEMA_ID &&
+            !table_schema->PrimaryKeys().empty()) {
+            return Status::NotImplemented(
+                "do not support schema evolution in pk table while scan process");
+        }
+        return table_schema;
+    }
+
+    static Status ValidateScan(const std::shared_ptr<TableSchema>& table_schema,
+                               const std::shared_ptr<arrow::Schema>& arrow_schema,
+                               const CoreOptions& core_options, const ScanContext* context) {
+        // validate options
+        if (core_options.GetBucket() == -1) {
+            if (!table_schema->PrimaryKeys().empty()) {
+                return Status::NotImplemented(
+                    fmt::format("do not support pk table bucket={} in scan process",
+                                core_options.GetBucket()));
+            }
+        } else if (core_options.GetBucket() < 1 &&
+                   !SchemaValidation::IsPostponeBucketTable(*table_schema,
+                                                            core_options.GetBucket())) {
+            return Status::Invalid(
+                fmt::format("do not support bucket={} in scan process", core_options.GetBucket()));
+        }
+        // validate schema and scan filter
+        if (context->GetScanFilters() && context->GetScanFilters()->GetPredicate()) {
+            PAIMON_RETURN_NOT_OK(PredicateValidator::ValidatePredicateWithSchema(
+                *arrow_schema, context->GetScanFilters()->GetPredicate(),
+                /*validate_field_idx=*/false));
+            PAIMON_RETURN_NOT_OK(PredicateValidator::ValidatePredicateWithLiterals(
+                context->GetScanFilters()->GetPredicate()));
+        }
+        return Status::OK();
+    }
+
+    static Result<std::shared_ptr<FileStorePathFactory>> CreatePathFactory(
+        const std::shared_ptr<TableSchema>& table_schema,
+        const std::shared_ptr<arrow::Schema>& arrow_schema, const CoreOptions& core_options,
+        const ScanContext* context) {
+        PAIMON_ASSIGN_OR_RAISE(std::vector<std::string> external_paths,
+                               core_options.CreateExternalPaths());
+        return FileStorePathFactory::Create(
+            context->GetPath(), arrow_schema, table_schema->PartitionKeys(),
+            core_options.GetPartitionDefaultName(), core_options.GetWriteFileFormat()->Identifier(),
+            core_options.DataFilePrefix(), core_options.LegacyPartitionNameEnabled(),
+            external_paths, core_options.IndexFileInDataFileDir(), context->GetMemoryPool());
+    }
+
+    static Result<std::shared_ptr<SnapshotReader>> CreateSnapshotReader(
+        const std::shared_ptr<FileStorePathFactory>& path_factory,
+        const std::shared_ptr<arrow::Schema>& arrow_schema,
+        const std::shared_ptr<TableSchema>& table_schema, const CoreOptions& core_options,
+        const std::string& branch, const ScanContext* context) {
+        PAIMON_ASSIGN_OR_RAISE(
+            std::shared_ptr<FileStoreScan> file_store_scan,
+            CreateFileStoreScan(path_factory, arrow_schema, table_schema, core_options,
+                                context->GetExecutor(), context->GetMemoryPool(),
+                                context->GetPath(), branch, context->GetScanFilters()));
+        PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<SplitGenerator> split_generator,
+                               CreateSplitGenerator(table_schema, core_options, context));
+        PAIMON_ASSIGN_OR_RAISE(
+            std::unique_ptr<IndexFileHandler> index_file_handler,
+            CreateIndexFileHandler(core_options, path_factory, context->GetMemoryPool()));
+        return std::make_shared<SnapshotReader>(file_store_scan, path_factory,
+                                                std::move(split_generator),
+                                                std::move(index_file_handler));
+    }
+
+    static Result<std::unique_ptr<TableScan>> CreateFallbackBatchScan(
+        std::unique_ptr<TableScan>&& main_scan, const std::shared_ptr<TableSchema>& table_schema,
+        const std::shared_ptr<arrow::Schema>& arrow_schema, const CoreOptions& core_options,
+        const std::shared_ptr<FileStorePathFactory>& path_factory,
+        const std::string& fallback_branch, const ScanContext* context) {
+        // A partition is covered by the main branch as long as it has files, whatever the
+        // predicate is, so partitions of the main branch are listed with partition filters only.
+        std::shared_ptr<ScanFilter> partition_scan_filter;
+        if (context->GetScanFilters()) {
+            partition_scan_filter = std::make_shared<ScanFilter>(
+                /*predicate=*/nullptr, context->GetScanFilters()->GetPartitionFilters(),
+                /*bucket_filter=*/std::nullopt);
+        }
+        PAIMON_ASSIGN_OR_RAISE(
+            std::unique_ptr<FileStoreScan> main_partition_scan,
+            CreateFileStoreScan(path_factory, arrow_schema, table_schema, core_options,
+                                context->GetExecutor(), context->GetMemoryPool(),
+                                context->GetPath(), BranchManager::DEFAULT_MAIN_BRANCH,
+                                partition_scan_filter));
+
+        PAIMON_ASSIGN_OR_RAISE(
+            std::shared_ptr<TableSchema> fallback_schema,
+            LoadTableSchema(core_options.GetFileSystem(), context->GetPath(), fallback_branch,
+                            /*loaded_schema=*/nullptr));
+        // splits of both branches are arbitrated by their serialized partitions
+        PAIMON_ASSIGN_OR_RAISE(std::vector<DataField> partition_fields,
+                               table_schema->GetFields(table_schema->PartitionKeys()));
+        PAIMON_ASSIGN_OR_RAISE(std::vector<DataField> fallback_partition_fields,
+                               fallback_schema->GetFields(fallback_schema->PartitionKeys()));
+        bool same_partition = partition_fields.size() == fallback_partition_fields.size();
+        for (size_t i = 0; same_partition && i < partition_fields.size(); ++i) {
+            same_partition =
+                partition_fields[i].Name() == fallback_partition_fields[i].Name() &&
+                partition_fields[i].Type()->Equals(fallback_partition_fields[i].Type());
+        }
+        if (!same_partition) {
+            return Status::Invalid(
+                fmt::format("partition keys of main branch and fallback branch {} are different",
+                            fallback_branch));
+        }
+
+        // snapshot ids are local to a branch, the fallback branch is always read from its latest
+        // snapshot
+        auto fallback_options = fallback_schema->Options();
+        for (const auto& [key, value] : context->GetOptions()) {
+            if (key == Options::SCAN_SNAPSHOT_ID || key == Options::SCAN_MODE ||
+                key == Options::SCAN_FALLBACK_BRANCH) {
+                continue;
+            }
+            fallback_options[key] = value;
+        }
+        fallback_options[Options::BRANCH] = fallback_branch;
+        PAIMON_ASSIGN_OR_RAISE(CoreOptions fallback_core_options,
+                               CoreOptions::FromMap(fallback_options));
+        auto fallback_arrow_schema =
+            DataField::ConvertDataFieldsToArrowSchema(fallback_schema->Fields());
+        PAIMON_RETURN_NOT_OK(
+            ValidateScan(fallback_schema, fallback_arrow_schema, fallback_core_options, context));
+        PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<FileStorePathFactory> fallback_path_factory,
+                               CreatePathFactory(fallback_schema, fallback_arrow_schema,
+                                                 fallback_core_options, context));
+        PAIMON_ASSIGN_OR_RAISE(
+            std::shared_ptr<SnapshotReader> fallback_snapshot_reader,
+            CreateSnapshotReader(fallback_path_factory, fallback_arrow_schema, fallback_schema,
+                                 fallback_core_options, fallback_branch, context));
+        // partitions covered by the main branch are excluded from the fallback snapshot reader
+        // before planning, so all splits of the fallback branch are kept and the limit applies
+        auto fallback_scan = std::make_unique<DataTableBatchScan>(
+            /*pk_table=*/!fallback_schema->PrimaryKeys().empty(), fallback_core_options,
+            fallback_snapshot_reader, context->GetLimit());
+        return std::make_unique<FallbackBatchScan>(
+            std::move(main_scan), std::move(main_partition_scan), std::move(fallback_scan),
+            fallback_snapshot_reader);
+    }
 };
 
 Result<std::unique_ptr<TableScan>> TableScan::Create(std::unique_ptr<ScanContext> context) {
@@ -162,79 +350,50 @@ Result<std::unique_ptr<TableScan>> TableScan::Create(std::unique_ptr<ScanContext
 
     // load schema
     PAIMON_ASSIGN_OR_RAISE(CoreOptions tmp_options, CoreOptions::FromMap(context->GetOptions()));
-    SchemaManager schema_manager(tmp_options.GetFileSystem(), context->GetPath());
-    PAIMON_ASSIGN_OR_RAISE(std::optional<std::shared_ptr<TableSchema>> latest_table_schema,
-                           schema_manager.Latest());
-    if (latest_table_schema == std::nullopt) {
-        return Status::Invalid("not found latest schema");
-    }
-    const auto& table_schema = latest_table_schema.value();
-    if (table_schema->Id() != TableSchema::FIRST_SCHEMA_ID &&
-        !table_schema->PrimaryKeys().empty()) {
-        return Status::NotImplemented(
-            "do not support schema evolution in pk table while scan process");
-    }
+    PAIMON_ASSIGN_OR_RAISE(
+        std::shared_ptr<TableSchema> table_schema,
+        TableScanImpl::LoadTableSchema(tmp_options.GetFileSystem(), context->GetPath(),
+                                       BranchManager::DEFAULT_MAIN_BRANCH,
+                                       context->GetTableSchema()));
     // merge options
     auto options = table_schema->Options();
     for (const auto& [key, value] : context->GetOptions()) {
         options[key] = value;
     }
     PAIMON_ASSIGN_OR_RAISE(CoreOptions core_options, CoreOptions::FromMap(options));
-    // validate options
-    if (core_options.GetBucket() == -1) {
-        if (!table_schema->PrimaryKeys().empty()) {
-            return Status::NotImplemented(fmt::format(
-                "do not support pk table bucket={} in scan process", core_options.GetBucket()));
-        }
-    } else if (core_options.GetBucket() < 1 &&
-               !SchemaValidation::IsPostponeBucketTable(*table_schema, core_options.GetBucket())) {
-        return Status::Invalid(
-            fmt::format("do not support bucket={} in scan process", core_options.GetBucket()));
-    }
-
-    // validate schema and scan filter
     auto arrow_schema = DataField::ConvertDataFieldsToArrowSchema(table_schema->Fields());
-    if (context->GetScanFilters() && context->GetScanFilters()->GetPredicate()) {
-        PAIMON_RETURN_NOT_OK(PredicateValidator::ValidatePredicateWithSchema(
-            *arrow_schema, context->GetScanFilters()->GetPredicate(),
-            /*validate_field_idx=*/false));
-        PAIMON_RETURN_NOT_OK(PredicateValidator::ValidatePredicateWithLiterals(
-            context->GetScanFilters()->GetPredicate()));
-    }
-    PAIMON_ASSIGN_OR_RAISE(std::vector<std::string> external_paths,
-                           core_options.CreateExternalPaths());
+    PAIMON_RETURN_NOT_OK(
+        TableScanImpl::ValidateScan(table_schema, arrow_schema, core_options, context.get()));
+
     PAIMON_ASSIGN_OR_RAISE(
         std::shared_ptr<FileStorePathFactory> path_factory,
-        FileStorePathFactory::Create(
-            context->GetPath(), arrow_schema, table_schema->PartitionKeys(),
-            core_options.GetPartitionDefaultName(), core_options.GetWriteFileFormat()->Identifier(),
-            core_options.DataFilePrefix(), core_options.LegacyPartitionNameEnabled(),
-            external_paths, core_options.IndexFileInDataFileDir(), context->GetMemoryPool()));
-
-    PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<FileStoreScan> file_store_scan,
-                           TableScanImpl::CreateFileStoreScan(
-                               path_factory, arrow_schema, table_schema, core_options,
-                               context->GetExecutor(), context->GetMemoryPool(), context.get()));
+        TableScanImpl::CreatePathFactory(table_schema, arrow_schema, core_options, context.get()));
     PAIMON_ASSIGN_OR_RAISE(
-        std::unique_ptr<SplitGenerator> split_generator,
-        TableScanImpl::CreateSplitGenerator(table_schema, core_options, context.get()));
-    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<IndexFileHandler> index_file_handler,
-                           TableScanImpl::CreateIndexFileHandler(core_options, path_factory,
-                                                                 context->GetMemoryPool()));
-    auto snapshot_reader = std::make_shared<SnapshotReader>(
-        file_store_scan, path_factory, std::move(split_generator), std::move(index_file_handler));
+        std::shared_ptr<SnapshotReader> snapshot_reader,
+        TableScanImpl::CreateSnapshotReader(path_factory, arrow_schema, table_schema, core_options,
+                                            BranchManager::DEFAULT_MAIN_BRANCH, context.get()));
     if (context->IsStreamingMode()) {
         return std::make_unique<DataTableStreamScan>(core_options, snapshot_reader);
     }
     auto batch_scan =
         std::make_unique<DataTableBatchScan>(/*pk_table=*/!table_schema->PrimaryKeys().empty(),
                                              core_options, snapshot_reader, context->GetLimit());
+    std::unique_ptr<TableScan> main_scan;
     if (!core_options.DataEvolutionEnabled()) {
-        return batch_scan;
+        main_scan = std::move(batch_scan);
+    } else {
+        main_scan = std::make_unique<DataEvolutionBatchScan>(
+            context->GetPath(), snapshot_reader, std::move(batch_scan),
+            context->GetGlobalIndexResult(), core_options, context->GetMemoryPool(),
+            context->GetExecutor());
+    }
+    std::optional<std::string> fallback_branch = core_options.GetScanFallbackBranch();
+    if (fallback_branch == std::nullopt) {
+        return main_scan;
     }
-    return std::make_unique<DataEvolutionBatchScan>(
-        context->GetPath(), snapshot_reader, std::move(batch_scan), context->GetGlobalIndexResult(),
-        core_options, context->GetMemoryPool(), context->GetExecutor());
+    return TableScanImpl::CreateFallbackBatchScan(std::move(main_scan), table_schema, arrow_schema,
+                                                  core_options, path_factory,
+                                                  fallback_branch.value(), context.get());
 }
 
 }  // namespace paimon
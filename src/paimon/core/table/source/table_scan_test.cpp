@@ -16,11 +16,15 @@
 
 #include "paimon/table/source/table_scan.h"
 
+#include <map>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "gtest/gtest.h"
+#include "paimon/common/data/binary_row.h"
+#include "paimon/core/table/source/data_split_impl.h"
+#include "paimon/core/table/source/fallback_data_split.h"
 #include "paimon/defs.h"
 #include "paimon/scan_context.h"
 #include "paimon/status.h"
@@ -57,4 +61,42 @@ TEST(TableScanTest, TestNoSchemaEvolution) {
     ASSERT_NOK_WITH_MSG(TableScan::Create(std::move(context)), "do not support schema evolution");
 }
 
+TEST(TableScanTest, TestFallbackBranch) {
+    // main branch has partition pt=1, fallback branch "test" has partition pt=2
+    std::string path = paimon::test::GetDataDir() +
+                       "/orc/append_table_with_append_pt_branch.db/"
+                       "append_table_with_append_pt_branch/";
+    ScanContextBuilder builder(path);
+    ASSERT_OK_AND_ASSIGN(auto context, builder.Finish());
+    ASSERT_OK_AND_ASSIGN(auto table_scan, TableScan::Create(std::move(context)));
+    ASSERT_OK_AND_ASSIGN(auto plan, table_scan->CreatePlan());
+    ASSERT_TRUE(plan->SnapshotId());
+
+    std::map<int32_t, bool> partition_to_fallback;
+    for (const auto& split : plan->Splits()) {
+        auto fallback_split = std::dynamic_pointer_cast<FallbackDataSplit>(split);
+        ASSERT_TRUE(fallback_split);
+        auto data_split = std::dynamic_pointer_cast<DataSplitImpl>(fallback_split->GetSplit());
+        ASSERT_TRUE(data_split);
+        partition_to_fallback[data_split->Partition().GetInt(0)] = fallback_split->IsFallback();
+    }
+    std::map<int32_t, bool> expected = {{1, false}, {2, true}};
+    ASSERT_EQ(expected, partition_to_fallback);
+
+    // partitions of the main branch are never planned from the fallback branch
+    ScanContextBuilder partition_builder(path);
+    partition_builder.SetPartitionFilter({{{"pt", "1"}}});
+    ASSERT_OK_AND_ASSIGN(auto partition_context, partition_builder.Finish());
+    ASSERT_OK_AND_ASSIGN(auto partition_scan, TableScan::Create(std::move(partition_context)));
+    ASSERT_OK_AND_ASSIGN(auto partition_plan, partition_scan->CreatePlan());
+    ASSERT_FALSE(partition_plan->Splits().empty());
+    for (const auto& split : partition_plan->Splits()) {
+        auto fallback_split = std::dynamic_pointer_cast<FallbackDataSplit>(split);
+        ASSERT_TRUE(fallback_split);
+        ASSERT_FALSE(fallback_split->IsFallback());
+    }
+    ASSERT_NOK_WITH_MSG(partition_scan->CreateBucketedPlan(),
+                        "bucketed plan is not supported with scan.fallback-branch");
+}
+
 }  // namespace paimon::test
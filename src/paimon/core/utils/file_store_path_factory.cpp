@@ -17,6 +17,7 @@
 #include "paimon/core/utils/file_store_path_factory.h"
 
 #include <cassert>
+#include <optional>
 
 #include "paimon/common/fs/external_path_provider.h"
 #include "paimon/common/memory/memory_segment.h"
@@ -132,6 +133,26 @@ std::unique_ptr<PathFactory> FileStorePathFactory::CreateIndexManifestFileFactor
     };
     return std::make_unique<IndexManifestFileFactory>(shared_from_this());
 }
+std::unique_ptr<PathFactory> FileStorePathFactory::CreatePartitionStatsFileFactory() {
+    class PartitionStatsFileFactory : public PathFactory {
+     public:
+        explicit PartitionStatsFileFactory(const std::shared_ptr<FileStorePathFactory>& factory)
+            : factory_(factory) {
+            assert(factory_);
+        }
+
+        std::string NewPath() const override {
+            return factory_->NewPartitionStatsFile();
+        }
+        std::string ToPath(const std::string& file_name) const override {
+            return factory_->ToManifestFilePath(file_name);
+        }
+
+     private:
+        std::shared_ptr<FileStorePathFactory> factory_;
+    };
+    return std::make_unique<PartitionStatsFileFactory>(shared_from_this());
+}
 
 Result<std::unique_ptr<IndexPathFactory>> FileStorePathFactory::CreateIndexFileFactory(
     const BinaryRow& partition, int32_t bucket) {
@@ -208,25 +229,27 @@ Result<std::string> FileStorePathFactory::GetPartitionString(const BinaryRow& pa
     if (partition.GetSegments().size() == 0) {
         return Status::Invalid("invalid binary row partition");
     }
-    auto iter = row_to_str_cache_.find(partition);
-    if (PAIMON_LIKELY(iter != row_to_str_cache_.end())) {
-        return iter->second;
+    std::optional<std::string> cached = row_to_str_cache_.Find(partition);
+    if (PAIMON_LIKELY(cached != std::nullopt)) {
+        return std::move(cached).value();
     }
     std::vector<std::pair<std::string, std::string>> part_values;
     PAIMON_ASSIGN_OR_RAISE(part_values, partition_computer_->GeneratePartitionVector(partition));
     PAIMON_ASSIGN_OR_RAISE(std::string part_str,
                            PartitionPathUtils::GeneratePartitionPath(part_values))
-    return row_to_str_cache_.insert({partition, part_str}).first->second;
+    row_to_str_cache_.Insert(partition, part_str);
+    return part_str;
 }
 
 Result<BinaryRow> FileStorePathFactory::ToBinaryRow(
     const std::map<std::string, std::string>& partition) const {
-    auto iter = map_to_row_cache_.find(partition);
-    if (PAIMON_LIKELY(iter != map_to_row_cache_.end())) {
-        return iter->second;
+    std::optional<BinaryRow> cached_row = map_to_row_cache_.Find(partition);
+    if (PAIMON_LIKELY(cached_row != std::nullopt)) {
+        return std::move(cached_row).value();
     }
     PAIMON_ASSIGN_OR_RAISE(BinaryRow row, partition_computer_->ToBinaryRow(partition));
-    return map_to_row_cache_.insert({partition, row}).first->second;
+    map_to_row_cache_.Insert(partition, row);
+    return row;
 }
 
 Result<std::vector<std::string>> FileStorePathFactory::GetHierarchicalPartitionPath(
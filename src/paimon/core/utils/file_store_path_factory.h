@@ -28,6 +28,8 @@
 #include "arrow/c/bridge.h"
 #include "paimon/common/data/binary_row.h"
 #include "paimon/common/utils/binary_row_partition_computer.h"
+#include "paimon/common/utils/concurrent_hash_map.h"
+#include "paimon/common/utils/murmurhash_utils.h"
 #include "paimon/common/utils/path_util.h"
 #include "paimon/core/index/index_path_factory.h"
 #include "paimon/memory/memory_pool.h"
@@ -68,6 +70,7 @@ class FileStorePathFactory : public std::enable_shared_from_this<FileStorePathFa
     std::unique_ptr<PathFactory> CreateManifestFileFactory();
     std::unique_ptr<PathFactory> CreateManifestListFactory();
     std::unique_ptr<PathFactory> CreateIndexManifestFileFactory();
+    std::unique_ptr<PathFactory> CreatePartitionStatsFileFactory();
     Result<std::unique_ptr<IndexPathFactory>> CreateIndexFileFactory(const BinaryRow& partition,
                                                                      int32_t bucket);
     std::unique_ptr<IndexPathFactory> CreateGlobalIndexFileFactory();
@@ -109,6 +112,11 @@ class FileStorePathFactory : public std::enable_shared_from_this<FileStorePathFa
             ManifestPath(root_),
             "index-manifest-" + uuid_ + "-" + std::to_string(index_manifest_count_.fetch_add(1)));
     }
+    std::string NewPartitionStatsFile() const {
+        return PathUtil::JoinPath(ManifestPath(root_),
+                                  "partition-stats-" + uuid_ + "-" +
+                                      std::to_string(partition_stats_count_.fetch_add(1)));
+    }
     std::string NewIndexFile() const {
         return PathUtil::JoinPath(IndexPath(root_),
                                   IndexPathFactory::INDEX_PREFIX + uuid_ + "-" +
@@ -119,6 +127,16 @@ class FileStorePathFactory : public std::enable_shared_from_this<FileStorePathFa
             StatisticsPath(root_),
             "stats-" + uuid_ + "-" + std::to_string(stats_file_count_.fetch_add(1)));
     }
+    std::string NewColumnSketchesFile() const {
+        return PathUtil::JoinPath(StatisticsPath(root_),
+                                  "column-sketches-" + uuid_ + "-" +
+                                      std::to_string(stats_file_count_.fetch_add(1)));
+    }
+    std::string NewBucketSketchesFile() const {
+        return PathUtil::JoinPath(StatisticsPath(root_),
+                                  "bucket-sketches-" + uuid_ + "-" +
+                                      std::to_string(stats_file_count_.fetch_add(1)));
+    }
     std::string ToManifestFilePath(const std::string& file_name) const {
         return PathUtil::JoinPath(ManifestPath(root_), file_name);
     }
@@ -142,6 +160,37 @@ class FileStorePathFactory : public std::enable_shared_from_this<FileStorePathFa
     Result<std::unique_ptr<ExternalPathProvider>> CreateExternalPathProvider(
         const BinaryRow& partition, int32_t bucket) const;
 
+ private:
+    class BinaryRowHashCompare {
+     public:
+        size_t hash(const BinaryRow& key) const {
+            return std::hash<BinaryRow>{}(key);
+        }
+
+        bool equal(const BinaryRow& a, const BinaryRow& b) const {
+            return a == b;
+        }
+    };
+
+    class PartitionSpecHashCompare {
+     public:
+        size_t hash(const std::map<std::string, std::string>& key) const {
+            int32_t ret = MurmurHashUtils::DEFAULT_SEED;
+            for (const auto& [name, value] : key) {
+                ret = MurmurHashUtils::HashUnsafeBytes(reinterpret_cast<const void*>(name.data()),
+                                                       /*offset=*/0, name.size(), ret);
+                ret = MurmurHashUtils::HashUnsafeBytes(reinterpret_cast<const void*>(value.data()),
+                                                       /*offset=*/0, value.size(), ret);
+            }
+            return ret;
+        }
+
+        bool equal(const std::map<std::string, std::string>& a,
+                   const std::map<std::string, std::string>& b) const {
+            return a == b;
+        }
+    };
+
  private:
     std::string root_;
     std::string format_identifier_;
@@ -154,12 +203,17 @@ class FileStorePathFactory : public std::enable_shared_from_this<FileStorePathFa
     mutable std::atomic<int32_t> manifest_file_count_ = 0;
     mutable std::atomic<int32_t> manifest_list_count_ = 0;
     mutable std::atomic<int32_t> index_manifest_count_ = 0;
+    mutable std::atomic<int32_t> partition_stats_count_ = 0;
     std::shared_ptr<std::atomic<int32_t>> index_file_count_ =
         std::make_shared<std::atomic<int32_t>>(0);
     mutable std::atomic<int32_t> stats_file_count_ = 0;
 
-    mutable std::map<std::map<std::string, std::string>, BinaryRow> map_to_row_cache_;
-    mutable std::unordered_map<BinaryRow, std::string> row_to_str_cache_;
+    // partition rows are looked up by concurrent writes
+    mutable ConcurrentHashMap<std::map<std::string, std::string>, BinaryRow,
+                              PartitionSpecHashCompare>
+        map_to_row_cache_;
+    // partition strings are looked up by concurrent split generation
+    mutable ConcurrentHashMap<BinaryRow, std::string, BinaryRowHashCompare> row_to_str_cache_;
 };
 
 }  // namespace paimon
@@ -17,6 +17,7 @@
 #include "paimon/core/utils/file_store_path_factory.h"
 
 #include <optional>
+#include <thread>
 #include <variant>
 
 #include "arrow/type.h"
@@ -452,4 +453,39 @@ TEST_F(FileStorePathFactoryTest, TestCreateIndexFileFactory) {
                       file_store_path_factory->uuid_ + "-0");
     }
 }
+
+TEST_F(FileStorePathFactoryTest, TestConcurrentBucketPath) {
+    auto dir = UniqueTestDirectory::Create();
+    ASSERT_TRUE(dir);
+    auto path_factory = CreateFactory(dir->Str());
+    auto pool = GetDefaultPool();
+    std::vector<BinaryRow> partitions;
+    for (int32_t i = 0; i < 16; ++i) {
+        partitions.push_back(BinaryRowGenerator::GenerateRow({i % 2 == 0, i}, pool.get()));
+    }
+    std::vector<std::string> expected;
+    for (const auto& partition : partitions) {
+        ASSERT_OK_AND_ASSIGN(std::string path, path_factory->BucketPath(partition, 0));
+        expected.push_back(path);
+    }
+    // fresh factory so that the partition string cache is populated concurrently
+    path_factory = CreateFactory(dir->Str());
+    std::vector<std::vector<std::string>> actual(4);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < actual.size(); ++t) {
+        threads.emplace_back([&, t]() {
+            for (const auto& partition : partitions) {
+                auto path = path_factory->BucketPath(partition, 0);
+                actual[t].push_back(path.ok() ? path.value() : "");
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (const auto& paths : actual) {
+        ASSERT_EQ(paths, expected);
+    }
+}
+
 }  // namespace paimon::test
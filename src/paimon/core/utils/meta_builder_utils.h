@@ -0,0 +1,106 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "arrow/api.h"
+#include "arrow/util/checked_cast.h"
+#include "paimon/common/data/binary_row.h"
+#include "paimon/common/utils/arrow/status_utils.h"
+#include "paimon/common/utils/serialization_utils.h"
+#include "paimon/memory/bytes.h"
+#include "paimon/memory/memory_pool.h"
+#include "paimon/status.h"
+
+namespace paimon {
+
+/// Utils to append meta (e.g., manifest entries) to arrow builders of their data types directly.
+/// Values are appended exactly as `MetaToArrowArrayConverter` converts them from the `BinaryRow`
+/// produced by `ObjectSerializer::ToRow()`.
+class MetaBuilderUtils {
+ public:
+    MetaBuilderUtils() = delete;
+    ~MetaBuilderUtils() = delete;
+
+    template <typename BuilderType>
+    static BuilderType* FieldBuilder(arrow::StructBuilder* builder, int32_t field_index) {
+        return arrow::internal::checked_cast<BuilderType*>(builder->field_builder(field_index));
+    }
+
+    /// Append `value` to the `field_index`-th field of `builder`, or null if `value` is empty.
+    template <typename BuilderType, typename ValueType>
+    static Status AppendOptional(arrow::StructBuilder* builder, int32_t field_index,
+                                 const std::optional<ValueType>& value) {
+        auto* field_builder = FieldBuilder<BuilderType>(builder, field_index);
+        if (value == std::nullopt) {
+            PAIMON_RETURN_NOT_OK_FROM_ARROW(field_builder->AppendNull());
+        } else {
+            PAIMON_RETURN_NOT_OK_FROM_ARROW(field_builder->Append(value.value()));
+        }
+        return Status::OK();
+    }
+
+    /// Append `row` serialized by `SerializationUtils::SerializeBinaryRow()`.
+    static Status AppendBinaryRow(const BinaryRow& row, MemoryPool* pool,
+                                  arrow::BinaryBuilder* builder) {
+        std::shared_ptr<Bytes> bytes = SerializationUtils::SerializeBinaryRow(row, pool);
+        PAIMON_RETURN_NOT_OK_FROM_ARROW(builder->Append(bytes->data(), bytes->size()));
+        return Status::OK();
+    }
+
+    static Status AppendBytes(const Bytes& bytes, arrow::BinaryBuilder* builder) {
+        PAIMON_RETURN_NOT_OK_FROM_ARROW(builder->Append(bytes.data(), bytes.size()));
+        return Status::OK();
+    }
+
+    /// Append a list of strings, empty strings are appended as null items.
+    static Status AppendStrings(const std::vector<std::optional<std::string>>& strs,
+                                arrow::ListBuilder* builder) {
+        PAIMON_RETURN_NOT_OK_FROM_ARROW(builder->Append());
+        auto* value_builder =
+            arrow::internal::checked_cast<arrow::StringBuilder*>(builder->value_builder());
+        for (const auto& str : strs) {
+            if (str == std::nullopt) {
+                PAIMON_RETURN_NOT_OK_FROM_ARROW(value_builder->AppendNull());
+            } else {
+                PAIMON_RETURN_NOT_OK_FROM_ARROW(value_builder->Append(str.value()));
+            }
+        }
+        return Status::OK();
+    }
+
+    /// Append a list of strings, or null if `strs` is empty.
+    static Status AppendStrings(const std::optional<std::vector<std::string>>& strs,
+                                arrow::ListBuilder* builder) {
+        if (strs == std::nullopt) {
+            PAIMON_RETURN_NOT_OK_FROM_ARROW(builder->AppendNull());
+            return Status::OK();
+        }
+        PAIMON_RETURN_NOT_OK_FROM_ARROW(builder->Append());
+        auto* value_builder =
+            arrow::internal::checked_cast<arrow::StringBuilder*>(builder->value_builder());
+        PAIMON_RETURN_NOT_OK_FROM_ARROW(value_builder->AppendValues(strs.value()));
+        return Status::OK();
+    }
+};
+
+}  // namespace paimon
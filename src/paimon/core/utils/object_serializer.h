@@ -25,6 +25,9 @@
 #include "paimon/common/io/memory_segment_output_stream.h"
 #include "paimon/io/data_input_stream.h"
 
+namespace arrow {
+class StructBuilder;
+}  // namespace arrow
 struct ArrowArray;
 
 namespace paimon {
@@ -45,6 +48,18 @@ class ObjectSerializer {
     /// Convert an `InternalRow` to `T`.
     virtual Result<T> FromRow(const InternalRow& row_data) const = 0;
 
+    /// @return Whether `AppendTo()` is supported, otherwise records are converted to arrow arrays
+    /// through `ToRow()`.
+    virtual bool SupportAppendTo() const {
+        return false;
+    }
+
+    /// Append a `T` to a struct builder of `GetDataType()` directly, without encoding it to a
+    /// `BinaryRow` first. The appended value is the same as the one converted from `ToRow()`.
+    virtual Status AppendTo(const T& record, arrow::StructBuilder* builder) const {
+        return Status::NotImplemented("AppendTo is not supported by the serializer");
+    }
+
     /// Get the number of fields.
     int32_t NumFields() const {
         return data_type_->num_fields();
@@ -24,8 +24,10 @@
 
 #include "arrow/c/bridge.h"
 #include "arrow/c/helpers.h"
+#include "arrow/util/checked_cast.h"
 #include "paimon/common/data/columnar/columnar_row.h"
 #include "paimon/common/utils/arrow/arrow_utils.h"
+#include "paimon/common/utils/arrow/mem_utils.h"
 #include "paimon/common/utils/arrow/status_utils.h"
 #include "paimon/common/utils/path_util.h"
 #include "paimon/common/utils/scope_guard.h"
@@ -69,12 +71,20 @@ class ObjectsFile {
 
     Result<std::pair<std::string, int64_t>> WriteWithoutRolling(const std::vector<T>& records);
 
+ protected:
+    /// Convert records to a struct array of the data type of `serializer_`. Records are appended
+    /// to the arrow builders directly if the serializer supports it, otherwise they are encoded
+    /// to `BinaryRow`s first.
+    Result<std::shared_ptr<arrow::Array>> ToArrowArray(const T* records, size_t num_records);
+
  protected:
     std::shared_ptr<PathFactory> path_factory_;
     std::shared_ptr<MemoryPool> pool_;
     std::unique_ptr<ObjectSerializer<T>> serializer_;
     std::shared_ptr<WriterBuilder> writer_builder_;
     std::unique_ptr<MetaToArrowArrayConverter> to_array_converter_;
+    std::unique_ptr<arrow::MemoryPool> arrow_pool_;
+    std::unique_ptr<arrow::StructBuilder> array_builder_;
 
  private:
     std::shared_ptr<FileSystem> file_system_;
@@ -154,22 +164,47 @@ Status ObjectsFile<T>::Read(const std::string& file_name,
     return Status::OK();
 }
 
+template <typename T>
+Result<std::shared_ptr<arrow::Array>> ObjectsFile<T>::ToArrowArray(const T* records,
+                                                                   size_t num_records) {
+    if (!serializer_->SupportAppendTo()) {
+        std::vector<BinaryRow> rows;
+        rows.reserve(num_records);
+        for (size_t i = 0; i < num_records; i++) {
+            PAIMON_ASSIGN_OR_RAISE(BinaryRow row, serializer_->ToRow(records[i]));
+            rows.push_back(std::move(row));
+        }
+        if (!to_array_converter_) {
+            PAIMON_ASSIGN_OR_RAISE(to_array_converter_, MetaToArrowArrayConverter::Create(
+                                                            serializer_->GetDataType(), pool_));
+        }
+        return to_array_converter_->NextBatch(rows);
+    }
+    if (!array_builder_) {
+        arrow_pool_ = GetArrowPool(pool_);
+        std::unique_ptr<arrow::ArrayBuilder> array_builder;
+        PAIMON_RETURN_NOT_OK_FROM_ARROW(
+            arrow::MakeBuilder(arrow_pool_.get(), serializer_->GetDataType(), &array_builder));
+        array_builder_ =
+            arrow::internal::checked_pointer_cast<arrow::StructBuilder>(std::move(array_builder));
+    }
+    ScopeGuard guard([this]() { array_builder_->Reset(); });
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(array_builder_->Reserve(num_records));
+    for (size_t i = 0; i < num_records; i++) {
+        PAIMON_RETURN_NOT_OK(serializer_->AppendTo(records[i], array_builder_.get()));
+    }
+    std::shared_ptr<arrow::Array> array;
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(array_builder_->Finish(&array));
+    guard.Release();
+    return array;
+}
+
 template <typename T>
 Result<std::pair<std::string, int64_t>> ObjectsFile<T>::WriteWithoutRolling(
     const std::vector<T>& records) {
     std::string file_path = path_factory_->NewPath();
-    std::vector<BinaryRow> rows;
-    rows.reserve(records.size());
-    for (const auto& record : records) {
-        PAIMON_ASSIGN_OR_RAISE(BinaryRow row, serializer_->ToRow(record));
-        rows.push_back(std::move(row));
-    }
-    if (!to_array_converter_) {
-        PAIMON_ASSIGN_OR_RAISE(to_array_converter_, MetaToArrowArrayConverter::Create(
-                                                        serializer_->GetDataType(), pool_));
-    }
     PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<arrow::Array> array,
-                           to_array_converter_->NextBatch(rows));
+                           ToArrowArray(records.data(), records.size()));
     ::ArrowArray c_array;
     PAIMON_RETURN_NOT_OK_FROM_ARROW(arrow::ExportArray(*array, &c_array));
     ScopeGuard guard([&]() {
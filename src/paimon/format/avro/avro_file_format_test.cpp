@@ -17,6 +17,7 @@
 #include <cstdint>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -29,6 +30,7 @@
 #include "paimon/common/utils/arrow/mem_utils.h"
 #include "paimon/common/utils/path_util.h"
 #include "paimon/core/utils/manifest_meta_reader.h"
+#include "paimon/format/column_stats.h"
 #include "paimon/format/file_format.h"
 #include "paimon/format/file_format_factory.h"
 #include "paimon/format/format_writer.h"
@@ -112,4 +114,54 @@ TEST_P(AvroFileFormatTest, TestSimple) {
     ASSERT_TRUE(output_array->Equals(input_array));
 }
 
+TEST(AvroFileFormatStatsTest, TestCollectStatsWhileWriting) {
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<FileFormat> file_format,
+                         FileFormatFactory::Get("avro", {}));
+    arrow::FieldVector fields = {
+        arrow::field("f0", arrow::boolean()), arrow::field("f1", arrow::int32()),
+        arrow::field("field_null", arrow::int32()), arrow::field("f2", arrow::utf8()),
+        arrow::field("f3", arrow::binary())};
+    auto schema = arrow::schema(fields);
+    auto data_type = arrow::struct_(fields);
+
+    ::ArrowSchema c_schema;
+    ASSERT_TRUE(arrow::ExportSchema(*schema, &c_schema).ok());
+    ASSERT_OK_AND_ASSIGN(auto writer_builder, file_format->CreateWriterBuilder(&c_schema, 1024));
+    std::shared_ptr<FileSystem> fs = std::make_shared<LocalFileSystem>();
+    auto dir = ::paimon::test::UniqueTestDirectory::Create();
+    ASSERT_TRUE(dir);
+    ASSERT_OK_AND_ASSIGN(
+        std::shared_ptr<OutputStream> out,
+        fs->Create(PathUtil::JoinPath(dir->Str(), "file.avro"), /*overwrite=*/false));
+    ASSERT_OK_AND_ASSIGN(auto writer, writer_builder->Build(out, "zstd"));
+
+    for (const auto& data_str : {R"([[true, 2147483647, null, "20250327", "banana"],
+                                     [false, null, null, "20250327", "dog"]])",
+                                 R"([[null, -2147483648, null, null, null],
+                                     [true, 7, null, "20250326", "mouse"]])"}) {
+        auto input_array =
+            arrow::ipc::internal::json::ArrayFromJSON(data_type, data_str).ValueOr(nullptr);
+        ASSERT_TRUE(input_array);
+        ::ArrowArray c_array;
+        ASSERT_TRUE(arrow::ExportArray(*input_array, &c_array).ok());
+        ASSERT_OK(writer->AddBatch(&c_array));
+    }
+    ASSERT_OK(writer->Flush());
+    ASSERT_OK(writer->Finish());
+    ASSERT_OK(out->Flush());
+    ASSERT_OK(out->Close());
+
+    auto stats_aware_writer = dynamic_cast<StatsAwareFormatWriter*>(writer.get());
+    ASSERT_TRUE(stats_aware_writer);
+    ASSERT_OK_AND_ASSIGN(std::optional<ColumnStatsVector> stats,
+                         stats_aware_writer->GetColumnStats(GetDefaultPool()));
+    ASSERT_TRUE(stats);
+    ASSERT_EQ(5, stats->size());
+    ASSERT_EQ("min false, max true, null count 1", (*stats)[0]->ToString());
+    ASSERT_EQ("min -2147483648, max 2147483647, null count 1", (*stats)[1]->ToString());
+    ASSERT_EQ("min null, max null, null count 4", (*stats)[2]->ToString());
+    ASSERT_EQ("min 20250326, max 20250327, null count 1", (*stats)[3]->ToString());
+    ASSERT_EQ("min null, max null, null count 1", (*stats)[4]->ToString());
+}
+
 }  // namespace paimon::avro::test
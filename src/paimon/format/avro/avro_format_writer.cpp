@@ -19,6 +19,7 @@
 #include <cassert>
 #include <exception>
 #include <memory>
+#include <optional>
 #include <utility>
 #include <vector>
 
@@ -49,11 +50,12 @@ namespace paimon::avro {
 AvroFormatWriter::AvroFormatWriter(
     const std::shared_ptr<::avro::DataFileWriter<::avro::GenericDatum>>& file_writer,
     const ::avro::ValidSchema& avro_schema, const std::shared_ptr<arrow::DataType>& data_type,
-    std::unique_ptr<AvroAdaptor> adaptor)
+    std::unique_ptr<AvroAdaptor> adaptor, std::unique_ptr<ColumnarStatsCollector> stats_collector)
     : writer_(file_writer),
       avro_schema_(avro_schema),
       data_type_(data_type),
-      adaptor_(std::move(adaptor)) {}
+      adaptor_(std::move(adaptor)),
+      stats_collector_(std::move(stats_collector)) {}
 
 Result<std::unique_ptr<AvroFormatWriter>> AvroFormatWriter::Create(
     std::unique_ptr<::avro::OutputStream> out, const std::shared_ptr<arrow::Schema>& schema,
@@ -65,8 +67,17 @@ Result<std::unique_ptr<AvroFormatWriter>> AvroFormatWriter::Create(
             std::move(out), avro_schema, DEFAULT_SYNC_INTERVAL, codec);
         auto data_type = arrow::struct_(schema->fields());
         auto adaptor = std::make_unique<AvroAdaptor>(data_type);
-        return std::unique_ptr<AvroFormatWriter>(
-            new AvroFormatWriter(writer, avro_schema, data_type, std::move(adaptor)));
+        // statistics are optional, do not fail the writer for types the collector not supports
+        std::unique_ptr<ColumnarStatsCollector> stats_collector;
+        Result<std::unique_ptr<ColumnarStatsCollector>> stats_collector_result =
+            ColumnarStatsCollector::Create(schema);
+        if (stats_collector_result.ok()) {
+            stats_collector = std::move(stats_collector_result).value();
+        } else if (!stats_collector_result.status().IsNotImplemented()) {
+            return stats_collector_result.status();
+        }
+        return std::unique_ptr<AvroFormatWriter>(new AvroFormatWriter(
+            writer, avro_schema, data_type, std::move(adaptor), std::move(stats_collector)));
     } catch (const ::avro::Exception& e) {
         return Status::Invalid(fmt::format("avro format writer create failed. {}", e.what()));
     } catch (const std::exception& e) {
@@ -111,6 +122,9 @@ Status AvroFormatWriter::AddBatch(ArrowArray* batch) {
     assert(batch);
     PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(std::shared_ptr<arrow::Array> arrow_array,
                                       arrow::ImportArray(batch, data_type_));
+    if (stats_collector_) {
+        PAIMON_RETURN_NOT_OK(stats_collector_->Collect(*arrow_array));
+    }
     PAIMON_ASSIGN_OR_RAISE(std::vector<::avro::GenericDatum> datums,
                            adaptor_->ConvertArrayToGenericDatums(arrow_array, avro_schema_));
     try {
@@ -128,4 +142,13 @@ Status AvroFormatWriter::AddBatch(ArrowArray* batch) {
     return Status::OK();
 }
 
+Result<std::optional<ColumnStatsVector>> AvroFormatWriter::GetColumnStats(
+    const std::shared_ptr<MemoryPool>& pool) {
+    if (!stats_collector_) {
+        return std::optional<ColumnStatsVector>();
+    }
+    PAIMON_ASSIGN_OR_RAISE(ColumnStatsVector stats, stats_collector_->GetResult());
+    return std::optional<ColumnStatsVector>(std::move(stats));
+}
+
 }  // namespace paimon::avro
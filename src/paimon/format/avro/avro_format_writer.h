@@ -19,11 +19,13 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <optional>
 
 #include "arrow/api.h"
 #include "avro/DataFile.hh"
 #include "avro/Stream.hh"
 #include "avro/ValidSchema.hh"
+#include "paimon/common/format/columnar_stats_collector.h"
 #include "paimon/format/avro/avro_adaptor.h"
 #include "paimon/format/format_writer.h"
 #include "paimon/metrics.h"
@@ -39,6 +41,7 @@ class GenericDatum;
 class OutputStream;
 }  // namespace avro
 namespace paimon {
+class MemoryPool;
 class Metrics;
 }  // namespace paimon
 struct ArrowArray;
@@ -46,7 +49,9 @@ struct ArrowArray;
 namespace paimon::avro {
 
 /// A `FormatWriter` implementation that writes data in Avro format.
-class AvroFormatWriter : public FormatWriter {
+///
+/// Avro files carry no column statistics, so they are collected from the written batches.
+class AvroFormatWriter : public StatsAwareFormatWriter {
  public:
     static Result<std::unique_ptr<AvroFormatWriter>> Create(
         std::unique_ptr<::avro::OutputStream> out, const std::shared_ptr<arrow::Schema>& schema,
@@ -64,19 +69,24 @@ class AvroFormatWriter : public FormatWriter {
         return metrics_;
     }
 
+    Result<std::optional<ColumnStatsVector>> GetColumnStats(
+        const std::shared_ptr<MemoryPool>& pool) override;
+
  private:
     static constexpr size_t DEFAULT_SYNC_INTERVAL = 16 * 1024;
 
     AvroFormatWriter(
         const std::shared_ptr<::avro::DataFileWriter<::avro::GenericDatum>>& file_writer,
         const ::avro::ValidSchema& avro_schema, const std::shared_ptr<arrow::DataType>& data_type,
-        std::unique_ptr<AvroAdaptor> adaptor);
+        std::unique_ptr<AvroAdaptor> adaptor,
+        std::unique_ptr<ColumnarStatsCollector> stats_collector);
 
     std::shared_ptr<::avro::DataFileWriter<::avro::GenericDatum>> writer_;
     ::avro::ValidSchema avro_schema_;
     std::shared_ptr<arrow::DataType> data_type_;
     std::shared_ptr<Metrics> metrics_;
     std::unique_ptr<AvroAdaptor> adaptor_;
+    std::unique_ptr<ColumnarStatsCollector> stats_collector_;
 };
 
 }  // namespace paimon::avro
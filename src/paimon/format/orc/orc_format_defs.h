@@ -34,6 +34,10 @@ static inline const char ORC_DICTIONARY_KEY_SIZE_THRESHOLD[] = "orc.dictionary-k
 static constexpr double DEFAULT_DICTIONARY_KEY_SIZE_THRESHOLD = 0.8;
 // default value of ORC_WRITE_ENABLE_METRICS is false
 static inline const char ORC_WRITE_ENABLE_METRICS[] = "orc.write.enable-metrics";
+// size of the file tail kept in memory by orc writer, which is used to fetch statistics of a
+// written file without re-opening it. 0 means statistics are always read from the written file.
+static inline const char ORC_WRITE_TAIL_BUFFER_SIZE[] = "orc.write.tail-buffer-size";
+static constexpr uint64_t DEFAULT_TAIL_BUFFER_SIZE = 1024 * 1024;
 // default value of ORC_TIMESTAMP_LTZ_LEGACY_TYPE is true. This option is used to be compatible with
 // the paimon-orc's old behavior for the `timestamp_ltz` data type. Details at
 // https://github.com/apache/paimon/issues/5066.
@@ -41,6 +41,9 @@
 #include "paimon/format/orc/orc_format_defs.h"
 #include "paimon/format/orc/orc_memory_pool.h"
 #include "paimon/format/orc/orc_metrics.h"
+#include "paimon/format/orc/orc_output_stream_impl.h"
+#include "paimon/format/orc/orc_stats_extractor.h"
+#include "paimon/format/orc/orc_tail_input_stream.h"
 #include "paimon/macros.h"
 
 namespace paimon {
@@ -92,6 +95,13 @@ Result<std::unique_ptr<OrcFormatWriter>> OrcFormatWriter::Create(
             writer_metrics = std::make_unique<::orc::WriterMetrics>();
             writer_options.setWriterMetrics(writer_metrics.get());
         }
+        PAIMON_ASSIGN_OR_RAISE(uint64_t tail_buffer_size,
+                               OptionsUtils::GetValueFromMap<uint64_t>(
+                                   options, ORC_WRITE_TAIL_BUFFER_SIZE, DEFAULT_TAIL_BUFFER_SIZE));
+        if (auto orc_output_stream = dynamic_cast<OrcOutputStreamImpl*>(output_stream.get())) {
+            // enable before the writer is created, so that small files are kept from the header
+            orc_output_stream->EnableTailBuffer(tail_buffer_size);
+        }
         std::unique_ptr<::orc::Writer> writer =
             ::orc::createWriter(*orc_type, output_stream.get(), writer_options);
         assert(writer);
@@ -164,6 +174,7 @@ Status OrcFormatWriter::Finish() {
         writer_->close();
         writer_.reset();
         writer_metrics_.reset();
+        finished_length_ = output_stream_->getLength();
     } catch (const std::exception& e) {
         return Status::Invalid(
             fmt::format("orc format writer finish failed for file {}, with {} error",
@@ -176,6 +187,31 @@ Status OrcFormatWriter::Finish() {
     return Status::OK();
 }
 
+Result<std::optional<ColumnStatsVector>> OrcFormatWriter::GetColumnStats(
+    const std::shared_ptr<MemoryPool>& pool) {
+    if (finished_length_ < 0) {
+        return Status::Invalid("cannot get column stats before orc format writer finished");
+    }
+    auto orc_output_stream = dynamic_cast<OrcOutputStreamImpl*>(output_stream_.get());
+    if (orc_output_stream == nullptr || orc_output_stream->GetTailBuffer().empty()) {
+        return std::optional<ColumnStatsVector>();
+    }
+    bool out_of_range = false;
+    auto tail_input_stream = std::make_unique<OrcTailInputStream>(
+        orc_output_stream->getName(), finished_length_, orc_output_stream->GetTailBuffer(),
+        &out_of_range);
+    OrcStatsExtractor stats_extractor(arrow::schema(data_type_->fields()));
+    auto result = stats_extractor.ExtractFromStream(std::move(tail_input_stream), pool);
+    if (!result.ok()) {
+        if (out_of_range) {
+            // metadata and footer are larger than the kept tail, fall back to reading the file
+            return std::optional<ColumnStatsVector>();
+        }
+        return result.status();
+    }
+    return std::optional<ColumnStatsVector>(std::move(result).value().first);
+}
+
 Result<bool> OrcFormatWriter::ReachTargetSize(bool suggested_check, int64_t target_size) const {
     if (suggested_check) {
         PAIMON_ASSIGN_OR_RAISE(uint64_t length, GetEstimateLength());
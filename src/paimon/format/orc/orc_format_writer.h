@@ -19,6 +19,7 @@
 #include <cstdint>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 
 #include "arrow/api.h"
@@ -27,6 +28,7 @@
 #include "orc/Type.hh"
 #include "orc/Vector.hh"
 #include "orc/Writer.hh"
+#include "paimon/format/column_stats.h"
 #include "paimon/format/format_writer.h"
 #include "paimon/format/orc/orc_memory_pool.h"
 #include "paimon/metrics.h"
@@ -47,7 +49,7 @@ struct ArrowArray;
 
 namespace paimon::orc {
 /// A `FormatWriter` implementation that writes data in ORC format.
-class OrcFormatWriter : public FormatWriter {
+class OrcFormatWriter : public StatsAwareFormatWriter {
  public:
     static Result<std::unique_ptr<OrcFormatWriter>> Create(
         std::unique_ptr<::orc::OutputStream>&& output_stream, const arrow::Schema& schema,
@@ -64,6 +66,11 @@ class OrcFormatWriter : public FormatWriter {
 
     std::shared_ptr<Metrics> GetWriterMetrics() const override;
 
+    /// Statistics are parsed from the file tail kept in memory by the output stream. Returns
+    /// `std::nullopt` if the kept tail does not cover the metadata and footer of the file.
+    Result<std::optional<ColumnStatsVector>> GetColumnStats(
+        const std::shared_ptr<MemoryPool>& pool) override;
+
  private:
     OrcFormatWriter(const std::shared_ptr<OrcMemoryPool>& orc_memory_pool,
                     std::unique_ptr<::orc::OutputStream>&& output_stream,
@@ -92,5 +99,7 @@ class OrcFormatWriter : public FormatWriter {
     ::orc::WriterOptions writer_options_;
     std::shared_ptr<arrow::DataType> data_type_;
     std::shared_ptr<Metrics> metrics_;
+    // file length after finish, -1 if the writer is not finished
+    int64_t finished_length_ = -1;
 };
 }  // namespace paimon::orc
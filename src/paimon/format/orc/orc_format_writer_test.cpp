@@ -18,6 +18,7 @@
 
 #include <cstddef>
 #include <list>
+#include <optional>
 #include <utility>
 #include <vector>
 
@@ -39,6 +40,7 @@
 #include "paimon/format/orc/orc_input_stream_impl.h"
 #include "paimon/format/orc/orc_metrics.h"
 #include "paimon/format/orc/orc_output_stream_impl.h"
+#include "paimon/format/orc/orc_stats_extractor.h"
 #include "paimon/fs/file_system.h"
 #include "paimon/fs/local/local_file_system.h"
 #include "paimon/memory/memory_pool.h"
@@ -199,6 +201,56 @@ TEST_F(OrcFormatWriterTest, TestWriteWithVariousBatchSize) {
         }
     }
 }
+
+TEST_F(OrcFormatWriterTest, TestGetColumnStatsFromTailBuffer) {
+    auto test_root_dir = paimon::test::UniqueTestDirectory::Create();
+    ASSERT_TRUE(test_root_dir);
+    std::string test_root = test_root_dir->Str();
+    ASSERT_OK(file_system_->Mkdirs(test_root));
+    std::string file_name = test_root + "/test.orc";
+
+    auto schema_pair = PrepareArrowSchema();
+    const auto& arrow_schema = schema_pair.first;
+    const auto& struct_type = schema_pair.second;
+    // tail buffer size -> whether stats are available in memory
+    std::vector<std::pair<std::string, bool>> cases = {
+        {"1048576", true}, {"16", false}, {"0", false}};
+    for (const auto& [tail_buffer_size, expect_in_memory] : cases) {
+        std::map<std::string, std::string> options = {
+            {ORC_WRITE_TAIL_BUFFER_SIZE, tail_buffer_size}};
+        ASSERT_OK_AND_ASSIGN(std::shared_ptr<OutputStream> out,
+                             file_system_->Create(file_name, /*overwrite=*/true));
+        ASSERT_OK_AND_ASSIGN(std::unique_ptr<OrcOutputStreamImpl> output_stream,
+                             OrcOutputStreamImpl::Create(out));
+        ASSERT_OK_AND_ASSIGN(auto format_writer, OrcFormatWriter::Create(
+                                                     std::move(output_stream), arrow_schema,
+                                                     options, /*compression=*/"zstd",
+                                                     /*batch_size=*/10, pool_));
+        std::shared_ptr<OrcFormatWriter> shared_writer = std::move(format_writer);
+        ASSERT_NOK_WITH_MSG(shared_writer->GetColumnStats(pool_),
+                            "cannot get column stats before orc format writer finished");
+        AddRecordBatchOnce(shared_writer, struct_type, /*record_batch_size=*/10, /*offset=*/0);
+        AddRecordBatchOnce(shared_writer, struct_type, /*record_batch_size=*/10, /*offset=*/10);
+        ASSERT_OK(shared_writer->Finish());
+        ASSERT_OK(out->Flush());
+        ASSERT_OK(out->Close());
+
+        ASSERT_OK_AND_ASSIGN(std::optional<ColumnStatsVector> in_memory_stats,
+                             shared_writer->GetColumnStats(pool_));
+        ASSERT_EQ(expect_in_memory, in_memory_stats.has_value());
+        if (!expect_in_memory) {
+            continue;
+        }
+        OrcStatsExtractor stats_extractor(std::make_shared<arrow::Schema>(arrow_schema));
+        ASSERT_OK_AND_ASSIGN(ColumnStatsVector file_stats,
+                             stats_extractor.Extract(file_system_, file_name, pool_));
+        ASSERT_EQ(file_stats.size(), in_memory_stats->size());
+        for (size_t i = 0; i < file_stats.size(); ++i) {
+            ASSERT_EQ(file_stats[i]->ToString(), in_memory_stats.value()[i]->ToString());
+        }
+    }
+}
+
 TEST_F(OrcFormatWriterTest, TestPrepareOptionsFileCompression) {
     arrow::FieldVector fields;
     std::shared_ptr<arrow::DataType> data_type = arrow::struct_(fields);
@@ -57,6 +57,21 @@ void OrcOutputStreamImpl::write(const void* buf, size_t length) {
             fmt::format("write failed, expected length: {}, actual write length: {}", length,
                         write_len.value()));
     }
+    if (tail_capacity_ > 0) {
+        AppendToTailBuffer(static_cast<const char*>(buf), length);
+    }
+}
+
+void OrcOutputStreamImpl::AppendToTailBuffer(const char* buf, size_t length) {
+    if (length >= tail_capacity_) {
+        tail_buffer_.assign(buf + length - tail_capacity_, tail_capacity_);
+        return;
+    }
+    tail_buffer_.append(buf, length);
+    // trim lazily so that each written byte is moved at most once
+    if (tail_buffer_.size() > 2 * tail_capacity_) {
+        tail_buffer_.erase(0, tail_buffer_.size() - tail_capacity_);
+    }
 }
 
 void OrcOutputStreamImpl::close() {
@@ -20,6 +20,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <string_view>
 
 #include "orc/OrcFile.hh"
 #include "paimon/fs/file_system.h"
@@ -48,14 +49,30 @@ class OrcOutputStreamImpl : public ::orc::OutputStream {
     }
     void close() override;
 
+    /// Keep at least the last `capacity` bytes written to this stream in memory, so that the
+    /// file tail (metadata, footer and postscript) can be parsed after closing without reading
+    /// the file back. Must be called before anything is written.
+    void EnableTailBuffer(uint64_t capacity) {
+        tail_capacity_ = capacity;
+    }
+
+    /// @return The last bytes written to this stream, at most twice the capacity of tail buffer.
+    std::string_view GetTailBuffer() const {
+        return tail_buffer_;
+    }
+
  private:
     OrcOutputStreamImpl(const std::shared_ptr<paimon::OutputStream>& output_stream,
                         const std::string& name);
 
+    void AppendToTailBuffer(const char* buf, size_t length);
+
  private:
     static constexpr uint64_t ORC_NATURAL_WRITE_SIZE = 128 * 1024;
 
     std::shared_ptr<paimon::OutputStream> output_stream_;
     std::string file_name_;
+    uint64_t tail_capacity_ = 0;
+    std::string tail_buffer_;
 };
 }  // namespace paimon::orc
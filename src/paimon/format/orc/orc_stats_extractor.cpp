@@ -56,6 +56,14 @@ OrcStatsExtractor::ExtractWithFileInfo(const std::shared_ptr<FileSystem>& file_s
     assert(input_stream);
     PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<OrcInputStreamImpl> orc_input_stream,
                            OrcInputStreamImpl::Create(input_stream, DEFAULT_NATURAL_READ_SIZE));
+    return ExtractFromStream(std::move(orc_input_stream), pool);
+}
+
+Result<std::pair<ColumnStatsVector, FormatStatsExtractor::FileInfo>>
+OrcStatsExtractor::ExtractFromStream(std::unique_ptr<::orc::InputStream>&& orc_input_stream,
+                                     const std::shared_ptr<MemoryPool>& pool) {
+    assert(orc_input_stream);
+    std::string path = orc_input_stream->getName();
     try {
         ::orc::ReaderOptions reader_options;
         auto orc_pool = std::make_shared<OrcMemoryPool>(pool);
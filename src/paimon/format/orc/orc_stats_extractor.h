@@ -23,6 +23,7 @@
 
 #include "arrow/api.h"
 #include "orc/Common.hh"
+#include "orc/OrcFile.hh"
 #include "orc/Statistics.hh"
 #include "orc/Type.hh"
 #include "paimon/format/column_stats.h"
@@ -61,6 +62,12 @@ class OrcStatsExtractor : public FormatStatsExtractor {
         const std::shared_ptr<FileSystem>& file_system, const std::string& path,
         const std::shared_ptr<MemoryPool>& pool) override;
 
+    /// Extracts statistics for each column and `FileInfo` from an orc input stream, which reads
+    /// either a file on the file system or the file tail kept in memory by the orc writer.
+    Result<std::pair<ColumnStatsVector, FileInfo>> ExtractFromStream(
+        std::unique_ptr<::orc::InputStream>&& orc_input_stream,
+        const std::shared_ptr<MemoryPool>& pool);
+
  private:
     Result<std::unique_ptr<ColumnStats>> FetchColumnStatistics(
         const ::orc::ColumnStatistics* column_stats, const ::orc::Type* type,
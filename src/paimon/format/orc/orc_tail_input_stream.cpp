@@ -0,0 +1,41 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/format/orc/orc_tail_input_stream.h"
+
+#include <cstring>
+
+#include "fmt/format.h"
+#include "orc/Exceptions.hh"
+
+namespace paimon::orc {
+
+void OrcTailInputStream::read(void* buf, uint64_t length, uint64_t offset) {
+    uint64_t tail_offset = file_length_ - tail_.size();
+    if (offset < tail_offset || offset + length > file_length_) {
+        *out_of_range_ = true;
+        throw ::orc::ParseError(
+            fmt::format("read [{}, {}) out of kept file tail [{}, {}) of {}", offset,
+                        offset + length, tail_offset, file_length_, name_));
+    }
+    std::memcpy(buf, tail_.data() + (offset - tail_offset), length);
+}
+
+std::future<void> OrcTailInputStream::readAsync(void* buf, uint64_t length, uint64_t offset) {
+    throw ::orc::NotImplementedYet("do not support read async for orc tail input stream");
+}
+
+}  // namespace paimon::orc
@@ -0,0 +1,56 @@
+/*
+ * Copyright 2025-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <future>
+#include <string>
+#include <string_view>
+
+#include "orc/OrcFile.hh"
+
+namespace paimon::orc {
+/// An orc input stream which serves the tail of a just written file (metadata, footer and
+/// postscript) from the memory kept by `OrcOutputStreamImpl`, so that statistics can be parsed
+/// without re-opening the file. Reads before the kept tail fail and set `out_of_range`.
+class OrcTailInputStream : public ::orc::InputStream {
+ public:
+    /// @param tail Last bytes of the file, must outlive this stream.
+    /// @param out_of_range Set to true once a read falls outside the kept tail.
+    OrcTailInputStream(const std::string& name, uint64_t file_length, std::string_view tail,
+                       bool* out_of_range)
+        : name_(name), file_length_(file_length), tail_(tail), out_of_range_(out_of_range) {}
+
+    uint64_t getLength() const override {
+        return file_length_;
+    }
+    uint64_t getNaturalReadSize() const override {
+        return tail_.size();
+    }
+    void read(void* buf, uint64_t length, uint64_t offset) override;
+    std::future<void> readAsync(void* buf, uint64_t length, uint64_t offset) override;
+    const std::string& getName() const override {
+        return name_;
+    }
+
+ private:
+    std::string name_;
+    uint64_t file_length_;
+    std::string_view tail_;
+    bool* out_of_range_;
+};
+}  // namespace paimon::orc
@@ -25,7 +25,6 @@
 
 #include "arrow/array.h"
 #include "arrow/compute/api.h"
-#include "arrow/dataset/file_parquet.h"
 #include "arrow/record_batch.h"
 #include "arrow/type.h"
 #include "arrow/type_fwd.h"
@@ -19,15 +19,9 @@
 #include <cstddef>
 #include <unordered_map>
 
-#include "arrow/acero/options.h"
 #include "arrow/array/array_nested.h"
 #include "arrow/c/abi.h"
 #include "arrow/c/bridge.h"
-#include "arrow/compute/api.h"
-#include "arrow/dataset/dataset.h"
-#include "arrow/dataset/file_base.h"
-#include "arrow/dataset/file_parquet.h"
-#include "arrow/dataset/type_fwd.h"
 #include "arrow/io/caching.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/record_batch.h"
@@ -40,11 +34,14 @@
 #include "paimon/common/utils/options_utils.h"
 #include "paimon/format/parquet/parquet_field_id_converter.h"
 #include "paimon/format/parquet/parquet_format_defs.h"
+#include "paimon/format/parquet/parquet_row_group_filter.h"
 #include "paimon/format/parquet/parquet_timestamp_converter.h"
-#include "paimon/format/parquet/predicate_converter.h"
+#include "paimon/memory/memory_pool.h"
 #include "paimon/reader/batch_reader.h"
 #include "paimon/utils/roaring_bitmap32.h"
 #include "parquet/arrow/reader.h"
+#include "parquet/file_reader.h"
+#include "parquet/metadata.h"
 #include "parquet/properties.h"
 
 namespace arrow {
@@ -163,41 +160,11 @@ Result<std::vector<int32_t>> ParquetFileBatchReader::FilterRowGroupsByPredicate(
     if (!predicate) {
         return Status::Invalid("cannot pushdown an empty predicate");
     }
-    // convert paimon predicate to arrow expression
-    PAIMON_ASSIGN_OR_RAISE(
-        uint32_t predicate_node_count_limit,
-        OptionsUtils::GetValueFromMap<uint32_t>(options_, PARQUET_READ_PREDICATE_NODE_COUNT_LIMIT,
-                                                DEFAULT_PARQUET_READ_PREDICATE_NODE_COUNT_LIMIT));
-    PAIMON_ASSIGN_OR_RAISE(arrow::compute::Expression expr,
-                           PredicateConverter::Convert(predicate, predicate_node_count_limit));
-    PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(arrow::Expression bind_expr, expr.Bind(*file_schema));
-
-    // prepare file source
-    PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(int64_t file_length, input_stream_->GetSize());
-    auto file_source = arrow::dataset::FileSource(input_stream_, /*size=*/file_length);
-
-    // filter row group by arrow expression and row group meta
-    auto parquet_file_format = std::make_shared<arrow::dataset::ParquetFileFormat>();
-    PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(
-        std::shared_ptr<arrow::dataset::ParquetFileFragment> file_fragment,
-        parquet_file_format->MakeFragment(
-            file_source, /*partition_expression=*/PredicateConverter::AlwaysTrue(),
-            /*physical_schema=*/nullptr, /*row_groups=*/src_row_groups));
-    PAIMON_RETURN_NOT_OK_FROM_ARROW(
-        file_fragment->EnsureCompleteMetadata(reader_->GetFileReader()));
-    PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(arrow::dataset::FragmentVector target_fragments,
-                                      file_fragment->SplitByRowGroup(bind_expr));
-    std::vector<int32_t> target_row_groups;
-    target_row_groups.reserve(src_row_groups.size());
-    for (const auto& fragment : target_fragments) {
-        auto parquet_fragment = dynamic_cast<arrow::dataset::ParquetFileFragment*>(fragment.get());
-        if (!parquet_fragment) {
-            return Status::Invalid("cannot cast to ParquetFileFragment in ParquetFileBatchReader");
-        }
-        target_row_groups.insert(target_row_groups.end(), parquet_fragment->row_groups().begin(),
-                                 parquet_fragment->row_groups().end());
-    }
-    return target_row_groups;
+    // test predicate against row group statistics in parquet footer, which is already loaded
+    std::shared_ptr<::parquet::FileMetaData> file_metadata =
+        reader_->GetFileReader()->parquet_reader()->metadata();
+    return ParquetRowGroupFilter::Filter(predicate, file_schema, *file_metadata, src_row_groups,
+                                         GetDefaultPool());
 }
 
 Result<std::vector<int32_t>> ParquetFileBatchReader::FilterRowGroupsByBitmap(
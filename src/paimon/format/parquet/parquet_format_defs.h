@@ -45,14 +45,8 @@ static inline const char PARQUET_READ_CACHE_OPTION_PREFETCH_LIMIT[] =
 static inline const char PARQUET_READ_CACHE_OPTION_RANGE_SIZE_LIMIT[] =
     "parquet.read.cache-option.range-size-limit";
 
-// stack-overflow may happen while the number of predicate node is too large, limit the number of
-// predicate nodes. Predicate will not be pushdown when exceed limit.
-static inline const char PARQUET_READ_PREDICATE_NODE_COUNT_LIMIT[] =
-    "parquet.read.predicate-node-count-limit";
-
 static constexpr uint32_t DEFAULT_PARQUET_READ_CACHE_OPTION_PREFETCH_LIMIT = 0;
 static constexpr uint32_t DEFAULT_PARQUET_READ_CACHE_OPTION_RANGE_SIZE_LIMIT = 32 * 1024 * 1024;
-static constexpr uint32_t DEFAULT_PARQUET_READ_PREDICATE_NODE_COUNT_LIMIT = 512;
 
 class ParquetMetrics {
  public:
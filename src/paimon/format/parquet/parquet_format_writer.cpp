@@ -25,8 +25,10 @@
 #include "paimon/common/utils/arrow/status_utils.h"
 #include "paimon/format/parquet/parquet_format_defs.h"
 #include "paimon/format/parquet/parquet_output_stream_impl.h"
+#include "paimon/format/parquet/parquet_stats_extractor.h"
 #include "paimon/metrics.h"
 #include "parquet/arrow/writer.h"
+#include "parquet/metadata.h"
 #include "parquet/properties.h"
 
 namespace arrow {
@@ -76,6 +78,18 @@ Status ParquetFormatWriter::Finish() {
     return Status::OK();
 }
 
+Result<std::optional<ColumnStatsVector>> ParquetFormatWriter::GetColumnStats(
+    const std::shared_ptr<MemoryPool>& pool) {
+    std::shared_ptr<::parquet::FileMetaData> file_metadata = writer_->metadata();
+    if (file_metadata == nullptr) {
+        return Status::Invalid("cannot get column stats before parquet format writer finished");
+    }
+    ParquetStatsExtractor stats_extractor(schema_);
+    PAIMON_ASSIGN_OR_RAISE(ColumnStatsVector column_stats,
+                           stats_extractor.ExtractFromMetadata(*file_metadata, pool));
+    return std::optional<ColumnStatsVector>(std::move(column_stats));
+}
+
 Result<bool> ParquetFormatWriter::ReachTargetSize(bool suggested_check, int64_t target_size) const {
     if (suggested_check) {
         PAIMON_ASSIGN_OR_RAISE(const uint64_t length, GetEstimateLength());
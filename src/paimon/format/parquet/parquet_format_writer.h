@@ -18,8 +18,10 @@
 
 #include <cstdint>
 #include <memory>
+#include <optional>
 
 #include "paimon/common/utils/arrow/mem_utils.h"
+#include "paimon/format/column_stats.h"
 #include "paimon/format/format_writer.h"
 #include "paimon/format/parquet/parquet_output_stream_impl.h"
 #include "paimon/fs/file_system.h"
@@ -48,7 +50,7 @@ struct ArrowArray;
 
 namespace paimon::parquet {
 
-class ParquetFormatWriter : public FormatWriter {
+class ParquetFormatWriter : public StatsAwareFormatWriter {
  public:
     static Result<std::unique_ptr<ParquetFormatWriter>> Create(
         const std::shared_ptr<OutputStream>& output_stream,
@@ -68,6 +70,10 @@ class ParquetFormatWriter : public FormatWriter {
         return metrics_;
     }
 
+    /// Statistics are converted from the file metadata held by the parquet writer after closing.
+    Result<std::optional<ColumnStatsVector>> GetColumnStats(
+        const std::shared_ptr<MemoryPool>& pool) override;
+
  private:
     ParquetFormatWriter(std::unique_ptr<::parquet::arrow::FileWriter> writer,
                         const std::shared_ptr<ParquetOutputStreamImpl>& out,
@@ -17,6 +17,7 @@
 #include "paimon/format/parquet/parquet_format_writer.h"
 
 #include <map>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -38,6 +39,7 @@
 #include "paimon/common/utils/path_util.h"
 #include "paimon/format/parquet/parquet_field_id_converter.h"
 #include "paimon/format/parquet/parquet_format_defs.h"
+#include "paimon/format/parquet/parquet_stats_extractor.h"
 #include "paimon/fs/file_system.h"
 #include "paimon/fs/local/local_file_system.h"
 #include "paimon/memory/memory_pool.h"
@@ -259,6 +261,42 @@ TEST_F(ParquetFormatWriterTest, TestWriteMultipleTimes) {
     ASSERT_EQ(37, counter);
 }
 
+TEST_F(ParquetFormatWriterTest, TestGetColumnStatsFromMetadata) {
+    auto schema_pair = PrepareArrowSchema();
+    const auto& arrow_schema = schema_pair.first;
+    const auto& struct_type = schema_pair.second;
+
+    std::string file_path = PathUtil::JoinPath(dir_->Str(), "column_stats");
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<OutputStream> out,
+                         fs_->Create(file_path, /*overwrite=*/false));
+    ::parquet::WriterProperties::Builder builder;
+    // produce multiple row groups whose stats need to be merged
+    builder.max_row_group_length(7);
+    auto writer_properties = builder.build();
+    ASSERT_OK_AND_ASSIGN(
+        std::shared_ptr<ParquetFormatWriter> format_writer,
+        ParquetFormatWriter::Create(out, arrow_schema, writer_properties, arrow_pool_));
+    AddRecordBatchOnce(format_writer, struct_type, 10, 0);
+    AddRecordBatchOnce(format_writer, struct_type, 10, 10);
+    ASSERT_NOK_WITH_MSG(format_writer->GetColumnStats(pool_),
+                        "cannot get column stats before parquet format writer finished");
+    ASSERT_OK(format_writer->Finish());
+    ASSERT_OK(out->Flush());
+    ASSERT_OK(out->Close());
+
+    ASSERT_OK_AND_ASSIGN(std::optional<ColumnStatsVector> in_memory_stats,
+                         format_writer->GetColumnStats(pool_));
+    ASSERT_TRUE(in_memory_stats);
+    ParquetStatsExtractor stats_extractor(arrow_schema);
+    ASSERT_OK_AND_ASSIGN(ColumnStatsVector file_stats,
+                         stats_extractor.Extract(fs_, file_path, pool_));
+    ASSERT_EQ(3, in_memory_stats->size());
+    ASSERT_EQ(file_stats.size(), in_memory_stats->size());
+    for (size_t i = 0; i < file_stats.size(); ++i) {
+        ASSERT_EQ(file_stats[i]->ToString(), in_memory_stats.value()[i]->ToString());
+    }
+}
+
 TEST_F(ParquetFormatWriterTest, TestGetEstimateLength) {
     auto schema_pair = PrepareArrowSchema();
     const auto& arrow_schema = schema_pair.first;
@@ -0,0 +1,179 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/format/parquet/parquet_row_group_filter.h"
+
+#include <cstddef>
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+#include "fmt/format.h"
+#include "paimon/common/predicate/predicate_filter.h"
+#include "paimon/common/predicate/predicate_utils.h"
+#include "paimon/common/utils/field_type_utils.h"
+#include "paimon/core/stats/simple_stats.h"
+#include "paimon/core/stats/simple_stats_converter.h"
+#include "paimon/defs.h"
+#include "paimon/format/column_stats.h"
+#include "paimon/format/parquet/parquet_stats_extractor.h"
+#include "paimon/predicate/compound_predicate.h"
+#include "paimon/predicate/leaf_predicate.h"
+#include "paimon/predicate/predicate_builder.h"
+#include "paimon/status.h"
+#include "parquet/metadata.h"
+#include "parquet/schema.h"
+#include "parquet/statistics.h"
+
+namespace paimon::parquet {
+
+namespace {
+
+// Whether all leaves of `predicate` are on top-level primitive columns of `file_schema` with the
+// same type, collects the names of these columns to `field_names`.
+Result<bool> CanTestByStats(const std::shared_ptr<Predicate>& predicate,
+                            const arrow::Schema& file_schema, std::set<std::string>* field_names) {
+    if (auto compound_predicate = std::dynamic_pointer_cast<CompoundPredicate>(predicate)) {
+        for (const auto& child : compound_predicate->Children()) {
+            PAIMON_ASSIGN_OR_RAISE(bool testable, CanTestByStats(child, file_schema, field_names));
+            if (!testable) {
+                return false;
+            }
+        }
+        return true;
+    } else if (auto leaf_predicate = std::dynamic_pointer_cast<LeafPredicate>(predicate)) {
+        std::shared_ptr<arrow::Field> field =
+            file_schema.GetFieldByName(leaf_predicate->FieldName());
+        if (!field) {
+            return false;
+        }
+        Result<FieldType> field_type = FieldTypeUtils::ConvertToFieldType(field->type()->id());
+        if (!field_type.ok() || field_type.value() != leaf_predicate->GetFieldType()) {
+            return false;
+        }
+        switch (field_type.value()) {
+            case FieldType::ARRAY:
+            case FieldType::MAP:
+            case FieldType::STRUCT:
+            case FieldType::BLOB:
+                return false;
+            default:
+                field_names->insert(field->name());
+                return true;
+        }
+    }
+    return Status::Invalid(fmt::format(
+        "cannot cast predicate {} to CompoundPredicate or LeafPredicate", predicate->ToString()));
+}
+
+}  // namespace
+
+Result<std::vector<int32_t>> ParquetRowGroupFilter::Filter(
+    const std::shared_ptr<Predicate>& predicate, const std::shared_ptr<arrow::Schema>& file_schema,
+    const ::parquet::FileMetaData& file_metadata, const std::vector<int32_t>& src_row_groups,
+    const std::shared_ptr<MemoryPool>& pool) {
+    if (!predicate) {
+        return Status::Invalid("cannot filter row groups with an empty predicate");
+    }
+    std::vector<std::shared_ptr<Predicate>> testable_predicates;
+    std::set<std::string> field_names;
+    for (const auto& sub_predicate : PredicateUtils::SplitAnd(predicate)) {
+        std::set<std::string> sub_field_names;
+        PAIMON_ASSIGN_OR_RAISE(bool testable,
+                               CanTestByStats(sub_predicate, *file_schema, &sub_field_names));
+        if (testable) {
+            testable_predicates.push_back(sub_predicate);
+            field_names.insert(sub_field_names.begin(), sub_field_names.end());
+        }
+    }
+    if (testable_predicates.empty()) {
+        return src_row_groups;
+    }
+
+    // only the stats of columns referenced by predicate are converted, field indexes of predicate
+    // are remapped to these columns
+    const ::parquet::SchemaDescriptor* parquet_schema = file_metadata.schema();
+    std::map<std::string, int32_t> stats_field_name_to_idx;
+    arrow::FieldVector stats_fields;
+    std::vector<int32_t> column_indices;
+    std::vector<std::shared_ptr<::parquet::schema::PrimitiveNode>> primitive_nodes;
+    for (const auto& field : file_schema->fields()) {
+        if (field_names.find(field->name()) == field_names.end()) {
+            continue;
+        }
+        int32_t column_index = parquet_schema->ColumnIndex(field->name());
+        if (column_index < 0) {
+            return Status::Invalid(
+                fmt::format("cannot find column {} in parquet schema", field->name()));
+        }
+        stats_field_name_to_idx[field->name()] = static_cast<int32_t>(stats_fields.size());
+        stats_fields.push_back(field);
+        column_indices.push_back(column_index);
+        primitive_nodes.push_back(
+            arrow::internal::checked_pointer_cast<::parquet::schema::PrimitiveNode>(
+                parquet_schema->Column(column_index)->schema_node()));
+    }
+    auto stats_schema = arrow::schema(stats_fields);
+    PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<Predicate> testable_predicate,
+                           PredicateBuilder::And(testable_predicates));
+    PAIMON_ASSIGN_OR_RAISE(
+        std::shared_ptr<Predicate> stats_predicate,
+        PredicateUtils::CreatePickedFieldFilter(testable_predicate, stats_field_name_to_idx));
+    auto predicate_filter = std::dynamic_pointer_cast<PredicateFilter>(stats_predicate);
+    if (!predicate_filter) {
+        return Status::Invalid("cannot cast to predicate filter");
+    }
+
+    std::vector<int32_t> target_row_groups;
+    target_row_groups.reserve(src_row_groups.size());
+    std::vector<std::shared_ptr<ColumnStats>> row_group_stats(stats_fields.size());
+    for (int32_t row_group_idx : src_row_groups) {
+        if (row_group_idx < 0 || row_group_idx >= file_metadata.num_row_groups()) {
+            return Status::Invalid(
+                fmt::format("src row group {} not in row group meta", row_group_idx));
+        }
+        std::unique_ptr<::parquet::RowGroupMetaData> row_group =
+            file_metadata.RowGroup(row_group_idx);
+        for (size_t i = 0; i < stats_fields.size(); ++i) {
+            std::unique_ptr<::parquet::ColumnChunkMetaData> column_chunk =
+                row_group->ColumnChunk(column_indices[i]);
+            // missing stats are converted to unknown stats, which keep the row group
+            std::shared_ptr<::parquet::Statistics> parquet_stats;
+            if (column_chunk->is_stats_set()) {
+                parquet_stats = column_chunk->statistics();
+            }
+            PAIMON_ASSIGN_OR_RAISE(
+                row_group_stats[i],
+                ParquetStatsExtractor::ConvertColumnStats(parquet_stats, primitive_nodes[i],
+                                                          stats_fields[i]->type(), pool));
+        }
+        PAIMON_ASSIGN_OR_RAISE(SimpleStats stats,
+                               SimpleStatsConverter::ToBinary(row_group_stats, pool.get()));
+        PAIMON_ASSIGN_OR_RAISE(
+            bool predicate_result,
+            predicate_filter->Test(stats_schema, row_group->num_rows(), stats.MinValues(),
+                                   stats.MaxValues(), stats.NullCounts()));
+        if (predicate_result) {
+            target_row_groups.push_back(row_group_idx);
+        }
+    }
+    return target_row_groups;
+}
+
+}  // namespace paimon::parquet
@@ -0,0 +1,55 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/type_fwd.h"
+#include "paimon/result.h"
+
+namespace parquet {
+class FileMetaData;
+}  // namespace parquet
+
+namespace paimon {
+class MemoryPool;
+class Predicate;
+}  // namespace paimon
+
+namespace paimon::parquet {
+
+/// Prunes row groups of a parquet file by testing a predicate against the column statistics of
+/// each row group, in the same way as data files are filtered by their stats in a scan.
+class ParquetRowGroupFilter {
+ public:
+    ParquetRowGroupFilter() = delete;
+    ~ParquetRowGroupFilter() = delete;
+
+    /// Only the conjuncts of `predicate` whose fields are top-level primitive columns in
+    /// `file_schema` with the same type are tested, the others are assumed to be true.
+    ///
+    /// @return Row groups in `src_row_groups` which may contain rows matching the predicate.
+    static Result<std::vector<int32_t>> Filter(const std::shared_ptr<Predicate>& predicate,
+                                               const std::shared_ptr<arrow::Schema>& file_schema,
+                                               const ::parquet::FileMetaData& file_metadata,
+                                               const std::vector<int32_t>& src_row_groups,
+                                               const std::shared_ptr<MemoryPool>& pool);
+};
+
+}  // namespace paimon::parquet
@@ -0,0 +1,169 @@
+/*
+ * Copyright 2024-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/format/parquet/parquet_row_group_filter.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/api.h"
+#include "arrow/c/abi.h"
+#include "arrow/c/bridge.h"
+#include "arrow/ipc/json_simple.h"
+#include "gtest/gtest.h"
+#include "paimon/common/utils/arrow/mem_utils.h"
+#include "paimon/defs.h"
+#include "paimon/format/parquet/parquet_format_writer.h"
+#include "paimon/format/parquet/parquet_input_stream_impl.h"
+#include "paimon/fs/file_system.h"
+#include "paimon/memory/memory_pool.h"
+#include "paimon/predicate/literal.h"
+#include "paimon/predicate/predicate_builder.h"
+#include "paimon/testing/utils/testharness.h"
+#include "parquet/file_reader.h"
+#include "parquet/metadata.h"
+#include "parquet/properties.h"
+
+namespace paimon::parquet::test {
+
+class ParquetRowGroupFilterTest : public ::testing::Test {
+ public:
+    void SetUp() override {
+        pool_ = GetDefaultPool();
+        arrow_pool_ = GetArrowPool(pool_);
+        dir_ = paimon::test::UniqueTestDirectory::Create();
+        ASSERT_TRUE(dir_);
+        fs_ = dir_->GetFileSystem();
+        file_schema_ = arrow::schema({arrow::field("f0", arrow::int32()),
+                                      arrow::field("f1", arrow::utf8()),
+                                      arrow::field("f2", arrow::int64())});
+        // three row groups: f0 in [1, 2], f0 in [3, 4], f0 all null
+        auto array =
+            arrow::ipc::internal::json::ArrayFromJSON(arrow::struct_(file_schema_->fields()), R"([
+            [1, "a", 10], [2, "b", 20], [3, "c", 30], [4, "d", 40], [null, "e", 50], [null, "f", 60]
+        ])")
+                .ValueOrDie();
+        std::string file_path = dir_->Str() + "/test.parquet";
+        ASSERT_OK_AND_ASSIGN(std::shared_ptr<OutputStream> out,
+                             fs_->Create(file_path, /*overwrite=*/false));
+        ::parquet::WriterProperties::Builder builder;
+        builder.max_row_group_length(2);
+        ASSERT_OK_AND_ASSIGN(
+            auto format_writer,
+            ParquetFormatWriter::Create(out, file_schema_, builder.build(), arrow_pool_));
+        auto arrow_array = std::make_unique<ArrowArray>();
+        ASSERT_TRUE(arrow::ExportArray(*array, arrow_array.get()).ok());
+        ASSERT_OK(format_writer->AddBatch(arrow_array.get()));
+        ASSERT_OK(format_writer->Finish());
+        ASSERT_OK(out->Close());
+
+        ASSERT_OK_AND_ASSIGN(std::shared_ptr<InputStream> in, fs_->Open(file_path));
+        ASSERT_OK_AND_ASSIGN(uint64_t length, in->Length());
+        auto in_stream = std::make_shared<ParquetInputStreamImpl>(in, arrow_pool_, length);
+        file_metadata_ = ::parquet::ParquetFileReader::Open(in_stream)->metadata();
+        ASSERT_EQ(3, file_metadata_->num_row_groups());
+    }
+
+    void CheckResult(const std::shared_ptr<Predicate>& predicate,
+                     const std::vector<int32_t>& expected_row_groups,
+                     const std::vector<int32_t>& src_row_groups = {0, 1, 2}) const {
+        ASSERT_OK_AND_ASSIGN(std::vector<int32_t> row_groups,
+                             ParquetRowGroupFilter::Filter(predicate, file_schema_,
+                                                           *file_metadata_, src_row_groups, pool_));
+        ASSERT_EQ(expected_row_groups, row_groups);
+    }
+
+ protected:
+    std::shared_ptr<MemoryPool> pool_;
+    std::shared_ptr<arrow::MemoryPool> arrow_pool_;
+    std::unique_ptr<paimon::test::UniqueTestDirectory> dir_;
+    std::shared_ptr<FileSystem> fs_;
+    std::shared_ptr<arrow::Schema> file_schema_;
+    std::shared_ptr<::parquet::FileMetaData> file_metadata_;
+};
+
+TEST_F(ParquetRowGroupFilterTest, TestLeafPredicate) {
+    CheckResult(PredicateBuilder::GreaterThan(/*field_index=*/0, /*field_name=*/"f0",
+                                              FieldType::INT, Literal(2)),
+                {1});
+    CheckResult(PredicateBuilder::IsNull(/*field_index=*/0, /*field_name=*/"f0", FieldType::INT),
+                {2});
+    CheckResult(PredicateBuilder::IsNotNull(/*field_index=*/0, /*field_name=*/"f0",
+                                            FieldType::INT),
+                {0, 1});
+    CheckResult(PredicateBuilder::In(/*field_index=*/1, /*field_name=*/"f1", FieldType::STRING,
+                                     {Literal(FieldType::STRING, "b", 1),
+                                      Literal(FieldType::STRING, "f", 1)}),
+                {0, 2});
+    CheckResult(PredicateBuilder::LessThan(/*field_index=*/2, /*field_name=*/"f2",
+                                           FieldType::BIGINT, Literal(30l)),
+                {0}, /*src_row_groups=*/{0, 2});
+}
+
+TEST_F(ParquetRowGroupFilterTest, TestCompoundPredicate) {
+    ASSERT_OK_AND_ASSIGN(
+        auto or_predicate,
+        PredicateBuilder::Or({PredicateBuilder::Equal(/*field_index=*/0, /*field_name=*/"f0",
+                                                      FieldType::INT, Literal(1)),
+                              PredicateBuilder::Equal(/*field_index=*/1, /*field_name=*/"f1",
+                                                      FieldType::STRING,
+                                                      Literal(FieldType::STRING, "f", 1))}));
+    CheckResult(or_predicate, {0, 2});
+    ASSERT_OK_AND_ASSIGN(
+        auto and_predicate,
+        PredicateBuilder::And({or_predicate, PredicateBuilder::GreaterOrEqual(
+                                                 /*field_index=*/2, /*field_name=*/"f2",
+                                                 FieldType::BIGINT, Literal(50l))}));
+    CheckResult(and_predicate, {2});
+}
+
+TEST_F(ParquetRowGroupFilterTest, TestUntestablePredicate) {
+    // field not in file, the conjunct is ignored
+    ASSERT_OK_AND_ASSIGN(
+        auto and_predicate,
+        PredicateBuilder::And({PredicateBuilder::Equal(/*field_index=*/0, /*field_name=*/"f0",
+                                                       FieldType::INT, Literal(3)),
+                               PredicateBuilder::Equal(/*field_index=*/3, /*field_name=*/"f3",
+                                                       FieldType::INT, Literal(100))}));
+    CheckResult(and_predicate, {1});
+    // field not in file, the whole disjunction is ignored
+    ASSERT_OK_AND_ASSIGN(
+        auto or_predicate,
+        PredicateBuilder::Or({PredicateBuilder::Equal(/*field_index=*/0, /*field_name=*/"f0",
+                                                      FieldType::INT, Literal(3)),
+                              PredicateBuilder::Equal(/*field_index=*/3, /*field_name=*/"f3",
+                                                      FieldType::INT, Literal(100))}));
+    CheckResult(or_predicate, {0, 1, 2});
+    // type mismatch with file column
+    CheckResult(PredicateBuilder::Equal(/*field_index=*/2, /*field_name=*/"f2", FieldType::INT,
+                                        Literal(100)),
+                {0, 1, 2});
+}
+
+TEST_F(ParquetRowGroupFilterTest, TestInvalid) {
+    auto predicate = PredicateBuilder::IsNull(/*field_index=*/0, /*field_name=*/"f0",
+                                              FieldType::INT);
+    ASSERT_NOK_WITH_MSG(ParquetRowGroupFilter::Filter(predicate, file_schema_, *file_metadata_,
+                                                      /*src_row_groups=*/{3}, pool_),
+                        "src row group 3 not in row group meta");
+    ASSERT_NOK_WITH_MSG(ParquetRowGroupFilter::Filter(nullptr, file_schema_, *file_metadata_,
+                                                      /*src_row_groups=*/{0}, pool_),
+                        "cannot filter row groups with an empty predicate");
+}
+
+}  // namespace paimon::parquet::test
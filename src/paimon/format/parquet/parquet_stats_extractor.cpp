@@ -284,17 +284,24 @@ ParquetStatsExtractor::ExtractWithFileInfo(const std::shared_ptr<FileSystem>& fi
 
     std::shared_ptr<::parquet::FileMetaData> file_metadata =
         file_reader_builder.raw_reader()->metadata();
-    int32_t field_count = file_metadata->schema()->group_node()->field_count();
+    PAIMON_ASSIGN_OR_RAISE(ColumnStatsVector result_stats,
+                           ExtractFromMetadata(*file_metadata, pool));
+    return std::make_pair(std::move(result_stats), FileInfo(file_metadata->num_rows()));
+}
+
+Result<ColumnStatsVector> ParquetStatsExtractor::ExtractFromMetadata(
+    const ::parquet::FileMetaData& file_metadata, const std::shared_ptr<MemoryPool>& pool) const {
+    int32_t field_count = file_metadata.schema()->group_node()->field_count();
 
     ColumnStatsVector result_stats;
     result_stats.reserve(field_count);
 
     std::unordered_map<std::string, std::shared_ptr<::parquet::Statistics>> merged_stats;
 
-    for (int32_t row_group_idx = 0; row_group_idx < file_metadata->num_row_groups();
+    for (int32_t row_group_idx = 0; row_group_idx < file_metadata.num_row_groups();
          ++row_group_idx) {
-        for (int32_t col_idx = 0; col_idx < file_metadata->num_columns(); ++col_idx) {
-            auto column_chunk = file_metadata->RowGroup(row_group_idx)->ColumnChunk(col_idx);
+        for (int32_t col_idx = 0; col_idx < file_metadata.num_columns(); ++col_idx) {
+            auto column_chunk = file_metadata.RowGroup(row_group_idx)->ColumnChunk(col_idx);
             if (!column_chunk->is_stats_set()) {
                 continue;
             }
@@ -305,7 +312,7 @@ ParquetStatsExtractor::ExtractWithFileInfo(const std::shared_ptr<FileSystem>& fi
     }
 
     for (int32_t field_idx = 0; field_idx < field_count; ++field_idx) {
-        auto node = file_metadata->schema()->group_node()->field(field_idx);
+        auto node = file_metadata.schema()->group_node()->field(field_idx);
         if (node->is_group()) {
             // nested type do not have parquet stats
             const auto& logical_type = node->logical_type();
@@ -332,7 +339,14 @@ ParquetStatsExtractor::ExtractWithFileInfo(const std::shared_ptr<FileSystem>& fi
             result_stats.push_back(col_stats);
         }
     }
-    return std::make_pair(std::move(result_stats), FileInfo(file_metadata->num_rows()));
+    return result_stats;
+}
+
+Result<std::unique_ptr<ColumnStats>> ParquetStatsExtractor::ConvertColumnStats(
+    const std::shared_ptr<::parquet::Statistics>& stats,
+    const std::shared_ptr<::parquet::schema::PrimitiveNode>& primitive_node,
+    const std::shared_ptr<arrow::DataType>& write_type, const std::shared_ptr<MemoryPool>& pool) {
+    return ConvertStatsToColumnStats(stats, primitive_node, write_type, pool);
 }
 
 }  // namespace paimon::parquet
@@ -33,6 +33,7 @@
 #include "parquet/types.h"
 
 namespace arrow {
+class DataType;
 class Schema;
 }  // namespace arrow
 
@@ -65,6 +66,21 @@ class ParquetStatsExtractor : public FormatStatsExtractor {
         const std::shared_ptr<FileSystem>& file_system, const std::string& path,
         const std::shared_ptr<MemoryPool>& pool) override;
 
+    /// Extracts statistics for each column from parquet file metadata, which is either read from
+    /// the footer of a file or kept in memory by the parquet writer.
+    Result<ColumnStatsVector> ExtractFromMetadata(const ::parquet::FileMetaData& file_metadata,
+                                                  const std::shared_ptr<MemoryPool>& pool) const;
+
+    /// Converts statistics of a primitive column chunk to column stats, `stats` may be nullptr
+    /// if the column chunk has no statistics.
+    ///
+    /// @param write_type Arrow type the column is written with.
+    static Result<std::unique_ptr<ColumnStats>> ConvertColumnStats(
+        const std::shared_ptr<::parquet::Statistics>& stats,
+        const std::shared_ptr<::parquet::schema::PrimitiveNode>& primitive_node,
+        const std::shared_ptr<arrow::DataType>& write_type,
+        const std::shared_ptr<MemoryPool>& pool);
+
  private:
     void PrintConvertedType(const ::parquet::schema::Node* node);
 
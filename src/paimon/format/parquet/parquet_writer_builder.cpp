@@ -40,9 +40,11 @@ namespace paimon::parquet {
 
 Result<std::unique_ptr<FormatWriter>> ParquetWriterBuilder::Build(
     const std::shared_ptr<OutputStream>& out, const std::string& compression) {
-    PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<::parquet::WriterProperties> writer_properties,
-                           PrepareWriterProperties(compression));
-    return ParquetFormatWriter::Create(out, schema_, writer_properties, pool_);
+    if (writer_properties_ == nullptr || writer_properties_compression_ != compression) {
+        PAIMON_ASSIGN_OR_RAISE(writer_properties_, PrepareWriterProperties(compression));
+        writer_properties_compression_ = compression;
+    }
+    return ParquetFormatWriter::Create(out, schema_, writer_properties_, pool_);
 }
 
 Result<std::shared_ptr<::parquet::WriterProperties>> ParquetWriterBuilder::PrepareWriterProperties(
@@ -59,6 +59,7 @@ class ParquetWriterBuilder : public WriterBuilder {
 
     WriterBuilder* WithMemoryPool(const std::shared_ptr<MemoryPool>& pool) override {
         pool_ = GetArrowPool(pool);
+        writer_properties_.reset();
         return this;
     }
 
@@ -78,6 +79,9 @@ class ParquetWriterBuilder : public WriterBuilder {
     std::shared_ptr<arrow::MemoryPool> pool_;
     std::shared_ptr<arrow::Schema> schema_;
     std::map<std::string, std::string> options_;
+    // writer properties of the last built file, reused while compression does not change
+    std::shared_ptr<::parquet::WriterProperties> writer_properties_;
+    std::string writer_properties_compression_;
 };
 
 }  // namespace paimon::parquet
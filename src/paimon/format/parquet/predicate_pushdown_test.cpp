@@ -35,7 +35,6 @@
 #include "paimon/data/timestamp.h"
 #include "paimon/defs.h"
 #include "paimon/format/parquet/parquet_file_batch_reader.h"
-#include "paimon/format/parquet/parquet_format_defs.h"
 #include "paimon/format/parquet/parquet_format_writer.h"
 #include "paimon/format/parquet/parquet_input_stream_impl.h"
 #include "paimon/fs/file_system.h"
@@ -101,16 +100,12 @@ class PredicatePushdownTest : public ::testing::Test {
 
     void CheckResult(const std::shared_ptr<arrow::Schema>& read_schema,
                      const std::shared_ptr<Predicate>& predicate,
-                     const std::shared_ptr<arrow::Array>& expected_array,
-                     uint32_t predicate_node_count_limit =
-                         paimon::parquet::DEFAULT_PARQUET_READ_PREDICATE_NODE_COUNT_LIMIT) {
+                     const std::shared_ptr<arrow::Array>& expected_array) {
         ASSERT_OK_AND_ASSIGN(std::shared_ptr<InputStream> in, fs_->Open(file_name_));
         ASSERT_OK_AND_ASSIGN(uint64_t length, in->Length());
         auto in_stream = std::make_shared<ParquetInputStreamImpl>(in, arrow_pool_, length);
 
         std::map<std::string, std::string> options;
-        options[paimon::parquet::PARQUET_READ_PREDICATE_NODE_COUNT_LIMIT] =
-            std::to_string(predicate_node_count_limit);
         ASSERT_OK_AND_ASSIGN(auto batch_reader,
                              ParquetFileBatchReader::Create(std::move(in_stream), arrow_pool_,
                                                             options, batch_size_));
@@ -203,12 +198,14 @@ TEST_F(PredicatePushdownTest, TestIntDoubleData) {
         CheckResult(read_schema, predicate, /*expected_array=*/nullptr);
     }
     {
-        // f2 in [1,2,3] but has small predicate node limit, has data
-        auto predicate =
-            PredicateBuilder::In(/*field_index=*/2, /*field_name=*/"f2", FieldType::BIGINT,
-                                 {Literal(1l), Literal(2l), Literal(3l)});
-        CheckResult(read_schema, predicate, expected_array,
-                    /*predicate_node_count_limit=*/1);
+        // f2 in [100, 2100), large predicate is also pushed down, no data
+        std::vector<Literal> literals;
+        for (int64_t i = 100; i < 2100; ++i) {
+            literals.emplace_back(i);
+        }
+        auto predicate = PredicateBuilder::In(/*field_index=*/2, /*field_name=*/"f2",
+                                              FieldType::BIGINT, literals);
+        CheckResult(read_schema, predicate, /*expected_array=*/nullptr);
     }
     {
         // f2 not in [1,2,3], has data
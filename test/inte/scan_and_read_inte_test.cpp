@@ -25,6 +25,8 @@
 #include <vector>
 
 #include "arrow/api.h"
+#include "arrow/c/abi.h"
+#include "arrow/c/bridge.h"
 #include "arrow/ipc/json_simple.h"
 #include "gtest/gtest.h"
 #include "paimon/common/factories/io_hook.h"
@@ -321,6 +323,54 @@ TEST_P(ScanAndReadInteTest, TestWithAppendSnapshot1) {
     ASSERT_TRUE(expected->Equals(read_result)) << read_result->ToString();
 }
 
+TEST_P(ScanAndReadInteTest, TestWithAppendSnapshot1ByArrowArrayStream) {
+    auto [file_format, enable_prefetch] = GetParam();
+    std::string table_path = GetDataDir() + "/" + file_format + "/append_09.db/append_09";
+
+    // scan
+    ScanContextBuilder scan_context_builder(table_path);
+    scan_context_builder.AddOption(Options::SCAN_SNAPSHOT_ID, "1");
+    ASSERT_OK_AND_ASSIGN(auto scan_context, scan_context_builder.Finish());
+    ASSERT_OK_AND_ASSIGN(auto table_scan, TableScan::Create(std::move(scan_context)));
+    ASSERT_OK_AND_ASSIGN(auto result_plan, table_scan->CreatePlan());
+    auto splits = result_plan->Splits();
+    ASSERT_EQ(3, splits.size());
+
+    // read through an arrow c stream, with at most one batch read ahead
+    ReadContextBuilder read_context_builder(table_path);
+    AddReadOptionsForPrefetch(&read_context_builder);
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<ReadContext> read_context, read_context_builder.Finish());
+    ASSERT_OK_AND_ASSIGN(auto table_read, TableRead::Create(std::move(read_context)));
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<ArrowArrayStream> stream,
+                         table_read->CreateArrowArrayStream(splits, /*max_read_ahead_batches=*/1,
+                                                            /*max_read_ahead_bytes=*/1));
+    auto record_batch_reader = arrow::ImportRecordBatchReader(stream.get()).ValueOrDie();
+    auto table = record_batch_reader->ToTable().ValueOrDie();
+    auto read_result = table->CombineChunksToBatch().ValueOrDie()->ToStructArray().ValueOrDie();
+
+    // check result
+    auto expected = arrow::ipc::internal::json::ArrayFromJSON(arrow_data_type_, R"([
+[0, "Alice", 10, 1, 11.1],
+[0, "Bob", 10, 0, 12.1],
+[0, "Emily", 10, 0, 13.1],
+[0, "Tony", 10, 0, 14.1],
+[0, "Lucy", 20, 1, 14.1]
+   ])")
+                        .ValueOrDie();
+    ASSERT_TRUE(expected->Equals(read_result)) << read_result->ToString();
+
+    // a stream without any split still reports the read schema
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<ArrowArrayStream> empty_stream,
+                         table_read->CreateArrowArrayStream(
+                             std::vector<std::shared_ptr<Split>>()));
+    auto empty_reader = arrow::ImportRecordBatchReader(empty_stream.get()).ValueOrDie();
+    ASSERT_TRUE(empty_reader->schema()->Equals(arrow::schema(arrow_data_type_->fields())))
+        << empty_reader->schema()->ToString();
+    std::shared_ptr<arrow::RecordBatch> batch;
+    ASSERT_TRUE(empty_reader->ReadNext(&batch).ok());
+    ASSERT_FALSE(batch);
+}
+
 TEST_P(ScanAndReadInteTest, TestWithAppendSnapshot3) {
     auto [file_format, enable_prefetch] = GetParam();
     std::string table_path = GetDataDir() + "/" + file_format + "/append_09.db/append_09";
@@ -1070,6 +1120,73 @@ TEST_P(ScanAndReadInteTest, TestWithPKWithMorBatchScanLatestSnapshot) {
     ASSERT_TRUE(expected->Equals(read_result)) << read_result->ToString();
 }
 
+TEST_P(ScanAndReadInteTest, TestWithPKKeyOrderedRead) {
+    auto [file_format, enable_prefetch] = GetParam();
+    for (const auto& [table_name, snapshot_id] :
+         std::vector<std::pair<std::string, int64_t>>({{"pk_table_scan_and_read_mor", 5},
+                                                       {"pk_table_scan_and_read_dv", 6}})) {
+        std::string table_path = paimon::test::GetDataDir() + file_format + "/" + table_name +
+                                 ".db/" + table_name + "/";
+        ScanContextBuilder scan_context_builder(table_path);
+        scan_context_builder.AddOption(Options::SCAN_SNAPSHOT_ID, std::to_string(snapshot_id));
+        ASSERT_OK_AND_ASSIGN(auto scan_context, scan_context_builder.Finish());
+        ASSERT_OK_AND_ASSIGN(auto table_scan, TableScan::Create(std::move(scan_context)));
+        ASSERT_OK_AND_ASSIGN(auto result_plan, table_scan->CreatePlan());
+        ASSERT_EQ(result_plan->SnapshotId().value(), snapshot_id);
+
+        // rows of all partitions and buckets are ordered by the trimmed primary key (f0, f2)
+        ReadContextBuilder read_context_builder(table_path);
+        AddReadOptionsForPrefetch(&read_context_builder);
+        read_context_builder.AddOption(Options::READ_BATCH_SIZE, "2");
+        ASSERT_OK_AND_ASSIGN(auto read_context, read_context_builder.Finish());
+        ASSERT_OK_AND_ASSIGN(auto table_read, TableRead::Create(std::move(read_context)));
+        ASSERT_OK_AND_ASSIGN(auto batch_reader,
+                             table_read->CreateKeyOrderedReader(result_plan->Splits()));
+        ASSERT_OK_AND_ASSIGN(auto read_result,
+                             ReadResultCollector::CollectResult(batch_reader.get()));
+
+        std::string expected_str;
+        if (snapshot_id == 5) {
+            expected_str = R"([
+[0, "Alice", 10, 1, 19.1],
+[0, "Bob", 10, 0, 12.1],
+[0, "David", 10, 0, 17.1],
+[0, "Emily", 10, 0, 13.1],
+[0, "Lucy", 20, 1, 14.1],
+[0, "Marco", 10, 0, 21.1],
+[0, "Marco2", 10, 0, 31.1],
+[0, "Paul", 20, 1, 18.1],
+[0, "Skye", 10, 0, 21.0],
+[0, "Skye2", 10, 0, 31.0],
+[0, "Two roads diverged in a wood, and I took the one less traveled by, And that has made all the difference.", 10, 1, 11.0]
+   ])";
+        } else {
+            expected_str = R"([
+[0, "Alex", 10, 0, 16.1],
+[0, "Alice", 10, 1, 19.1],
+[0, "Bob", 10, 0, 12.1],
+[0, "David", 10, 0, 17.1],
+[0, "Emily", 10, 0, 13.1],
+[0, "Lucy", 20, 1, 14.1],
+[0, "Paul", 20, 1, 18.1],
+[0, "Two roads diverged in a wood, and I took the one less traveled by, And that has made all the difference.", 10, 1, 11.0]
+   ])";
+        }
+        auto expected = arrow::ipc::internal::json::ArrayFromJSON(arrow_data_type_, expected_str)
+                            .ValueOrDie();
+        auto combined = arrow::Concatenate(read_result->chunks()).ValueOrDie();
+        ASSERT_TRUE(expected->Equals(combined)) << combined->ToString();
+
+        // key fields must be read to order the rows
+        ReadContextBuilder no_key_context_builder(table_path);
+        no_key_context_builder.SetReadSchema({"f0", "f3"});
+        ASSERT_OK_AND_ASSIGN(auto no_key_context, no_key_context_builder.Finish());
+        ASSERT_OK_AND_ASSIGN(auto no_key_read, TableRead::Create(std::move(no_key_context)));
+        ASSERT_NOK_WITH_MSG(no_key_read->CreateKeyOrderedReader(result_plan->Splits()),
+                            "requires primary key field f2 in read schema");
+    }
+}
+
 TEST_P(ScanAndReadInteTest, TestWithPKWithMorBatchScanSnapshot2) {
     auto [file_format, enable_prefetch] = GetParam();
     std::string table_path = paimon::test::GetDataDir() + file_format +
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <map>
@@ -44,6 +45,7 @@
 #include "paimon/result.h"
 #include "paimon/scan_context.h"
 #include "paimon/status.h"
+#include "paimon/table/source/bucketed_plan.h"
 #include "paimon/table/source/plan.h"
 #include "paimon/table/source/startup_mode.h"
 #include "paimon/table/source/table_scan.h"
@@ -2062,4 +2064,81 @@ TEST_F(ScanInteTest, TestScanAppendWithBitmapAndAlterTableWithEmptyResult) {
     ASSERT_TRUE(result_plan->Splits().empty());
 }
 
+TEST_F(ScanInteTest, TestBucketedPlan) {
+    auto create_scan = [](const std::string& table_path,
+                          const std::map<std::string, std::string>& options)
+        -> Result<std::unique_ptr<TableScan>> {
+        ScanContextBuilder context_builder(table_path);
+        for (const auto& [key, value] : options) {
+            context_builder.AddOption(key, value);
+        }
+        PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<ScanContext> scan_context,
+                               context_builder.Finish());
+        return TableScan::Create(std::move(scan_context));
+    };
+
+    std::string append_path = paimon::test::GetDataDir() + "orc/append_09.db/append_09";
+    ASSERT_OK_AND_ASSIGN(auto append_scan,
+                         create_scan(append_path, {{Options::SCAN_SNAPSHOT_ID, "1"}}));
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<BucketedPlan> append_plan,
+                         append_scan->CreateBucketedPlan());
+    ASSERT_EQ(1, append_plan->SnapshotId().value());
+    ASSERT_EQ(2, append_plan->NumBuckets());
+    ASSERT_EQ(1, append_plan->BucketKeys().size());
+    ASSERT_EQ("f2", append_plan->BucketKeys()[0]->name());
+    ASSERT_TRUE(append_plan->BucketKeys()[0]->type()->Equals(arrow::int32()));
+    const auto& buckets = append_plan->Buckets();
+    ASSERT_EQ(3, buckets.size());
+    std::vector<std::pair<std::string, int32_t>> partition_buckets;
+    for (const auto& bucket_splits : buckets) {
+        partition_buckets.emplace_back(bucket_splits.partition.at("f1"), bucket_splits.bucket);
+        ASSERT_EQ(1, bucket_splits.splits.size());
+        auto data_split = std::dynamic_pointer_cast<DataSplitImpl>(bucket_splits.splits[0]);
+        ASSERT_TRUE(data_split);
+        ASSERT_EQ(bucket_splits.bucket, data_split->Bucket());
+    }
+    std::sort(partition_buckets.begin(), partition_buckets.end());
+    std::vector<std::pair<std::string, int32_t>> expected_partition_buckets = {
+        {"10", 0}, {"10", 1}, {"20", 0}};
+    ASSERT_EQ(expected_partition_buckets, partition_buckets);
+
+    // pk_09 has the same number of buckets and the same type of bucket key f2
+    std::string pk_path = paimon::test::GetDataDir() + "orc/pk_09.db/pk_09";
+    ASSERT_OK_AND_ASSIGN(auto pk_scan, create_scan(pk_path, {}));
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<BucketedPlan> pk_plan, pk_scan->CreateBucketedPlan());
+    ASSERT_OK_AND_ASSIGN(std::vector<BucketedPlan::BucketPair> pairs,
+                         BucketedPlan::PairBuckets(*append_plan, *pk_plan));
+    ASSERT_FALSE(pairs.empty());
+    size_t left_split_count = 0;
+    size_t right_split_count = 0;
+    for (const auto& pair : pairs) {
+        for (const auto& split : pair.left) {
+            ASSERT_EQ(pair.bucket, std::dynamic_pointer_cast<DataSplitImpl>(split)->Bucket());
+        }
+        for (const auto& split : pair.right) {
+            ASSERT_EQ(pair.bucket, std::dynamic_pointer_cast<DataSplitImpl>(split)->Bucket());
+        }
+        left_split_count += pair.left.size();
+        right_split_count += pair.right.size();
+    }
+    ASSERT_EQ(3, left_split_count);
+    size_t pk_split_count = 0;
+    for (const auto& bucket_splits : pk_plan->Buckets()) {
+        pk_split_count += bucket_splits.splits.size();
+    }
+    ASSERT_EQ(pk_split_count, right_split_count);
+
+    // a different number of buckets is not co-partitioned
+    ASSERT_OK_AND_ASSIGN(auto rescaled_scan,
+                         create_scan(append_path, {{Options::SCAN_SNAPSHOT_ID, "1"},
+                                                   {Options::BUCKET, "4"}}));
+    ASSERT_NOK(rescaled_scan->CreateBucketedPlan());
+
+    // bucket unaware table has no bucketed plan
+    std::string unaware_path =
+        paimon::test::GetDataDir() + "orc/append_with_bitmap.db/append_with_bitmap/";
+    ASSERT_OK_AND_ASSIGN(auto unaware_scan, create_scan(unaware_path, {}));
+    ASSERT_NOK_WITH_MSG(unaware_scan->CreateBucketedPlan(), "fixed number of buckets");
+}
+
 }  // namespace paimon::test
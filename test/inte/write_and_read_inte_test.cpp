@@ -25,14 +25,28 @@
 
 #include "arrow/type.h"
 #include "gtest/gtest.h"
+#include "paimon/catalog/catalog.h"
+#include "paimon/catalog/identifier.h"
+#include "paimon/commit_message.h"
+#include "paimon/common/data/binary_row.h"
 #include "paimon/common/utils/date_time_utils.h"
 #include "paimon/common/utils/path_util.h"
 #include "paimon/common/utils/string_utils.h"
+#include "paimon/core/io/compact_increment.h"
+#include "paimon/core/io/data_file_meta.h"
+#include "paimon/core/io/data_increment.h"
+#include "paimon/core/table/sink/commit_message_impl.h"
 #include "paimon/defs.h"
 #include "paimon/fs/file_system.h"
+#include "paimon/memory/memory_pool.h"
+#include "paimon/predicate/literal.h"
+#include "paimon/predicate/predicate_builder.h"
 #include "paimon/result.h"
+#include "paimon/scan_context.h"
+#include "paimon/stats/table_statistics.h"
 #include "paimon/status.h"
 #include "paimon/table/source/startup_mode.h"
+#include "paimon/table_delete.h"
 #include "paimon/testing/utils/test_helper.h"
 #include "paimon/testing/utils/testharness.h"
 
@@ -533,6 +547,441 @@ TEST_P(WriteAndReadInteTest, TestPkTimestampType) {
     ASSERT_TRUE(success);
 }
 
+TEST_P(WriteAndReadInteTest, TestAppendColumnSketches) {
+    arrow::FieldVector fields = {arrow::field("f0", arrow::utf8()),
+                                 arrow::field("f1", arrow::int32())};
+    auto schema = arrow::schema(fields);
+    auto [file_format, file_system] = GetParam();
+    std::map<std::string, std::string> options = {
+        {Options::MANIFEST_FORMAT, "orc"},       {Options::FILE_FORMAT, file_format},
+        {Options::BUCKET, "-1"},                 {Options::FILE_SYSTEM, file_system},
+        {Options::COLUMN_SKETCHES_ENABLED, "true"}};
+    if (file_system == "jindo") {
+        options = AddOptionsForJindo(options);
+    }
+    ASSERT_OK_AND_ASSIGN(
+        auto helper, TestHelper::Create(test_dir_, schema, /*partition_keys=*/{},
+                                        /*primary_keys=*/{}, options, /*is_streaming_mode=*/false));
+    ASSERT_OK_AND_ASSIGN(auto catalog, Catalog::Create(test_dir_, options));
+    int64_t commit_identifier = 0;
+    std::string data1 = R"([
+            ["banana", 1],
+            ["dog", 2],
+            ["banana", 3],
+            [null, 4]
+    ])";
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<RecordBatch> batch1,
+                         TestHelper::MakeRecordBatch(arrow::struct_(fields), data1,
+                                                     /*partition_map=*/{}, /*bucket=*/0, {}));
+    ASSERT_OK_AND_ASSIGN(auto commit_msgs1,
+                         helper->WriteAndCommit(std::move(batch1), commit_identifier++,
+                                                /*expected_commit_messages=*/std::nullopt));
+    ASSERT_OK_AND_ASSIGN(std::optional<std::shared_ptr<TableStatistics>> statistics1,
+                         catalog->LoadTableStatistics(Identifier("foo", "bar")));
+    ASSERT_TRUE(statistics1);
+    ASSERT_EQ(1, statistics1.value()->SnapshotId());
+    ASSERT_EQ(2, statistics1.value()->Columns().size());
+    std::shared_ptr<ColumnStatistics> f0 = statistics1.value()->GetColumn("f0");
+    ASSERT_TRUE(f0);
+    ASSERT_EQ(4, f0->RowCount());
+    ASSERT_EQ(1, f0->NullCount());
+    ASSERT_EQ(2, f0->DistinctCount());
+    ASSERT_FALSE(f0->HasQuantiles());
+
+    std::string data2 = R"([
+            ["cat", 5],
+            ["dog", 6],
+            ["lucy", 7],
+            ["mouse", 8]
+    ])";
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<RecordBatch> batch2,
+                         TestHelper::MakeRecordBatch(arrow::struct_(fields), data2,
+                                                     /*partition_map=*/{}, /*bucket=*/0, {}));
+    // sketches of data files are kept through the serialization of commit messages
+    ASSERT_OK(helper->write_->Write(std::move(batch2)));
+    ASSERT_OK_AND_ASSIGN(std::vector<std::shared_ptr<CommitMessage>> commit_msgs2,
+                         helper->write_->PrepareCommit(/*wait_compaction=*/false,
+                                                       commit_identifier));
+    auto pool = GetDefaultPool();
+    ASSERT_OK_AND_ASSIGN(std::string serialized_msgs2,
+                         CommitMessage::SerializeList(commit_msgs2, pool));
+    ASSERT_OK_AND_ASSIGN(commit_msgs2, CommitMessage::DeserializeList(
+                                           CommitMessage::CurrentVersion(), serialized_msgs2.data(),
+                                           serialized_msgs2.size(), pool));
+    ASSERT_OK(helper->commit_->Commit(commit_msgs2, commit_identifier++));
+    ASSERT_OK_AND_ASSIGN(std::optional<std::shared_ptr<TableStatistics>> statistics2,
+                         catalog->LoadTableStatistics(Identifier("foo", "bar")));
+    ASSERT_TRUE(statistics2);
+    ASSERT_EQ(2, statistics2.value()->SnapshotId());
+    f0 = statistics2.value()->GetColumn("f0");
+    ASSERT_EQ(8, f0->RowCount());
+    ASSERT_EQ(1, f0->NullCount());
+    ASSERT_EQ(5, f0->DistinctCount());
+    std::shared_ptr<ColumnStatistics> f1 = statistics2.value()->GetColumn("f1");
+    ASSERT_TRUE(f1);
+    ASSERT_EQ(8, f1->DistinctCount());
+    ASSERT_TRUE(f1->HasQuantiles());
+    ASSERT_EQ(std::optional<double>(1), f1->Quantile(0.0));
+    ASSERT_EQ(std::optional<double>(8), f1->Quantile(1.0));
+    ASSERT_EQ(std::vector<double>({1, 4, 8}), f1->EquiDepthBoundaries(2));
+    ASSERT_FALSE(statistics2.value()->GetColumn("non-exist"));
+
+    // sketches of the overwritten files are dropped, the ones of the new files are kept
+    std::string data3 = R"([
+            ["cat", 9],
+            ["cat", 10]
+    ])";
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<RecordBatch> batch3,
+                         TestHelper::MakeRecordBatch(arrow::struct_(fields), data3,
+                                                     /*partition_map=*/{}, /*bucket=*/0, {}));
+    ASSERT_OK(helper->write_->Write(std::move(batch3)));
+    ASSERT_OK_AND_ASSIGN(std::vector<std::shared_ptr<CommitMessage>> commit_msgs3,
+                         helper->write_->PrepareCommit(/*wait_compaction=*/false,
+                                                       commit_identifier));
+    ASSERT_OK(helper->commit_->Overwrite(/*partitions=*/{}, commit_msgs3, commit_identifier++));
+    ASSERT_OK_AND_ASSIGN(std::optional<std::shared_ptr<TableStatistics>> statistics3,
+                         catalog->LoadTableStatistics(Identifier("foo", "bar")));
+    ASSERT_TRUE(statistics3);
+    ASSERT_EQ(3, statistics3.value()->SnapshotId());
+    f0 = statistics3.value()->GetColumn("f0");
+    ASSERT_EQ(2, f0->RowCount());
+    ASSERT_EQ(0, f0->NullCount());
+    ASSERT_EQ(1, f0->DistinctCount());
+
+    // sketches rebuilt from the live files keep growing with appended files
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<RecordBatch> batch4,
+                         TestHelper::MakeRecordBatch(arrow::struct_(fields), data1,
+                                                     /*partition_map=*/{}, /*bucket=*/0, {}));
+    ASSERT_OK_AND_ASSIGN(auto commit_msgs4,
+                         helper->WriteAndCommit(std::move(batch4), commit_identifier++,
+                                                /*expected_commit_messages=*/std::nullopt));
+    ASSERT_OK_AND_ASSIGN(std::optional<std::shared_ptr<TableStatistics>> statistics4,
+                         catalog->LoadTableStatistics(Identifier("foo", "bar")));
+    ASSERT_TRUE(statistics4);
+    ASSERT_EQ(4, statistics4.value()->SnapshotId());
+    f0 = statistics4.value()->GetColumn("f0");
+    ASSERT_EQ(6, f0->RowCount());
+    ASSERT_EQ(1, f0->NullCount());
+    ASSERT_EQ(3, f0->DistinctCount());
+}
+
+TEST_P(WriteAndReadInteTest, TestPkColumnSketches) {
+    arrow::FieldVector fields = {arrow::field("f0", arrow::utf8()),
+                                 arrow::field("f1", arrow::int32())};
+    auto schema = arrow::schema(fields);
+    auto [file_format, file_system] = GetParam();
+    std::map<std::string, std::string> options = {
+        {Options::MANIFEST_FORMAT, "orc"},       {Options::FILE_FORMAT, file_format},
+        {Options::BUCKET, "2"},                  {Options::FILE_SYSTEM, file_system},
+        {Options::COLUMN_SKETCHES_ENABLED, "true"}};
+    if (file_system == "jindo") {
+        options = AddOptionsForJindo(options);
+    }
+    ASSERT_OK_AND_ASSIGN(
+        auto helper, TestHelper::Create(test_dir_, schema, /*partition_keys=*/{},
+                                        /*primary_keys=*/{"f0"}, options,
+                                        /*is_streaming_mode=*/false));
+    ASSERT_OK_AND_ASSIGN(auto catalog, Catalog::Create(test_dir_, options));
+    int64_t commit_identifier = 0;
+    std::string data1 = R"([
+            ["banana", 1],
+            ["dog", 2]
+    ])";
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<RecordBatch> batch1,
+                         TestHelper::MakeRecordBatch(arrow::struct_(fields), data1,
+                                                     /*partition_map=*/{}, /*bucket=*/0, {}));
+    ASSERT_OK_AND_ASSIGN(auto commit_msgs1,
+                         helper->WriteAndCommit(std::move(batch1), commit_identifier++,
+                                                /*expected_commit_messages=*/std::nullopt));
+    std::string data2 = R"([
+            ["cat", 2],
+            ["lucy", 3]
+    ])";
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<RecordBatch> batch2,
+                         TestHelper::MakeRecordBatch(arrow::struct_(fields), data2,
+                                                     /*partition_map=*/{}, /*bucket=*/1, {}));
+    ASSERT_OK_AND_ASSIGN(auto commit_msgs2,
+                         helper->WriteAndCommit(std::move(batch2), commit_identifier++,
+                                                /*expected_commit_messages=*/std::nullopt));
+
+    // sketches of both buckets are merged, special fields are not sketched
+    ASSERT_OK_AND_ASSIGN(std::optional<std::shared_ptr<TableStatistics>> statistics,
+                         catalog->LoadTableStatistics(Identifier("foo", "bar")));
+    ASSERT_TRUE(statistics);
+    ASSERT_EQ(2, statistics.value()->SnapshotId());
+    ASSERT_EQ(2, statistics.value()->Columns().size());
+    std::shared_ptr<ColumnStatistics> f0 = statistics.value()->GetColumn("f0");
+    ASSERT_TRUE(f0);
+    ASSERT_EQ(4, f0->RowCount());
+    ASSERT_EQ(4, f0->DistinctCount());
+    std::shared_ptr<ColumnStatistics> f1 = statistics.value()->GetColumn("f1");
+    ASSERT_TRUE(f1);
+    ASSERT_EQ(3, f1->DistinctCount());
+    ASSERT_EQ(std::optional<double>(1), f1->Quantile(0.0));
+    ASSERT_EQ(std::optional<double>(3), f1->Quantile(1.0));
+}
+
+TEST_P(WriteAndReadInteTest, TestAppendDeleteWithDeletionVectors) {
+    arrow::FieldVector fields = {arrow::field("f0", arrow::utf8()),
+                                 arrow::field("f1", arrow::int32())};
+    auto schema = arrow::schema(fields);
+    auto [file_format, file_system] = GetParam();
+    std::map<std::string, std::string> options = {
+        {Options::MANIFEST_FORMAT, "orc"},          {Options::FILE_FORMAT, file_format},
+        {Options::BUCKET, "-1"},                    {Options::FILE_SYSTEM, file_system},
+        {Options::DELETION_VECTORS_ENABLED, "true"}};
+    if (file_system == "jindo") {
+        options = AddOptionsForJindo(options);
+    }
+    ASSERT_OK_AND_ASSIGN(
+        auto helper, TestHelper::Create(test_dir_, schema, /*partition_keys=*/{},
+                                        /*primary_keys=*/{}, options, /*is_streaming_mode=*/false));
+    int64_t commit_identifier = 0;
+    std::string data = R"([
+            ["banana", 2],
+            ["dog", 1],
+            ["lucy", 14],
+            ["dog", 3],
+            ["mouse", 100]
+    ])";
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<RecordBatch> batch,
+                         TestHelper::MakeRecordBatch(arrow::struct_(fields), data,
+                                                     /*partition_map=*/{}, /*bucket=*/0, {}));
+    ASSERT_OK_AND_ASSIGN(auto commit_msgs,
+                         helper->WriteAndCommit(std::move(batch), commit_identifier++,
+                                                /*expected_commit_messages=*/std::nullopt));
+    auto delete_rows = [&](const std::shared_ptr<Predicate>& predicate)
+        -> Result<std::vector<std::shared_ptr<CommitMessage>>> {
+        ScanContextBuilder scan_context_builder(test_dir_ + "/foo.db/bar");
+        scan_context_builder.SetOptions(options).SetPredicate(predicate);
+        PAIMON_ASSIGN_OR_RAISE(auto scan_context, scan_context_builder.Finish());
+        PAIMON_ASSIGN_OR_RAISE(auto table_delete, TableDelete::Create(std::move(scan_context)));
+        return table_delete->Delete();
+    };
+    arrow::FieldVector fields_with_row_kind = fields;
+    fields_with_row_kind.insert(fields_with_row_kind.begin(),
+                                arrow::field("_VALUE_KIND", arrow::int8()));
+    auto data_type = arrow::struct_(fields_with_row_kind);
+
+    // delete rows from a file without deletion vector
+    auto equal_dog =
+        PredicateBuilder::Equal(/*field_index=*/0, /*field_name=*/"f0", FieldType::STRING,
+                                Literal(FieldType::STRING, "dog", 3));
+    ASSERT_OK_AND_ASSIGN(auto delete_msgs, delete_rows(equal_dog));
+    ASSERT_EQ(1, delete_msgs.size());
+    ASSERT_OK(helper->commit_->Commit(delete_msgs, commit_identifier++));
+    ASSERT_OK_AND_ASSIGN(std::vector<std::shared_ptr<Split>> data_splits,
+                         helper->NewScan(StartupMode::LatestFull(), /*snapshot_id=*/std::nullopt));
+    ASSERT_OK_AND_ASSIGN(bool success, helper->ReadAndCheckResult(data_type, data_splits, R"([
+            [0, "banana", 2],
+            [0, "lucy", 14],
+            [0, "mouse", 100]
+    ])"));
+    ASSERT_TRUE(success);
+
+    // merge with the existing deletion vector
+    auto greater_than = PredicateBuilder::GreaterThan(/*field_index=*/1, /*field_name=*/"f1",
+                                                      FieldType::INT, Literal(10));
+    ASSERT_OK_AND_ASSIGN(delete_msgs, delete_rows(greater_than));
+    ASSERT_EQ(1, delete_msgs.size());
+    ASSERT_OK(helper->commit_->Commit(delete_msgs, commit_identifier++));
+    ASSERT_OK_AND_ASSIGN(data_splits,
+                         helper->NewScan(StartupMode::LatestFull(), /*snapshot_id=*/std::nullopt));
+    ASSERT_OK_AND_ASSIGN(success, helper->ReadAndCheckResult(data_type, data_splits, R"([
+            [0, "banana", 2]
+    ])"));
+    ASSERT_TRUE(success);
+
+    // rows have been deleted, nothing to commit
+    ASSERT_OK_AND_ASSIGN(delete_msgs, delete_rows(equal_dog));
+    ASSERT_TRUE(delete_msgs.empty());
+
+    // concurrent deletes replace the same deletion vectors, the later commit conflicts
+    auto equal_banana =
+        PredicateBuilder::Equal(/*field_index=*/0, /*field_name=*/"f0", FieldType::STRING,
+                                Literal(FieldType::STRING, "banana", 6));
+    ASSERT_OK_AND_ASSIGN(delete_msgs, delete_rows(equal_banana));
+    ASSERT_OK_AND_ASSIGN(auto concurrent_delete_msgs, delete_rows(equal_banana));
+    ASSERT_OK(helper->commit_->Commit(delete_msgs, commit_identifier++));
+    ASSERT_NOK_WITH_MSG(helper->commit_->Commit(concurrent_delete_msgs, commit_identifier++),
+                        "which is not previously added");
+
+    // predicate is required
+    ScanContextBuilder scan_context_builder(test_dir_ + "/foo.db/bar");
+    scan_context_builder.SetOptions(options);
+    ASSERT_OK_AND_ASSIGN(auto scan_context, scan_context_builder.Finish());
+    ASSERT_NOK_WITH_MSG(TableDelete::Create(std::move(scan_context)),
+                        "table delete requires a predicate");
+}
+
+TEST_P(WriteAndReadInteTest, TestAppendDeleteAfterDataFileRemoved) {
+    arrow::FieldVector fields = {arrow::field("f0", arrow::utf8()),
+                                 arrow::field("f1", arrow::int32())};
+    auto schema = arrow::schema(fields);
+    auto [file_format, file_system] = GetParam();
+    std::map<std::string, std::string> options = {
+        {Options::MANIFEST_FORMAT, "orc"},          {Options::FILE_FORMAT, file_format},
+        {Options::BUCKET, "-1"},                    {Options::FILE_SYSTEM, file_system},
+        {Options::DELETION_VECTORS_ENABLED, "true"}};
+    if (file_system == "jindo") {
+        options = AddOptionsForJindo(options);
+    }
+    ASSERT_OK_AND_ASSIGN(
+        auto helper, TestHelper::Create(test_dir_, schema, /*partition_keys=*/{},
+                                        /*primary_keys=*/{}, options, /*is_streaming_mode=*/false));
+    int64_t commit_identifier = 0;
+    auto write_and_commit = [&](const std::string& data) -> Result<std::shared_ptr<DataFileMeta>> {
+        PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<RecordBatch> batch,
+                               TestHelper::MakeRecordBatch(arrow::struct_(fields), data,
+                                                           /*partition_map=*/{}, /*bucket=*/0,
+                                                           {}));
+        PAIMON_ASSIGN_OR_RAISE(
+            auto commit_msgs, helper->WriteAndCommit(std::move(batch), commit_identifier++,
+                                                     /*expected_commit_messages=*/std::nullopt));
+        auto commit_msg = std::dynamic_pointer_cast<CommitMessageImpl>(commit_msgs[0]);
+        return commit_msg->GetNewFilesIncrement().NewFiles()[0];
+    };
+    auto delete_rows = [&](const std::string& value) -> Status {
+        ScanContextBuilder scan_context_builder(test_dir_ + "/foo.db/bar");
+        scan_context_builder.SetOptions(options).SetPredicate(
+            PredicateBuilder::Equal(/*field_index=*/0, /*field_name=*/"f0", FieldType::STRING,
+                                    Literal(FieldType::STRING, value.data(), value.size())));
+        PAIMON_ASSIGN_OR_RAISE(auto scan_context, scan_context_builder.Finish());
+        PAIMON_ASSIGN_OR_RAISE(auto table_delete, TableDelete::Create(std::move(scan_context)));
+        PAIMON_ASSIGN_OR_RAISE(auto delete_msgs, table_delete->Delete());
+        return helper->commit_->Commit(delete_msgs, commit_identifier++);
+    };
+
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<DataFileMeta> removed_file, write_and_commit(R"([
+            ["dog", 1],
+            ["cat", 2]
+    ])"));
+    ASSERT_OK(delete_rows("dog"));
+    ASSERT_OK(write_and_commit(R"([
+            ["mouse", 3],
+            ["lucy", 4]
+    ])"));
+    // remove the data file without touching the deletion vectors of the bucket, as a compaction
+    // which does not rewrite deletion vectors does
+    std::vector<std::shared_ptr<CommitMessage>> remove_msgs = {
+        std::make_shared<CommitMessageImpl>(
+            BinaryRow::EmptyRow(), /*bucket=*/0, /*total_buckets=*/std::nullopt,
+            DataIncrement(/*new_files=*/{}, /*deleted_files=*/{}, /*changelog_files=*/{}),
+            CompactIncrement(/*compact_before=*/{removed_file}, /*compact_after=*/{},
+                             /*changelog_files=*/{}))};
+    ASSERT_OK(helper->commit_->Commit(remove_msgs, commit_identifier++));
+
+    // the deletion vector of the removed file is not carried forward
+    ASSERT_OK(delete_rows("mouse"));
+    arrow::FieldVector fields_with_row_kind = fields;
+    fields_with_row_kind.insert(fields_with_row_kind.begin(),
+                                arrow::field("_VALUE_KIND", arrow::int8()));
+    ASSERT_OK_AND_ASSIGN(std::vector<std::shared_ptr<Split>> data_splits,
+                         helper->NewScan(StartupMode::LatestFull(), /*snapshot_id=*/std::nullopt));
+    ASSERT_OK_AND_ASSIGN(bool success,
+                         helper->ReadAndCheckResult(arrow::struct_(fields_with_row_kind),
+                                                    data_splits, R"([
+            [0, "lucy", 4]
+    ])"));
+    ASSERT_TRUE(success);
+}
+
+TEST_P(WriteAndReadInteTest, TestStreamingReadDeletionVectorChanges) {
+    arrow::FieldVector fields = {arrow::field("f0", arrow::utf8()),
+                                 arrow::field("f1", arrow::int32())};
+    auto schema = arrow::schema(fields);
+    auto [file_format, file_system] = GetParam();
+    std::map<std::string, std::string> options = {
+        {Options::MANIFEST_FORMAT, "orc"},          {Options::FILE_FORMAT, file_format},
+        {Options::BUCKET, "-1"},                    {Options::FILE_SYSTEM, file_system},
+        {Options::DELETION_VECTORS_ENABLED, "true"}};
+    if (file_system == "jindo") {
+        options = AddOptionsForJindo(options);
+    }
+    ASSERT_OK_AND_ASSIGN(
+        auto helper, TestHelper::Create(test_dir_, schema, /*partition_keys=*/{},
+                                        /*primary_keys=*/{}, options, /*is_streaming_mode=*/true));
+    int64_t commit_identifier = 0;
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<RecordBatch> batch,
+                         TestHelper::MakeRecordBatch(arrow::struct_(fields), R"([
+            ["banana", 2],
+            ["dog", 1],
+            ["lucy", 14],
+            ["dog", 3]
+    ])",
+                                                     /*partition_map=*/{}, /*bucket=*/0, {}));
+    ASSERT_OK(helper->WriteAndCommit(std::move(batch), commit_identifier++,
+                                     /*expected_commit_messages=*/std::nullopt));
+    arrow::FieldVector fields_with_row_kind = fields;
+    fields_with_row_kind.insert(fields_with_row_kind.begin(),
+                                arrow::field("_VALUE_KIND", arrow::int8()));
+    auto data_type = arrow::struct_(fields_with_row_kind);
+
+    ASSERT_OK_AND_ASSIGN(std::vector<std::shared_ptr<Split>> data_splits,
+                         helper->NewScan(StartupMode::LatestFull(), /*snapshot_id=*/std::nullopt));
+    ASSERT_OK_AND_ASSIGN(bool success, helper->ReadAndCheckResult(data_type, data_splits, R"([
+            [0, "banana", 2],
+            [0, "dog", 1],
+            [0, "lucy", 14],
+            [0, "dog", 3]
+    ])"));
+    ASSERT_TRUE(success);
+
+    auto delete_rows = [&](const std::shared_ptr<Predicate>& predicate) -> Status {
+        ScanContextBuilder scan_context_builder(test_dir_ + "/foo.db/bar");
+        scan_context_builder.SetOptions(options).SetPredicate(predicate);
+        PAIMON_ASSIGN_OR_RAISE(auto scan_context, scan_context_builder.Finish());
+        PAIMON_ASSIGN_OR_RAISE(auto table_delete, TableDelete::Create(std::move(scan_context)));
+        PAIMON_ASSIGN_OR_RAISE(auto delete_msgs, table_delete->Delete());
+        return helper->commit_->Commit(delete_msgs, commit_identifier++);
+    };
+    // newly deleted rows are read as deletes
+    ASSERT_OK(delete_rows(PredicateBuilder::Equal(/*field_index=*/0, /*field_name=*/"f0",
+                                                  FieldType::STRING,
+                                                  Literal(FieldType::STRING, "dog", 3))));
+    ASSERT_OK_AND_ASSIGN(data_splits, helper->Scan());
+    ASSERT_OK_AND_ASSIGN(success, helper->ReadAndCheckResult(data_type, data_splits, R"([
+            [3, "dog", 1],
+            [3, "dog", 3]
+    ])"));
+    ASSERT_TRUE(success);
+
+    // rows deleted by the previous deletion vector are not read again
+    ASSERT_OK(delete_rows(PredicateBuilder::GreaterThan(/*field_index=*/1, /*field_name=*/"f1",
+                                                        FieldType::INT, Literal(1))));
+    ASSERT_OK_AND_ASSIGN(data_splits, helper->Scan());
+    ASSERT_OK_AND_ASSIGN(success, helper->ReadAndCheckResult(data_type, data_splits, R"([
+            [3, "banana", 2],
+            [3, "lucy", 14]
+    ])"));
+    ASSERT_TRUE(success);
+
+    // rows appended later are read with their deletion files applied
+    ASSERT_OK_AND_ASSIGN(batch, TestHelper::MakeRecordBatch(arrow::struct_(fields), R"([
+            ["mouse", 100],
+            ["cat", 7]
+    ])",
+                                                            /*partition_map=*/{}, /*bucket=*/0,
+                                                            {}));
+    ASSERT_OK(helper->WriteAndCommit(std::move(batch), commit_identifier++,
+                                     /*expected_commit_messages=*/std::nullopt));
+    ASSERT_OK_AND_ASSIGN(data_splits, helper->Scan());
+    ASSERT_OK_AND_ASSIGN(success, helper->ReadAndCheckResult(data_type, data_splits, R"([
+            [0, "mouse", 100],
+            [0, "cat", 7]
+    ])"));
+    ASSERT_TRUE(success);
+
+    // a new streaming scan from the latest snapshot skips the deleted rows
+    ASSERT_OK_AND_ASSIGN(data_splits,
+                         helper->NewScan(StartupMode::LatestFull(), /*snapshot_id=*/std::nullopt));
+    ASSERT_OK_AND_ASSIGN(success, helper->ReadAndCheckResult(data_type, data_splits, R"([
+            [0, "mouse", 100],
+            [0, "cat", 7]
+    ])"));
+    ASSERT_TRUE(success);
+}
+
 std::vector<std::pair<std::string, std::string>> GetTestValuesForWriteAndReadInteTest() {
     std::vector<std::pair<std::string, std::string>> values = {{"parquet", "local"}};
 #ifdef PAIMON_ENABLE_ORC